@@ -0,0 +1,257 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file BenchmarkTopologies.cpp
+ *
+ */
+
+#include <memory>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+#include <ddspipe_participants/configuration/InitialPeersParticipantConfiguration.hpp>
+#include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
+#include <ddspipe_participants/types/address/Address.hpp>
+#include <ddspipe_participants/types/security/tls/TlsConfiguration.hpp>
+
+#include <ddsrouter_core/configuration/ShmParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/WanInitialPeersParticipantConfiguration.hpp>
+
+#include "BenchmarkTopologies.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace benchmark {
+
+namespace {
+
+//! Port where the WAN participants listen, away from the ones of the blackbox tests
+constexpr const uint16_t WAN_PORT = 11866;
+
+//! Names of the topologies, in the order of \c Topology
+const std::vector<std::string> TOPOLOGY_NAMES = {
+    "direct", "local", "local-shm", "wan-udp", "wan-udp-io-uring", "wan-udp-mmsg", "wan-tcp", "wan-tls", "repeater-udp", "repeater-tcp"};
+
+using ParticipantConfigurationPair = std::pair<
+    core::types::ParticipantKind,
+    std::shared_ptr<ddspipe::participants::ParticipantConfiguration>>;
+
+ParticipantConfigurationPair simple_participant(
+        uint32_t domain)
+{
+    auto conf = std::make_shared<ddspipe::participants::SimpleParticipantConfiguration>();
+    conf->id = ddspipe::core::types::ParticipantId("simple_participant_" + std::to_string(domain));
+    conf->domain.domain_id = domain;
+    return {core::types::ParticipantKind::simple, conf};
+}
+
+ParticipantConfigurationPair shm_participant(
+        uint32_t domain)
+{
+    auto conf = std::make_shared<core::ShmParticipantConfiguration>();
+    conf->id = ddspipe::core::types::ParticipantId("shm_participant_" + std::to_string(domain));
+    conf->domain.domain_id = domain;
+    return {core::types::ParticipantKind::shm, conf};
+}
+
+/**
+ * @brief Initial Peers Participant listening in (server) or connecting to (client) \c WAN_PORT in the loopback.
+ */
+ParticipantConfigurationPair initial_peers_participant(
+        const std::string& id,
+        bool server,
+        ddspipe::participants::types::TransportProtocol transport_protocol,
+        bool repeater,
+        bool tls,
+        const std::string& tls_directory,
+        core::UdpIoBackend io_backend = core::UdpIoBackend::fastdds)
+{
+    auto conf = std::make_shared<core::WanInitialPeersParticipantConfiguration>();
+    conf->id = ddspipe::core::types::ParticipantId(id);
+
+    const ddspipe::participants::types::Address address(
+        "127.0.0.1",
+        WAN_PORT,
+        WAN_PORT,
+        ddspipe::participants::types::IpVersion::v4,
+        transport_protocol);
+
+    if (server)
+    {
+        conf->listening_addresses.insert(address);
+    }
+    else
+    {
+        conf->connection_addresses.insert(address);
+    }
+
+    conf->is_repeater = repeater;
+    conf->io.backend = io_backend;
+
+    if (tls)
+    {
+        ddspipe::participants::types::TlsConfiguration tls_configuration;
+        tls_configuration.certificate_authority_file = tls_directory + "/ca.crt";
+        if (server)
+        {
+            tls_configuration.private_key_file = tls_directory + "/ddsrouter.key";
+            tls_configuration.certificate_chain_file = tls_directory + "/ddsrouter.crt";
+            tls_configuration.dh_params_file = tls_directory + "/dh_params.pem";
+        }
+        conf->tls_configuration = tls_configuration;
+    }
+
+    return {core::types::ParticipantKind::initial_peers, conf};
+}
+
+/**
+ * @brief Configuration of a DDS Router forwarding the topics of \c topic_prefix between \c participants .
+ */
+core::DdsRouterConfiguration router_configuration(
+        const std::string& topic_prefix,
+        const std::vector<ParticipantConfigurationPair>& participants)
+{
+    core::DdsRouterConfiguration conf;
+
+    ddspipe::core::types::WildcardDdsFilterTopic topic;
+    topic.topic_name.set_value(topic_prefix + "*");
+    conf.ddspipe_configuration.allowlist.insert(
+        utils::Heritable<ddspipe::core::types::WildcardDdsFilterTopic>::make_heritable(topic));
+
+    for (const auto& participant : participants)
+    {
+        conf.participants_configurations.insert(participant);
+    }
+
+    return conf;
+}
+
+} /* namespace */
+
+std::string to_string(
+        Topology topology)
+{
+    return TOPOLOGY_NAMES[static_cast<std::size_t>(topology)];
+}
+
+Topology topology_from_string(
+        const std::string& name)
+{
+    for (std::size_t i = 0; i < TOPOLOGY_NAMES.size(); ++i)
+    {
+        if (TOPOLOGY_NAMES[i] == name)
+        {
+            return static_cast<Topology>(i);
+        }
+    }
+
+    throw utils::InitializationException(
+              utils::Formatter() << "Unknown topology <" << name << ">.");
+}
+
+uint32_t remote_domain(
+        Topology topology)
+{
+    return topology == Topology::direct ? 0 : 1;
+}
+
+core::DdsRouterConfiguration local_configuration(
+        const std::string& topic_prefix,
+        uint32_t participants,
+        bool shm /* = false */)
+{
+    std::vector<ParticipantConfigurationPair> local_participants;
+    for (uint32_t domain = 0; domain < participants; ++domain)
+    {
+        local_participants.push_back(shm ? shm_participant(domain) : simple_participant(domain));
+    }
+    return router_configuration(topic_prefix, local_participants);
+}
+
+std::vector<core::DdsRouterConfiguration> topology_configurations(
+        Topology topology,
+        const std::string& topic_prefix,
+        const std::string& tls_directory)
+{
+    using ddspipe::participants::types::TransportProtocol;
+
+    switch (topology)
+    {
+        case Topology::direct:
+            return {};
+
+        case Topology::local:
+            return {local_configuration(topic_prefix, 2)};
+
+        case Topology::local_shm:
+            return {local_configuration(topic_prefix, 2, true)};
+
+        case Topology::wan_udp:
+        case Topology::wan_udp_io_uring:
+        case Topology::wan_udp_mmsg:
+        case Topology::wan_tcp:
+        case Topology::wan_tls:
+        {
+            const TransportProtocol transport =
+                    topology == Topology::wan_tcp || topology == Topology::wan_tls ?
+                    TransportProtocol::tcp : TransportProtocol::udp;
+            const bool tls = topology == Topology::wan_tls;
+            core::UdpIoBackend io_backend = core::UdpIoBackend::fastdds;
+            if (topology == Topology::wan_udp_io_uring)
+            {
+                io_backend = core::UdpIoBackend::io_uring;
+            }
+            else if (topology == Topology::wan_udp_mmsg)
+            {
+                io_backend = core::UdpIoBackend::mmsg;
+            }
+
+            return {
+                router_configuration(topic_prefix, {
+                    initial_peers_participant("wan_server", true, transport, false, tls, tls_directory, io_backend),
+                    simple_participant(0)}),
+                router_configuration(topic_prefix, {
+                    initial_peers_participant("wan_client", false, transport, false, tls, tls_directory, io_backend),
+                    simple_participant(1)})
+            };
+        }
+
+        case Topology::repeater_udp:
+        case Topology::repeater_tcp:
+        default:
+        {
+            const TransportProtocol transport =
+                    topology == Topology::repeater_udp ? TransportProtocol::udp : TransportProtocol::tcp;
+
+            return {
+                router_configuration(topic_prefix, {
+                    initial_peers_participant("repeater", true, transport, true, false, tls_directory)}),
+                router_configuration(topic_prefix, {
+                    initial_peers_participant("wan_client_0", false, transport, false, false, tls_directory),
+                    simple_participant(0)}),
+                router_configuration(topic_prefix, {
+                    initial_peers_participant("wan_client_1", false, transport, false, false, tls_directory),
+                    simple_participant(1)})
+            };
+        }
+    }
+}
+
+} /* namespace benchmark */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
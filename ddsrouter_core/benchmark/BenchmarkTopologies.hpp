@@ -0,0 +1,86 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/configuration/DdsRouterConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace benchmark {
+
+/**
+ * Deployments of DDS Routers connecting domain 0 with domain 1, as in the blackbox tests.
+ */
+enum class Topology
+{
+    direct,           //!< No router: both ends in domain 0
+    local,            //!< A router with a Simple Participant in each domain
+    local_shm,        //!< A router with a Shared Memory Participant in each domain
+    wan_udp,          //!< Two routers connected by Initial Peers Participants over UDP in the loopback
+    wan_udp_io_uring, //!< As \c wan_udp , with the io_uring UDP transport in the Initial Peers Participants
+    wan_udp_mmsg,     //!< As \c wan_udp , with the batched (mmsg) UDP transport in the Initial Peers Participants
+    wan_tcp,          //!< Two routers connected by Initial Peers Participants over TCP in the loopback
+    wan_tls,          //!< Two routers connected by Initial Peers Participants over TCP with TLS in the loopback
+    repeater_udp,     //!< Two routers connected through a third repeater router over UDP in the loopback
+    repeater_tcp,     //!< Two routers connected through a third repeater router over TCP in the loopback
+};
+
+//! Name of \c topology in the command line and the results
+std::string to_string(
+        Topology topology);
+
+/**
+ * @brief Topology named \c name .
+ *
+ * @throw \c utils::InitializationException if there is no topology with that name
+ */
+Topology topology_from_string(
+        const std::string& name);
+
+//! Domain where the other end is in \c topology (0 when there is no router)
+uint32_t remote_domain(
+        Topology topology);
+
+/**
+ * @brief Configuration of a DDS Router with a Simple Participant in each domain from 0 to \c participants - 1 .
+ *
+ * @param topic_prefix only the topics whose name starts with this prefix are forwarded
+ * @param participants number of Simple Participants
+ * @param shm use Shared Memory Participants (only shared memory transport) instead of Simple Participants
+ */
+core::DdsRouterConfiguration local_configuration(
+        const std::string& topic_prefix,
+        uint32_t participants,
+        bool shm = false);
+
+/**
+ * @brief Configurations of the DDS Routers that connect domain 0 with domain 1 in \c topology .
+ *
+ * @param topology deployment of the routers (none for \c Topology::direct )
+ * @param topic_prefix only the topics whose name starts with this prefix are forwarded
+ * @param tls_directory directory with the certificates of the blackbox tests, used by \c Topology::wan_tls
+ */
+std::vector<core::DdsRouterConfiguration> topology_configurations(
+        Topology topology,
+        const std::string& topic_prefix,
+        const std::string& tls_directory);
+
+} /* namespace benchmark */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,418 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file DiscoveryBenchmark.cpp
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+
+#include <fastdds/dds/core/status/PublicationMatchedStatus.hpp>
+#include <fastdds/dds/core/status/SubscriptionMatchedStatus.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/DataWriterListener.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include <ddsrouter_core/core/DdsRouter.hpp>
+
+#include "HelloWorld/HelloWorldPubSubTypes.h"
+
+#include "BenchmarkTopologies.hpp"
+#include "DiscoveryBenchmark.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace benchmark {
+
+namespace {
+
+//! Prefix of the topics of the benchmark, all of them forwarded by the DDS Router
+constexpr const char* TOPIC_PREFIX = "DDS-Router-Benchmark-Discovery-";
+
+//! Prefix of the types of the benchmark, one per topic
+constexpr const char* TYPE_PREFIX = "DDS-Router-Benchmark-Type-";
+
+//! Period to check whether the endpoints are matched
+constexpr const std::chrono::milliseconds MATCH_POLL_PERIOD(1);
+
+/**
+ * Listener of the endpoints of one side, that counts how many of them are matched with at least one remote endpoint.
+ */
+class MatchCounter : public fastdds::dds::DataWriterListener, public fastdds::dds::DataReaderListener
+{
+public:
+
+    void on_publication_matched(
+            fastdds::dds::DataWriter*,
+            const fastdds::dds::PublicationMatchedStatus& info) override
+    {
+        update_(info.current_count_change, info.current_count);
+    }
+
+    void on_subscription_matched(
+            fastdds::dds::DataReader*,
+            const fastdds::dds::SubscriptionMatchedStatus& info) override
+    {
+        update_(info.current_count_change, info.current_count);
+    }
+
+    //! Number of endpoints matched with at least one remote endpoint
+    int64_t matched() const noexcept
+    {
+        return matched_.load();
+    }
+
+protected:
+
+    void update_(
+            int32_t change,
+            int32_t count) noexcept
+    {
+        if (change > 0 && count == change)
+        {
+            // First matches of this endpoint
+            ++matched_;
+        }
+        else if (change < 0 && count == 0)
+        {
+            // Last match of this endpoint lost
+            --matched_;
+        }
+    }
+
+    std::atomic<int64_t> matched_ {0};
+};
+
+/**
+ * A participant with a writer (or a reader) for each of N synthetic topics, each with its own type.
+ */
+class SyntheticEndpoints
+{
+public:
+
+    /**
+     * @brief Create the participant in \c domain and the endpoints of \c topics topics.
+     *
+     * @throw \c utils::InitializationException if an entity cannot be created
+     */
+    SyntheticEndpoints(
+            uint32_t domain,
+            uint32_t topics,
+            bool writers)
+    {
+        fastdds::dds::DomainParticipantQos pqos;
+        pqos.name(writers ? "Participant_synthetic_writers" : "Participant_synthetic_readers");
+        participant_ = fastdds::dds::DomainParticipantFactory::get_instance()->create_participant(domain, pqos);
+
+        if (participant_ != nullptr)
+        {
+            publisher_ = participant_->create_publisher(fastdds::dds::PUBLISHER_QOS_DEFAULT);
+            subscriber_ = participant_->create_subscriber(fastdds::dds::SUBSCRIBER_QOS_DEFAULT);
+        }
+
+        for (uint32_t i = 0; publisher_ != nullptr && subscriber_ != nullptr && i < topics; ++i)
+        {
+            fastdds::dds::TypeSupport type(new HelloWorldPubSubType());
+            type->setName((TYPE_PREFIX + std::to_string(i)).c_str());
+            type.register_type(participant_);
+
+            fastdds::dds::Topic* topic = participant_->create_topic(
+                TOPIC_PREFIX + std::to_string(i), type.get_type_name(), fastdds::dds::TOPIC_QOS_DEFAULT);
+            if (topic == nullptr)
+            {
+                break;
+            }
+            topics_.push_back(topic);
+
+            if (writers)
+            {
+                fastdds::dds::DataWriter* writer =
+                        publisher_->create_datawriter(topic, fastdds::dds::DATAWRITER_QOS_DEFAULT, &counter_);
+                if (writer == nullptr)
+                {
+                    break;
+                }
+                writers_.push_back(writer);
+            }
+            else
+            {
+                fastdds::dds::DataReader* reader =
+                        subscriber_->create_datareader(topic, fastdds::dds::DATAREADER_QOS_DEFAULT, &counter_);
+                if (reader == nullptr)
+                {
+                    break;
+                }
+                readers_.push_back(reader);
+            }
+        }
+
+        if (writers_.size() + readers_.size() != topics)
+        {
+            destroy_entities_();
+            throw utils::InitializationException(
+                      utils::Formatter() << "Failed to create the " << topics << " synthetic "
+                                         << (writers ? "writers" : "readers") << " in domain " << domain << ".");
+        }
+    }
+
+    ~SyntheticEndpoints()
+    {
+        destroy_entities_();
+    }
+
+    //! Number of endpoints matched with at least one remote endpoint
+    int64_t matched() const noexcept
+    {
+        return counter_.matched();
+    }
+
+    //! Delete the writers and readers, keeping the participant and the topics
+    void delete_endpoints() noexcept
+    {
+        for (auto writer : writers_)
+        {
+            publisher_->delete_datawriter(writer);
+        }
+        writers_.clear();
+
+        for (auto reader : readers_)
+        {
+            subscriber_->delete_datareader(reader);
+        }
+        readers_.clear();
+    }
+
+protected:
+
+    void destroy_entities_() noexcept
+    {
+        if (participant_ == nullptr)
+        {
+            return;
+        }
+
+        delete_endpoints();
+        for (auto topic : topics_)
+        {
+            participant_->delete_topic(topic);
+        }
+        topics_.clear();
+
+        if (subscriber_ != nullptr)
+        {
+            participant_->delete_subscriber(subscriber_);
+        }
+        if (publisher_ != nullptr)
+        {
+            participant_->delete_publisher(publisher_);
+        }
+        fastdds::dds::DomainParticipantFactory::get_instance()->delete_participant(participant_);
+        participant_ = nullptr;
+    }
+
+    fastdds::dds::DomainParticipant* participant_ {nullptr};
+    fastdds::dds::Publisher* publisher_ {nullptr};
+    fastdds::dds::Subscriber* subscriber_ {nullptr};
+    std::vector<fastdds::dds::Topic*> topics_;
+    std::vector<fastdds::dds::DataWriter*> writers_;
+    std::vector<fastdds::dds::DataReader*> readers_;
+
+    //! Listener of every endpoint
+    MatchCounter counter_;
+};
+
+//! Parameters of a case of the benchmark
+struct DiscoveryCase
+{
+    //! Number of synthetic topics
+    uint32_t topics;
+
+    //! Whether the router removes the entities of the topics without readers
+    bool remove_unused_entities;
+
+    //! Maximum time to wait for the bridges to be created or removed
+    std::chrono::milliseconds timeout;
+};
+
+/**
+ * @brief Wait at most \c timeout for \c condition to hold.
+ *
+ * @return seconds waited, or NaN if the condition did not hold in time
+ */
+double wait_seconds(
+        const std::chrono::steady_clock::time_point& start,
+        const std::function<bool()>& condition,
+        std::chrono::milliseconds timeout)
+{
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() - start > timeout)
+        {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        std::this_thread::sleep_for(MATCH_POLL_PERIOD);
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+//! Seconds that \c function takes to run
+double measure_seconds(
+        const std::function<void()>& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+BenchmarkCase run_case(
+        const DiscoveryCase& test_case)
+{
+    const int64_t topics = test_case.topics;
+
+    SyntheticEndpoints writers(0, test_case.topics, true);
+    SyntheticEndpoints readers(1, test_case.topics, false);
+
+    auto configuration = local_configuration(TOPIC_PREFIX, 2);
+    configuration.ddspipe_configuration.remove_unused_entities = test_case.remove_unused_entities;
+
+    const uint64_t start_memory = current_memory_bytes();
+    const uint64_t start_cpu = process_cpu_time_ns();
+    const auto start = std::chrono::steady_clock::now();
+
+    // Every bridge is active once the router matches every reader
+    core::DdsRouter router(configuration);
+    router.start();
+    const double bridges_s = wait_seconds(start, [&readers, topics]()
+                    {
+                        return readers.matched() >= topics;
+                    }, test_case.timeout);
+
+    const uint64_t end_cpu = process_cpu_time_ns();
+    const uint64_t end_memory = current_memory_bytes();
+
+    // Reload blocking every topic, and allowing them again
+    auto blocking_configuration = configuration;
+    ddspipe::core::types::WildcardDdsFilterTopic blocked_topics;
+    blocked_topics.topic_name.set_value(std::string(TOPIC_PREFIX) + "*");
+    blocking_configuration.ddspipe_configuration.blocklist.insert(
+        utils::Heritable<ddspipe::core::types::WildcardDdsFilterTopic>::make_heritable(blocked_topics));
+
+    const double reload_block_s = measure_seconds([&]()
+                    {
+                        router.reload_configuration(blocking_configuration);
+                    });
+    const double reload_allow_s = measure_seconds([&]()
+                    {
+                        router.reload_configuration(configuration);
+                    });
+
+    // Delete the readers, so the router removes the entities it no longer uses and unmatches every writer
+    double unused_removal_s = std::numeric_limits<double>::quiet_NaN();
+    if (test_case.remove_unused_entities)
+    {
+        const auto removal_start = std::chrono::steady_clock::now();
+        readers.delete_endpoints();
+        unused_removal_s = wait_seconds(removal_start, [&writers]()
+                        {
+                            return writers.matched() == 0;
+                        }, test_case.timeout);
+    }
+
+    router.stop();
+
+    BenchmarkCase result;
+    result.parameter("topics", test_case.topics);
+    result.parameter("remove_unused_entities", test_case.remove_unused_entities ? 1 : 0);
+
+    result.metric("bridges_s", bridges_s);
+    result.metric("discovery_cpu_s", (end_cpu - start_cpu) / 1e9);
+    result.metric("router_memory_mb", end_memory >= start_memory ? (end_memory - start_memory) / 1e6 : 0);
+    result.metric("peak_memory_mb", peak_memory_bytes() / 1e6);
+    result.metric("reload_block_s", reload_block_s);
+    result.metric("reload_allow_s", reload_allow_s);
+    result.metric("unused_removal_s", unused_removal_s);
+
+    return result;
+}
+
+std::vector<BenchmarkCase> run(
+        const BenchmarkArguments& arguments)
+{
+    const auto topics = arguments.get_numbers("topics", {10, 100, 1000, 10000});
+    const auto remove_unused_entities = arguments.get_numbers("remove-unused-entities", {0, 1});
+
+    DiscoveryCase test_case;
+    test_case.timeout = std::chrono::milliseconds(arguments.get_number("timeout", 300000));
+
+    std::vector<BenchmarkCase> results;
+    for (const auto n_topics : topics)
+    {
+        for (const auto remove_unused : remove_unused_entities)
+        {
+            if (n_topics == 0 || n_topics > std::numeric_limits<uint32_t>::max() || remove_unused > 1)
+            {
+                throw utils::InitializationException(
+                          utils::Formatter() << "Discovery benchmark requires at least 1 topic, "
+                                             << "and remove-unused-entities to be 0 or 1.");
+            }
+
+            test_case.topics = static_cast<uint32_t>(n_topics);
+            test_case.remove_unused_entities = remove_unused == 1;
+
+            std::cerr << "Discovery: " << n_topics << " topics, remove unused entities " << remove_unused
+                      << std::endl;
+            results.push_back(run_case(test_case));
+        }
+    }
+    return results;
+}
+
+} /* namespace */
+
+BenchmarkDescription discovery_benchmark()
+{
+    BenchmarkDescription description;
+    description.name = "discovery";
+    description.usage =
+            "  --topics=<n,...>                  Number of synthetic topics, each with its own type, writer and\n"
+            "                                    reader [10,100,1000,10000]\n"
+            "  --remove-unused-entities=<n,...>  Whether the router removes unused entities (0 or 1) [0,1]\n"
+            "  --timeout=<ms>                    Maximum time to create or remove the bridges [300000]\n";
+    description.arguments = {"topics", "remove-unused-entities", "timeout"};
+    description.run = run;
+    return description;
+}
+
+} /* namespace benchmark */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,37 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "benchmark_utils.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace benchmark {
+
+/**
+ * @brief Discovery scalability benchmark.
+ *
+ * A participant in domain 0 creates a writer and a participant in domain 1 a reader for each of N synthetic topics,
+ * each with its own type, and a DDS Router with a Simple Participant in each domain bridges them.
+ * For every number of topics, with and without removing unused entities, it measures the time and CPU until every
+ * bridge is active, the memory of the router, the time to reload the configuration, and the time to remove the
+ * unused entities once the readers are gone.
+ */
+BenchmarkDescription discovery_benchmark();
+
+} /* namespace benchmark */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,446 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file LatencyBenchmark.cpp
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include <ddsrouter_core/core/DdsRouter.hpp>
+
+#include "HelloWorld/HelloWorldPubSubTypes.h"
+
+#include "BenchmarkTopologies.hpp"
+#include "LatencyBenchmark.hpp"
+
+#ifndef DDSROUTER_BENCHMARK_TLS_DIRECTORY
+#define DDSROUTER_BENCHMARK_TLS_DIRECTORY "resources/tls"
+#endif // ifndef DDSROUTER_BENCHMARK_TLS_DIRECTORY
+
+namespace eprosima {
+namespace ddsrouter {
+namespace benchmark {
+
+namespace {
+
+//! Prefix of the topics of the benchmark, all of them forwarded by the DDS Routers
+constexpr const char* TOPIC_PREFIX = "DDS-Router-Benchmark-Latency-";
+
+//! Maximum time for the routers to connect both ends
+constexpr const std::chrono::seconds ROUTE_TIMEOUT(30);
+
+//! Time to wait for each sample while the routers connect both ends
+constexpr const std::chrono::milliseconds ROUTE_PING_TIMEOUT(100);
+
+/**
+ * DDS entities of one end of the ping-pong, that write in one topic and read from the other.
+ *
+ * The ponger writes back every sample it reads, and the pinger waits for the samples it writes to come back.
+ */
+class PingPongEndpoint : public fastdds::dds::DataReaderListener
+{
+public:
+
+    /**
+     * @brief Create the entities of the end in domain \c domain .
+     *
+     * @throw \c utils::InitializationException if an entity cannot be created
+     */
+    PingPongEndpoint(
+            uint32_t domain,
+            const std::string& write_topic_name,
+            const std::string& read_topic_name,
+            bool echo)
+        : echo_(echo)
+    {
+        fastdds::dds::DomainParticipantQos pqos;
+        pqos.name(echo ? "Participant_ponger" : "Participant_pinger");
+        participant_ = fastdds::dds::DomainParticipantFactory::get_instance()->create_participant(domain, pqos);
+
+        if (participant_ != nullptr)
+        {
+            fastdds::dds::TypeSupport type(new HelloWorldPubSubType());
+            type.register_type(participant_);
+
+            publisher_ = participant_->create_publisher(fastdds::dds::PUBLISHER_QOS_DEFAULT);
+            subscriber_ = participant_->create_subscriber(fastdds::dds::SUBSCRIBER_QOS_DEFAULT);
+            write_topic_ = participant_->create_topic(write_topic_name, type.get_type_name(),
+                            fastdds::dds::TOPIC_QOS_DEFAULT);
+            read_topic_ = participant_->create_topic(read_topic_name, type.get_type_name(),
+                            fastdds::dds::TOPIC_QOS_DEFAULT);
+        }
+
+        if (publisher_ != nullptr && write_topic_ != nullptr)
+        {
+            fastdds::dds::DataWriterQos wqos = fastdds::dds::DATAWRITER_QOS_DEFAULT;
+            wqos.reliability().kind = fastdds::dds::RELIABLE_RELIABILITY_QOS;
+            wqos.durability().kind = fastdds::dds::VOLATILE_DURABILITY_QOS;
+            wqos.history().kind = fastdds::dds::KEEP_LAST_HISTORY_QOS;
+            wqos.history().depth = 1;
+            wqos.endpoint().history_memory_policy =
+                    fastrtps::rtps::MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+            writer_ = publisher_->create_datawriter(write_topic_, wqos);
+        }
+
+        if (subscriber_ != nullptr && read_topic_ != nullptr)
+        {
+            fastdds::dds::DataReaderQos rqos = fastdds::dds::DATAREADER_QOS_DEFAULT;
+            rqos.reliability().kind = fastdds::dds::RELIABLE_RELIABILITY_QOS;
+            rqos.durability().kind = fastdds::dds::VOLATILE_DURABILITY_QOS;
+            rqos.history().kind = fastdds::dds::KEEP_LAST_HISTORY_QOS;
+            rqos.history().depth = 1;
+            rqos.endpoint().history_memory_policy =
+                    fastrtps::rtps::MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+            reader_ = subscriber_->create_datareader(read_topic_, rqos, this);
+        }
+
+        if (writer_ == nullptr || reader_ == nullptr)
+        {
+            destroy_entities_();
+            throw utils::InitializationException(
+                      utils::Formatter() << "Failed to create the " << (echo ? "ponger" : "pinger")
+                                         << " in domain " << domain << ".");
+        }
+    }
+
+    ~PingPongEndpoint()
+    {
+        destroy_entities_();
+    }
+
+    /**
+     * @brief Write \c sample and wait at most \c timeout for it to come back.
+     *
+     * @return whether the sample came back in time
+     */
+    bool ping(
+            const HelloWorld& sample,
+            std::chrono::nanoseconds timeout)
+    {
+        // Not locked while writing, as the samples between entities of the same process may be delivered (and
+        // written back) in this same thread
+        if (!writer_->write(const_cast<HelloWorld*>(&sample)))
+        {
+            return false;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        return received_.wait_for(lock, timeout, [this, &sample]()
+                       {
+                           return last_index_ == sample.index();
+                       });
+    }
+
+    //! Read the samples and write them back (ponger) or notify their arrival (pinger)
+    void on_data_available(
+            fastdds::dds::DataReader* reader) override
+    {
+        fastdds::dds::SampleInfo info;
+        while (reader->take_next_sample(&sample_, &info) == fastrtps::types::ReturnCode_t::RETCODE_OK)
+        {
+            if (!info.valid_data)
+            {
+                continue;
+            }
+
+            if (echo_)
+            {
+                writer_->write(&sample_);
+            }
+            else
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    last_index_ = sample_.index();
+                }
+                received_.notify_all();
+            }
+        }
+    }
+
+protected:
+
+    void destroy_entities_() noexcept
+    {
+        if (participant_ == nullptr)
+        {
+            return;
+        }
+
+        if (reader_ != nullptr)
+        {
+            subscriber_->delete_datareader(reader_);
+        }
+        if (writer_ != nullptr)
+        {
+            publisher_->delete_datawriter(writer_);
+        }
+        if (subscriber_ != nullptr)
+        {
+            participant_->delete_subscriber(subscriber_);
+        }
+        if (publisher_ != nullptr)
+        {
+            participant_->delete_publisher(publisher_);
+        }
+        if (read_topic_ != nullptr)
+        {
+            participant_->delete_topic(read_topic_);
+        }
+        if (write_topic_ != nullptr)
+        {
+            participant_->delete_topic(write_topic_);
+        }
+        fastdds::dds::DomainParticipantFactory::get_instance()->delete_participant(participant_);
+        participant_ = nullptr;
+    }
+
+    //! Whether this end writes back the samples it reads
+    const bool echo_;
+
+    fastdds::dds::DomainParticipant* participant_ {nullptr};
+    fastdds::dds::Publisher* publisher_ {nullptr};
+    fastdds::dds::Subscriber* subscriber_ {nullptr};
+    fastdds::dds::Topic* write_topic_ {nullptr};
+    fastdds::dds::Topic* read_topic_ {nullptr};
+    fastdds::dds::DataWriter* writer_ {nullptr};
+    fastdds::dds::DataReader* reader_ {nullptr};
+
+    //! Placeholder where the samples are read (only used from the listener)
+    HelloWorld sample_;
+
+    //! Index of the last sample read by the pinger
+    uint32_t last_index_ {0};
+
+    //! Protects \c last_index_
+    std::mutex mutex_;
+
+    //! Notified when the pinger reads a sample
+    std::condition_variable received_;
+};
+
+//! Parameters of a case of the benchmark
+struct LatencyCase
+{
+    //! Deployment of the routers between the ends
+    Topology topology;
+
+    //! Size of the message of each sample in bytes
+    uint32_t payload_size;
+
+    //! Samples measured
+    uint32_t samples;
+
+    //! Samples sent before measuring
+    uint32_t warmup_samples;
+
+    //! Time to wait for each sample to come back before considering it lost
+    std::chrono::milliseconds timeout;
+
+    //! Directory with the certificates used by the TLS topology
+    std::string tls_directory;
+};
+
+//! Nearest rank percentile \c q (from 0 to 1) of \c sorted_values , in microseconds
+double percentile_us(
+        const std::vector<int64_t>& sorted_values,
+        double q)
+{
+    if (sorted_values.empty())
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    const std::size_t rank = static_cast<std::size_t>(std::ceil(q * sorted_values.size()));
+    return sorted_values[std::min(sorted_values.size(), std::max<std::size_t>(rank, 1)) - 1] / 1e3;
+}
+
+BenchmarkCase run_case(
+        const LatencyCase& test_case)
+{
+    const std::string ping_topic = std::string(TOPIC_PREFIX) + "ping";
+    const std::string pong_topic = std::string(TOPIC_PREFIX) + "pong";
+
+    PingPongEndpoint ponger(remote_domain(test_case.topology), pong_topic, ping_topic, true);
+    PingPongEndpoint pinger(0, ping_topic, pong_topic, false);
+
+    std::vector<std::unique_ptr<core::DdsRouter>> routers;
+    for (const auto& configuration : topology_configurations(test_case.topology, TOPIC_PREFIX,
+            test_case.tls_directory))
+    {
+        routers.emplace_back(new core::DdsRouter(configuration));
+        routers.back()->start();
+    }
+
+    HelloWorld sample;
+    sample.message(std::string(test_case.payload_size, 'x'));
+    uint32_t index = 0;
+
+    // Wait until the routers connect both ends
+    const auto route_deadline = std::chrono::steady_clock::now() + ROUTE_TIMEOUT;
+    do
+    {
+        if (std::chrono::steady_clock::now() > route_deadline)
+        {
+            throw utils::InitializationException(
+                      utils::Formatter() << "Topology " << to_string(test_case.topology)
+                                         << " did not connect the pinger and the ponger.");
+        }
+        sample.index(++index);
+    } while (!pinger.ping(sample, ROUTE_PING_TIMEOUT));
+
+    for (uint32_t i = 0; i < test_case.warmup_samples; ++i)
+    {
+        sample.index(++index);
+        pinger.ping(sample, test_case.timeout);
+    }
+
+    std::vector<int64_t> round_trips;
+    round_trips.reserve(test_case.samples);
+    uint32_t lost = 0;
+
+    for (uint32_t i = 0; i < test_case.samples; ++i)
+    {
+        sample.index(++index);
+
+        const auto start = std::chrono::steady_clock::now();
+        if (pinger.ping(sample, test_case.timeout))
+        {
+            round_trips.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start).count());
+        }
+        else
+        {
+            ++lost;
+        }
+    }
+
+    for (auto& router : routers)
+    {
+        router->stop();
+    }
+
+    std::sort(round_trips.begin(), round_trips.end());
+    const double mean_us = round_trips.empty() ?
+            std::numeric_limits<double>::quiet_NaN() :
+            std::accumulate(round_trips.begin(), round_trips.end(), 0.0) / round_trips.size() / 1e3;
+
+    BenchmarkCase result;
+    result.parameter("topology", to_string(test_case.topology));
+    result.parameter("payload_size", test_case.payload_size);
+
+    result.metric("samples", round_trips.size());
+    result.metric("lost_samples", lost);
+    result.metric("rtt_us_mean", mean_us);
+    result.metric("rtt_us_min", percentile_us(round_trips, 0));
+    result.metric("rtt_us_p50", percentile_us(round_trips, 0.5));
+    result.metric("rtt_us_p90", percentile_us(round_trips, 0.9));
+    result.metric("rtt_us_p99", percentile_us(round_trips, 0.99));
+    result.metric("rtt_us_p99_9", percentile_us(round_trips, 0.999));
+    result.metric("rtt_us_max", percentile_us(round_trips, 1));
+
+    return result;
+}
+
+std::vector<BenchmarkCase> run(
+        const BenchmarkArguments& arguments)
+{
+    std::vector<Topology> topologies;
+    for (const auto& name : arguments.get_list("topologies", {
+                "direct", "local", "local-shm", "wan-udp", "wan-udp-io-uring", "wan-udp-mmsg", "wan-tcp", "wan-tls",
+                "repeater-udp", "repeater-tcp"}))
+    {
+        topologies.push_back(topology_from_string(name));
+    }
+    const auto payload_sizes = arguments.get_numbers("payload-sizes", {16, 1024, 65536, 1048576});
+
+    LatencyCase test_case;
+    test_case.samples = static_cast<uint32_t>(arguments.get_number("samples", 1000));
+    test_case.warmup_samples = static_cast<uint32_t>(arguments.get_number("warmup-samples", 100));
+    test_case.timeout = std::chrono::milliseconds(arguments.get_number("timeout", 1000));
+    test_case.tls_directory = arguments.get("tls-directory", DDSROUTER_BENCHMARK_TLS_DIRECTORY);
+
+    std::vector<BenchmarkCase> results;
+    for (const auto topology : topologies)
+    {
+        for (const auto payload_size : payload_sizes)
+        {
+            if (payload_size > std::numeric_limits<uint32_t>::max())
+            {
+                throw utils::InitializationException(
+                          utils::Formatter() << "Payload size " << payload_size << " is too large.");
+            }
+
+            test_case.topology = topology;
+            test_case.payload_size = static_cast<uint32_t>(payload_size);
+
+            std::cerr << "Latency: topology " << to_string(topology) << ", payload " << payload_size << " B"
+                      << std::endl;
+            results.push_back(run_case(test_case));
+        }
+    }
+    return results;
+}
+
+} /* namespace */
+
+BenchmarkDescription latency_benchmark()
+{
+    BenchmarkDescription description;
+    description.name = "latency";
+    description.usage =
+            "  --topologies=<name,...>   Deployments of the routers between the ends: direct (no router), local,\n"
+            "                            local-shm, wan-udp, wan-udp-io-uring, wan-udp-mmsg, wan-tcp, wan-tls,\n"
+            "                            repeater-udp, repeater-tcp [all]\n"
+            "  --payload-sizes=<n,...>   Sizes of the payload in bytes [16,1024,65536,1048576]\n"
+            "  --samples=<n>             Samples measured in each case [1000]\n"
+            "  --warmup-samples=<n>      Samples sent before measuring [100]\n"
+            "  --timeout=<ms>            Time to wait for a sample before considering it lost [1000]\n"
+            "  --tls-directory=<path>    Directory with the certificates of the wan-tls topology [test resources]\n";
+    description.arguments = {
+        "topologies", "payload-sizes", "samples", "warmup-samples", "timeout", "tls-directory"};
+    description.run = run;
+    return description;
+}
+
+} /* namespace benchmark */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,36 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "benchmark_utils.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace benchmark {
+
+/**
+ * @brief Round trip latency benchmark.
+ *
+ * A pinger in domain 0 sends one sample at a time to a ponger in the other domain, which sends it back, through the
+ * DDS Routers of a topology, all of them in this process.
+ * Every combination of topology and payload size is run, and the percentiles of the round trip time are measured.
+ * The \c direct topology, without routers, is the baseline to compute the latency added by the routers.
+ */
+BenchmarkDescription latency_benchmark();
+
+} /* namespace benchmark */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,357 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file ThroughputBenchmark.cpp
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <thread>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/core/DdsRouter.hpp>
+
+#include <test_participants.hpp>
+
+#include "BenchmarkTopologies.hpp"
+#include "ThroughputBenchmark.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace benchmark {
+
+namespace {
+
+//! Prefix of the topics of the benchmark, all of them forwarded by the DDS Router
+constexpr const char* TOPIC_PREFIX = "DDS-Router-Benchmark-Throughput-";
+
+//! Time without receptions after which the samples in flight of a topic are considered lost
+constexpr const std::chrono::milliseconds LOST_SAMPLES_TIMEOUT(100);
+
+//! Parameters of a case of the benchmark
+struct ThroughputCase
+{
+    //! Size of the message of each sample in bytes
+    uint32_t payload_size;
+
+    //! Number of topics, each with its own publisher
+    uint32_t topics;
+
+    //! Number of participants of the DDS Router, each in its own domain
+    uint32_t participants;
+
+    //! Number of threads of the DDS Router
+    uint32_t threads;
+
+    //! Kind of the participants of the DDS Router: simple or shm (only shared memory transport)
+    std::string participant_kind;
+
+    //! Maximum bytes sent and not yet received per topic
+    uint64_t max_in_flight;
+
+    //! Time publishing before measuring
+    std::chrono::milliseconds warmup;
+
+    //! Time measuring
+    std::chrono::milliseconds duration;
+};
+
+/**
+ * Counters of the samples of a topic, shared by its publishing thread and its subscribers.
+ */
+struct TopicCounters
+{
+    //! Samples published
+    std::atomic<uint64_t> sent {0};
+
+    //! Samples received by any subscriber
+    std::atomic<uint32_t> received {0};
+};
+
+std::string topic_name(
+        uint32_t topic)
+{
+    return TOPIC_PREFIX + std::to_string(topic);
+}
+
+/**
+ * @brief Publish \c sample in \c publisher until \c stop is set.
+ *
+ * At most \c max_in_flight_samples per subscriber are sent and not yet received, so large payloads do not pile up in
+ * the histories of the writers.
+ * Samples not received after \c LOST_SAMPLES_TIMEOUT are considered lost, as the subscribers are best effort.
+ */
+void publish(
+        test::TestPublisher<HelloWorld>& publisher,
+        HelloWorld sample,
+        uint32_t subscribers,
+        uint64_t max_in_flight_samples,
+        TopicCounters& counters,
+        const std::atomic<bool>& stop)
+{
+    uint64_t lost = 0;
+    uint32_t last_received = counters.received.load();
+    auto last_progress = std::chrono::steady_clock::now();
+
+    while (!stop.load(std::memory_order_relaxed))
+    {
+        const uint32_t received = counters.received.load(std::memory_order_relaxed);
+        if (received != last_received)
+        {
+            last_received = received;
+            last_progress = std::chrono::steady_clock::now();
+        }
+
+        // The counter of receptions wraps around, so only the lower 32 bits of the difference are meaningful.
+        // It is negative when samples considered lost arrive afterwards.
+        const uint64_t sent = counters.sent.load(std::memory_order_relaxed) * subscribers;
+        const int32_t difference = static_cast<int32_t>(static_cast<uint32_t>(sent - lost) - received);
+        const uint64_t in_flight = difference > 0 ? static_cast<uint64_t>(difference) : 0;
+
+        if (in_flight >= max_in_flight_samples * subscribers)
+        {
+            if (std::chrono::steady_clock::now() - last_progress > LOST_SAMPLES_TIMEOUT)
+            {
+                lost += in_flight;
+                last_progress = std::chrono::steady_clock::now();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+            continue;
+        }
+
+        sample.index(sample.index() + 1);
+        if (publisher.publish(sample))
+        {
+            counters.sent.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+BenchmarkCase run_case(
+        const ThroughputCase& test_case)
+{
+    HelloWorld sample;
+    sample.message(std::string(test_case.payload_size, 'x'));
+
+    const uint32_t subscribers_per_topic = test_case.participants - 1;
+    const uint64_t max_in_flight_samples =
+            std::max<uint64_t>(1, test_case.max_in_flight / std::max<uint32_t>(1, test_case.payload_size));
+
+    std::vector<std::unique_ptr<TopicCounters>> counters;
+    std::vector<std::unique_ptr<test::TestPublisher<HelloWorld>>> publishers;
+    std::vector<std::unique_ptr<test::TestSubscriber<HelloWorld>>> subscribers;
+
+    // Publishers in domain 0 and subscribers in every other domain
+    for (uint32_t topic = 0; topic < test_case.topics; ++topic)
+    {
+        counters.emplace_back(new TopicCounters());
+
+        publishers.emplace_back(new test::TestPublisher<HelloWorld>());
+        if (!publishers.back()->init(0, topic_name(topic)))
+        {
+            throw utils::InitializationException(
+                      utils::Formatter() << "Failed to create the publisher of topic " << topic_name(topic) << ".");
+        }
+
+        for (uint32_t domain = 1; domain < test_case.participants; ++domain)
+        {
+            subscribers.emplace_back(new test::TestSubscriber<HelloWorld>());
+            if (!subscribers.back()->init(domain, &sample, &counters.back()->received, topic_name(topic)))
+            {
+                throw utils::InitializationException(
+                          utils::Formatter() << "Failed to create the subscriber of topic " << topic_name(topic)
+                                             << " in domain " << domain << ".");
+            }
+        }
+    }
+
+    auto configuration = local_configuration(TOPIC_PREFIX, test_case.participants, test_case.participant_kind == "shm");
+    configuration.advanced_options.number_of_threads = test_case.threads;
+
+    core::DdsRouter router(configuration);
+    router.start();
+
+    for (auto& publisher : publishers)
+    {
+        publisher->wait_discovery();
+    }
+    for (auto& subscriber : subscribers)
+    {
+        subscriber->wait_discovery();
+    }
+
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> publishing_threads;
+    for (uint32_t topic = 0; topic < test_case.topics; ++topic)
+    {
+        publishing_threads.emplace_back(
+            publish,
+            std::ref(*publishers[topic]),
+            sample,
+            subscribers_per_topic,
+            max_in_flight_samples,
+            std::ref(*counters[topic]),
+            std::cref(stop));
+    }
+
+    // Total of the counters of every topic
+    const auto totals = [&counters]()
+            {
+                std::pair<uint64_t, uint64_t> sent_and_received {0, 0};
+                for (const auto& topic_counters : counters)
+                {
+                    sent_and_received.first += topic_counters->sent.load();
+                    sent_and_received.second += topic_counters->received.load();
+                }
+                return sent_and_received;
+            };
+
+    std::this_thread::sleep_for(test_case.warmup);
+
+    const auto start_totals = totals();
+    const uint64_t start_cpu = process_cpu_time_ns();
+    const auto start = std::chrono::steady_clock::now();
+
+    std::this_thread::sleep_for(test_case.duration);
+
+    const auto end_totals = totals();
+    const uint64_t end_cpu = process_cpu_time_ns();
+    const auto end = std::chrono::steady_clock::now();
+
+    stop.store(true);
+    for (auto& thread : publishing_threads)
+    {
+        thread.join();
+    }
+    router.stop();
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    const double sent = static_cast<double>(end_totals.first - start_totals.first);
+    const double received = static_cast<double>(end_totals.second - start_totals.second);
+    const double cpu_us = static_cast<double>(end_cpu - start_cpu) / 1e3;
+
+    BenchmarkCase result;
+    result.parameter("payload_size", test_case.payload_size);
+    result.parameter("topics", test_case.topics);
+    result.parameter("participants", test_case.participants);
+    result.parameter("threads", test_case.threads);
+    result.parameter("participant_kind", test_case.participant_kind);
+
+    result.metric("duration_s", seconds);
+    result.metric("samples_sent", sent);
+    result.metric("samples_received", received);
+    result.metric("msgs_per_s", received / seconds);
+    result.metric("mb_per_s", received * test_case.payload_size / seconds / 1e6);
+    result.metric("cpu_us_per_msg", received > 0 ? cpu_us / received : std::numeric_limits<double>::quiet_NaN());
+    result.metric("cpu_cores", cpu_us / 1e6 / seconds);
+
+    return result;
+}
+
+std::vector<BenchmarkCase> run(
+        const BenchmarkArguments& arguments)
+{
+    const auto payload_sizes = arguments.get_numbers("payload-sizes", {16, 1024, 65536, 1048576, 8388608});
+    const auto topics = arguments.get_numbers("topics", {1});
+    const auto participants = arguments.get_numbers("participants", {2});
+    const auto threads = arguments.get_numbers("threads", {12});
+    const auto participant_kinds = arguments.get_list("participant-kinds", {"simple"});
+
+    ThroughputCase test_case;
+    test_case.max_in_flight = arguments.get_number("max-in-flight", 64 * 1024 * 1024);
+    test_case.warmup = std::chrono::milliseconds(arguments.get_number("warmup", 1000));
+    test_case.duration = std::chrono::milliseconds(arguments.get_number("duration", 5000));
+
+    std::vector<BenchmarkCase> results;
+    for (const auto payload_size : payload_sizes)
+    {
+        for (const auto n_topics : topics)
+        {
+            for (const auto n_participants : participants)
+            {
+                for (const auto n_threads : threads)
+                {
+                    for (const auto& participant_kind : participant_kinds)
+                    {
+                        if (payload_size > std::numeric_limits<uint32_t>::max() || n_topics == 0 ||
+                                n_participants < 2 || n_threads == 0)
+                        {
+                            throw utils::InitializationException(
+                                      utils::Formatter() << "Throughput benchmark requires at least 1 topic, "
+                                                         << "2 participants and 1 thread.");
+                        }
+
+                        if (participant_kind != "simple" && participant_kind != "shm")
+                        {
+                            throw utils::InitializationException(
+                                      utils::Formatter() << "Unknown participant kind <" << participant_kind
+                                                         << ">, expected simple or shm.");
+                        }
+
+                        test_case.payload_size = static_cast<uint32_t>(payload_size);
+                        test_case.topics = static_cast<uint32_t>(n_topics);
+                        test_case.participants = static_cast<uint32_t>(n_participants);
+                        test_case.threads = static_cast<uint32_t>(n_threads);
+                        test_case.participant_kind = participant_kind;
+
+                        std::cerr << "Throughput: payload " << payload_size << " B, " << n_topics << " topics, "
+                                  << n_participants << " " << participant_kind << " participants, " << n_threads
+                                  << " threads" << std::endl;
+                        results.push_back(run_case(test_case));
+                    }
+                }
+            }
+        }
+    }
+    return results;
+}
+
+} /* namespace */
+
+BenchmarkDescription throughput_benchmark()
+{
+    BenchmarkDescription description;
+    description.name = "throughput";
+    description.usage =
+            "  --payload-sizes=<n,...>   Sizes of the payload in bytes [16,1024,65536,1048576,8388608]\n"
+            "  --topics=<n,...>          Number of topics, each with its own publisher [1]\n"
+            "  --participants=<n,...>    Number of participants of the router, one per domain (min 2) [2]\n"
+            "  --threads=<n,...>         Number of threads of the router [12]\n"
+            "  --participant-kinds=<...> Kinds of the participants of the router: simple, shm [simple]\n"
+            "  --max-in-flight=<bytes>   Maximum bytes per topic sent and not yet received [67108864]\n"
+            "  --warmup=<ms>             Time publishing before measuring [1000]\n"
+            "  --duration=<ms>           Time measuring each case [5000]\n";
+    description.arguments = {
+        "payload-sizes", "topics", "participants", "threads", "participant-kinds", "max-in-flight", "warmup",
+        "duration"};
+    description.run = run;
+    return description;
+}
+
+} /* namespace benchmark */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
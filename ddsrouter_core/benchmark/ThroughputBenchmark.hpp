@@ -0,0 +1,36 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "benchmark_utils.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace benchmark {
+
+/**
+ * @brief Throughput benchmark.
+ *
+ * A DDS Router with a Simple Participant per domain forwards the samples of the publishers of domain 0, one per
+ * topic, to the subscribers of every other domain, all of them in this process.
+ * Every combination of payload size, number of topics, number of participants and number of threads is run, and
+ * the messages and bytes received per second and the CPU of the process per message are measured.
+ */
+BenchmarkDescription throughput_benchmark();
+
+} /* namespace benchmark */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
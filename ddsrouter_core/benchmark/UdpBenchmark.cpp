@@ -0,0 +1,258 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file UdpBenchmark.cpp
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/transport/IoUringUdp.hpp>
+#include <ddsrouter_core/transport/MmsgUdp.hpp>
+
+#include "UdpBenchmark.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace benchmark {
+
+namespace {
+
+//! Backends of the benchmark: io_uring, and batched system calls without and with UDP offload
+const std::vector<std::string> BACKENDS = {"io-uring", "mmsg-no-offload", "mmsg"};
+
+//! Loopback address, where the receiver is bound to any free port
+const core::UdpEndpoint LOCALHOST {{127, 0, 0, 1}, 0};
+
+//! Parameters of a case of the benchmark
+struct UdpCase
+{
+    //! Name of the backend, one of \c BACKENDS
+    std::string backend;
+
+    //! Datagrams per system call with mmsg, or entries of the rings with io_uring
+    uint32_t batch_size;
+
+    //! Size of each datagram in bytes
+    uint32_t payload_size;
+
+    //! Number of threads sending at once
+    uint32_t senders;
+
+    //! Bytes of the send and receive buffers of the sockets
+    uint32_t socket_buffer_size;
+
+    //! Time sending before measuring
+    std::chrono::milliseconds warmup;
+
+    //! Time measuring
+    std::chrono::milliseconds duration;
+};
+
+std::unique_ptr<core::IUdpSender> create_sender(
+        const UdpCase& test_case,
+        const core::UdpSocketOptions& options)
+{
+    if (test_case.backend == "io-uring")
+    {
+        return std::make_unique<core::IoUringUdpSender>(options, test_case.batch_size);
+    }
+    return std::make_unique<core::MmsgUdpSender>(options, test_case.batch_size, test_case.backend == "mmsg");
+}
+
+std::unique_ptr<core::IUdpReceiver> create_receiver(
+        const UdpCase& test_case,
+        const core::UdpSocketOptions& options,
+        const core::IUdpReceiver::DatagramCallback& callback)
+{
+    if (test_case.backend == "io-uring")
+    {
+        return std::make_unique<core::IoUringUdpReceiver>(
+            LOCALHOST, std::vector<core::UdpEndpoint>(), test_case.payload_size, options, test_case.batch_size,
+            callback);
+    }
+    return std::make_unique<core::MmsgUdpReceiver>(
+        LOCALHOST, std::vector<core::UdpEndpoint>(), test_case.payload_size, options, test_case.batch_size,
+        test_case.backend == "mmsg", callback);
+}
+
+BenchmarkCase run_case(
+        const UdpCase& test_case)
+{
+    core::UdpSocketOptions options;
+    options.send_buffer_size = test_case.socket_buffer_size;
+    options.receive_buffer_size = test_case.socket_buffer_size;
+
+    std::atomic<uint64_t> received(0);
+    auto receiver = create_receiver(test_case, options,
+                    [&received](const uint8_t*, uint32_t, const core::UdpEndpoint&)
+                    {
+                        received.fetch_add(1, std::memory_order_relaxed);
+                    });
+    auto sender = create_sender(test_case, options);
+
+    core::UdpEndpoint destination = LOCALHOST;
+    destination.port = receiver->port();
+    const std::vector<core::UdpEndpoint> destinations = {destination};
+    const std::vector<uint8_t> datagram(test_case.payload_size, 'x');
+
+    // Datagrams beyond what the receiver keeps up with are dropped by the kernel, as with any UDP flood
+    std::atomic<bool> stop(false);
+    std::atomic<uint64_t> sent(0);
+    std::vector<std::thread> sending_threads;
+    for (uint32_t i = 0; i < test_case.senders; ++i)
+    {
+        sending_threads.emplace_back([&]()
+                {
+                    while (!stop.load(std::memory_order_relaxed))
+                    {
+                        if (sender->send_to(datagram.data(), test_case.payload_size, destinations))
+                        {
+                            sent.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                });
+    }
+
+    std::this_thread::sleep_for(test_case.warmup);
+
+    const uint64_t start_sent = sent.load();
+    const uint64_t start_received = received.load();
+    const uint64_t start_cpu = process_cpu_time_ns();
+    const auto start = std::chrono::steady_clock::now();
+
+    std::this_thread::sleep_for(test_case.duration);
+
+    const uint64_t end_sent = sent.load();
+    const uint64_t end_received = received.load();
+    const uint64_t end_cpu = process_cpu_time_ns();
+    const auto end = std::chrono::steady_clock::now();
+
+    stop.store(true);
+    for (auto& thread : sending_threads)
+    {
+        thread.join();
+    }
+
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    const double packets_sent = static_cast<double>(end_sent - start_sent);
+    const double packets_received = static_cast<double>(end_received - start_received);
+    const double cpu_us = static_cast<double>(end_cpu - start_cpu) / 1e3;
+
+    BenchmarkCase result;
+    result.parameter("backend", test_case.backend);
+    result.parameter("batch_size", test_case.batch_size);
+    result.parameter("payload_size", test_case.payload_size);
+    result.parameter("senders", test_case.senders);
+
+    result.metric("duration_s", seconds);
+    result.metric("packets_sent", packets_sent);
+    result.metric("packets_received", packets_received);
+    result.metric("packets_per_s", packets_received / seconds);
+    result.metric("mb_per_s", packets_received * test_case.payload_size / seconds / 1e6);
+    result.metric("cpu_us_per_packet",
+            packets_received > 0 ? cpu_us / packets_received : std::numeric_limits<double>::quiet_NaN());
+    result.metric("cpu_cores", cpu_us / 1e6 / seconds);
+
+    return result;
+}
+
+std::vector<BenchmarkCase> run(
+        const BenchmarkArguments& arguments)
+{
+    const auto backends = arguments.get_list("backends", BACKENDS);
+    const auto batch_sizes = arguments.get_numbers("batch-sizes", {1, 32});
+    const auto payload_sizes = arguments.get_numbers("payload-sizes", {64, 1024});
+    const auto senders = arguments.get_numbers("senders", {1, 4});
+
+    UdpCase test_case;
+    test_case.socket_buffer_size = static_cast<uint32_t>(arguments.get_number("socket-buffer-size", 8 * 1024 * 1024));
+    test_case.warmup = std::chrono::milliseconds(arguments.get_number("warmup", 500));
+    test_case.duration = std::chrono::milliseconds(arguments.get_number("duration", 2000));
+
+    std::vector<BenchmarkCase> results;
+    for (const auto& backend : backends)
+    {
+        if (std::find(BACKENDS.begin(), BACKENDS.end(), backend) == BACKENDS.end())
+        {
+            throw utils::InitializationException(
+                      utils::Formatter() << "Unknown backend <" << backend
+                                         << ">, expected io-uring, mmsg-no-offload or mmsg.");
+        }
+
+        for (const auto batch_size : batch_sizes)
+        {
+            for (const auto payload_size : payload_sizes)
+            {
+                for (const auto n_senders : senders)
+                {
+                    if (batch_size == 0 || batch_size > 1024 || payload_size == 0 || payload_size > 65507 ||
+                            n_senders == 0)
+                    {
+                        throw utils::InitializationException(
+                                  utils::Formatter() << "UDP benchmark requires a batch size between 1 and 1024, "
+                                                     << "a payload size between 1 and 65507 and at least 1 sender.");
+                    }
+
+                    test_case.backend = backend;
+                    test_case.batch_size = static_cast<uint32_t>(batch_size);
+                    test_case.payload_size = static_cast<uint32_t>(payload_size);
+                    test_case.senders = static_cast<uint32_t>(n_senders);
+
+                    std::cerr << "UDP: " << backend << ", batch " << batch_size << ", payload " << payload_size
+                              << " B, " << n_senders << " senders" << std::endl;
+                    results.push_back(run_case(test_case));
+                }
+            }
+        }
+    }
+    return results;
+}
+
+} /* namespace */
+
+BenchmarkDescription udp_benchmark()
+{
+    BenchmarkDescription description;
+    description.name = "udp";
+    description.usage =
+            "  --backends=<name,...>     UDP I/O backends: io-uring, mmsg-no-offload, mmsg (with GSO and GRO) [all]\n"
+            "  --batch-sizes=<n,...>     Datagrams per system call of mmsg, or entries of the rings of io-uring\n"
+            "                            [1,32]\n"
+            "  --payload-sizes=<n,...>   Sizes of the datagrams in bytes [64,1024]\n"
+            "  --senders=<n,...>         Number of threads sending at once [1,4]\n"
+            "  --socket-buffer-size=<n>  Bytes of the send and receive buffers of the sockets [8388608]\n"
+            "  --warmup=<ms>             Time sending before measuring [500]\n"
+            "  --duration=<ms>           Time measuring each case [2000]\n";
+    description.arguments = {
+        "backends", "batch-sizes", "payload-sizes", "senders", "socket-buffer-size", "warmup", "duration"};
+    description.run = run;
+    return description;
+}
+
+} /* namespace benchmark */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
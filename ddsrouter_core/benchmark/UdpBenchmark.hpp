@@ -0,0 +1,36 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include "benchmark_utils.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace benchmark {
+
+/**
+ * @brief UDP I/O backends benchmark.
+ *
+ * Several threads send datagrams as fast as possible through the sender of a backend (io_uring, or batched
+ * system calls with or without UDP offload) to a receiver of the same backend in the loopback.
+ * For every backend, batch size, payload size and number of sending threads, it measures the datagrams received per
+ * second and the CPU of the process (sending and receiving) per datagram received.
+ */
+BenchmarkDescription udp_benchmark();
+
+} /* namespace benchmark */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
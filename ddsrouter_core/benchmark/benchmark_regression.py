@@ -0,0 +1,362 @@
+# Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import json
+import math
+import os
+import shlex
+import shutil
+import statistics
+import subprocess
+import sys
+
+DESCRIPTION = """Run the DDS Router benchmarks, store their results and compare them against a baseline"""
+USAGE = ('python3 benchmark_regression.py run -e <path/to/ddsrouter_benchmark> -r <results/dir> '
+         '[-b <baseline/dir>]\n'
+         '       python3 benchmark_regression.py compare -r <results/dir> -b <baseline/dir>')
+
+BENCHMARKS = ['throughput', 'latency', 'discovery', 'udp']
+
+# Metrics where a higher value is better. Any other compared metric is better when lower.
+HIGHER_IS_BETTER = {'msgs_per_s', 'packets_per_s', 'mb_per_s'}
+
+# Metrics that describe the run instead of the performance, so they are not compared
+NOT_COMPARED = {'duration_s', 'samples', 'samples_sent', 'samples_received', 'packets_sent', 'packets_received'}
+
+
+def parse_options():
+    """
+    Parse arguments.
+
+    :return: The arguments parsed.
+    """
+    parser = argparse.ArgumentParser(
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+        add_help=True,
+        description=(DESCRIPTION),
+        usage=(USAGE)
+    )
+    subparsers = parser.add_subparsers(dest='command', required=True)
+
+    run_parser = subparsers.add_parser(
+        'run',
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+        help=('Run the benchmarks and store their results. '
+              'If a baseline is given, compare against it (or store the results as baseline if it does not exist).')
+    )
+    run_parser.add_argument(
+        '-e',
+        '--exe',
+        type=str,
+        required=True,
+        help='Path to the ddsrouter_benchmark executable.'
+    )
+    run_parser.add_argument(
+        '--benchmarks',
+        type=str,
+        default=','.join(BENCHMARKS),
+        help='Comma separated benchmarks to run.'
+    )
+    run_parser.add_argument(
+        '--repetitions',
+        type=int,
+        default=3,
+        help='Times each benchmark is run, to estimate the noise of its metrics.'
+    )
+    for benchmark in BENCHMARKS:
+        run_parser.add_argument(
+            f'--{benchmark}-args',
+            type=str,
+            default='',
+            help=f'Arguments for the {benchmark} benchmark (e.g. "--payload-sizes=16,1024").'
+        )
+    add_comparison_options(run_parser, baseline_required=False)
+
+    compare_parser = subparsers.add_parser(
+        'compare',
+        formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+        help='Compare stored results against a baseline.'
+    )
+    add_comparison_options(compare_parser, baseline_required=True)
+
+    return parser.parse_args()
+
+
+def add_comparison_options(parser, baseline_required):
+    """
+    Add the arguments to store and compare results.
+
+    :param parser: Parser where the arguments are added.
+    :param baseline_required: Whether the baseline must be given.
+    """
+    parser.add_argument(
+        '-r',
+        '--results',
+        type=str,
+        required=True,
+        help='Directory with the results (one JSON file per benchmark).'
+    )
+    parser.add_argument(
+        '-b',
+        '--baseline',
+        type=str,
+        required=baseline_required,
+        help='Directory with the baseline results.'
+    )
+    parser.add_argument(
+        '--min-threshold',
+        type=float,
+        default=0.05,
+        help='Minimum relative change of a metric to be reported (0.05 is 5%%).'
+    )
+    parser.add_argument(
+        '--noise-factor',
+        type=float,
+        default=3.0,
+        help=('The threshold of a metric is at least this factor times its relative standard deviation among '
+              'the repetitions of the baseline and the results.')
+    )
+    parser.add_argument(
+        '--verbose',
+        action='store_true',
+        help='Print every compared metric, not only the regressions and improvements.'
+    )
+
+
+def run_benchmarks(args):
+    """
+    Run each benchmark the times given, and store all their reports in <results>/<benchmark>.json.
+
+    :param args: Arguments parsed.
+    :return: Whether every run succeeded.
+    """
+    os.makedirs(args.results, exist_ok=True)
+
+    for benchmark in args.benchmarks.split(','):
+        if benchmark not in BENCHMARKS:
+            print(f'Unknown benchmark <{benchmark}>.', file=sys.stderr)
+            return False
+
+        command = [args.exe, benchmark] + shlex.split(getattr(args, f'{benchmark}_args'))
+        runs = []
+        for repetition in range(args.repetitions):
+            print(f'Running {benchmark} ({repetition + 1}/{args.repetitions}): {" ".join(command)}',
+                  file=sys.stderr)
+            process = subprocess.run(command, stdout=subprocess.PIPE, universal_newlines=True)
+            if process.returncode != 0:
+                print(f'Benchmark {benchmark} failed with code {process.returncode}.', file=sys.stderr)
+                return False
+            runs.append(json.loads(process.stdout))
+
+        stored = {
+            'benchmark': benchmark,
+            'version': runs[0]['version'],
+            'commit': runs[0]['commit'],
+            'command': command,
+            'runs': runs,
+        }
+        with open(os.path.join(args.results, f'{benchmark}.json'), 'w') as results_file:
+            json.dump(stored, results_file, indent=2)
+
+    return True
+
+
+def load_results(directory):
+    """
+    Load the metrics of every case in the results of a directory.
+
+    A single report of ddsrouter_benchmark is read as a result with one run.
+
+    :param directory: Directory with one JSON file per benchmark.
+    :return: Dictionary from (benchmark, parameters) to dictionary from metric to the list of its values in each run,
+        and dictionary from benchmark to the version it was run with.
+    """
+    cases = {}
+    versions = {}
+    for file_name in sorted(os.listdir(directory)):
+        if not file_name.endswith('.json'):
+            continue
+
+        with open(os.path.join(directory, file_name)) as results_file:
+            stored = json.load(results_file)
+
+        runs = stored['runs'] if 'runs' in stored else [stored]
+        versions[stored['benchmark']] = f"{stored['version']} ({stored['commit']})"
+
+        for report in runs:
+            for result in report['results']:
+                key = (stored['benchmark'], tuple(sorted(result['parameters'].items())))
+                metrics = cases.setdefault(key, {})
+                for metric, value in result['metrics'].items():
+                    metrics.setdefault(metric, []).append(value)
+
+    return cases, versions
+
+
+def category(metric):
+    """
+    Category of a metric in the report.
+
+    :param metric: Name of the metric.
+    :return: Name of the category.
+    """
+    if metric in HIGHER_IS_BETTER:
+        return 'throughput'
+    if metric.startswith('rtt_'):
+        return 'latency'
+    if metric.startswith('cpu_') or metric.endswith('_cpu_s'):
+        return 'cpu'
+    if metric.endswith('_memory_mb'):
+        return 'memory'
+    if metric == 'lost_samples':
+        return 'reliability'
+    return 'startup'
+
+
+def relative_deviation(values):
+    """
+    Relative standard deviation of the repetitions of a metric.
+
+    :param values: Values of the metric in each run.
+    :return: Standard deviation divided by the mean (0 with less than two values).
+    """
+    if len(values) < 2:
+        return 0.0
+    mean = statistics.mean(values)
+    return statistics.stdev(values) / abs(mean) if mean != 0 else 0.0
+
+
+def compare_metric(baseline_values, current_values, higher_is_better, min_threshold, noise_factor):
+    """
+    Compare the median of a metric in the results against the baseline.
+
+    The threshold of the change is the minimum threshold or, if higher, the noise factor times the relative
+    standard deviation of the repetitions of the baseline or the results.
+
+    :return: Tuple with the status (regression, improvement or ok), the medians of the baseline and results, the
+        relative change and the threshold used.
+    """
+    baseline_valid = [value for value in baseline_values if value is not None]
+    current_valid = [value for value in current_values if value is not None]
+
+    if not baseline_valid:
+        return ('ok', None, statistics.median(current_valid) if current_valid else None, None, None)
+    if not current_valid:
+        # The metric could not be measured (e.g. a timeout), while it was in the baseline
+        return ('regression', statistics.median(baseline_valid), None, None, None)
+
+    baseline = statistics.median(baseline_valid)
+    current = statistics.median(current_valid)
+    threshold = max(min_threshold,
+                    noise_factor * max(relative_deviation(baseline_valid), relative_deviation(current_valid)))
+
+    if baseline == 0:
+        change = 0.0 if current == 0 else math.copysign(math.inf, current)
+    else:
+        change = (current - baseline) / abs(baseline)
+
+    worse = -change if higher_is_better else change
+    if worse > threshold:
+        status = 'regression'
+    elif worse < -threshold:
+        status = 'improvement'
+    else:
+        status = 'ok'
+
+    return (status, baseline, current, change, threshold)
+
+
+def format_value(value):
+    """Format a metric value for the report."""
+    return 'n/a' if value is None else f'{value:.6g}'
+
+
+def compare(args):
+    """
+    Compare the results against the baseline and print the report.
+
+    :param args: Arguments parsed.
+    :return: Whether there is no regression.
+    """
+    baseline_cases, baseline_versions = load_results(args.baseline)
+    current_cases, current_versions = load_results(args.results)
+
+    print('DDS Router benchmark comparison')
+    for benchmark in sorted(set(baseline_versions) | set(current_versions)):
+        print(f'  {benchmark}: baseline {baseline_versions.get(benchmark, "missing")}, '
+              f'results {current_versions.get(benchmark, "missing")}')
+    print()
+
+    counts = {'regression': 0, 'improvement': 0, 'ok': 0}
+    for key in sorted(current_cases):
+        benchmark, parameters = key
+        case_name = f"{benchmark} {' '.join(f'{name}={value}' for name, value in parameters)}"
+
+        if key not in baseline_cases:
+            if args.verbose:
+                print(f'NEW          {case_name}')
+            continue
+
+        for metric, current_values in current_cases[key].items():
+            if metric in NOT_COMPARED or metric not in baseline_cases[key]:
+                continue
+
+            status, baseline, current, change, threshold = compare_metric(
+                baseline_cases[key][metric],
+                current_values,
+                metric in HIGHER_IS_BETTER,
+                args.min_threshold,
+                args.noise_factor)
+            counts[status] += 1
+
+            if status == 'ok' and not args.verbose:
+                continue
+
+            change_text = '' if change is None else f' ({change:+.1%}, threshold {threshold:.1%})'
+            print(f'{status.upper():<12} {category(metric):<11} {case_name}  {metric}: '
+                  f'{format_value(baseline)} -> {format_value(current)}{change_text}')
+
+    for key in sorted(set(baseline_cases) - set(current_cases)):
+        benchmark, parameters = key
+        print(f"MISSING      {benchmark} {' '.join(f'{name}={value}' for name, value in parameters)}")
+
+    print()
+    print(f"{counts['regression']} regressions, {counts['improvement']} improvements, "
+          f"{counts['ok']} metrics within their threshold.")
+
+    return counts['regression'] == 0
+
+
+def main():
+    """Run the benchmarks and/or compare their results, returning 1 if there is any regression."""
+    args = parse_options()
+
+    if args.command == 'run':
+        if not run_benchmarks(args):
+            return 1
+
+        if args.baseline is None:
+            return 0
+
+        if not os.path.isdir(args.baseline):
+            shutil.copytree(args.results, args.baseline)
+            print(f'No baseline found: results stored as baseline in {args.baseline}.')
+            return 0
+
+    return 0 if compare(args) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,352 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file benchmark_utils.cpp
+ *
+ */
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif // ifdef _WIN32
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/library/config.h>
+
+#include "benchmark_utils.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace benchmark {
+
+namespace {
+
+//! Render \c value as a JSON string
+std::string json_string(
+        const std::string& value)
+{
+    std::ostringstream output;
+    output << '"';
+    for (const char c : value)
+    {
+        switch (c)
+        {
+            case '"':
+                output << "\\\"";
+                break;
+            case '\\':
+                output << "\\\\";
+                break;
+            case '\n':
+                output << "\\n";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    output << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                           << std::dec;
+                }
+                else
+                {
+                    output << c;
+                }
+        }
+    }
+    output << '"';
+    return output.str();
+}
+
+//! Write \c fields as a JSON object
+void write_object(
+        std::ostream& output,
+        const std::vector<std::pair<std::string, std::string>>& fields)
+{
+    output << "{";
+    for (std::size_t i = 0; i < fields.size(); ++i)
+    {
+        output << (i == 0 ? "" : ", ") << json_string(fields[i].first) << ": " << fields[i].second;
+    }
+    output << "}";
+}
+
+} /* namespace */
+
+BenchmarkArguments::BenchmarkArguments(
+        int argc,
+        char** argv,
+        int first)
+{
+    for (int i = first; i < argc; ++i)
+    {
+        const std::string argument(argv[i]);
+        const std::size_t equal = argument.find('=');
+        if (argument.rfind("--", 0) != 0 || equal == std::string::npos || equal == 2)
+        {
+            throw utils::InitializationException(
+                      utils::Formatter() << "Argument <" << argument << "> is not of the form --name=value.");
+        }
+        values_[argument.substr(2, equal - 2)] = argument.substr(equal + 1);
+    }
+}
+
+bool BenchmarkArguments::has(
+        const std::string& name) const noexcept
+{
+    return values_.find(name) != values_.end();
+}
+
+std::string BenchmarkArguments::get(
+        const std::string& name,
+        const std::string& default_value) const
+{
+    auto it = values_.find(name);
+    return it == values_.end() ? default_value : it->second;
+}
+
+uint64_t BenchmarkArguments::get_number(
+        const std::string& name,
+        uint64_t default_value) const
+{
+    auto it = values_.find(name);
+    return it == values_.end() ? default_value : to_number_(name, it->second);
+}
+
+std::vector<std::string> BenchmarkArguments::get_list(
+        const std::string& name,
+        const std::vector<std::string>& default_values) const
+{
+    auto it = values_.find(name);
+    if (it == values_.end())
+    {
+        return default_values;
+    }
+
+    std::vector<std::string> values;
+    std::istringstream input(it->second);
+    std::string value;
+    while (std::getline(input, value, ','))
+    {
+        values.push_back(value);
+    }
+
+    if (values.empty())
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Argument <" << name << "> requires at least one value.");
+    }
+    return values;
+}
+
+std::vector<uint64_t> BenchmarkArguments::get_numbers(
+        const std::string& name,
+        const std::vector<uint64_t>& default_values) const
+{
+    if (!has(name))
+    {
+        return default_values;
+    }
+
+    std::vector<uint64_t> numbers;
+    for (const auto& value : get_list(name, {}))
+    {
+        numbers.push_back(to_number_(name, value));
+    }
+    return numbers;
+}
+
+std::vector<std::string> BenchmarkArguments::unknown(
+        const std::vector<std::string>& known_names) const
+{
+    std::vector<std::string> unknown_names;
+    for (const auto& value : values_)
+    {
+        bool known = false;
+        for (const auto& known_name : known_names)
+        {
+            known = known || value.first == known_name;
+        }
+        if (!known)
+        {
+            unknown_names.push_back(value.first);
+        }
+    }
+    return unknown_names;
+}
+
+uint64_t BenchmarkArguments::to_number_(
+        const std::string& name,
+        const std::string& value)
+{
+    std::size_t parsed = 0;
+    uint64_t number = 0;
+    try
+    {
+        number = std::stoull(value, &parsed);
+    }
+    catch (const std::exception&)
+    {
+        parsed = 0;
+    }
+
+    if (value.empty() || parsed != value.size())
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Value <" << value << "> of argument <" << name << "> is not a number.");
+    }
+    return number;
+}
+
+void BenchmarkCase::parameter(
+        const std::string& name,
+        uint64_t value)
+{
+    parameters.emplace_back(name, std::to_string(value));
+}
+
+void BenchmarkCase::parameter(
+        const std::string& name,
+        const std::string& value)
+{
+    parameters.emplace_back(name, json_string(value));
+}
+
+void BenchmarkCase::metric(
+        const std::string& name,
+        double value)
+{
+    if (!std::isfinite(value))
+    {
+        // JSON has no representation for NaN nor infinity
+        metrics.emplace_back(name, "null");
+        return;
+    }
+
+    std::ostringstream output;
+    output << std::setprecision(10) << value;
+    metrics.emplace_back(name, output.str());
+}
+
+void write_report(
+        std::ostream& output,
+        const std::string& benchmark_name,
+        const std::vector<BenchmarkCase>& cases)
+{
+    output << "{\n";
+    output << "  \"benchmark\": " << json_string(benchmark_name) << ",\n";
+    output << "  \"version\": " << json_string(DDSROUTER_CORE_VERSION_STRING) << ",\n";
+    output << "  \"commit\": " << json_string(DDSROUTER_CORE_COMMIT_HASH) << ",\n";
+    output << "  \"results\": [";
+    for (std::size_t i = 0; i < cases.size(); ++i)
+    {
+        output << (i == 0 ? "\n" : ",\n") << "    {\"parameters\": ";
+        write_object(output, cases[i].parameters);
+        output << ", \"metrics\": ";
+        write_object(output, cases[i].metrics);
+        output << "}";
+    }
+    output << "\n  ]\n}\n";
+}
+
+uint64_t process_cpu_time_ns() noexcept
+{
+#ifdef _WIN32
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time))
+    {
+        return 0;
+    }
+    // FILETIME counts intervals of 100 nanoseconds
+    const auto to_ns = [](const FILETIME& time)
+            {
+                return ((static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) * 100;
+            };
+    return to_ns(kernel_time) + to_ns(user_time);
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+    const auto to_ns = [](const timeval& time)
+            {
+                return static_cast<uint64_t>(time.tv_sec) * 1000000000 + static_cast<uint64_t>(time.tv_usec) * 1000;
+            };
+    return to_ns(usage.ru_utime) + to_ns(usage.ru_stime);
+#endif // ifdef _WIN32
+}
+
+uint64_t peak_memory_bytes() noexcept
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return 0;
+    }
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+#ifdef __APPLE__
+    // macOS reports the maximum resident set size in bytes
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+    // Linux reports the maximum resident set size in kilobytes
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif // ifdef __APPLE__
+#endif // ifdef _WIN32
+}
+
+uint64_t current_memory_bytes() noexcept
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return 0;
+    }
+    return counters.WorkingSetSize;
+#elif defined(__linux__)
+    // The second field of statm is the number of resident pages
+    std::ifstream statm("/proc/self/statm");
+    uint64_t size = 0;
+    uint64_t resident = 0;
+    if (!(statm >> size >> resident))
+    {
+        return 0;
+    }
+    return resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif // if defined(_WIN32)
+}
+
+} /* namespace benchmark */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
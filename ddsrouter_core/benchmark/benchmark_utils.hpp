@@ -0,0 +1,170 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace benchmark {
+
+/**
+ * Arguments of a benchmark, given as \c --name=value in the command line.
+ *
+ * Lists are given as comma separated values (e.g. \c --payload-sizes=16,1024 ), so a benchmark
+ * sweeps every combination of them.
+ */
+class BenchmarkArguments
+{
+public:
+
+    /**
+     * @brief Parse the arguments \c argv[first] to \c argv[argc-1] .
+     *
+     * @throw \c utils::InitializationException if an argument is not of the form \c --name=value
+     */
+    BenchmarkArguments(
+            int argc,
+            char** argv,
+            int first);
+
+    //! Whether the argument \c name is given
+    bool has(
+            const std::string& name) const noexcept;
+
+    //! Value of the argument \c name , or \c default_value if not given
+    std::string get(
+            const std::string& name,
+            const std::string& default_value) const;
+
+    /**
+     * @brief Numeric value of the argument \c name , or \c default_value if not given.
+     *
+     * @throw \c utils::InitializationException if the value is not a number
+     */
+    uint64_t get_number(
+            const std::string& name,
+            uint64_t default_value) const;
+
+    /**
+     * @brief Comma separated values of the argument \c name , or \c default_values if not given.
+     *
+     * @throw \c utils::InitializationException if the argument is given without values
+     */
+    std::vector<std::string> get_list(
+            const std::string& name,
+            const std::vector<std::string>& default_values) const;
+
+    /**
+     * @brief Comma separated numeric values of the argument \c name , or \c default_values if not given.
+     *
+     * @throw \c utils::InitializationException if a value is not a number
+     */
+    std::vector<uint64_t> get_numbers(
+            const std::string& name,
+            const std::vector<uint64_t>& default_values) const;
+
+    //! Names of the given arguments that are not in \c known_names
+    std::vector<std::string> unknown(
+            const std::vector<std::string>& known_names) const;
+
+protected:
+
+    //! Parse \c value as a number, or throw mentioning the argument \c name
+    static uint64_t to_number_(
+            const std::string& name,
+            const std::string& value);
+
+    //! Values of the arguments, indexed by name (without the leading dashes)
+    std::map<std::string, std::string> values_;
+};
+
+/**
+ * Result of a case of a benchmark: the parameters that identify the case and the metrics measured in it.
+ *
+ * The values are stored already rendered as JSON.
+ */
+struct BenchmarkCase
+{
+    //! Add a parameter that identifies the case
+    void parameter(
+            const std::string& name,
+            uint64_t value);
+
+    //! Add a parameter that identifies the case
+    void parameter(
+            const std::string& name,
+            const std::string& value);
+
+    //! Add a measured metric
+    void metric(
+            const std::string& name,
+            double value);
+
+    //! Parameters of the case, in insertion order
+    std::vector<std::pair<std::string, std::string>> parameters;
+
+    //! Metrics of the case, in insertion order
+    std::vector<std::pair<std::string, std::string>> metrics;
+};
+
+/**
+ * Description of a benchmark runnable from the command line.
+ */
+struct BenchmarkDescription
+{
+    //! Name used to select the benchmark in the command line
+    std::string name;
+
+    //! Help of the arguments of the benchmark, one per line
+    std::string usage;
+
+    //! Names of the arguments accepted by the benchmark
+    std::vector<std::string> arguments;
+
+    //! Run every case of the benchmark selected by the arguments
+    std::function<std::vector<BenchmarkCase>(const BenchmarkArguments&)> run;
+};
+
+/**
+ * @brief Write the JSON report of the benchmark \c benchmark_name with every case in \c cases .
+ *
+ * The report is an object with the benchmark name, the DDS Router version and commit, and a \c results array
+ * with an object of \c parameters and \c metrics per case.
+ */
+void write_report(
+        std::ostream& output,
+        const std::string& benchmark_name,
+        const std::vector<BenchmarkCase>& cases);
+
+//! CPU time (user and system) consumed by this process so far, in nanoseconds
+uint64_t process_cpu_time_ns() noexcept;
+
+//! Peak resident memory of this process so far, in bytes
+uint64_t peak_memory_bytes() noexcept;
+
+//! Resident memory of this process, in bytes (0 if not available in this platform)
+uint64_t current_memory_bytes() noexcept;
+
+} /* namespace benchmark */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,124 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file main.cpp
+ *
+ */
+
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "DiscoveryBenchmark.hpp"
+#include "LatencyBenchmark.hpp"
+#include "ThroughputBenchmark.hpp"
+#include "UdpBenchmark.hpp"
+
+using namespace eprosima::ddsrouter::benchmark;
+
+namespace {
+
+//! Every benchmark runnable from the command line
+std::vector<BenchmarkDescription> benchmarks()
+{
+    return {
+        throughput_benchmark(),
+        latency_benchmark(),
+        discovery_benchmark(),
+        udp_benchmark(),
+    };
+}
+
+void print_usage(
+        const char* executable)
+{
+    std::cerr << "Usage: " << executable << " <benchmark> [--output=<file>] [--<argument>=<value> ...]\n\n"
+              << "Run a benchmark of the DDS Router and write its results as JSON "
+              << "(to standard output unless --output is given).\n"
+              << "Lists of values are comma separated, and every combination of them is run.\n";
+
+    for (const auto& benchmark : benchmarks())
+    {
+        std::cerr << "\n" << benchmark.name << ":\n" << benchmark.usage;
+    }
+}
+
+} /* namespace */
+
+int main(
+        int argc,
+        char** argv)
+{
+    if (argc < 2)
+    {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    const std::string name(argv[1]);
+    for (const auto& benchmark : benchmarks())
+    {
+        if (benchmark.name != name)
+        {
+            continue;
+        }
+
+        try
+        {
+            const BenchmarkArguments arguments(argc, argv, 2);
+
+            auto known_arguments = benchmark.arguments;
+            known_arguments.push_back("output");
+            const auto unknown_arguments = arguments.unknown(known_arguments);
+            if (!unknown_arguments.empty())
+            {
+                std::cerr << "Unknown argument <" << unknown_arguments.front() << "> of benchmark " << name << ".\n";
+                print_usage(argv[0]);
+                return 1;
+            }
+
+            const auto results = benchmark.run(arguments);
+
+            if (arguments.has("output"))
+            {
+                std::ofstream output(arguments.get("output", ""));
+                if (!output)
+                {
+                    std::cerr << "Failed to open " << arguments.get("output", "") << " to write the results.\n";
+                    return 1;
+                }
+                write_report(output, name, results);
+            }
+            else
+            {
+                write_report(std::cout, name, results);
+            }
+            return 0;
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Benchmark " << name << " failed: " << e.what() << "\n";
+            return 1;
+        }
+    }
+
+    std::cerr << "Unknown benchmark <" << name << ">.\n";
+    print_usage(argv[0]);
+    return 1;
+}
@@ -14,17 +14,26 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <ddspipe_core/configuration/DdsPipeConfiguration.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
 #include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 
 #include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
 #include <ddspipe_participants/xml/XmlHandlerConfiguration.hpp>
 
+#include <ddsrouter_core/configuration/DeduplicationConfiguration.hpp>
+#include <ddsrouter_core/configuration/InterestConfiguration.hpp>
+#include <ddsrouter_core/configuration/LinkGroupConfiguration.hpp>
+#include <ddsrouter_core/configuration/MonitorConfiguration.hpp>
+#include <ddsrouter_core/configuration/RedundancyGroupConfiguration.hpp>
 #include <ddsrouter_core/configuration/SpecsConfiguration.hpp>
 #include <ddsrouter_core/types/ParticipantKind.hpp>
+#include <ddsrouter_core/types/TopicMaxAge.hpp>
 
 #include <ddsrouter_core/library/library_dll.h>
 
@@ -56,6 +65,16 @@ struct DdsRouterConfiguration : public ddspipe::core::IConfiguration
     DDSROUTER_CORE_DllAPI bool is_valid(
             utils::Formatter& error_msg) const noexcept override;
 
+    /**
+     * @brief Participants connected to other DDS Routers (router links).
+     *
+     * The readers they discover belong to other DDS Routers, so they are not local interest.
+     * By default, these are the WAN participants (initial peers and discovery server, also when used as a local
+     * discovery server), the Unix domain socket participants and the participants with interest-based forwarding.
+     * \c router_links overrides the default of specific participants.
+     */
+    DDSROUTER_CORE_DllAPI std::set<ddspipe::core::types::ParticipantId> router_link_participants() const;
+
     /////////////////////////
     // VARIABLES
     /////////////////////////
@@ -77,6 +96,27 @@ struct DdsRouterConfiguration : public ddspipe::core::IConfiguration
     //! XML Handler configuration
     ddspipe::participants::XmlHandlerConfiguration xml_configuration {};
 
+    //! Latency budgets for specific topics. They take precedence over \c SpecsConfiguration::max_age .
+    std::vector<types::TopicMaxAge> topic_max_ages {};
+
+    //! Duplicate suppression of the participants that enable it, indexed by participant id
+    std::map<ddspipe::core::types::ParticipantId, DeduplicationConfiguration> deduplication_configurations {};
+
+    //! Redundancy groups. Their duplicate suppression takes precedence over \c deduplication_configurations .
+    std::vector<RedundancyGroupConfiguration> redundancy_groups {};
+
+    //! Link groups. The data is only sent through the link of each group with the lowest round trip time.
+    std::vector<LinkGroupConfiguration> link_groups {};
+
+    //! Participants that only forward the topics of interest of a remote DDS Router, indexed by participant id
+    std::map<ddspipe::core::types::ParticipantId, InterestConfiguration> interest_configurations {};
+
+    //! Whether each participant is connected to other DDS Routers, overriding the default of its kind
+    std::map<ddspipe::core::types::ParticipantId, bool> router_links {};
+
+    //! Publication of the statistics in a DDS topic
+    MonitorConfiguration monitor_configuration {};
+
 protected:
 
     //! Auxiliar method to validate that class type of the participants are compatible with their kinds.
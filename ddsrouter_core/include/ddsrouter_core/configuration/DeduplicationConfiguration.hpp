@@ -0,0 +1,72 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the configuration of the duplicate suppression of the readers of a participant.
+ *
+ * A sample is identified by the GUID of the writer that originally published it and its sequence number,
+ * which every DDS Router forwards along with the sample.
+ */
+struct DeduplicationConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI DeduplicationConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    /**
+     * @brief Number of sequence numbers tracked for each writer.
+     *
+     * @note Each writer uses one bit per sequence number, rounded up to a multiple of 64.
+     * @warning Samples older than the window are discarded as duplicates.
+     */
+    unsigned int window = 1024;
+
+    /**
+     * @brief Time in milliseconds after which the window of a writer that does not publish is erased.
+     *
+     * @warning Copies of a sample arriving later than this through another path are not detected.
+     */
+    utils::Duration_ms lease = 60000;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,112 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/GeneratedSample.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the configuration of a topic published by a generator participant.
+ *
+ * The samples are \c types::GeneratedSample whose data is determined by the name of the topic.
+ */
+struct GeneratedTopicConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI GeneratedTopicConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    //! DDS topic where the samples are published
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::DdsTopic dds_topic() const;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Name of the topic
+    std::string topic_name {};
+
+    //! Name of the type of the topic
+    std::string type_name {types::GeneratedSample::TYPE_NAME};
+
+    //! Samples published per second
+    double rate = 10;
+
+    //! Bytes of each serialized sample
+    unsigned int payload_size = 64;
+
+    /**
+     * @brief Number of instances the samples are distributed among (round robin).
+     *
+     * @note 0 means the topic is not keyed.
+     */
+    unsigned int keys = 0;
+};
+
+/**
+ * This data struct contains the configuration of a participant that publishes synthetic samples from inside the
+ * DDS Router, to load test it without external publishers.
+ */
+struct GeneratorParticipantConfiguration : public ddspipe::participants::ParticipantConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI GeneratorParticipantConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Topics published by the participant
+    std::vector<GeneratedTopicConfiguration> topics {};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,98 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the configuration of a link of a \c LinkGroupConfiguration .
+ */
+struct LinkConfiguration
+{
+    //! Participant that sends the data through this link
+    ddspipe::core::types::ParticipantId participant {};
+
+    //! IPv4 address where the remote DDS Router answers the probes through this link
+    std::string probe_ip {};
+
+    //! Port where the remote DDS Router answers the probes
+    uint16_t probe_port {0};
+};
+
+/**
+ * This data struct contains the configuration of a link group.
+ *
+ * The participants of a link group are different links (e.g. different WAN participants) that reach the same
+ * remote DDS Router. The round trip time of each link is measured with probes, and the data is only sent through the
+ * link with the lowest one.
+ */
+struct LinkGroupConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI LinkGroupConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Name of the group
+    std::string name {};
+
+    //! Links of the group
+    std::vector<LinkConfiguration> links {};
+
+    //! Time (in milliseconds) between two probes in each link
+    utils::Duration_ms probe_period = 100;
+
+    //! Time (in milliseconds) without answers to consider a link down
+    utils::Duration_ms detection_time = 1000;
+
+    /**
+     * @brief Improvement of the round trip time (in milliseconds) required to change the active link.
+     *
+     * @note It avoids changing the active link continuously when links have similar round trip times.
+     */
+    utils::Duration_ms hysteresis = 5;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
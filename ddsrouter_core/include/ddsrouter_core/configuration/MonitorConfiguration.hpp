@@ -0,0 +1,73 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the configuration of the publication of the DDS Router statistics in a DDS topic.
+ *
+ * The statistics are published periodically by a participant of the DDS Router in the given domain,
+ * so they can be subscribed by any DDS application, or forwarded by the DDS Router itself to remote networks.
+ */
+struct MonitorConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI MonitorConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Whether the statistics are published
+    bool enable = false;
+
+    //! Domain where the statistics are published
+    uint32_t domain = 0;
+
+    //! Name of the topic where the statistics are published
+    std::string topic_name = "ddsrouter/statistics";
+
+    //! Time between publications in milliseconds
+    utils::Duration_ms period = 1000;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,83 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the configuration of a participant that records every sample it receives in MCAP
+ * files.
+ */
+struct RecorderParticipantConfiguration : public ddspipe::participants::ParticipantConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI RecorderParticipantConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    /**
+     * @brief Path and prefix of the files.
+     *
+     * Each file is named \c <file_prefix>_<start time>_<index>.mcap , with the time the recording started and
+     * the index of the file in the recording.
+     */
+    std::string file_prefix = "ddsrouter";
+
+    //! Bytes after which the file is closed and the next one is started (0 to never rotate)
+    uint64_t max_file_size = 0;
+
+    //! Uncompressed bytes of the messages of each chunk
+    uint64_t chunk_size = 1024 * 1024;
+
+    //! Whether to compress the chunks with LZ4
+    bool compress = true;
+
+    /**
+     * @brief Bytes of the samples received and not written yet after which new samples are dropped.
+     *
+     * Samples are kept in the shared payload pool until written, so this bounds the memory the recorder takes
+     * when the disk cannot keep up with the traffic.
+     */
+    uint64_t max_pending_size = 64 * 1024 * 1024;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
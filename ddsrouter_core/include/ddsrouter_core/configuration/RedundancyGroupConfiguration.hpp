@@ -0,0 +1,71 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <set>
+#include <string>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/configuration/DeduplicationConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the configuration of a redundancy group.
+ *
+ * The participants of a redundancy group are independent paths (e.g. different WAN links) that receive the same
+ * samples. Their readers share the duplicate suppression, so each sample is only forwarded by the path where it
+ * arrives first.
+ */
+struct RedundancyGroupConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI RedundancyGroupConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Name of the group
+    std::string name {};
+
+    //! Participants of the group (one per path)
+    std::set<ddspipe::core::types::ParticipantId> participants {};
+
+    //! Duplicate suppression shared by the participants of the group
+    DeduplicationConfiguration deduplication {};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,67 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the configuration of a participant that publishes the samples recorded in MCAP files.
+ */
+struct ReplayerParticipantConfiguration : public ddspipe::participants::ParticipantConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI ReplayerParticipantConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! MCAP files replayed, one after the other
+    std::vector<std::string> files;
+
+    /**
+     * @brief Speed of the replay relative to the recording (e.g. 2 replays twice as fast).
+     *
+     * 0 replays the samples as fast as they are forwarded.
+     */
+    double playback_rate = 1;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
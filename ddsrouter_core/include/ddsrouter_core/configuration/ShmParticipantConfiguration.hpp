@@ -0,0 +1,70 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the configuration of a simple participant that only uses the shared memory transport,
+ * to route the traffic of the applications in the same host.
+ */
+struct ShmParticipantConfiguration : public ddspipe::participants::SimpleParticipantConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI ShmParticipantConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    /**
+     * @brief Bytes of the shared memory segment of the participant, where the samples it sends are written.
+     *
+     * It bounds the samples in flight, so it is larger than the Fast DDS default (512 KiB) to fit large samples.
+     */
+    uint32_t segment_size = 8 * 1024 * 1024;
+
+    /**
+     * @brief Maximum bytes of each message, above which samples are fragmented.
+     *
+     * 0 keeps the Fast DDS default.
+     */
+    uint32_t max_message_size = 0;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,55 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_participants/configuration/ParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the configuration of a participant that discards every sample it receives, only
+ * counting them, to measure the forwarding capacity of the DDS Router.
+ */
+struct SinkParticipantConfiguration : public ddspipe::participants::ParticipantConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI SinkParticipantConfiguration() = default;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    /**
+     * @brief Whether to verify the checksum of every sample received.
+     *
+     * @note The samples must be \c types::GeneratedSample s, e.g. from a generator participant.
+     */
+    bool verify_checksum = false;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,99 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the options of the sockets of a WAN participant (initial peers or discovery server).
+ *
+ * A value of 0 keeps the default of the system or of Fast DDS.
+ */
+struct SocketConfiguration : public ddspipe::core::IConfiguration
+{
+
+    //! Largest differentiated services code point (6 bits)
+    static constexpr uint8_t MAX_DSCP = 63;
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI SocketConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    //! Whether any option only applied by the UDP I/O backends other than Fast DDS is set
+    DDSROUTER_CORE_DllAPI bool requires_io_backend() const noexcept;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Bytes of the send buffer of the UDP and TCP sockets
+    uint32_t send_buffer_size = 0;
+
+    //! Bytes of the receive buffer of the UDP and TCP sockets
+    uint32_t receive_buffer_size = 0;
+
+    //! Whether TCP sockets disable the Nagle algorithm, sending small messages without waiting to coalesce them
+    bool tcp_nodelay = false;
+
+    /**
+     * @brief Milliseconds between the RTPS keep alive requests of the TCP connections.
+     *
+     * These are messages of the Fast DDS TCP transport, not the keepalive of the sockets ( \c SO_KEEPALIVE ).
+     */
+    uint32_t rtps_keep_alive_period = 0;
+
+    //! Milliseconds without answer to an RTPS keep alive request after which a TCP connection is closed
+    uint32_t rtps_keep_alive_timeout = 0;
+
+    /**
+     * @brief Microseconds that the UDP sockets busy poll the device while waiting for datagrams ( \c SO_BUSY_POLL ).
+     *
+     * Only applied by the I/O backends other than Fast DDS.
+     * Raising it above the system default requires the \c CAP_NET_ADMIN capability.
+     */
+    uint32_t busy_poll = 0;
+
+    /**
+     * @brief Differentiated services code point (0 to 63) of the datagrams sent by the UDP sockets.
+     *
+     * It is set in the 6 upper bits of the type of service ( \c IP_TOS ).
+     * Only applied by the I/O backends other than Fast DDS.
+     */
+    uint8_t dscp = 0;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -14,10 +14,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <set>
+#include <string>
 
 #include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/time/time_utils.hpp>
 
 #include <ddspipe_core/configuration/IConfiguration.hpp>
 #include <ddspipe_core/types/dds/TopicQoS.hpp>
@@ -32,6 +35,7 @@ namespace core {
  * This data struct contains the values for advance configuration of the DDS Router such as:
  * - Number of threads to Thread Pool
  * - Default maximum history depth
+ * - Default latency budget
  */
 struct SpecsConfiguration : public ddspipe::core::IConfiguration
 {
@@ -66,6 +70,62 @@ struct SpecsConfiguration : public ddspipe::core::IConfiguration
 
     //! The globally configured Topic QoS.
     ddspipe::core::types::TopicQoS topic_qos{};
+
+    /**
+     * @brief Default maximum age (in milliseconds) of a sample to be forwarded.
+     *
+     * @note The default value is 0, which means that samples are never discarded by age.
+     * @note It can be overwritten for specific topics with \c DdsRouterConfiguration::topic_max_ages .
+     */
+    utils::Duration_ms max_age = 0;
+
+    /**
+     * @brief UDP port where the probes of the link groups of remote DDS Routers are answered.
+     *
+     * @note The default value is 0, which means that probes are not answered.
+     */
+    uint16_t link_probe_port = 0;
+
+    /**
+     * @brief IPv4 addresses of the remote DDS Routers whose link probes are answered.
+     *
+     * @note The default value is empty, which means that the probes of any host are answered.
+     * @warning The probes are not authenticated: restrict the peers when the port is reachable
+     * from untrusted networks.
+     */
+    std::set<std::string> link_probe_peers {};
+
+    /**
+     * @brief UDP port where the topics with local readers are announced to remote DDS Routers.
+     *
+     * @note The default value is 0, which means that the local interest is not announced.
+     */
+    uint16_t interest_port = 0;
+
+    /**
+     * @brief IPv4 addresses of the remote DDS Routers whose interest requests are answered.
+     *
+     * @note The default value is empty, which means that the requests of any host are answered.
+     * @warning The interest protocol is not authenticated: restrict the peers when the port is reachable
+     * from untrusted networks.
+     */
+    std::set<std::string> interest_peers {};
+
+    /**
+     * @brief Whether to measure the latency from the source timestamp of the samples until they are forwarded.
+     *
+     * @note The default value is false, as it requires the clocks of the sources and the router hosts
+     * to be synchronized.
+     * @note The latency added by the DDS Router itself is always measured.
+     */
+    bool source_latency = false;
+
+    /**
+     * @brief Whether to measure the latency added by the DDS Router to the samples of each route.
+     *
+     * @note It can be changed in a running DDS Router by reloading its configuration.
+     */
+    bool route_latency = true;
 };
 
 } /* namespace core */
@@ -0,0 +1,91 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_core/configuration/IConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/transport/IoUringUdp.hpp>
+#include <ddsrouter_core/transport/MmsgUdp.hpp>
+#include <ddsrouter_core/transport/UdpBackend.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the configuration of the I/O of the UDP sockets of a WAN participant
+ * (initial peers or discovery server).
+ */
+struct UdpIoConfiguration : public ddspipe::core::IConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI UdpIoConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! I/O backend of the UDP sockets
+    UdpIoBackend backend = UdpIoBackend::fastdds;
+
+    /**
+     * @brief Entries of the io_uring of each socket, with \c UdpIoBackend::io_uring .
+     *
+     * They are the sends that can be in flight at once, and the datagrams that can be received without being read.
+     * Rounded up to a power of two by the kernel.
+     */
+    uint32_t ring_entries = IO_URING_DEFAULT_RING_ENTRIES;
+
+    /**
+     * @brief Whether a kernel thread polls the submission queue of the sender, with \c UdpIoBackend::io_uring .
+     *
+     * It saves the system call of each send at the cost of a CPU busy while messages are being sent.
+     */
+    bool sqpoll = false;
+
+    /**
+     * @brief Maximum datagrams sent or received in each system call, with \c UdpIoBackend::mmsg .
+     *
+     * Each receiver keeps a buffer of the maximum message size per datagram of the batch.
+     */
+    uint32_t batch_size = MMSG_DEFAULT_BATCH_SIZE;
+
+    /**
+     * @brief Whether to use UDP segmentation (GSO) and receive (GRO) offload, with \c UdpIoBackend::mmsg .
+     *
+     * They are only used if the kernel supports them.
+     */
+    bool offload = true;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
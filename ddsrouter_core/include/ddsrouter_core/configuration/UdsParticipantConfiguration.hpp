@@ -0,0 +1,71 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/transport/UnixSocket.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the configuration of a simple participant that only uses the Unix domain socket
+ * transport, to link DDS Routers in the same host.
+ */
+struct UdsParticipantConfiguration : public ddspipe::participants::SimpleParticipantConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI UdsParticipantConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    /**
+     * @brief Directory where the socket files are created.
+     *
+     * Every DDS Router linked must use the same one (e.g. a volume shared by their containers).
+     */
+    std::string socket_directory = "/tmp";
+
+    //! Bytes above which messages are passed in a memory file instead of inline in the datagram
+    uint32_t memfd_threshold = UNIX_SOCKET_MAX_INLINE_SIZE;
+
+    //! Maximum bytes of each message, above which samples are fragmented
+    uint32_t max_message_size = 1024 * 1024;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
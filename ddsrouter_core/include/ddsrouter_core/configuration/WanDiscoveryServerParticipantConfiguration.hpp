@@ -0,0 +1,62 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddspipe_participants/configuration/DiscoveryServerParticipantConfiguration.hpp>
+
+#include <ddsrouter_core/configuration/SocketConfiguration.hpp>
+#include <ddsrouter_core/configuration/UdpIoConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * This data struct contains the configuration of a discovery server participant, along with the I/O backend and the
+ * options of its sockets.
+ */
+struct WanDiscoveryServerParticipantConfiguration : public ddspipe::participants::DiscoveryServerParticipantConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI WanDiscoveryServerParticipantConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! I/O of the UDP sockets
+    UdpIoConfiguration io {};
+
+    //! Options of the sockets
+    SocketConfiguration socket {};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -14,6 +14,11 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <cpp_utils/ReturnCode.hpp>
 #include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
 
@@ -26,7 +31,19 @@
 
 #include <ddsrouter_core/core/ParticipantFactory.hpp>
 #include <ddsrouter_core/configuration/DdsRouterConfiguration.hpp>
+#include <ddsrouter_core/interest/InterestPublisher.hpp>
+#include <ddsrouter_core/interest/InterestSubscriber.hpp>
+#include <ddsrouter_core/interest/LocalInterest.hpp>
 #include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/link/LinkProbeResponder.hpp>
+#include <ddsrouter_core/link/LinkSelector.hpp>
+#include <ddsrouter_core/metrics/CountingPayloadPool.hpp>
+#include <ddsrouter_core/metrics/MetricsRegistry.hpp>
+#include <ddsrouter_core/metrics/StatisticsPublisher.hpp>
+#include <ddsrouter_core/participant/RouterParticipant.hpp>
+#include <ddsrouter_core/types/DdsRouterStatistics.hpp>
+#include <ddsrouter_core/types/LinkStatistics.hpp>
+#include <ddsrouter_core/types/RedundancyPathStatistics.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -101,6 +118,46 @@ public:
      */
     DDSROUTER_CORE_DllAPI utils::ReturnCode stop() noexcept;
 
+    // STATISTICS
+    /**
+     * @brief Snapshot of the statistics of the DDS Router.
+     *
+     * @note Taking the snapshot reads every counter, so it should not be called in a tight loop.
+     *
+     * @return traffic of every topic in every participant, payload pool occupancy, and redundancy and link groups
+     */
+    DDSROUTER_CORE_DllAPI types::DdsRouterStatistics get_statistics() const;
+
+    /**
+     * @brief Number of samples discarded for exceeding their latency budget.
+     *
+     * @return map with the number of discarded samples indexed by topic name
+     */
+    DDSROUTER_CORE_DllAPI std::map<std::string, uint64_t> expired_samples() const;
+
+    /**
+     * @brief Number of samples discarded for being duplicates of samples already received.
+     *
+     * @return map with the number of discarded samples indexed by topic name
+     */
+    DDSROUTER_CORE_DllAPI std::map<std::string, uint64_t> duplicated_samples() const;
+
+    /**
+     * @brief Statistics of the participants (paths) of every redundancy group.
+     *
+     * @return map with the statistics of each path indexed by participant id
+     */
+    DDSROUTER_CORE_DllAPI std::map<ddspipe::core::types::ParticipantId,
+            types::RedundancyPathStatistics> redundancy_statistics() const;
+
+    /**
+     * @brief Statistics of the links of every link group.
+     *
+     * @return map with the statistics of each link indexed by participant id
+     */
+    DDSROUTER_CORE_DllAPI std::map<ddspipe::core::types::ParticipantId,
+            types::LinkStatistics> link_statistics() const;
+
 protected:
 
     /**
@@ -111,12 +168,22 @@ protected:
      */
     void init_participants_();
 
+    /**
+     * @brief Start tracking the topics with local readers and announcing them to remote DDS Routers
+     *
+     * @throw \c InitializationException in case the interest port cannot be bound.
+     */
+    void init_local_interest_();
+
+    //! Record the endpoints discovered, updated and removed in the \c FlightRecorder
+    void init_discovery_recording_();
+
 
     DdsRouterConfiguration configuration_;
 
     std::shared_ptr<ddspipe::core::DiscoveryDatabase> discovery_database_;
 
-    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+    std::shared_ptr<CountingPayloadPool> payload_pool_;
 
     std::shared_ptr<ddspipe::core::ParticipantsDatabase> participants_database_;
 
@@ -126,7 +193,38 @@ protected:
 
     std::unique_ptr<ddspipe::core::DdsPipe> ddspipe_;
 
+    //! Traffic counters of every topic in every participant
+    std::shared_ptr<MetricsRegistry> metrics_;
+
+    //! Participants of the router, wrapping the ones created by the \c ParticipantFactory
+    std::vector<std::shared_ptr<RouterParticipant>> router_participants_;
+
+    //! Counters of the participants that belong to a redundancy group, indexed by participant id
+    std::map<ddspipe::core::types::ParticipantId, std::shared_ptr<RedundancyPathCounters>> redundancy_paths_;
+
+    //! Selectors of the link groups, indexed by the id of each participant of the group
+    std::map<ddspipe::core::types::ParticipantId, std::shared_ptr<LinkSelector>> link_selectors_;
+
+    //! Responder of the probes of the link groups of remote DDS Routers (nullptr if disabled)
+    std::unique_ptr<LinkProbeResponder> link_probe_responder_;
+
+    //! Topics with local readers (nullptr if not announced)
+    std::shared_ptr<LocalInterest> local_interest_;
+
+    //! Publisher of \c local_interest_ to remote DDS Routers (nullptr if disabled)
+    std::unique_ptr<InterestPublisher> interest_publisher_;
+
+    //! Interest of the remote DDS Routers, indexed by the id of the participant that forwards data to each of them
+    std::map<ddspipe::core::types::ParticipantId, std::shared_ptr<InterestSubscriber>> remote_interests_;
+
     ParticipantFactory participant_factory_;
+
+    /**
+     * @brief Publisher of the statistics in a DDS topic (nullptr if disabled).
+     *
+     * @note It must be the last attribute, so it stops taking statistics before the rest of attributes are destroyed.
+     */
+    std::unique_ptr<StatisticsPublisher> statistics_publisher_;
 };
 
 } /* namespace core */
@@ -0,0 +1,87 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <ddspipe_core/types/dds/Guid.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Message of the protocol used by DDS Routers to tell each other the topics with readers behind them.
+ *
+ * A DDS Router sends \c request messages to a remote one, which answers with \c interest messages containing the
+ * topics with live readers behind it. Interest messages are also sent every time these topics change.
+ * Requests carry the GUID prefixes of the participants of the requesting DDS Router, so the remote one does not
+ * announce back the readers of the requesting DDS Router itself (see \c LocalInterest ).
+ */
+struct InterestMessage
+{
+    //! Kind of message
+    enum class Kind : uint8_t
+    {
+        request = 1,
+        interest = 2,
+    };
+
+    //! Value identifying the messages of this protocol
+    static constexpr uint32_t MAGIC = 0x4452494E;
+
+    //! Maximum size of a serialized message (so it fits in a UDP datagram)
+    static constexpr std::size_t MAX_SIZE = 65000;
+
+    /**
+     * @brief Serialize the message.
+     *
+     * If the topics do not fit in \c MAX_SIZE , the message is serialized with \c all_topics set instead.
+     */
+    DDSROUTER_CORE_DllAPI std::vector<uint8_t> serialize() const;
+
+    /**
+     * @brief Deserialize a message.
+     *
+     * @return whether \c data contains a valid message
+     */
+    DDSROUTER_CORE_DllAPI static bool deserialize(
+            const uint8_t* data,
+            const std::size_t size,
+            InterestMessage& message);
+
+    //! Kind of message
+    Kind kind {Kind::request};
+
+    //! Whether every topic is of interest (\c topics is ignored)
+    bool all_topics {false};
+
+    //! Names of the topics of interest
+    std::set<std::string> topics {};
+
+    //! GUID prefixes of the participants of the DDS Router that sends a request
+    std::set<ddspipe::core::types::GuidPrefix> participants {};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,115 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <ddsrouter_core/interest/LocalInterest.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/link/UdpSocket.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Announces the \c LocalInterest of the DDS Router to the \c InterestSubscriber of remote DDS Routers.
+ *
+ * Every request received is answered with the current local interest, and its sender is subscribed to the changes
+ * of the local interest for some time (so it must keep sending requests periodically).
+ * The interest sent to each subscriber excludes the readers of the participants listed in its requests.
+ * The protocol is not authenticated, so the requests can be restricted to a set of peers.
+ */
+class InterestPublisher
+{
+public:
+
+    /**
+     * @brief Construct a new InterestPublisher object and start answering requests.
+     *
+     * @param [in] port : UDP port where the requests are received
+     * @param [in] local_interest : interest to announce
+     * @param [in] peers : IPv4 addresses whose requests are answered. Empty means any.
+     *
+     * @throw \c InitializationException if the port cannot be bound
+     */
+    DDSROUTER_CORE_DllAPI InterestPublisher(
+            const uint16_t port,
+            const std::shared_ptr<LocalInterest>& local_interest,
+            const std::set<std::string>& peers = {});
+
+    //! Stop answering requests
+    DDSROUTER_CORE_DllAPI ~InterestPublisher();
+
+    //! Port where the requests are received
+    DDSROUTER_CORE_DllAPI uint16_t port() const noexcept;
+
+protected:
+
+    //! Address of a subscriber (IPv4 address and port)
+    using Address = std::pair<std::string, uint16_t>;
+
+    //! Internal thread routine
+    void run_() noexcept;
+
+    //! Subscriber of the local interest
+    struct Subscriber
+    {
+        //! Time of its last request
+        int64_t last_request;
+
+        //! GUID prefixes of its participants
+        std::set<ddspipe::core::types::GuidPrefix> participants;
+    };
+
+    //! Send the current local interest to a subscriber
+    void send_interest_(
+            const Address& address,
+            const Subscriber& subscriber) noexcept;
+
+    //! Socket where the requests are received
+    UdpSocket socket_;
+
+    //! Interest to announce
+    std::shared_ptr<LocalInterest> local_interest_;
+
+    //! IPv4 addresses whose requests are answered (empty means any)
+    const std::set<std::string> peers_;
+
+    //! Subscribers of the local interest (only accessed from the internal thread)
+    std::map<Address, Subscriber> subscribers_;
+
+    //! Buffer to receive requests (only accessed from the internal thread)
+    std::vector<uint8_t> buffer_;
+
+    //! Whether the internal thread must stop
+    std::atomic<bool> stop_ {false};
+
+    //! Internal thread
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,152 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/types/dds/Guid.hpp>
+
+#include <ddsrouter_core/configuration/InterestConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/link/UdpSocket.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Keeps track of the interest of a remote DDS Router, announced by its \c InterestPublisher .
+ *
+ * Requests are sent periodically to the remote DDS Router from an internal thread, and its answers and updates
+ * are applied to the interest flag of each topic, so writers can check them without locking.
+ * Only the datagrams sent from the address of the remote DDS Router are accepted.
+ *
+ * While the remote DDS Router does not answer (e.g. it has not started yet or the connection is lost), every topic
+ * is of interest, so the data is forwarded as if this mechanism was disabled.
+ */
+class InterestSubscriber
+{
+public:
+
+    //! Time between two requests
+    static constexpr utils::Duration_ms REQUEST_PERIOD = 500;
+
+    //! Time without answers to consider the remote interest unknown
+    static constexpr utils::Duration_ms LEASE_DURATION = 3 * REQUEST_PERIOD;
+
+    /**
+     * @brief Construct a new InterestSubscriber object and start sending requests.
+     *
+     * @param [in] configuration : address of the remote DDS Router
+     *
+     * @throw \c InitializationException if the socket cannot be created
+     */
+    DDSROUTER_CORE_DllAPI InterestSubscriber(
+            const InterestConfiguration& configuration);
+
+    //! Stop sending requests
+    DDSROUTER_CORE_DllAPI ~InterestSubscriber();
+
+    /**
+     * @brief Flag that tells whether the remote DDS Router is interested in a topic.
+     *
+     * The flag is updated every time the remote interest changes.
+     */
+    DDSROUTER_CORE_DllAPI std::shared_ptr<const std::atomic<bool>> interest_flag(
+            const std::string& topic_name);
+
+    //! Whether the remote DDS Router has announced its interest recently
+    DDSROUTER_CORE_DllAPI bool is_known() const noexcept;
+
+    //! Topics of interest of the remote DDS Router (meaningless if \c is_known is false)
+    DDSROUTER_CORE_DllAPI std::set<std::string> topics() const;
+
+    //! Number that increases every time \c is_known or \c topics change
+    DDSROUTER_CORE_DllAPI uint64_t version() const noexcept;
+
+    /**
+     * @brief Register the GUID prefix of the local participant connected to the remote DDS Router.
+     *
+     * It is sent in the requests, so the remote DDS Router does not take the readers of this participant as
+     * interest to announce back.
+     */
+    DDSROUTER_CORE_DllAPI void add_participant(
+            const ddspipe::core::types::GuidPrefix& prefix);
+
+protected:
+
+    //! Internal thread routine
+    void run_() noexcept;
+
+    //! Receive the messages of the remote DDS Router until \c deadline
+    void receive_interest_(
+            const int64_t deadline) noexcept;
+
+    //! Update the remote interest and the flags of every topic
+    void update_interest_(
+            const bool known,
+            const std::set<std::string>& topics);
+
+    //! Address of the remote DDS Router
+    const InterestConfiguration configuration_;
+
+    //! Socket to send requests and receive the interest
+    UdpSocket socket_;
+
+    //! Whether the remote interest is known
+    std::atomic<bool> known_ {false};
+
+    //! Time of the last message of the remote DDS Router (only accessed from the internal thread)
+    int64_t last_interest_ {0};
+
+    //! Topics of interest of the remote DDS Router
+    std::set<std::string> topics_;
+
+    //! Interest flag of each topic
+    std::map<std::string, std::shared_ptr<std::atomic<bool>>> flags_;
+
+    //! Number that increases every time the remote interest changes
+    std::atomic<uint64_t> version_ {0};
+
+    //! GUID prefixes of the local participants connected to the remote DDS Router
+    std::set<ddspipe::core::types::GuidPrefix> participants_;
+
+    //! Buffer to receive messages (only accessed from the internal thread)
+    std::vector<uint8_t> buffer_;
+
+    //! Mutex to protect \c topics_ , \c flags_ and \c participants_
+    mutable std::mutex mutex_;
+
+    //! Whether the internal thread must stop
+    std::atomic<bool> stop_ {false};
+
+    //! Internal thread
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
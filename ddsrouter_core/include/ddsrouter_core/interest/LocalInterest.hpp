@@ -0,0 +1,126 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/interest/InterestSubscriber.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Keeps track of the topics with live readers behind the DDS Router, so they can be announced to remote DDS Routers
+ * (see \c InterestPublisher ).
+ *
+ * It is fed with the endpoints of the \c DiscoveryDatabase .
+ * The readers discovered by router links (participants connected to other DDS Routers) are interest too, so the
+ * data keeps flowing through several hops, but the interest announced to a remote DDS Router never includes its
+ * own readers, nor the interest announced by itself.
+ * If a router link knows the interest of the DDS Router at the other side (see \c InterestSubscriber ), that
+ * interest is used instead of the readers it discovers, as that DDS Router has readers in every topic it forwards.
+ *
+ * @warning The interest announced by a DDS Router to another may come back through a third one, so the interest
+ * of the topics without readers is only withdrawn in topologies without loops of DDS Routers.
+ */
+class LocalInterest
+{
+public:
+
+    /**
+     * @brief Construct a new LocalInterest object
+     *
+     * @param [in] router_links : participants connected to other DDS Routers
+     * @param [in] remote_interests : interest of the DDS Routers at the other side of some router links
+     */
+    DDSROUTER_CORE_DllAPI LocalInterest(
+            const std::set<ddspipe::core::types::ParticipantId>& router_links,
+            const std::map<ddspipe::core::types::ParticipantId, std::shared_ptr<InterestSubscriber>>&
+            remote_interests = {});
+
+    //! Add or update an endpoint discovered (ignored if it is not a reader)
+    DDSROUTER_CORE_DllAPI void update_endpoint(
+            const ddspipe::core::types::Endpoint& endpoint);
+
+    //! Remove an endpoint (ignored if it is not a reader)
+    DDSROUTER_CORE_DllAPI void erase_endpoint(
+            const ddspipe::core::types::Endpoint& endpoint);
+
+    /**
+     * @brief Names of the topics of interest for a remote DDS Router.
+     *
+     * @param [in] requester : GUID prefixes of the participants of the remote DDS Router.
+     *                         Its readers, and the interest announced by the router links that discover them,
+     *                         are excluded.
+     */
+    DDSROUTER_CORE_DllAPI std::set<std::string> topics(
+            const std::set<ddspipe::core::types::GuidPrefix>& requester = {}) const;
+
+    //! Number that increases every time \c topics may change
+    DDSROUTER_CORE_DllAPI uint64_t version() const noexcept;
+
+protected:
+
+    //! Live reader discovered
+    struct Reader
+    {
+        //! Participant that discovered the reader
+        ddspipe::core::types::ParticipantId participant;
+
+        //! Topic of the reader
+        std::string topic_name;
+    };
+
+    //! Set whether a reader is alive
+    void update_reader_(
+            const ddspipe::core::types::Endpoint& endpoint,
+            const bool alive);
+
+    //! Whether the interest of the DDS Router at the other side of a participant is known
+    bool is_remote_interest_known_(
+            const ddspipe::core::types::ParticipantId& participant) const;
+
+    //! Participants connected to other DDS Routers
+    const std::set<ddspipe::core::types::ParticipantId> router_links_;
+
+    //! Interest of the DDS Routers at the other side of some router links
+    const std::map<ddspipe::core::types::ParticipantId, std::shared_ptr<InterestSubscriber>> remote_interests_;
+
+    //! Every live reader
+    std::map<ddspipe::core::types::Guid, Reader> readers_;
+
+    //! Number that increases every time \c readers_ changes
+    std::atomic<uint64_t> version_ {0};
+
+    //! Mutex to protect \c readers_
+    mutable std::mutex mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
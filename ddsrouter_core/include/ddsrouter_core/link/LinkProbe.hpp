@@ -0,0 +1,52 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Datagram sent by a \c LinkSelector and echoed back by the \c LinkProbeResponder of the remote DDS Router.
+ *
+ * It is only interpreted by the DDS Router that sends it, so it does not need any byte order conversion.
+ */
+struct LinkProbe
+{
+    //! Value of \c magic in every probe ("DRLP")
+    static constexpr uint32_t MAGIC = 0x44524C50;
+
+    //! Whether this is a probe
+    bool is_valid() const noexcept
+    {
+        return magic == MAGIC;
+    }
+
+    //! Identifies the datagram as a probe
+    uint32_t magic {MAGIC};
+
+    //! Index of the link the probe has been sent through
+    uint32_t link_index {0};
+
+    //! Steady clock time (ns) when the probe was sent
+    int64_t timestamp {0};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,82 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/link/UdpSocket.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Answers the probes sent by the \c LinkSelector of remote DDS Routers, echoing them back from an internal thread.
+ *
+ * Only datagrams with the size and the magic of a \c LinkProbe are answered, so the port cannot be used to reflect
+ * arbitrary traffic. The probes are not authenticated, so they can be restricted to a set of peers.
+ */
+class LinkProbeResponder
+{
+public:
+
+    /**
+     * @brief Construct a new LinkProbeResponder object and start answering probes.
+     *
+     * @param [in] port : UDP port where the probes are received
+     * @param [in] peers : IPv4 addresses whose probes are answered. Empty means any.
+     *
+     * @throw \c InitializationException if the port cannot be bound
+     */
+    DDSROUTER_CORE_DllAPI LinkProbeResponder(
+            const uint16_t port,
+            const std::set<std::string>& peers = {});
+
+    //! Stop answering probes
+    DDSROUTER_CORE_DllAPI ~LinkProbeResponder();
+
+    //! Port where the probes are received
+    DDSROUTER_CORE_DllAPI uint16_t port() const noexcept;
+
+protected:
+
+    //! Internal thread routine
+    void run_() noexcept;
+
+    //! Read every datagram waiting in the socket and answer the valid probes
+    void answer_probes_() noexcept;
+
+    //! Socket where the probes are received
+    UdpSocket socket_;
+
+    //! IPv4 addresses whose probes are answered (empty means any)
+    const std::set<std::string> peers_;
+
+    //! Whether the internal thread must stop
+    std::atomic<bool> stop_ {false};
+
+    //! Internal thread
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
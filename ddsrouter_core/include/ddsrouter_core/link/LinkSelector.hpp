@@ -0,0 +1,133 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/configuration/LinkGroupConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/link/UdpSocket.hpp>
+#include <ddsrouter_core/types/LinkStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Selects the link of a link group with the lowest round trip time.
+ *
+ * An internal thread sends a probe through each link every probe period to the \c LinkProbeResponder of the remote
+ * DDS Router, and measures the round trip time of the answers.
+ * A link is down if it has not answered within the detection time.
+ * The active link only changes if it goes down, or if another link improves its round trip time by more than the
+ * hysteresis.
+ * If every link is down, every link is active, so no data is lost while the links recover.
+ *
+ * Checking the active link is lock free, so it can be done in the data path.
+ */
+class LinkSelector
+{
+public:
+
+    //! Value of the active link when every link is active
+    static constexpr int ALL_LINKS = -1;
+
+    /**
+     * @brief Construct a new LinkSelector object and start probing the links.
+     *
+     * @throw \c InitializationException if the probe socket cannot be created
+     */
+    DDSROUTER_CORE_DllAPI LinkSelector(
+            const LinkGroupConfiguration& configuration);
+
+    //! Stop probing the links
+    DDSROUTER_CORE_DllAPI ~LinkSelector();
+
+    //! Index of the link of \c participant_id in the group, or -1 if it does not belong to it
+    DDSROUTER_CORE_DllAPI int link_index(
+            const ddspipe::core::types::ParticipantId& participant_id) const noexcept;
+
+    //! Whether the data must be sent through link \c link_index
+    DDSROUTER_CORE_DllAPI bool is_active(
+            const int link_index) const noexcept;
+
+    //! Statistics of each link, indexed by participant id
+    DDSROUTER_CORE_DllAPI std::map<ddspipe::core::types::ParticipantId, types::LinkStatistics> statistics() const;
+
+protected:
+
+    //! State of a link
+    struct Link
+    {
+        LinkConfiguration configuration;
+
+        //! Smoothed round trip time in nanoseconds (0 = unknown)
+        std::atomic<int64_t> round_trip_time {0};
+
+        //! Steady clock time (ns) of the last answer
+        std::atomic<int64_t> last_answer {0};
+
+        std::atomic<bool> alive {false};
+
+        std::atomic<uint64_t> probes_sent {0};
+
+        std::atomic<uint64_t> probes_received {0};
+
+        std::atomic<uint64_t> activations {0};
+    };
+
+    //! Internal thread routine
+    void run_() noexcept;
+
+    //! Send a probe through every link
+    void send_probes_() noexcept;
+
+    //! Process the answers to the probes until \c deadline (steady clock ns)
+    void receive_answers_(
+            const int64_t deadline) noexcept;
+
+    //! Update the state of the links and select the active one
+    void select_link_() noexcept;
+
+    //! Configuration of the group
+    const LinkGroupConfiguration configuration_;
+
+    //! Links of the group, in the same order as in the configuration
+    std::vector<std::unique_ptr<Link>> links_;
+
+    //! Index of the active link (or \c ALL_LINKS )
+    std::atomic<int> active_link_ {ALL_LINKS};
+
+    //! Socket used to send the probes and receive the answers
+    UdpSocket socket_;
+
+    //! Whether the internal thread must stop
+    std::atomic<bool> stop_ {false};
+
+    //! Internal thread
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,122 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Minimal IPv4 UDP socket used by the control protocols between DDS Routers (link probes and interest).
+ *
+ * It hides the differences between POSIX and Windows sockets.
+ */
+class UdpSocket
+{
+public:
+
+    /**
+     * @brief Open a new UDP socket.
+     *
+     * @throw \c InitializationException if the socket cannot be created
+     */
+    DDSROUTER_CORE_DllAPI UdpSocket();
+
+    //! Close the socket
+    DDSROUTER_CORE_DllAPI ~UdpSocket();
+
+    UdpSocket(
+            const UdpSocket&) = delete;
+
+    UdpSocket& operator =(
+            const UdpSocket&) = delete;
+
+    /**
+     * @brief Bind the socket to \c port in every interface.
+     *
+     * @throw \c InitializationException if the port cannot be bound
+     */
+    DDSROUTER_CORE_DllAPI void bind(
+            const uint16_t port);
+
+    //! Port the socket is bound to (0 if not bound)
+    DDSROUTER_CORE_DllAPI uint16_t port() const noexcept;
+
+    //! Wait until there is a datagram to read or \c timeout expires
+    DDSROUTER_CORE_DllAPI bool wait_readable(
+            const utils::Duration_ms timeout) const noexcept;
+
+    /**
+     * @brief Send a datagram.
+     *
+     * @param [in] ip : IPv4 address of the destination in dotted notation
+     * @param [in] port : port of the destination
+     *
+     * @return whether the datagram has been sent
+     */
+    DDSROUTER_CORE_DllAPI bool send_to(
+            const void* data,
+            const std::size_t size,
+            const std::string& ip,
+            const uint16_t port) noexcept;
+
+    /**
+     * @brief Read a datagram, if any.
+     *
+     * @return size of the datagram read, or -1 if none
+     */
+    DDSROUTER_CORE_DllAPI int receive(
+            void* buffer,
+            const std::size_t size) noexcept;
+
+    /**
+     * @brief Read a datagram, if any, and get the address of its sender.
+     *
+     * @param [out] ip : IPv4 address of the sender in dotted notation
+     * @param [out] port : port of the sender
+     *
+     * @return size of the datagram read, or -1 if none
+     */
+    DDSROUTER_CORE_DllAPI int receive_from(
+            void* buffer,
+            const std::size_t size,
+            std::string& ip,
+            uint16_t& port) noexcept;
+
+    //! Whether \c ip is a valid IPv4 address in dotted notation
+    DDSROUTER_CORE_DllAPI static bool is_valid_ip(
+            const std::string& ip) noexcept;
+
+protected:
+
+    //! Native socket handle
+    intptr_t socket_;
+
+    //! Port the socket is bound to
+    uint16_t port_ {0};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,62 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/metrics/ShardedCounter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * \c FastPayloadPool that counts the payloads it has given and not released yet.
+ */
+class CountingPayloadPool : public ddspipe::core::FastPayloadPool
+{
+public:
+
+    DDSROUTER_CORE_DllAPI bool get_payload(
+            uint32_t size,
+            ddspipe::core::types::Payload& target_payload) override;
+
+    DDSROUTER_CORE_DllAPI bool get_payload(
+            const ddspipe::core::types::Payload& src_payload,
+            ddspipe::core::PayloadPool*& data_owner,
+            ddspipe::core::types::Payload& target_payload) override;
+
+    DDSROUTER_CORE_DllAPI bool release_payload(
+            ddspipe::core::types::Payload& target_payload) override;
+
+    //! Payloads given and not released yet
+    DDSROUTER_CORE_DllAPI uint64_t payloads_in_use() const noexcept;
+
+protected:
+
+    //! Payloads given
+    ShardedCounter acquired_payloads_ {};
+
+    //! Payloads released
+    ShardedCounter released_payloads_ {};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,93 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Time at which the sample being forwarded by the current thread entered the DDS Router.
+ *
+ * The DDS Pipe takes each sample from a reader and writes it in every writer from the same thread,
+ * so the \c RouterReader stores the stamp of the sample it returns and the \c RouterWriter s get it back when
+ * writing, without any allocation or synchronization.
+ * The stamp is bound to the address of the sample, so it is never applied to a different one.
+ */
+struct IngressStamp
+{
+    //! Participant index of the sources without index
+    static constexpr uint32_t UNKNOWN_SOURCE_INDEX = 0xFFFFFFFF;
+
+    //! Store \c stamp as the stamp of the sample being forwarded by the current thread
+    DDSROUTER_CORE_DllAPI static void set(
+            const IngressStamp& stamp) noexcept;
+
+    //! Stamp of \c data if it is the sample being forwarded by the current thread, nullptr otherwise
+    DDSROUTER_CORE_DllAPI static const IngressStamp* get(
+            const ddspipe::core::IRoutingData& data) noexcept;
+
+    //! Stamp of the sample being forwarded by the current thread, nullptr if there is none
+    DDSROUTER_CORE_DllAPI static const IngressStamp* current() noexcept;
+
+    //! Forget the stamp of the current thread, before taking the next sample
+    DDSROUTER_CORE_DllAPI static void reset() noexcept;
+
+    //! Sample the stamp belongs to
+    const ddspipe::core::IRoutingData* data {nullptr};
+
+    //! Participant that received the sample (owned by its \c RouterReader )
+    const ddspipe::core::types::ParticipantId* source {nullptr};
+
+    //! Index of \c source in the \c MetricsRegistry (see \c MetricsRegistry::participant_index )
+    uint32_t source_index {UNKNOWN_SOURCE_INDEX};
+
+    //! Steady clock time (ns) of the reception of the sample
+    int64_t time_ns {0};
+
+    //! Source timestamp (ns since epoch) of the sample (0 if it has none)
+    int64_t source_timestamp_ns {0};
+
+    //! GUID of the writer that originally published the sample
+    ddspipe::core::types::Guid origin_writer_guid {};
+
+    //! Sequence number of the sample in its original writer (0 if it is unknown)
+    uint64_t origin_sequence_number {0};
+
+    //! Whether the origin has been received from another DDS Router, so it is sent along with the sample
+    bool origin_stamped {false};
+
+    //! Id of the sample in the trace (0 if it is not traced, see \c Tracer )
+    uint64_t trace_sample {0};
+
+    //! Label of the topic of the sample in the trace (see \c Tracer::label )
+    uint32_t trace_topic {0};
+
+    //! Label of the participant that received the sample in the trace (see \c Tracer::label )
+    uint32_t trace_participant {0};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,104 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Minimal HTTP/1.1 server that exposes metrics to be scraped (e.g. by Prometheus).
+ *
+ * It answers \c GET requests to \c /metrics with the text returned by the content callback, and any other request
+ * with an error. Requests are served one by one in an internal thread, so the content callback is never called
+ * concurrently and never from the threads that forward the data.
+ */
+class MetricsHttpServer
+{
+public:
+
+    //! Callback that returns the body of the \c /metrics response
+    using ContentCallback = std::function<std::string()>;
+
+    //! Path where the metrics are served
+    static constexpr const char* METRICS_PATH = "/metrics";
+
+    //! Maximum size of a request (bigger requests are rejected)
+    static constexpr std::size_t MAX_REQUEST_SIZE = 8192;
+
+    //! Maximum time (in milliseconds) to receive a request
+    static constexpr int REQUEST_TIMEOUT = 1000;
+
+    /**
+     * @brief Construct a new MetricsHttpServer object and start serving the metrics.
+     *
+     * @param [in] port : TCP port where the server listens in every interface (0 to choose any free port)
+     * @param [in] content : callback that returns the metrics in the Prometheus text format
+     *
+     * @throw \c InitializationException if the port cannot be bound
+     */
+    DDSROUTER_CORE_DllAPI MetricsHttpServer(
+            const uint16_t port,
+            ContentCallback content);
+
+    //! Stop serving the metrics
+    DDSROUTER_CORE_DllAPI ~MetricsHttpServer();
+
+    MetricsHttpServer(
+            const MetricsHttpServer&) = delete;
+
+    MetricsHttpServer& operator =(
+            const MetricsHttpServer&) = delete;
+
+    //! Port where the server listens
+    DDSROUTER_CORE_DllAPI uint16_t port() const noexcept;
+
+protected:
+
+    //! Internal thread routine
+    void run_() noexcept;
+
+    //! Read a request from a connection and answer it
+    void serve_(
+            intptr_t connection) noexcept;
+
+    //! Native listening socket (stored as an integer to avoid exposing platform headers)
+    intptr_t socket_;
+
+    //! Port where the server listens
+    uint16_t port_ {0};
+
+    //! Callback that returns the metrics
+    ContentCallback content_;
+
+    //! Whether the internal thread must stop
+    std::atomic<bool> stop_ {false};
+
+    //! Internal thread
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,134 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participant/RouterReader.hpp>
+#include <ddsrouter_core/participant/RouterWriter.hpp>
+#include <ddsrouter_core/types/DdsRouterStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Registry of the traffic counters of every topic in every participant of a DDS Router.
+ *
+ * Counters are created the first time an endpoint of a topic is created in a participant, and kept afterwards,
+ * so the traffic of a topic is not lost when its endpoints are removed.
+ */
+class MetricsRegistry
+{
+public:
+
+    /**
+     * @brief Construct a new MetricsRegistry object
+     *
+     * @param [in] source_latency : whether the writers account the latency from the source timestamp of the samples
+     * @param [in] route_latency : whether the writers account the latency of the routes
+     */
+    DDSROUTER_CORE_DllAPI MetricsRegistry(
+            const bool source_latency = false,
+            const bool route_latency = true);
+
+    //! Whether the writers account the latency from the source timestamp of the samples
+    DDSROUTER_CORE_DllAPI bool source_latency() const noexcept;
+
+    //! Flag of whether the writers account the latency of the routes, shared with every writer
+    DDSROUTER_CORE_DllAPI std::shared_ptr<const std::atomic<bool>> route_latency() const noexcept;
+
+    //! Enable or disable the accounting of the latency of the routes in every writer
+    DDSROUTER_CORE_DllAPI void set_route_latency(
+            const bool enabled) noexcept;
+
+    /**
+     * @brief Index of \c participant_id , assigned the first time in consecutive order from 0.
+     *
+     * Samples carry the index of the participant they are received from, so the writers find the latencies of
+     * their route without locking (see \c RouteLatencies ).
+     */
+    DDSROUTER_CORE_DllAPI uint32_t participant_index(
+            const ddspipe::core::types::ParticipantId& participant_id);
+
+    //! Counters of the readers of \c topic_name in \c participant_id
+    DDSROUTER_CORE_DllAPI std::shared_ptr<RouterReaderCounters> reader_counters(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const std::string& topic_name);
+
+    //! Counters of the writers of \c topic_name in \c participant_id
+    DDSROUTER_CORE_DllAPI std::shared_ptr<RouterWriterCounters> writer_counters(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const std::string& topic_name);
+
+    /**
+     * @brief Register a reader of \c topic_name in \c participant_id , so its unread samples are accounted.
+     *
+     * The registry does not take the ownership of the reader.
+     */
+    DDSROUTER_CORE_DllAPI void register_reader(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const std::string& topic_name,
+            const std::shared_ptr<ddspipe::core::IReader>& reader);
+
+    //! Traffic of each topic in each participant, indexed by topic name and participant id
+    DDSROUTER_CORE_DllAPI std::map<std::string, std::map<ddspipe::core::types::ParticipantId,
+            types::TrafficStatistics>> traffic() const;
+
+    //! Latencies of each route of each topic, indexed by topic name and route
+    DDSROUTER_CORE_DllAPI std::map<std::string, std::map<types::Route,
+            types::RouteLatencyStatistics>> latencies() const;
+
+protected:
+
+    //! Counters and readers of a topic in a participant
+    struct Entry
+    {
+        std::shared_ptr<RouterReaderCounters> reader_counters;
+        std::shared_ptr<RouterWriterCounters> writer_counters;
+        std::vector<std::weak_ptr<ddspipe::core::IReader>> readers;
+    };
+
+    //! Whether the writers account the latency from the source timestamp of the samples
+    const bool source_latency_;
+
+    //! Whether the writers account the latency of the routes
+    const std::shared_ptr<std::atomic<bool>> route_latency_;
+
+    //! Indexes of the participants
+    std::map<ddspipe::core::types::ParticipantId, uint32_t> participant_indexes_;
+
+    //! Entries indexed by topic name and participant id
+    std::map<std::pair<std::string, ddspipe::core::types::ParticipantId>, Entry> entries_;
+
+    //! Mutex to protect \c entries_ and \c participant_indexes_
+    mutable std::mutex mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
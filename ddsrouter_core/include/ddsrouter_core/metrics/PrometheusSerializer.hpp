@@ -0,0 +1,38 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <string>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/DdsRouterStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * @brief Serialize the statistics of a DDS Router in the Prometheus text exposition format (version 0.0.4).
+ *
+ * Traffic metrics are labeled with \c topic and \c participant , drops also with \c reason ,
+ * and redundancy and link group metrics with \c participant .
+ */
+DDSROUTER_CORE_DllAPI std::string to_prometheus_text(
+        const types::DdsRouterStatistics& statistics);
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
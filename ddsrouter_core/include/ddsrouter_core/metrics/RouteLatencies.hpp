@@ -0,0 +1,106 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Latencies of the samples of a topic forwarded from one participant to another (a route).
+ */
+struct RouteLatency
+{
+    //! Construct a new RouteLatency, with the source latency only if it is accounted
+    DDSROUTER_CORE_DllAPI explicit RouteLatency(
+            const bool source_latency);
+
+    //! Time (ns) from the reception of the samples in the DDS Router until they are written
+    types::LatencyHistogram router {};
+
+    //! Time (ns) from the source timestamp of the samples until they are written (nullptr if not accounted)
+    const std::unique_ptr<types::LatencyHistogram> source;
+};
+
+/**
+ * Latencies of the samples written in a topic of a participant, indexed by the participant they are received from.
+ *
+ * The latencies of a route are created with its first sample, so only the routes actually used take memory.
+ * The latencies of the first \c CACHED_SOURCES participant indexes (see \c MetricsRegistry::participant_index )
+ * are cached once created, so the data path gets them without locking.
+ * Latencies are never erased, so the cached pointers are valid as long as this object.
+ */
+class RouteLatencies
+{
+public:
+
+    //! Number of source participant indexes whose latencies are got without locking
+    static constexpr uint32_t CACHED_SOURCES = 32;
+
+    /**
+     * @brief Construct a new RouteLatencies object
+     *
+     * @param [in] source_latency : whether the latency from the source timestamp of the samples is accounted
+     */
+    DDSROUTER_CORE_DllAPI explicit RouteLatencies(
+            const bool source_latency = false);
+
+    //! Latencies of the samples received from \c source (created the first time)
+    DDSROUTER_CORE_DllAPI std::shared_ptr<RouteLatency> get(
+            const ddspipe::core::types::ParticipantId& source);
+
+    /**
+     * @brief Latencies of the samples received from \c source , whose participant index is \c source_index .
+     *
+     * Once created, it is got without locking if \c source_index is lower than \c CACHED_SOURCES .
+     */
+    DDSROUTER_CORE_DllAPI RouteLatency* get(
+            const ddspipe::core::types::ParticipantId& source,
+            const uint32_t source_index);
+
+    //! Latencies of the samples received from each participant, indexed by participant id
+    DDSROUTER_CORE_DllAPI std::map<ddspipe::core::types::ParticipantId, std::shared_ptr<RouteLatency>> all() const;
+
+protected:
+
+    //! Whether the latency from the source timestamp of the samples is accounted
+    const bool source_latency_;
+
+    //! Latencies indexed by the participant the samples are received from
+    std::map<ddspipe::core::types::ParticipantId, std::shared_ptr<RouteLatency>> latencies_;
+
+    //! Mutex to protect \c latencies_
+    mutable std::mutex mutex_;
+
+    //! Latencies indexed by the participant index of the source (nullptr until created)
+    std::array<std::atomic<RouteLatency*>, CACHED_SOURCES> cached_ {};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,73 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Counter split in several shards, so threads incrementing it concurrently do not contend on the same cache line.
+ *
+ * Each thread is assigned a shard the first time it uses any counter, so as long as there are fewer threads than
+ * shards, every shard is only written by a single thread. Reading the value sums every shard, so it is much more
+ * expensive than incrementing it.
+ */
+class ShardedCounter
+{
+public:
+
+    //! Number of shards of every counter
+    static constexpr std::size_t SHARDS = 16;
+
+    //! Add \c value to the counter
+    void add(
+            const uint64_t value = 1) noexcept
+    {
+        shards_[shard_index_()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    //! Current value of the counter
+    DDSROUTER_CORE_DllAPI uint64_t value() const noexcept;
+
+    //! Set the counter to 0 (not synchronized with concurrent increments)
+    DDSROUTER_CORE_DllAPI void reset() noexcept;
+
+protected:
+
+    //! Shard of the calling thread
+    DDSROUTER_CORE_DllAPI static std::size_t shard_index_() noexcept;
+
+    //! Shard aligned to its own cache line
+    struct alignas(64) Shard
+    {
+        std::atomic<uint64_t> value {0};
+    };
+
+    //! Shards of the counter
+    std::array<Shard, SHARDS> shards_ {};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,96 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include <fastdds/dds/topic/TopicDataType.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Sample of the statistics topic of the DDS Router.
+ *
+ * It corresponds to the following IDL:
+ *
+ * @code
+ * module ddsrouter
+ * {
+ *     struct Statistics
+ *     {
+ *         unsigned long long timestamp;
+ *         string metrics;
+ *     };
+ * };
+ * @endcode
+ */
+struct StatisticsSample
+{
+    //! Time of the snapshot, in nanoseconds since epoch
+    uint64_t timestamp {0};
+
+    //! Statistics in Prometheus text format (see \c to_prometheus_text )
+    std::string metrics {};
+};
+
+/**
+ * Type support of \c StatisticsSample , so it can be published by a Fast DDS DataWriter.
+ */
+class StatisticsPubSubType : public fastdds::dds::TopicDataType
+{
+public:
+
+    //! Name of the type, as published in discovery
+    static constexpr const char* TYPE_NAME = "ddsrouter::Statistics";
+
+    DDSROUTER_CORE_DllAPI StatisticsPubSubType();
+
+    DDSROUTER_CORE_DllAPI bool serialize(
+            void* data,
+            fastrtps::rtps::SerializedPayload_t* payload) override;
+
+    DDSROUTER_CORE_DllAPI bool deserialize(
+            fastrtps::rtps::SerializedPayload_t* payload,
+            void* data) override;
+
+    DDSROUTER_CORE_DllAPI std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override;
+
+    //! The type has no key
+    DDSROUTER_CORE_DllAPI bool getKey(
+            void* data,
+            fastrtps::rtps::InstanceHandle_t* handle,
+            bool force_md5 = false) override;
+
+    DDSROUTER_CORE_DllAPI void* createData() override;
+
+    DDSROUTER_CORE_DllAPI void deleteData(
+            void* data) override;
+
+    //! Size of \c sample once serialized, including the encapsulation
+    DDSROUTER_CORE_DllAPI static uint32_t serialized_size(
+            const StatisticsSample& sample) noexcept;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
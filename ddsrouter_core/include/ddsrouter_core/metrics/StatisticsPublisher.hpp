@@ -0,0 +1,114 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include <ddsrouter_core/configuration/MonitorConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class DataWriter;
+class DomainParticipant;
+class Publisher;
+class Topic;
+
+} /* namespace dds */
+} /* namespace fastdds */
+
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Publishes the statistics of the DDS Router periodically in a DDS topic (see \c MonitorConfiguration ).
+ *
+ * The statistics are taken and serialized in an internal thread, so publishing them never blocks the threads that
+ * forward the data. The topic is reliable and transient local with depth 1, so late joiners get the last snapshot.
+ */
+class StatisticsPublisher
+{
+public:
+
+    //! Callback that returns the current statistics in Prometheus text format
+    using ContentCallback = std::function<std::string()>;
+
+    /**
+     * @brief Construct a new StatisticsPublisher object and start publishing.
+     *
+     * @param [in] configuration : domain, topic and period of the publication
+     * @param [in] content : callback that returns the statistics to publish
+     *
+     * @throw \c InitializationException if the DDS entities cannot be created
+     */
+    DDSROUTER_CORE_DllAPI StatisticsPublisher(
+            const MonitorConfiguration& configuration,
+            const ContentCallback& content);
+
+    //! Stop publishing and destroy the DDS entities
+    DDSROUTER_CORE_DllAPI ~StatisticsPublisher();
+
+    //! Number of snapshots published
+    DDSROUTER_CORE_DllAPI uint64_t published() const noexcept;
+
+protected:
+
+    //! Internal thread routine
+    void run_() noexcept;
+
+    //! Take a snapshot of the statistics and publish it
+    void publish_() noexcept;
+
+    //! Delete every DDS entity created
+    void destroy_entities_() noexcept;
+
+    //! Publication configuration
+    const MonitorConfiguration configuration_;
+
+    //! Callback that returns the statistics
+    ContentCallback content_;
+
+    //! DDS entities
+    fastdds::dds::DomainParticipant* participant_ {nullptr};
+    fastdds::dds::Publisher* publisher_ {nullptr};
+    fastdds::dds::Topic* topic_ {nullptr};
+    fastdds::dds::DataWriter* writer_ {nullptr};
+    fastdds::dds::TypeSupport type_;
+
+    //! Number of snapshots published
+    std::atomic<uint64_t> published_ {0};
+
+    //! Mutex and condition to wake up the internal thread when it must stop
+    std::mutex mutex_;
+    std::condition_variable stop_condition_;
+    bool stop_ {false};
+
+    //! Internal thread
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
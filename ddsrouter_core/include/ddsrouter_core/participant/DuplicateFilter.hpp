@@ -0,0 +1,152 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/types/dds/Guid.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/SequenceWindow.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Detects samples that have already been received, identified by the GUID of the writer that originally
+ * published them and their sequence number.
+ *
+ * It keeps a \c SequenceWindow for each writer, so the memory used per writer is fixed, and erases it once the
+ * writer has not published for longer than the lease (or when every writer that delivered its samples to this
+ * DDS Router is undiscovered).
+ * It is thread safe, so it can be shared by several readers. The writers are split in shards, each with its own
+ * mutex, so readers receiving samples from different writers rarely contend.
+ */
+class DuplicateFilter
+{
+public:
+
+    //! Number of shards of every filter
+    static constexpr std::size_t SHARDS = 16;
+
+    /**
+     * @brief Construct a new DuplicateFilter object
+     *
+     * @param [in] window_size : number of sequence numbers tracked for each writer
+     * @param [in] lease : time in milliseconds after which the window of a writer without new samples is erased
+     */
+    DDSROUTER_CORE_DllAPI DuplicateFilter(
+            const unsigned int window_size,
+            const utils::Duration_ms lease);
+
+    /**
+     * @brief Register a sample.
+     *
+     * @param [in] writer_guid : GUID of the writer that originally published the sample
+     * @param [in] sequence_number : sequence number of the sample in that writer
+     *
+     * @return true if it is the first time this sample is received
+     * @return false if the sample is a duplicate (or it is too old to know it)
+     */
+    DDSROUTER_CORE_DllAPI bool insert(
+            const ddspipe::core::types::Guid& writer_guid,
+            const uint64_t sequence_number);
+
+    /**
+     * @brief Register a sample delivered by a writer other than the one that originally published it
+     * (e.g. the writer of another DDS Router).
+     *
+     * @param [in] writer_guid : GUID of the writer that originally published the sample
+     * @param [in] sequence_number : sequence number of the sample in that writer
+     * @param [in] sender_guid : GUID of the writer the sample has been received from
+     *
+     * @return true if it is the first time this sample is received
+     * @return false if the sample is a duplicate (or it is too old to know it)
+     */
+    DDSROUTER_CORE_DllAPI bool insert(
+            const ddspipe::core::types::Guid& writer_guid,
+            const uint64_t sequence_number,
+            const ddspipe::core::types::Guid& sender_guid);
+
+    /**
+     * @brief Forget a writer that has been undiscovered.
+     *
+     * The windows of the origins delivered only by this writer are erased.
+     *
+     * @warning Copies of their samples still on their way through slower paths are not detected anymore.
+     */
+    DDSROUTER_CORE_DllAPI void erase(
+            const ddspipe::core::types::Guid& sender_guid);
+
+    //! Number of writers whose window is kept
+    DDSROUTER_CORE_DllAPI std::size_t size() const;
+
+protected:
+
+    //! Window of a writer and the last time it was used
+    struct Entry
+    {
+        types::SequenceWindow window;
+
+        //! Steady clock time (ms) of the last sample inserted
+        int64_t last_insert_ms;
+
+        //! Writers that delivered the samples of this origin (usually one per path)
+        std::vector<ddspipe::core::types::Guid> senders;
+    };
+
+    //! Writers of a shard, aligned to its own cache line
+    struct alignas(64) Shard
+    {
+        //! Window of sequence numbers received from each writer
+        std::map<ddspipe::core::types::Guid, Entry> windows;
+
+        //! Steady clock time (ms) of the last time the expired windows were erased
+        int64_t last_sweep_ms = 0;
+
+        //! Mutex to protect the shard
+        mutable std::mutex mutex;
+    };
+
+    //! Shard of a writer
+    Shard& shard_(
+            const ddspipe::core::types::Guid& writer_guid) noexcept;
+
+    //! Erase the windows of a shard not used since longer than the lease (the shard mutex must be locked)
+    void sweep_(
+            Shard& shard,
+            const int64_t now_ms) noexcept;
+
+    //! Number of sequence numbers tracked for each writer
+    const unsigned int window_size_;
+
+    //! Time in milliseconds after which an unused window is erased
+    const int64_t lease_ms_;
+
+    //! Shards of the filter
+    std::array<Shard, SHARDS> shards_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
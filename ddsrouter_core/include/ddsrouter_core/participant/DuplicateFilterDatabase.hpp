@@ -0,0 +1,72 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <ddspipe_core/types/dds/Guid.hpp>
+
+#include <ddsrouter_core/configuration/DeduplicationConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participant/DuplicateFilter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Database of the \c DuplicateFilter of each topic.
+ *
+ * The readers of every participant that share a database share the same filter for each topic,
+ * so a sample is only forwarded by the first of them that receives it.
+ */
+class DuplicateFilterDatabase
+{
+public:
+
+    /**
+     * @brief Construct a new DuplicateFilterDatabase object
+     *
+     * @param [in] configuration : configuration of every filter
+     */
+    DDSROUTER_CORE_DllAPI DuplicateFilterDatabase(
+            const DeduplicationConfiguration& configuration);
+
+    //! Get the filter of a topic, creating it if it does not exist yet
+    DDSROUTER_CORE_DllAPI std::shared_ptr<DuplicateFilter> get_filter(
+            const std::string& topic_name);
+
+    //! Forget an undiscovered writer in every filter (see \c DuplicateFilter::erase )
+    DDSROUTER_CORE_DllAPI void erase_writer(
+            const ddspipe::core::types::Guid& writer_guid);
+
+protected:
+
+    //! Configuration of every filter
+    const DeduplicationConfiguration configuration_;
+
+    //! Filters indexed by topic name
+    std::map<std::string, std::shared_ptr<DuplicateFilter>> filters_;
+
+    //! Mutex to protect \c filters_
+    std::mutex mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,95 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/ITopic.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/dds/TopicQoS.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that publishes synthetic samples from inside the DDS Router, to load test it without external
+ * publishers.
+ *
+ * Each generated topic is read by a \c GeneratorReader that produces \c types::GeneratedSample s at the rate of the
+ * topic. Every other reader created is a blank reader, and every writer is a blank writer, so the samples
+ * forwarded to this participant are discarded.
+ *
+ * The generated topics are not discovered: the DDS Router creates them as builtin topics.
+ */
+class GeneratorParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new GeneratorParticipant object
+     *
+     * @param [in] configuration : configuration of the participant and its topics
+     * @param [in] payload_pool : pool where the payloads of the samples are allocated
+     */
+    DDSROUTER_CORE_DllAPI GeneratorParticipant(
+            const std::shared_ptr<GeneratorParticipantConfiguration>& configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool);
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId id() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_repeater() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_rtps_kind() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::TopicQoS topic_qos() const noexcept override;
+
+    //! Create a blank writer: the generator does not consume samples
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override;
+
+    //! Create a \c GeneratorReader if \c topic is generated, or a blank reader otherwise
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& topic) override;
+
+    /**
+     * @brief Guid of the reader of the generated topic with index \c index .
+     *
+     * It is deterministic, so the source of the samples is the same in every execution.
+     */
+    DDSROUTER_CORE_DllAPI static ddspipe::core::types::Guid generated_guid(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const uint32_t index,
+            const bool keyed) noexcept;
+
+protected:
+
+    std::shared_ptr<GeneratorParticipantConfiguration> configuration_;
+
+    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
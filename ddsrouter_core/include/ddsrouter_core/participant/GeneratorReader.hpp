@@ -0,0 +1,165 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <fastrtps/utils/TimedMutex.hpp>
+
+#include <cpp_utils/ReturnCode.hpp>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/GeneratedSample.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader of a generator participant that produces the samples of a generated topic at its rate.
+ *
+ * While enabled, an internal thread keeps count of the samples that are due according to the rate, and notifies
+ * them as available. Each sample is only serialized when it is taken, in a payload of the shared payload pool.
+ * Sample \c n (starting at 0) has sequence \c n and key \c n modulo the number of keys.
+ *
+ * If the samples are not taken as fast as they are due, at most \c MAX_PENDING_SAMPLES are kept pending and the rest
+ * are skipped, so the reader never accumulates an unbounded backlog.
+ */
+class GeneratorReader : public ddspipe::core::IReader
+{
+public:
+
+    //! Maximum number of samples due and not taken yet
+    static constexpr uint64_t MAX_PENDING_SAMPLES = 1024;
+
+    /**
+     * @brief Construct a new GeneratorReader object
+     *
+     * @param [in] participant_id : id of the generator participant
+     * @param [in] guid : guid of the reader, used as source of the samples
+     * @param [in] configuration : configuration of the generated topic
+     * @param [in] payload_pool : pool where the payloads of the samples are allocated
+     */
+    DDSROUTER_CORE_DllAPI GeneratorReader(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const ddspipe::core::types::Guid& guid,
+            const GeneratedTopicConfiguration& configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool);
+
+    //! Stop the generation
+    DDSROUTER_CORE_DllAPI ~GeneratorReader();
+
+    //! Start generating samples
+    DDSROUTER_CORE_DllAPI void enable() noexcept override;
+
+    //! Stop generating samples. The samples pending are discarded.
+    DDSROUTER_CORE_DllAPI void disable() noexcept override;
+
+    DDSROUTER_CORE_DllAPI void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override;
+
+    DDSROUTER_CORE_DllAPI void unset_on_data_available_callback() noexcept override;
+
+    /**
+     * @brief Serialize the next sample due.
+     *
+     * @return \c RETCODE_OK if a sample has been taken
+     * @return \c RETCODE_NO_DATA if there is no sample due
+     * @return \c RETCODE_OUT_OF_RESOURCES if the payload pool could not allocate the payload
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept override;
+
+    //! Number of samples skipped because they were not taken in time
+    DDSROUTER_CORE_DllAPI uint64_t skipped_samples() const noexcept;
+
+    /////////////////////////
+    // RPC REQUIRED METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::Guid guid() const override;
+
+    DDSROUTER_CORE_DllAPI fastrtps::RecursiveTimedMutex& get_rtps_mutex() const override;
+
+    DDSROUTER_CORE_DllAPI uint64_t get_unread_count() const override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::DdsTopic topic() const override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId participant_id() const noexcept override;
+
+protected:
+
+    //! Routine of the generation thread: make samples due at the rate of the topic until disabled
+    void generation_routine_() noexcept;
+
+    const ddspipe::core::types::ParticipantId participant_id_;
+
+    const ddspipe::core::types::Guid guid_;
+
+    const ddspipe::core::types::DdsTopic topic_;
+
+    //! Samples per second
+    const double rate_;
+
+    //! Number of keys (0 = not keyed)
+    const uint32_t keys_;
+
+    //! Template of the samples of the topic
+    const types::GeneratedSample sample_;
+
+    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+
+    //! Protects the state of the generation and the callback
+    mutable std::mutex mutex_;
+
+    //! Wakes the generation thread up when the reader is disabled
+    std::condition_variable generation_cv_;
+
+    std::thread generation_thread_;
+
+    bool enabled_ {false};
+
+    //! Samples due and not taken yet
+    uint64_t pending_samples_ {0};
+
+    //! Sequence of the next sample taken
+    uint64_t next_sequence_ {0};
+
+    std::atomic<uint64_t> skipped_samples_ {0};
+
+    std::function<void()> on_data_available_lambda_;
+
+    //! Not used, as there is no RTPS entity behind the reader
+    mutable fastrtps::RecursiveTimedMutex rtps_mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,89 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/ITopic.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/dds/TopicQoS.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/recorder/McapRecorder.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that records every sample it receives in MCAP files, one channel per topic.
+ *
+ * The payloads are referenced from the shared payload pool of the DDS Router, so recording adds no discovery
+ * traffic and no copy of the data; and they are written by a background thread, so the forwarding never waits
+ * for the disk (see \c McapRecorder ).
+ *
+ * Every writer created is a \c RecorderWriter , and every reader a blank reader.
+ */
+class RecorderParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new RecorderParticipant object
+     *
+     * @param [in] configuration : configuration of the participant
+     * @param [in] payload_pool : shared payload pool of the DDS Router
+     *
+     * @throw \c utils::InitializationException if the first file cannot be created
+     */
+    DDSROUTER_CORE_DllAPI RecorderParticipant(
+            const std::shared_ptr<RecorderParticipantConfiguration>& configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool);
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId id() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_repeater() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_rtps_kind() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::TopicQoS topic_qos() const noexcept override;
+
+    //! Create a \c RecorderWriter that records the samples of \c topic in its own channel
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override;
+
+    //! Create a blank reader: the recorder does not produce samples
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& topic) override;
+
+    //! Recorder where the samples are queued
+    DDSROUTER_CORE_DllAPI const McapRecorder& recorder() const noexcept;
+
+protected:
+
+    std::shared_ptr<RecorderParticipantConfiguration> configuration_;
+
+    std::shared_ptr<McapRecorder> recorder_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,70 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <memory>
+
+#include <cpp_utils/ReturnCode.hpp>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/recorder/McapRecorder.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writer of a recorder participant: it queues the samples written in the channel of its topic.
+ */
+class RecorderWriter : public ddspipe::core::IWriter
+{
+public:
+
+    /**
+     * @brief Construct a new RecorderWriter object
+     *
+     * @param [in] recorder : recorder shared by every writer of the participant
+     * @param [in] channel_id : channel of the topic of the writer
+     */
+    DDSROUTER_CORE_DllAPI RecorderWriter(
+            const std::shared_ptr<McapRecorder>& recorder,
+            const uint16_t channel_id);
+
+    DDSROUTER_CORE_DllAPI void enable() noexcept override;
+
+    DDSROUTER_CORE_DllAPI void disable() noexcept override;
+
+    /**
+     * @brief Queue the sample to be recorded, without waiting for it to be written.
+     *
+     * @return \c RETCODE_OK always, even if the sample is dropped (it is accounted by the recorder)
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode write(
+            ddspipe::core::IRoutingData& data) noexcept override;
+
+protected:
+
+    std::shared_ptr<McapRecorder> recorder_;
+
+    const uint16_t channel_id_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
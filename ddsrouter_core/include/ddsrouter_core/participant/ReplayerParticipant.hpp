@@ -0,0 +1,92 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/ITopic.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/dds/TopicQoS.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/recorder/McapReplayer.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that publishes the samples recorded in MCAP files, at their original timing, at a multiple of it or
+ * as fast as possible.
+ *
+ * Each recorded topic is read by a \c ReplayerReader fed by the \c McapReplayer of the participant.
+ * Every other reader created is a blank reader, and every writer is a blank writer, so the samples forwarded to
+ * this participant are discarded.
+ *
+ * The recorded topics are not discovered: the DDS Router creates them as builtin topics.
+ */
+class ReplayerParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new ReplayerParticipant object
+     *
+     * @param [in] configuration : configuration of the participant and its files
+     * @param [in] payload_pool : pool where the payloads that cannot be mapped are copied
+     *
+     * @throw \c InitializationException if any file could not be mapped
+     */
+    DDSROUTER_CORE_DllAPI ReplayerParticipant(
+            const std::shared_ptr<ReplayerParticipantConfiguration>& configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool);
+
+    //! Stop the replay, so the replayer is not destroyed from its own thread
+    DDSROUTER_CORE_DllAPI ~ReplayerParticipant();
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId id() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_repeater() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_rtps_kind() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::TopicQoS topic_qos() const noexcept override;
+
+    //! Create a blank writer: the replayer does not consume samples
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override;
+
+    //! Create a \c ReplayerReader if \c topic is recorded, or a blank reader otherwise
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& topic) override;
+
+    //! Replayer of the files of this participant
+    DDSROUTER_CORE_DllAPI std::shared_ptr<McapReplayer> replayer() const noexcept;
+
+protected:
+
+    std::shared_ptr<ReplayerParticipantConfiguration> configuration_;
+
+    std::shared_ptr<McapReplayer> replayer_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,146 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include <fastrtps/utils/TimedMutex.hpp>
+
+#include <cpp_utils/ReturnCode.hpp>
+
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+class McapReplayer;
+
+/**
+ * Reader of a replayer participant that provides the samples of a replayed topic.
+ *
+ * The samples are pushed by the replay thread of the \c McapReplayer when they are due, and the reader notifies
+ * them as available. At most \c MAX_PENDING_SAMPLES are kept pending: the replay thread waits for the rest to be
+ * taken, so a fast replay goes as fast as the samples are forwarded.
+ *
+ * The reader keeps the replayer alive, as its pending samples may point to the files it maps.
+ */
+class ReplayerReader : public ddspipe::core::IReader
+{
+public:
+
+    //! Maximum number of samples pushed and not taken yet
+    static constexpr std::size_t MAX_PENDING_SAMPLES = 1024;
+
+    /**
+     * @brief Construct a new ReplayerReader object
+     *
+     * @param [in] participant_id : id of the replayer participant
+     * @param [in] guid : guid of the reader, used as source of the samples
+     * @param [in] topic : topic replayed
+     * @param [in] replayer : replayer of the participant, started once its readers are enabled
+     */
+    DDSROUTER_CORE_DllAPI ReplayerReader(
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const ddspipe::core::types::Guid& guid,
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<McapReplayer>& replayer);
+
+    //! Accept samples, and start the replay if every reader of the replayer is enabled
+    DDSROUTER_CORE_DllAPI void enable() noexcept override;
+
+    //! Discard the samples pending and the ones pushed until enabled again
+    DDSROUTER_CORE_DllAPI void disable() noexcept override;
+
+    DDSROUTER_CORE_DllAPI void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override;
+
+    DDSROUTER_CORE_DllAPI void unset_on_data_available_callback() noexcept override;
+
+    /**
+     * @brief Take the oldest sample pushed.
+     *
+     * @return \c RETCODE_OK if a sample has been taken
+     * @return \c RETCODE_NO_DATA if there is no sample pending
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept override;
+
+    /**
+     * @brief Push a sample due, and notify it.
+     *
+     * @param [in,out] data : sample pushed. It is only moved if consumed.
+     *
+     * @return whether the sample is consumed (pending, or discarded if the reader is disabled)
+     * @return false if there are already \c MAX_PENDING_SAMPLES pending
+     */
+    DDSROUTER_CORE_DllAPI bool push(
+            std::unique_ptr<ddspipe::core::types::RtpsPayloadData>& data) noexcept;
+
+    /////////////////////////
+    // RPC REQUIRED METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::Guid guid() const override;
+
+    DDSROUTER_CORE_DllAPI fastrtps::RecursiveTimedMutex& get_rtps_mutex() const override;
+
+    DDSROUTER_CORE_DllAPI uint64_t get_unread_count() const override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::DdsTopic topic() const override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId participant_id() const noexcept override;
+
+protected:
+
+    const ddspipe::core::types::ParticipantId participant_id_;
+
+    const ddspipe::core::types::Guid guid_;
+
+    const ddspipe::core::types::DdsTopic topic_;
+
+    std::shared_ptr<McapReplayer> replayer_;
+
+    //! Protects the samples pending, the state and the callback
+    mutable std::mutex mutex_;
+
+    bool enabled_ {false};
+
+    //! Whether it has been enabled at least once (and so accounted by the replayer)
+    bool ever_enabled_ {false};
+
+    std::deque<std::unique_ptr<ddspipe::core::types::RtpsPayloadData>> pending_samples_;
+
+    std::function<void()> on_data_available_lambda_;
+
+    //! Not used, as there is no RTPS entity behind the reader
+    mutable fastrtps::RecursiveTimedMutex rtps_mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,148 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/ITopic.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/dds/TopicQoS.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/interest/InterestSubscriber.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/link/LinkSelector.hpp>
+#include <ddsrouter_core/metrics/MetricsRegistry.hpp>
+#include <ddsrouter_core/participant/DuplicateFilterDatabase.hpp>
+#include <ddsrouter_core/participant/RouterReader.hpp>
+#include <ddsrouter_core/types/TopicMaxAge.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that wraps a participant created by the \c ParticipantFactory in order to add the DDS Router
+ * specific logic to its endpoints (see \c RouterReader and \c RouterWriter ).
+ *
+ * Every endpoint is wrapped, so its traffic is accounted in the \c MetricsRegistry .
+ */
+class RouterParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new RouterParticipant object
+     *
+     * @param [in] participant : internal participant to wrap
+     * @param [in] metrics : registry where the traffic of the endpoints is accounted
+     * @param [in] default_max_age : latency budget for topics without a specific one. 0 means unlimited.
+     * @param [in] topic_max_ages : latency budgets for specific topics. The first one that matches applies.
+     * @param [in] duplicate_filters : filters to discard duplicates (may be shared with other participants).
+     *                                  nullptr means no filtering.
+     * @param [in] redundancy_path : counters of the redundancy group path of the participant.
+     *                               nullptr if not in a group.
+     * @param [in] link_selector : selector of the link group of the participant. nullptr if not in a group.
+     * @param [in] remote_interest : interest of the remote DDS Router. nullptr to forward every topic.
+     *                              Transient local topics are always forwarded.
+     * @param [in] router_link : whether the participant connects to other DDS Routers, so the origin of the samples
+     *                           is exchanged with them.
+     * @param [in] stamp_origin : whether to send the origin of every sample (the participant suppresses duplicates).
+     */
+    DDSROUTER_CORE_DllAPI RouterParticipant(
+            const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+            const std::shared_ptr<MetricsRegistry>& metrics,
+            const utils::Duration_ms default_max_age,
+            const std::vector<types::TopicMaxAge>& topic_max_ages,
+            const std::shared_ptr<DuplicateFilterDatabase>& duplicate_filters = nullptr,
+            const std::shared_ptr<RedundancyPathCounters>& redundancy_path = nullptr,
+            const std::shared_ptr<LinkSelector>& link_selector = nullptr,
+            const std::shared_ptr<InterestSubscriber>& remote_interest = nullptr,
+            const bool router_link = false,
+            const bool stamp_origin = false);
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId id() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_repeater() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_rtps_kind() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::TopicQoS topic_qos() const noexcept override;
+
+    /**
+     * @brief Create a writer in the internal participant and wrap it in a \c RouterWriter .
+     */
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override;
+
+    /**
+     * @brief Create a reader in the internal participant and wrap it in a \c RouterReader .
+     */
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& topic) override;
+
+protected:
+
+    //! Latency budget that applies to a topic
+    utils::Duration_ms max_age_(
+            const ddspipe::core::ITopic& topic) const noexcept;
+
+    //! Whether a topic is transient local, so its samples are never filtered by the remote interest
+    bool is_transient_local_(
+            const ddspipe::core::ITopic& topic) const noexcept;
+
+    //! Whether the origin of the samples of a topic is exchanged (never in RPC topics)
+    bool exchanges_origin_(
+            const ddspipe::core::ITopic& topic) const noexcept;
+
+    //! Internal participant
+    std::shared_ptr<ddspipe::core::IParticipant> participant_;
+
+    //! Registry where the traffic of the endpoints is accounted
+    std::shared_ptr<MetricsRegistry> metrics_;
+
+    //! Latency budget for topics without a specific one
+    const utils::Duration_ms default_max_age_;
+
+    //! Latency budgets that apply to this participant
+    std::vector<types::TopicMaxAge> topic_max_ages_;
+
+    //! Filters to discard duplicates (nullptr = disabled)
+    std::shared_ptr<DuplicateFilterDatabase> duplicate_filters_;
+
+    //! Counters of the redundancy group path (nullptr if not in a group)
+    std::shared_ptr<RedundancyPathCounters> redundancy_path_;
+
+    //! Selector of the link group (nullptr if not in a group)
+    std::shared_ptr<LinkSelector> link_selector_;
+
+    //! Interest of the remote DDS Router (nullptr to forward every topic)
+    std::shared_ptr<InterestSubscriber> remote_interest_;
+
+    //! Whether the participant connects to other DDS Routers
+    const bool router_link_;
+
+    //! Whether the origin of every sample is sent
+    const bool stamp_origin_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,272 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <fastrtps/utils/TimedMutex.hpp>
+
+#include <cpp_utils/ReturnCode.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/metrics/IngressStamp.hpp>
+#include <ddsrouter_core/metrics/ShardedCounter.hpp>
+#include <ddsrouter_core/participant/DuplicateFilter.hpp>
+#include <ddsrouter_core/types/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Counters of the samples received and discarded by the \c RouterReader s of a topic in a participant.
+ */
+struct RouterReaderCounters
+{
+    //! Samples taken from the internal reader
+    ShardedCounter samples_received {};
+
+    //! Bytes of the samples taken from the internal reader
+    ShardedCounter bytes_received {};
+
+    //! Samples discarded for exceeding the latency budget
+    ShardedCounter expired_samples {};
+
+    //! Samples discarded for being duplicates of samples already received
+    ShardedCounter duplicated_samples {};
+};
+
+/**
+ * Counters of a participant that is a path of a redundancy group, shared by all its \c RouterReader s.
+ */
+struct RedundancyPathCounters
+{
+    //! Samples received first through this path
+    std::atomic<uint64_t> first_arrivals {0};
+
+    //! Samples received through this path after another path of the group
+    std::atomic<uint64_t> late_arrivals {0};
+
+    //! Latency (in nanoseconds) from the source timestamp to the reception in this path
+    types::LatencyHistogram latency {};
+};
+
+/**
+ * Reader that wraps the reader created by a participant and applies the DDS Router specific logic
+ * to every sample taken from it, before the sample reaches any writer.
+ *
+ * It accounts every sample received, and discards:
+ * - Samples whose source timestamp is older than the latency budget (max age) of the topic.
+ * - Samples that have been waiting inside the router for longer than the latency budget, since the internal
+ *   reader notified their reception.
+ * - Samples already received, if a \c DuplicateFilter is set.
+ *
+ * A sample is identified end to end by the writer that originally published it and its sequence number.
+ * Router links send this origin along with the samples, as their related sample identity (see \c RouterWriter ),
+ * so the DDS Routers after the first one identify the sample the same way whatever the path it arrives through.
+ * Only the readers of router links read the origin stamped, and they remove it from the sample, so the related
+ * sample identity of the applications is never taken as an origin, and the origin is never sent to them.
+ * RPC topics are not stamped, as their related sample identity correlates replies with requests.
+ *
+ * Every other method is forwarded to the internal reader.
+ */
+class RouterReader : public ddspipe::core::IReader
+{
+public:
+
+    /**
+     * @brief Construct a new RouterReader object
+     *
+     * @param [in] reader : internal reader to wrap
+     * @param [in] topic_name : name of the topic of the reader (for logging purposes)
+     * @param [in] max_age : latency budget in milliseconds. 0 means unlimited.
+     * @param [in] duplicate_filter : filter of already received samples. nullptr means no filtering.
+     * @param [in] counters : counters where the received and discarded samples are accounted
+     * @param [in] redundancy_path : counters of the redundancy group path of the reader. nullptr if not in a group.
+     * @param [in] participant_index : index of the participant of the reader in the \c MetricsRegistry ,
+     *                                 stamped in the samples taken (see \c IngressStamp )
+     * @param [in] router_link : whether the samples may carry the origin stamped by the DDS Router that sent them
+     */
+    DDSROUTER_CORE_DllAPI RouterReader(
+            const std::shared_ptr<ddspipe::core::IReader>& reader,
+            const std::string& topic_name,
+            const utils::Duration_ms max_age,
+            const std::shared_ptr<DuplicateFilter>& duplicate_filter,
+            const std::shared_ptr<RouterReaderCounters>& counters,
+            const std::shared_ptr<RedundancyPathCounters>& redundancy_path = nullptr,
+            const uint32_t participant_index = IngressStamp::UNKNOWN_SOURCE_INDEX,
+            const bool router_link = false);
+
+    //! Record the destruction of the reader in the \c FlightRecorder
+    DDSROUTER_CORE_DllAPI ~RouterReader();
+
+    DDSROUTER_CORE_DllAPI void enable() noexcept override;
+
+    DDSROUTER_CORE_DllAPI void disable() noexcept override;
+
+    /**
+     * @brief Set the callback of the internal reader.
+     *
+     * The callback is wrapped so the time of each notification is stored as the reception time of a sample.
+     * This is the router-ingress time used to check the latency budget.
+     */
+    DDSROUTER_CORE_DllAPI void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override;
+
+    DDSROUTER_CORE_DllAPI void unset_on_data_available_callback() noexcept override;
+
+    /**
+     * @brief Take the next sample from the internal reader that must be forwarded.
+     *
+     * Every sample taken is accounted in the counters.
+     * Expired and duplicated samples are released right away and accounted in the counters too.
+     * The sample returned is stamped with its reception time (see \c IngressStamp ).
+     * If it is traced, the time it waited since its reception is recorded (see \c Tracer ).
+     *
+     * @return \c RETCODE_OK if a valid sample has been taken
+     * @return any other value returned by the internal reader (e.g. \c RETCODE_NO_DATA )
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept override;
+
+    /////////////////////////
+    // RPC REQUIRED METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::Guid guid() const override;
+
+    DDSROUTER_CORE_DllAPI fastrtps::RecursiveTimedMutex& get_rtps_mutex() const override;
+
+    DDSROUTER_CORE_DllAPI uint64_t get_unread_count() const override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::DdsTopic topic() const override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId participant_id() const noexcept override;
+
+protected:
+
+    //! Account the reception of \c data in the counters and return its source timestamp in ns (0 if it has none)
+    int64_t account_reception_(
+            const ddspipe::core::IRoutingData& data) noexcept;
+
+    /**
+     * @brief Reception time of the sample just taken from the internal reader.
+     *
+     * The internal reader notifies each sample once, and samples are taken in reception order, so the oldest
+     * reception stored belongs to the sample taken.
+     * The receptions of the samples removed from the internal reader without being taken (e.g. replaced in a
+     * KEEP_LAST history) are discarded, so they do not shift the reception of the later samples.
+     *
+     * @return steady clock time (ns) of the reception, or the current time if it is unknown
+     */
+    int64_t take_reception_() noexcept;
+
+    //! Whether \c data , received at \c reception_ns (steady clock), exceeds the latency budget
+    bool is_expired_(
+            const ddspipe::core::IRoutingData& data,
+            const int64_t reception_ns) const noexcept;
+
+    /**
+     * @brief Get the origin of \c data , and remove it from \c data if it was stamped by another DDS Router.
+     *
+     * @param [in,out] data : sample received
+     * @param [out] writer_guid : GUID of the writer that originally published the sample
+     * @param [out] sequence_number : sequence number of the sample in that writer
+     * @param [out] stamped : whether the origin has been stamped by another DDS Router
+     *
+     * @return whether the origin of the sample is known
+     */
+    bool identify_origin_(
+            ddspipe::core::IRoutingData& data,
+            ddspipe::core::types::Guid& writer_guid,
+            uint64_t& sequence_number,
+            bool& stamped) const noexcept;
+
+    //! Whether \c data (with a known origin) has already been received. Otherwise, it is registered as received.
+    bool is_duplicated_(
+            const ddspipe::core::IRoutingData& data,
+            const ddspipe::core::types::Guid& writer_guid,
+            const uint64_t sequence_number) noexcept;
+
+    //! Account the arrival of \c data in the redundancy group path (if any)
+    void account_redundancy_path_(
+            const ddspipe::core::IRoutingData& data,
+            const bool duplicated) noexcept;
+
+    //! Name of the topic, used for logging
+    const std::string topic_name_;
+
+    //! Id of the participant of the internal reader, referenced by the \c IngressStamp of the samples taken
+    const ddspipe::core::types::ParticipantId participant_id_;
+
+    //! Index of the participant of the internal reader in the \c MetricsRegistry
+    const uint32_t participant_index_;
+
+    //! Labels of the topic and the participant in the trace
+    const uint32_t trace_topic_;
+    const uint32_t trace_participant_;
+
+    //! Topic and participant of the reader in the events of the \c FlightRecorder
+    const std::string flight_subject_;
+
+    //! Latency budget in nanoseconds (0 = unlimited)
+    const int64_t max_age_ns_;
+
+    //! Guards the receptions of the samples pending in the internal reader
+    std::mutex receptions_mutex_;
+
+    //! Steady clock time (ns) of the reception of the samples pending in the internal reader, oldest first
+    std::deque<int64_t> receptions_ns_;
+
+    //! Number of receptions stored since the creation of the reader
+    uint64_t receptions_count_ {0};
+
+    //! Whether the samples may carry the origin stamped by the DDS Router that sent them
+    const bool router_link_;
+
+    //! Filter of already received samples (may be shared with other readers)
+    std::shared_ptr<DuplicateFilter> duplicate_filter_;
+
+    //! Counters of received and discarded samples (shared by every reader in the same topic and participant)
+    std::shared_ptr<RouterReaderCounters> counters_;
+
+    //! Counters of the redundancy group path (nullptr if not in a group)
+    std::shared_ptr<RedundancyPathCounters> redundancy_path_;
+
+    /**
+     * @brief Internal reader.
+     *
+     * @note It must be the last attribute, so it is destroyed (and so its listener) before the attributes
+     * accessed from the wrapped callback.
+     */
+    std::shared_ptr<ddspipe::core::IReader> reader_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
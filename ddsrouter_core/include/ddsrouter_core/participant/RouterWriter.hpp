@@ -0,0 +1,182 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <cpp_utils/ReturnCode.hpp>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/link/LinkSelector.hpp>
+#include <ddsrouter_core/metrics/RouteLatencies.hpp>
+#include <ddsrouter_core/metrics/ShardedCounter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Counters of the samples sent and discarded by the \c RouterWriter s of a topic in a participant.
+ */
+struct RouterWriterCounters
+{
+    /**
+     * @brief Construct a new RouterWriterCounters object
+     *
+     * @param [in] source_latency : whether the latency from the source timestamp of the samples is accounted.
+     *                              It requires the clocks of the sources and the router hosts to be synchronized.
+     */
+    explicit RouterWriterCounters(
+            const bool source_latency = false)
+        : route_latencies(source_latency)
+    {
+    }
+
+    //! Samples sent by the internal writer
+    ShardedCounter samples_sent {};
+
+    //! Bytes of the samples sent by the internal writer
+    ShardedCounter bytes_sent {};
+
+    //! Samples not sent because the remote DDS Router is not interested in the topic
+    ShardedCounter uninterested_samples {};
+
+    //! Samples not sent because the link of the participant is not active
+    ShardedCounter inactive_link_samples {};
+
+    //! Samples the internal writer failed to send
+    ShardedCounter failed_writes {};
+
+    //! Latencies of the samples written, by the participant they are received from
+    RouteLatencies route_latencies;
+};
+
+/**
+ * Writer that wraps the writer created by a participant and applies the DDS Router specific logic
+ * to every sample before it is sent.
+ *
+ * It accounts every sample sent and the latency of its route (see \c IngressStamp ), traces the write of the
+ * traced samples (see \c Tracer ), records its creation, failed writes and latency outliers
+ * (see \c FlightRecorder ), and only sends the samples if the remote DDS Router is interested in the topic
+ * (see \c InterestSubscriber ), and if its participant is an active link of its link group (see \c LinkSelector ).
+ * In router links, it sends the origin of each sample as its related sample identity, so the DDS Router at the
+ * other side identifies it (see \c RouterReader ). The origin is only sent if the participant suppresses duplicates,
+ * or if the sample has been received from another DDS Router that already sent it, so the applications in the
+ * network of a router link that does not need it receive the samples as published.
+ */
+class RouterWriter : public ddspipe::core::IWriter
+{
+public:
+
+    /**
+     * @brief Construct a new RouterWriter object
+     *
+     * @param [in] writer : internal writer to wrap
+     * @param [in] participant_id : id of the participant of the writer (for tracing and recording purposes)
+     * @param [in] topic_name : name of the topic of the writer (for tracing and recording purposes)
+     * @param [in] counters : counters where the sent and discarded samples are accounted
+     * @param [in] interest_flag : whether the remote DDS Router is interested in the topic.
+     *                             nullptr if interest-based forwarding is disabled.
+     * @param [in] link_selector : selector of the link group of the participant. nullptr if not in a group.
+     * @param [in] link_index : index of the participant in the link group
+     * @param [in] route_latency : whether to account the latency of the routes (nullptr = always).
+     * @param [in] router_link : whether the participant is a router link, so the origin of the samples can be sent.
+     * @param [in] stamp_origin : whether to send the origin of every sample, and not only the ones received with it.
+     */
+    DDSROUTER_CORE_DllAPI RouterWriter(
+            const std::shared_ptr<ddspipe::core::IWriter>& writer,
+            const ddspipe::core::types::ParticipantId& participant_id,
+            const std::string& topic_name,
+            const std::shared_ptr<RouterWriterCounters>& counters,
+            const std::shared_ptr<const std::atomic<bool>>& interest_flag,
+            const std::shared_ptr<LinkSelector>& link_selector,
+            const int link_index,
+            const std::shared_ptr<const std::atomic<bool>>& route_latency = nullptr,
+            const bool router_link = false,
+            const bool stamp_origin = false);
+
+    //! Record the destruction of the writer in the \c FlightRecorder
+    DDSROUTER_CORE_DllAPI ~RouterWriter();
+
+    DDSROUTER_CORE_DllAPI void enable() noexcept override;
+
+    DDSROUTER_CORE_DllAPI void disable() noexcept override;
+
+    /**
+     * @brief Send \c data through the internal writer if the topic is of interest and the link of the participant
+     * is active.
+     *
+     * @return \c RETCODE_OK if the data is not sent (it is not of interest or is sent through another link)
+     * @return the value returned by the internal writer otherwise
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode write(
+            ddspipe::core::IRoutingData& data) noexcept override;
+
+protected:
+
+    //! Account the latency of \c data , just written, in the route it comes from
+    void account_latency_(
+            const ddspipe::core::IRoutingData& data) noexcept;
+
+    //! Write \c data in the internal writer, tracing the write if \c data is traced
+    utils::ReturnCode traced_write_(
+            ddspipe::core::IRoutingData& data) noexcept;
+
+    //! Write \c data with its origin as related sample identity, leaving \c data as it was for the other writers
+    utils::ReturnCode stamped_write_(
+            ddspipe::core::IRoutingData& data) noexcept;
+
+    //! Internal writer
+    std::shared_ptr<ddspipe::core::IWriter> writer_;
+
+    //! Labels of the topic and the participant in the trace
+    const uint32_t trace_topic_;
+    const uint32_t trace_participant_;
+
+    //! Topic and participant of the writer in the events of the \c FlightRecorder
+    const std::string flight_subject_;
+
+    //! Counters of sent and discarded samples (shared by every writer in the same topic and participant)
+    std::shared_ptr<RouterWriterCounters> counters_;
+
+    //! Whether the remote DDS Router is interested in the topic (nullptr = always)
+    std::shared_ptr<const std::atomic<bool>> interest_flag_;
+
+    //! Selector of the link group of the participant (nullptr if not in a group)
+    std::shared_ptr<LinkSelector> link_selector_;
+
+    //! Index of the participant in the link group
+    const int link_index_;
+
+    //! Whether the latency of the routes is accounted (nullptr = always)
+    std::shared_ptr<const std::atomic<bool>> route_latency_;
+
+    //! Whether the participant is a router link
+    const bool router_link_;
+
+    //! Whether the origin of every sample is sent along with it
+    const bool stamp_origin_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,64 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_participants/participant/rtps/CommonParticipant.hpp>
+
+#include <ddsrouter_core/configuration/ShmParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Simple participant whose only transport is shared memory, so the traffic with the applications in the same host
+ * never goes through the UDP loopback.
+ *
+ * The payload of each sample is written once in the shared memory segment of the sender, and every local receiver
+ * reads it from there. Inside the DDS Router, the payload is shared by every participant it is forwarded to.
+ */
+class ShmParticipant : public ddspipe::participants::rtps::CommonParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new ShmParticipant object
+     *
+     * @param [in] participant_configuration : configuration of the participant and its transport
+     * @param [in] payload_pool : pool shared by every participant of the DDS Router
+     * @param [in] discovery_database : database where the endpoints discovered are stored
+     */
+    DDSROUTER_CORE_DllAPI ShmParticipant(
+            const std::shared_ptr<ShmParticipantConfiguration>& participant_configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database);
+
+protected:
+
+    //! Attributes of a simple participant with the shared memory transport as its only transport
+    static fastrtps::rtps::RTPSParticipantAttributes reckon_participant_attributes_(
+            const ShmParticipantConfiguration* participant_configuration);
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
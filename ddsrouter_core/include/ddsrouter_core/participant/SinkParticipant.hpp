@@ -0,0 +1,84 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/interface/IParticipant.hpp>
+#include <ddspipe_core/interface/IReader.hpp>
+#include <ddspipe_core/interface/ITopic.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+#include <ddspipe_core/types/dds/TopicQoS.hpp>
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participant/SinkWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that discards every sample it receives, only counting them (and optionally verifying their
+ * checksum), to measure the forwarding capacity of the DDS Router without transport or logging costs.
+ *
+ * Every writer created is a \c SinkWriter , and every reader a blank reader.
+ */
+class SinkParticipant : public ddspipe::core::IParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new SinkParticipant object
+     *
+     * @param [in] configuration : configuration of the participant
+     */
+    DDSROUTER_CORE_DllAPI SinkParticipant(
+            const std::shared_ptr<SinkParticipantConfiguration>& configuration);
+
+    //! Log the samples received
+    DDSROUTER_CORE_DllAPI ~SinkParticipant();
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::ParticipantId id() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_repeater() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI bool is_rtps_kind() const noexcept override;
+
+    DDSROUTER_CORE_DllAPI ddspipe::core::types::TopicQoS topic_qos() const noexcept override;
+
+    //! Create a \c SinkWriter that accounts its samples in the counters of the participant
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IWriter> create_writer(
+            const ddspipe::core::ITopic& topic) override;
+
+    //! Create a blank reader: the sink does not produce samples
+    DDSROUTER_CORE_DllAPI std::shared_ptr<ddspipe::core::IReader> create_reader(
+            const ddspipe::core::ITopic& topic) override;
+
+    //! Counters of the samples received in every topic
+    DDSROUTER_CORE_DllAPI const SinkCounters& counters() const noexcept;
+
+protected:
+
+    std::shared_ptr<SinkParticipantConfiguration> configuration_;
+
+    std::shared_ptr<SinkCounters> counters_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
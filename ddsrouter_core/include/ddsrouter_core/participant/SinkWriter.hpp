@@ -0,0 +1,90 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include <cpp_utils/ReturnCode.hpp>
+
+#include <ddspipe_core/interface/IRoutingData.hpp>
+#include <ddspipe_core/interface/IWriter.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/metrics/ShardedCounter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Counters of the samples received by the writers of a sink participant.
+ */
+struct SinkCounters
+{
+    //! Samples written
+    ShardedCounter samples {};
+
+    //! Bytes of the payloads of the samples written
+    ShardedCounter bytes {};
+
+    //! Samples whose checksum did not match (only if verified)
+    ShardedCounter invalid_samples {};
+};
+
+/**
+ * Writer of a sink participant: it only accounts the samples written, and keeps no reference to them, so their
+ * payloads are released as soon as the rest of writers are done with them.
+ */
+class SinkWriter : public ddspipe::core::IWriter
+{
+public:
+
+    /**
+     * @brief Construct a new SinkWriter object
+     *
+     * @param [in] counters : counters where the samples are accounted (shared by every writer of the participant)
+     * @param [in] verify_checksum : whether to check the samples are valid \c types::GeneratedSample s
+     */
+    DDSROUTER_CORE_DllAPI SinkWriter(
+            const std::shared_ptr<SinkCounters>& counters,
+            const bool verify_checksum);
+
+    DDSROUTER_CORE_DllAPI void enable() noexcept override;
+
+    DDSROUTER_CORE_DllAPI void disable() noexcept override;
+
+    /**
+     * @brief Account the sample and discard it.
+     *
+     * @return \c RETCODE_OK always, even if the checksum is invalid
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode write(
+            ddspipe::core::IRoutingData& data) noexcept override;
+
+protected:
+
+    std::shared_ptr<SinkCounters> counters_;
+
+    const bool verify_checksum_;
+
+    //! Whether an invalid sample has already been reported, so the log is not flooded
+    std::atomic<bool> invalid_sample_reported_ {false};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,65 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_participants/participant/rtps/CommonParticipant.hpp>
+
+#include <ddsrouter_core/configuration/UdsParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Simple participant whose only transport is Unix domain sockets, to link DDS Routers in the same host without
+ * going through the TCP or UDP loopback.
+ *
+ * It discovers the participants of its domain with the same socket directory through the initial peers, and the
+ * messages larger than the memory file threshold are passed in a memory file instead of being copied through the
+ * socket.
+ */
+class UdsParticipant : public ddspipe::participants::rtps::CommonParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new UdsParticipant object
+     *
+     * @param [in] participant_configuration : configuration of the participant and its transport
+     * @param [in] payload_pool : pool shared by every participant of the DDS Router
+     * @param [in] discovery_database : database where the endpoints discovered are stored
+     */
+    DDSROUTER_CORE_DllAPI UdsParticipant(
+            const std::shared_ptr<UdsParticipantConfiguration>& participant_configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database);
+
+protected:
+
+    //! Attributes of a simple participant with the Unix domain socket transport as its only transport
+    static fastrtps::rtps::RTPSParticipantAttributes reckon_participant_attributes_(
+            const UdsParticipantConfiguration* participant_configuration);
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,62 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+
+#include <ddspipe_core/dynamic/DiscoveryDatabase.hpp>
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+#include <ddsrouter_core/configuration/WanDiscoveryServerParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/participant/WanParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Discovery server participant whose sockets use the I/O backend and options of its configuration.
+ *
+ * It is the same as the ddspipe discovery server participant but for its UDPv4 transports.
+ */
+class WanDiscoveryServerParticipant : public WanParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new WanDiscoveryServerParticipant object
+     *
+     * @param [in] participant_configuration : configuration of the participant and its I/O
+     * @param [in] payload_pool : pool shared by every participant of the DDS Router
+     * @param [in] discovery_database : database where the endpoints discovered are stored
+     */
+    DDSROUTER_CORE_DllAPI WanDiscoveryServerParticipant(
+            const std::shared_ptr<WanDiscoveryServerParticipantConfiguration>& participant_configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+            const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database);
+
+protected:
+
+    //! Attributes of the ddspipe discovery server participant, with the I/O backend and socket options applied
+    static fastrtps::rtps::RTPSParticipantAttributes reckon_participant_attributes_(
+            const WanDiscoveryServerParticipantConfiguration* participant_configuration);
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
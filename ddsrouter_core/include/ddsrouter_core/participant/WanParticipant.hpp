@@ -0,0 +1,76 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+#include <ddspipe_participants/participant/rtps/CommonParticipant.hpp>
+
+#include <ddsrouter_core/configuration/SocketConfiguration.hpp>
+#include <ddsrouter_core/configuration/UdpIoConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Base of the WAN participants (initial peers and discovery server), whose UDP sockets may use an I/O backend other
+ * than the Fast DDS one, and whose sockets may be tuned.
+ */
+class WanParticipant : public ddspipe::participants::rtps::CommonParticipant
+{
+public:
+
+    using ddspipe::participants::rtps::CommonParticipant::CommonParticipant;
+
+protected:
+
+    /**
+     * @brief Set the socket options of \c socket in the transports of \c params and use the I/O backend of \c io .
+     *
+     * The buffer sizes are set in every UDP and TCP transport, and the TCP options in every TCP transport.
+     * Then each Fast DDS UDPv4 transport is replaced with one that uses the I/O backend of \c io , which also
+     * applies the busy poll and DSCP of \c socket .
+     * The rest of settings of the transports are kept.
+     *
+     * @param [in] params : attributes reckoned for the participant
+     * @param [in] io : I/O configuration of the participant
+     * @param [in] socket : socket options of the participant
+     * @param [in] id : id of the participant, for the log
+     */
+    static fastrtps::rtps::RTPSParticipantAttributes configure_transports_(
+            fastrtps::rtps::RTPSParticipantAttributes params,
+            const UdpIoConfiguration& io,
+            const SocketConfiguration& socket,
+            const ddspipe::core::types::ParticipantId& id);
+
+    //! Set the socket options of \c socket in the Fast DDS UDP and TCP transports of \c params
+    static void apply_socket_configuration_(
+            fastrtps::rtps::RTPSParticipantAttributes& params,
+            const SocketConfiguration& socket);
+
+    //! Replace each Fast DDS UDPv4 transport of \c params with one that uses the I/O backend of \c io
+    static void use_io_backend_(
+            fastrtps::rtps::RTPSParticipantAttributes& params,
+            const UdpIoConfiguration& io,
+            const SocketConfiguration& socket,
+            const ddspipe::core::types::ParticipantId& id);
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,75 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Minimal codec of the LZ4 frame format, which is the \c lz4 compression of the MCAP chunks.
+ *
+ * The compressor emits independent blocks of up to 64 KiB with a greedy match search: it favours speed over
+ * ratio, as it runs in the I/O thread of the recorder.
+ * The decompressor accepts any frame (independent or linked blocks, with or without checksums), so files
+ * compressed by other tools can be read too, although the checksums are not verified.
+ */
+class Lz4Frame
+{
+public:
+
+    /**
+     * @brief Compress \c size bytes of \c data in a single LZ4 frame.
+     *
+     * @param [in] data : bytes to compress
+     * @param [in] size : number of bytes to compress
+     * @param [out] output : buffer where the frame is appended
+     */
+    DDSROUTER_CORE_DllAPI static void compress(
+            const uint8_t* data,
+            const size_t size,
+            std::vector<uint8_t>& output);
+
+    /**
+     * @brief Decompress a LZ4 frame.
+     *
+     * @param [in] data : LZ4 frame
+     * @param [in] size : bytes of the frame
+     * @param [out] output : buffer where the decompressed bytes are appended
+     *
+     * @return whether the frame is valid
+     */
+    DDSROUTER_CORE_DllAPI static bool decompress(
+            const uint8_t* data,
+            const size_t size,
+            std::vector<uint8_t>& output) noexcept;
+
+    //! xxHash32 of \c data with \c seed , used in the header checksum of the frame
+    DDSROUTER_CORE_DllAPI static uint32_t xxhash32(
+            const uint8_t* data,
+            const size_t size,
+            const uint32_t seed = 0) noexcept;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,60 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Owner of payloads that point to memory mapped files, so they are forwarded without copying their data.
+ *
+ * It does not allocate payloads, and releasing a payload only detaches it from the mapping (the mapping must
+ * outlive the payloads). Any other pool asked to reference one of these payloads copies its data instead.
+ */
+class MappedPayloadPool : public ddspipe::core::PayloadPool
+{
+public:
+
+    //! Point \c payload to \c size bytes of a mapping, and return whether it could
+    DDSROUTER_CORE_DllAPI bool map_payload(
+            const uint8_t* data,
+            const uint32_t size,
+            ddspipe::core::types::Payload& payload) noexcept;
+
+    //! Not supported: return false
+    DDSROUTER_CORE_DllAPI bool get_payload(
+            uint32_t size,
+            ddspipe::core::types::Payload& target_payload) override;
+
+    //! Reference the same mapped data if \c src_payload belongs to this pool, otherwise return false
+    DDSROUTER_CORE_DllAPI bool get_payload(
+            const ddspipe::core::types::Payload& src_payload,
+            ddspipe::core::PayloadPool*& data_owner,
+            ddspipe::core::types::Payload& target_payload) override;
+
+    //! Detach the payload from the mapping
+    DDSROUTER_CORE_DllAPI bool release_payload(
+            ddspipe::core::types::Payload& target_payload) override;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
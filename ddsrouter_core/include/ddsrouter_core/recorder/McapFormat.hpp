@@ -0,0 +1,70 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Constants of the MCAP format (https://mcap.dev/spec) shared by the MCAP writer and reader.
+ *
+ * Every record is its opcode (1 byte) followed by the length of its content (8 bytes) and the content.
+ * Integers are little endian, strings and byte arrays are prefixed by their length (4 bytes, or 8 bytes for the
+ * records of a chunk).
+ */
+
+//! Magic bytes at the beginning and end of every MCAP file
+constexpr uint8_t MCAP_MAGIC[] = {0x89, 'M', 'C', 'A', 'P', 0x30, '\r', '\n'};
+
+//! Bytes of the opcode and length that precede the content of every record
+constexpr uint64_t MCAP_RECORD_PREFIX_SIZE = 9;
+
+//! Encoding of the messages written by the DDS Router
+constexpr const char* MCAP_MESSAGE_ENCODING = "cdr";
+
+//! Key of the channel metadata that tells whether the topic is keyed ("true" or "false")
+constexpr const char* MCAP_KEYED_METADATA = "keyed";
+
+//! Compression of the chunks
+constexpr const char* MCAP_COMPRESSION_NONE = "";
+constexpr const char* MCAP_COMPRESSION_LZ4 = "lz4";
+
+//! Opcodes of the MCAP records
+enum class McapOpcode : uint8_t
+{
+    header = 0x01,
+    footer = 0x02,
+    schema = 0x03,
+    channel = 0x04,
+    message = 0x05,
+    chunk = 0x06,
+    message_index = 0x07,
+    chunk_index = 0x08,
+    attachment = 0x09,
+    attachment_index = 0x0A,
+    statistics = 0x0B,
+    metadata = 0x0C,
+    metadata_index = 0x0D,
+    summary_offset = 0x0E,
+    data_end = 0x0F,
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
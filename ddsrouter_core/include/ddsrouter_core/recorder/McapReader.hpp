@@ -0,0 +1,195 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/recorder/McapFormat.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Channel of a MCAP file
+struct McapChannel
+{
+    std::string topic_name;
+
+    //! Name of the schema of the channel (empty if it has none)
+    std::string type_name;
+
+    //! Whether the channel metadata tells the topic is keyed
+    bool keyed = false;
+};
+
+//! Message of a MCAP file
+struct McapMessage
+{
+    uint16_t channel_id = 0;
+
+    uint32_t sequence = 0;
+
+    //! Time the message was recorded (ns since epoch)
+    uint64_t log_time = 0;
+
+    //! Time the message was published (ns since epoch)
+    uint64_t publish_time = 0;
+
+    //! Data of the message
+    const uint8_t* data = nullptr;
+
+    uint32_t size = 0;
+
+    /**
+     * @brief Whether \c data points to the mapping of the file, so it is valid while the reader exists.
+     *
+     * Otherwise (the message is in a compressed chunk) it is only valid until the next message is read.
+     */
+    bool mapped = false;
+};
+
+/**
+ * Sequential reader of MCAP files (https://mcap.dev/spec), that maps the whole file in memory.
+ *
+ * The messages are read in the order they are in the file. Messages outside chunks or in uncompressed chunks are
+ * read straight from the mapping, and compressed chunks (only LZ4 is supported) are decompressed one at a time.
+ *
+ * The channels are known on construction if their records are in the data section outside chunks (as written by
+ * \c McapWriter ) or in the summary section; otherwise they are known once read.
+ * A file truncated (e.g. by a crash while recording) is read up to its last complete record.
+ */
+class McapReader
+{
+public:
+
+    /**
+     * @brief Map the file \c file_name and find its channels.
+     *
+     * @throw \c utils::InitializationException if the file cannot be mapped or it is not a MCAP file
+     */
+    DDSROUTER_CORE_DllAPI McapReader(
+            const std::string& file_name);
+
+    //! Unmap the file
+    DDSROUTER_CORE_DllAPI ~McapReader();
+
+    McapReader(
+            const McapReader&) = delete;
+
+    McapReader& operator =(
+            const McapReader&) = delete;
+
+    /**
+     * @brief Read the next message.
+     *
+     * @param [out] message : message read
+     *
+     * @return whether a message has been read (otherwise the end of the file has been reached)
+     *
+     * @throw \c utils::InconsistencyException if a chunk cannot be decompressed
+     */
+    DDSROUTER_CORE_DllAPI bool next(
+            McapMessage& message);
+
+    //! Read again from the first message
+    DDSROUTER_CORE_DllAPI void rewind() noexcept;
+
+    //! Channels known, by id
+    DDSROUTER_CORE_DllAPI const std::map<uint16_t, McapChannel>& channels() const noexcept;
+
+    //! Name of the file
+    DDSROUTER_CORE_DllAPI const std::string& file_name() const noexcept;
+
+protected:
+
+    //! Record read from the file or from a chunk
+    struct Record
+    {
+        McapOpcode opcode;
+        const uint8_t* content;
+        uint64_t length;
+    };
+
+    /**
+     * @brief Read the record at \c position of a buffer of \c size bytes, and advance \c position after it.
+     *
+     * @return whether there is a complete record at \c position
+     */
+    static bool read_record_(
+            const uint8_t* buffer,
+            const uint64_t size,
+            uint64_t& position,
+            Record& record) noexcept;
+
+    //! Unmap the file
+    void unmap_() noexcept;
+
+    //! Register the schemas and channels in the records of a buffer, skipping the rest
+    void read_channels_(
+            const uint8_t* buffer,
+            const uint64_t size) noexcept;
+
+    //! Register the schema or channel of a record
+    void register_record_(
+            const Record& record) noexcept;
+
+    //! Fill \c message from a message record
+    static bool read_message_(
+            const Record& record,
+            McapMessage& message) noexcept;
+
+    std::string file_name_;
+
+    //! Mapping of the whole file
+    const uint8_t* data_ = nullptr;
+
+    uint64_t size_ = 0;
+
+#if defined(_WIN32)
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif // if defined(_WIN32)
+
+    //! Name of each schema, by id
+    std::map<uint16_t, std::string> schemas_;
+
+    std::map<uint16_t, McapChannel> channels_;
+
+    //! Position of the next record of the file
+    uint64_t position_ = 0;
+
+    //! Records of the chunk being read (empty if none)
+    const uint8_t* chunk_ = nullptr;
+
+    uint64_t chunk_size_ = 0;
+
+    //! Position of the next record of the chunk
+    uint64_t chunk_position_ = 0;
+
+    //! Whether the records of the chunk are in the mapping (otherwise they are in \c decompressed_ )
+    bool chunk_mapped_ = false;
+
+    //! Buffer of the decompressed chunk (reused to avoid allocations)
+    std::vector<uint8_t> decompressed_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,223 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/metrics/ShardedCounter.hpp>
+#include <ddsrouter_core/recorder/McapWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Records samples in MCAP files from a background I/O thread.
+ *
+ * Recording a sample only takes a reference to its payload in the shared payload pool and pushes it in a bounded
+ * lock-free queue, so the forwarding threads never wait for the disk nor for each other. The I/O thread writes the
+ * queued samples in chunks, and rotates the file when it reaches its maximum size.
+ * When the queue is full or the queued samples reach their maximum size (because the disk cannot keep up),
+ * new samples are dropped and counted, instead of slowing down the forwarding.
+ */
+class McapRecorder
+{
+public:
+
+    //! Maximum number of samples queued (power of two)
+    static constexpr uint64_t QUEUE_SIZE = 1u << 14;
+
+    /**
+     * @brief Construct a new McapRecorder object, creating its first file and starting its I/O thread.
+     *
+     * @param [in] configuration : configuration of the recorder participant
+     * @param [in] payload_pool : shared payload pool, where the payloads of the samples are referenced
+     *
+     * @throw \c utils::InitializationException if the first file cannot be created
+     */
+    DDSROUTER_CORE_DllAPI McapRecorder(
+            const std::shared_ptr<RecorderParticipantConfiguration>& configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool);
+
+    //! Write the samples queued, close the file and stop the I/O thread
+    DDSROUTER_CORE_DllAPI ~McapRecorder();
+
+    /**
+     * @brief Register the channel of a topic.
+     *
+     * @return id of the channel, or 0 if there are no ids left
+     */
+    DDSROUTER_CORE_DllAPI uint16_t add_channel(
+            const ddspipe::core::types::DdsTopic& topic);
+
+    /**
+     * @brief Queue a sample to be written in a channel.
+     *
+     * It does not copy the payload (unless it does not belong to the shared payload pool) and never waits for
+     * the disk.
+     *
+     * @return whether the sample is queued (otherwise it is dropped)
+     */
+    DDSROUTER_CORE_DllAPI bool record(
+            const uint16_t channel_id,
+            const ddspipe::core::types::RtpsPayloadData& data) noexcept;
+
+    //! Samples written to the files
+    DDSROUTER_CORE_DllAPI uint64_t recorded_samples() const noexcept;
+
+    //! Samples dropped because the I/O thread fell behind or the files could not be written
+    DDSROUTER_CORE_DllAPI uint64_t dropped_samples() const noexcept;
+
+    //! Files created
+    DDSROUTER_CORE_DllAPI uint64_t files() const noexcept;
+
+protected:
+
+    //! Sample queued to be written
+    struct PendingSample
+    {
+        uint16_t channel_id;
+
+        //! Time the sample was recorded (ns since epoch)
+        uint64_t log_time;
+
+        //! Sample, whose payload is released from the pool when destroyed
+        std::unique_ptr<ddspipe::core::types::RtpsPayloadData> data;
+    };
+
+    /**
+     * Position of the bounded queue (see \c push_ ), aligned to its own cache line.
+     *
+     * The sequence is \c i when the slot is free for the i-th push, and \c i+1 once the i-th sample is in it.
+     */
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t> sequence;
+        PendingSample sample;
+    };
+
+    /**
+     * @brief Push \c sample in the queue, from any thread and without locking.
+     *
+     * @return whether the sample is queued (false if the queue is full)
+     */
+    bool push_(
+            PendingSample&& sample) noexcept;
+
+    //! Pop the oldest sample of the queue in \c sample (only from the I/O thread)
+    bool pop_(
+            PendingSample& sample) noexcept;
+
+    //! Whether there is a sample ready to be popped (only from the I/O thread)
+    bool ready_() const noexcept;
+
+    //! Routine of the I/O thread
+    void run_() noexcept;
+
+    //! Write a sample, opening a new file if needed, and rotating the file if it is full
+    void write_(
+            const PendingSample& sample);
+
+    //! Create the next file
+    void open_next_file_();
+
+    std::shared_ptr<RecorderParticipantConfiguration> configuration_;
+
+    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+
+    //! Start time of the recording, in the names of its files
+    std::string start_time_;
+
+    /////////////////////////
+    // QUEUE (lock free)
+    /////////////////////////
+
+    //! Slots of the queue, the i-th sample at position i % QUEUE_SIZE
+    std::unique_ptr<Slot[]> slots_;
+
+    //! Position of the next push
+    alignas(64) std::atomic<uint64_t> push_position_ {0};
+
+    //! Position of the next pop (only written by the I/O thread)
+    alignas(64) std::atomic<uint64_t> pop_position_ {0};
+
+    //! Bytes of the payloads of the samples queued or being written
+    std::atomic<uint64_t> pending_size_ {0};
+
+    std::atomic<bool> stop_ {false};
+
+    /////////////////////////
+    // SHARED WITH I/O THREAD (guarded by mutex_)
+    /////////////////////////
+
+    std::mutex mutex_;
+
+    /**
+     * @brief Wakes up the I/O thread when a sample is pushed in an empty queue.
+     *
+     * It is notified without locking \c mutex_ , so a wake up may be missed if the sample is pushed while the I/O
+     * thread is about to wait: the sample then waits at most \c FLUSH_PERIOD .
+     */
+    std::condition_variable condition_;
+
+    //! Topics of the channels, the one with id N at position N - 1
+    std::vector<ddspipe::core::types::DdsTopic> channels_;
+
+    /////////////////////////
+    // I/O THREAD
+    /////////////////////////
+
+    McapWriter writer_;
+
+    //! Channels already registered in the writer
+    std::size_t writer_channels_ = 0;
+
+    //! Sequence of the next message of each channel, the one with id N at position N - 1
+    std::vector<uint32_t> sequences_;
+
+    //! Index of the next file
+    std::atomic<uint64_t> next_file_index_ {0};
+
+    std::thread thread_;
+
+    /////////////////////////
+    // COUNTERS
+    /////////////////////////
+
+    ShardedCounter recorded_samples_ {};
+
+    ShardedCounter dropped_samples_ {};
+
+    //! Whether writing failed, so no further samples are recorded
+    std::atomic<bool> failed_ {false};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
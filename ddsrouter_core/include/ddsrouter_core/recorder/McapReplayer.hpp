@@ -0,0 +1,152 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddspipe_core/efficiency/payload/PayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/recorder/MappedPayloadPool.hpp>
+#include <ddsrouter_core/recorder/McapReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+class ReplayerReader;
+
+/**
+ * Replays the messages of MCAP files, pushing each one to the reader of its topic when it is due.
+ *
+ * The files are memory mapped and replayed one after the other in a single thread, so the messages of every topic
+ * keep their relative timing. A message is due at its log time relative to the first message, divided by the
+ * playback rate (or right away if the rate is 0).
+ *
+ * The payloads of messages in uncompressed chunks point to the mapping (owned by a \c MappedPayloadPool ), and
+ * the rest are copied to the shared payload pool. The files stay mapped while the replayer exists.
+ *
+ * The replay starts once every reader added is enabled, so no topic misses its first samples.
+ */
+class McapReplayer
+{
+public:
+
+    /**
+     * @brief Construct a new McapReplayer object, mapping its files.
+     *
+     * @param [in] configuration : configuration of the replayer participant
+     * @param [in] payload_pool : shared payload pool, where the payloads that are not in the mapping are copied
+     *
+     * @throw \c utils::InitializationException if a file cannot be mapped
+     */
+    DDSROUTER_CORE_DllAPI McapReplayer(
+            const std::shared_ptr<ReplayerParticipantConfiguration>& configuration,
+            const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool);
+
+    //! Stop the replay
+    DDSROUTER_CORE_DllAPI ~McapReplayer();
+
+    /**
+     * @brief Topics of the channels of the files, in the order they are found.
+     *
+     * @throw \c utils::InitializationException if a file cannot be mapped
+     */
+    DDSROUTER_CORE_DllAPI static std::vector<ddspipe::core::types::DdsTopic> read_topics(
+            const std::vector<std::string>& files);
+
+    //! Topics replayed
+    DDSROUTER_CORE_DllAPI const std::vector<ddspipe::core::types::DdsTopic>& topics() const noexcept;
+
+    //! Add the reader of a topic, where its messages are pushed
+    DDSROUTER_CORE_DllAPI void add_reader(
+            const std::shared_ptr<ReplayerReader>& reader);
+
+    //! Notify that a reader added has been enabled, starting the replay if every reader is
+    DDSROUTER_CORE_DllAPI void reader_enabled() noexcept;
+
+    //! Stop the replay, waiting for the replay thread to finish
+    DDSROUTER_CORE_DllAPI void stop() noexcept;
+
+    //! Messages pushed to their readers
+    DDSROUTER_CORE_DllAPI uint64_t replayed_samples() const noexcept;
+
+    //! Whether every file has been replayed
+    DDSROUTER_CORE_DllAPI bool finished() const noexcept;
+
+protected:
+
+    //! Routine of the replay thread
+    void run_() noexcept;
+
+    /**
+     * @brief Sample of a message, with its payload in the mapping if possible.
+     *
+     * @return the sample, or nullptr if its payload could not be allocated
+     */
+    std::unique_ptr<ddspipe::core::types::RtpsPayloadData> make_sample_(
+            const McapMessage& message,
+            const ReplayerReader& reader);
+
+    std::shared_ptr<ReplayerParticipantConfiguration> configuration_;
+
+    std::shared_ptr<ddspipe::core::PayloadPool> payload_pool_;
+
+    std::shared_ptr<MappedPayloadPool> mapped_payload_pool_;
+
+    std::vector<std::unique_ptr<McapReader>> files_;
+
+    std::vector<ddspipe::core::types::DdsTopic> topics_;
+
+    //! Protects the readers and the state of the replay
+    std::mutex mutex_;
+
+    //! Wakes the replay thread up when stopped
+    std::condition_variable condition_;
+
+    //! Readers by the unique name of their topic
+    std::map<std::string, std::weak_ptr<ReplayerReader>> readers_;
+
+    //! Readers enabled at least once
+    std::size_t enabled_readers_ = 0;
+
+    bool started_ = false;
+
+    bool stop_ = false;
+
+    std::thread thread_;
+
+    //! Sequence of the next sample of each topic, by unique name of the topic
+    std::map<std::string, uint64_t> sequences_;
+
+    std::atomic<uint64_t> replayed_samples_ {0};
+
+    std::atomic<bool> finished_ {false};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
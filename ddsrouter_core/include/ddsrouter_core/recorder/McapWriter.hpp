@@ -0,0 +1,173 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/recorder/McapFormat.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writer of MCAP files (https://mcap.dev/spec), with the messages grouped in chunks that are optionally
+ * compressed with LZ4.
+ *
+ * Each channel is a DDS topic whose messages are CDR serialized samples. As the DDS Router does not know the
+ * types it forwards, each channel has its own schema, named after the type and with no definition.
+ * The schema and channel records are written before the first message of the channel in each file, so every
+ * file can be read on its own.
+ *
+ * This class is not thread safe: it is meant to be used by a single I/O thread.
+ */
+class McapWriter
+{
+public:
+
+    /**
+     * @brief Construct a new McapWriter object, with no file open.
+     *
+     * @param [in] chunk_size : uncompressed bytes of the messages after which a chunk is written
+     * @param [in] compress : whether to compress the chunks with LZ4
+     */
+    DDSROUTER_CORE_DllAPI McapWriter(
+            const uint64_t chunk_size,
+            const bool compress);
+
+    //! Close the file if open
+    DDSROUTER_CORE_DllAPI ~McapWriter();
+
+    /**
+     * @brief Create the file \c file_name and write its header, closing the current file if any.
+     *
+     * @throw \c utils::InitializationException if the file cannot be created
+     */
+    DDSROUTER_CORE_DllAPI void open(
+            const std::string& file_name);
+
+    /**
+     * @brief Write the pending chunk and the end of the file, and close it.
+     *
+     * @throw \c utils::InconsistencyException if the file cannot be written
+     */
+    DDSROUTER_CORE_DllAPI void close();
+
+    //! Whether there is a file open
+    DDSROUTER_CORE_DllAPI bool is_open() const noexcept;
+
+    /**
+     * @brief Register a channel, so messages can be written in it.
+     *
+     * @param [in] channel_id : id of the channel (not 0)
+     * @param [in] topic_name : name of the topic
+     * @param [in] type_name : name of the type of the topic, used as name of its schema
+     * @param [in] keyed : whether the topic is keyed
+     */
+    DDSROUTER_CORE_DllAPI void add_channel(
+            const uint16_t channel_id,
+            const std::string& topic_name,
+            const std::string& type_name,
+            const bool keyed);
+
+    /**
+     * @brief Add a message to the current chunk, writing the chunk if it is full.
+     *
+     * @param [in] channel_id : registered channel of the message
+     * @param [in] sequence : sequence of the message in its channel
+     * @param [in] log_time : time the message was received (ns since epoch)
+     * @param [in] publish_time : time the message was published (ns since epoch)
+     * @param [in] data : serialized message
+     * @param [in] size : bytes of \c data
+     *
+     * @throw \c utils::InconsistencyException if the file cannot be written
+     */
+    DDSROUTER_CORE_DllAPI void write(
+            const uint16_t channel_id,
+            const uint32_t sequence,
+            const uint64_t log_time,
+            const uint64_t publish_time,
+            const uint8_t* data,
+            const uint32_t size);
+
+    /**
+     * @brief Write the current chunk (if not empty) and flush the file.
+     *
+     * @throw \c utils::InconsistencyException if the file cannot be written
+     */
+    DDSROUTER_CORE_DllAPI void flush();
+
+    //! Bytes of the current file, counting the current chunk uncompressed
+    DDSROUTER_CORE_DllAPI uint64_t size() const noexcept;
+
+protected:
+
+    //! Information of a registered channel
+    struct Channel
+    {
+        std::string topic_name;
+        std::string type_name;
+        bool keyed;
+    };
+
+    //! Write a record whose content is \c record_ followed by \c tail
+    void write_record_(
+            const McapOpcode opcode,
+            const uint8_t* tail = nullptr,
+            const uint64_t tail_size = 0);
+
+    //! Compress (if enabled) and write the current chunk
+    void write_chunk_();
+
+    const uint64_t chunk_size_;
+
+    const bool compress_;
+
+    std::ofstream file_;
+
+    std::string file_name_;
+
+    //! Bytes written to the file
+    uint64_t file_size_ = 0;
+
+    std::map<uint16_t, Channel> channels_;
+
+    //! Channels whose schema and channel records are already in the current file
+    std::set<uint16_t> channels_written_;
+
+    //! Records of the current chunk
+    std::vector<uint8_t> chunk_;
+
+    uint64_t chunk_start_time_ = 0;
+
+    uint64_t chunk_end_time_ = 0;
+
+    //! Buffer where the record being written is serialized (reused to avoid allocations)
+    std::vector<uint8_t> record_;
+
+    //! Buffer of the compressed chunk (reused to avoid allocations)
+    std::vector<uint8_t> compressed_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
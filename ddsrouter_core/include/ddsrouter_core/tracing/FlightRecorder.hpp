@@ -0,0 +1,104 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Kinds of events kept by the \c FlightRecorder .
+ */
+enum class FlightEventKind : uint8_t
+{
+    discovery,          //!< An endpoint has been discovered, updated or removed
+    bridge_created,     //!< A reader or writer of a bridge has been created
+    bridge_destroyed,   //!< A reader or writer of a bridge has been destroyed
+    sample_dropped,     //!< A sample has been dropped because of an error or an expired budget
+    reload,             //!< The configuration has been reloaded
+    latency_outlier,    //!< A sample has taken longer than the outlier threshold to be forwarded
+};
+
+/**
+ * Always-on record of the last events of the DDS Router, to diagnose incidents after they happen.
+ *
+ * Events are kept in a fixed-size ring shared by every thread, where the oldest ones are overwritten.
+ * Recording an event is lock-free and does not allocate, so it can be used in the forwarding path.
+ *
+ * The ring can be dumped at any time, even from a signal handler (e.g. on a crash),
+ * as dumping does not lock nor allocate either.
+ */
+class FlightRecorder
+{
+public:
+
+    //! Number of events kept (older ones are overwritten)
+    static constexpr std::size_t RING_SIZE = 1024;
+
+    //! Maximum length of the text of an event (longer texts are truncated)
+    static constexpr std::size_t TEXT_SIZE = 160;
+
+    //! Default minimum latency of a sample to be recorded as an outlier (100 ms)
+    static constexpr uint64_t DEFAULT_LATENCY_OUTLIER_THRESHOLD = 100000000;
+
+    /**
+     * @brief Record an event.
+     *
+     * The text of the event is \c subject followed by \c note , separated by a space if both are given.
+     * If the slot of the event is being written by another thread (the ring has been completely overwritten
+     * meanwhile), the event is discarded.
+     *
+     * @param [in] kind : kind of the event
+     * @param [in] subject : entity the event refers to (e.g. "topic=X participant=Y")
+     * @param [in] note : details of the event
+     */
+    DDSROUTER_CORE_DllAPI static void record(
+            const FlightEventKind kind,
+            const std::string& subject,
+            const char* note = "") noexcept;
+
+    //! Minimum latency (ns) of a sample to be recorded as an outlier (0 = disabled)
+    DDSROUTER_CORE_DllAPI static uint64_t latency_outlier_threshold() noexcept;
+
+    //! Set the minimum latency (ns) of a sample to be recorded as an outlier (0 = disabled)
+    DDSROUTER_CORE_DllAPI static void latency_outlier_threshold(
+            const uint64_t threshold_ns) noexcept;
+
+    //! Events kept, from the oldest to the newest, one per line
+    DDSROUTER_CORE_DllAPI static std::string to_string();
+
+    /**
+     * @brief Write the events kept to \c file_name , from the oldest to the newest, one per line.
+     *
+     * This method is async-signal-safe.
+     *
+     * @return whether the file has been written
+     */
+    DDSROUTER_CORE_DllAPI static bool dump(
+            const char* file_name) noexcept;
+
+    //! Forget every event kept
+    DDSROUTER_CORE_DllAPI static void clear() noexcept;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
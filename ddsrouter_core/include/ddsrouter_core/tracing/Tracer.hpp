@@ -0,0 +1,142 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Event recorded by a trace point of the forwarding path.
+ */
+struct TraceEvent
+{
+    //! Name of the trace point (static string)
+    const char* name {nullptr};
+
+    //! Whether the event is shown as an asynchronous span (it may overlap other spans of its thread)
+    bool async {false};
+
+    //! Label of the topic (see \c Tracer::label )
+    uint32_t topic {0};
+
+    //! Label of the participant (see \c Tracer::label )
+    uint32_t participant {0};
+
+    //! Id of the traced sample
+    uint64_t sample {0};
+
+    //! Steady clock time (ns) of the beginning of the span
+    int64_t start_ns {0};
+
+    //! Duration (ns) of the span
+    int64_t duration_ns {0};
+};
+
+/**
+ * Low overhead tracer of the samples forwarded by the DDS Router.
+ *
+ * Trace points (see \c DDSROUTER_TRACE_SAMPLE and \c DDSROUTER_TRACE_SPAN ) record events in a ring buffer
+ * of the thread that executes them, so tracing does not synchronize the threads of the forwarding path.
+ * Only one of each \c sampling samples is traced, so tracing can stay enabled in production.
+ *
+ * The events recorded can be exported at any time in the Chrome trace event format,
+ * which can be loaded in \c chrome://tracing or Perfetto.
+ *
+ * Trace points are compiled only if the CMake option \c DDSROUTER_TRACING is enabled (default),
+ * and they do nothing until the tracer is enabled.
+ */
+class Tracer
+{
+public:
+
+    //! Number of events kept per thread (older ones are overwritten)
+    static constexpr std::size_t RING_SIZE = 4096;
+
+    //! Whether the trace points of the forwarding path have been compiled
+    DDSROUTER_CORE_DllAPI static bool trace_points_compiled() noexcept;
+
+    /**
+     * @brief Start tracing samples.
+     *
+     * @param [in] sampling : trace one of each \c sampling samples (values lower than 1 are taken as 1)
+     */
+    DDSROUTER_CORE_DllAPI static void enable(
+            const uint32_t sampling = 1) noexcept;
+
+    //! Stop tracing samples (events already recorded are kept)
+    DDSROUTER_CORE_DllAPI static void disable() noexcept;
+
+    //! Whether samples are being traced
+    DDSROUTER_CORE_DllAPI static bool enabled() noexcept;
+
+    //! Id of a text (e.g. a topic name) to be referenced by the events
+    DDSROUTER_CORE_DllAPI static uint32_t label(
+            const std::string& text);
+
+    /**
+     * @brief Decide whether the next sample is traced.
+     *
+     * @return id of the sample if it must be traced, 0 otherwise
+     */
+    DDSROUTER_CORE_DllAPI static uint64_t sample() noexcept;
+
+    //! Record \c event in the ring buffer of the current thread
+    DDSROUTER_CORE_DllAPI static void record(
+            const TraceEvent& event) noexcept;
+
+    //! Events recorded in every thread, in the Chrome trace event format (JSON)
+    DDSROUTER_CORE_DllAPI static std::string to_chrome_trace();
+
+    /**
+     * @brief Write the events recorded in every thread to \c file_name in the Chrome trace event format.
+     *
+     * @return whether the file has been written
+     */
+    DDSROUTER_CORE_DllAPI static bool export_chrome_trace(
+            const std::string& file_name) noexcept;
+
+    //! Forget every event recorded
+    DDSROUTER_CORE_DllAPI static void clear() noexcept;
+
+    //! Steady clock time in nanoseconds, as used in the events
+    DDSROUTER_CORE_DllAPI static int64_t now() noexcept;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#if defined(DDSROUTER_TRACING_ENABLED)
+
+//! Id of the sample to trace (0 if it must not be traced)
+#define DDSROUTER_TRACE_SAMPLE() ::eprosima::ddsrouter::core::Tracer::sample()
+
+//! Record a \c TraceEvent
+#define DDSROUTER_TRACE_SPAN(event) ::eprosima::ddsrouter::core::Tracer::record(event)
+
+#else
+
+#define DDSROUTER_TRACE_SAMPLE() (static_cast<uint64_t>(0))
+
+#define DDSROUTER_TRACE_SPAN(event)
+
+#endif // if defined(DDSROUTER_TRACING_ENABLED)
@@ -0,0 +1,195 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/transport/UdpBackend.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Default number of entries of the submission queue of an io_uring
+constexpr uint32_t IO_URING_DEFAULT_RING_ENTRIES = 64;
+
+//! Submission and completion queues shared with the kernel, defined in the source file
+class IoUring;
+
+/**
+ * Sends datagrams through an io_uring.
+ *
+ * Each datagram is copied to a buffer of the sender, and one send operation per destination is queued in the ring
+ * and submitted with a single system call.
+ * The call returns without waiting for the sends, whose buffers are reused once they complete.
+ * With a kernel polling thread (SQPOLL) no system call is needed while the thread is awake.
+ *
+ * It is only available in Linux 5.11 or higher.
+ */
+class IoUringUdpSender : public IUdpSender
+{
+public:
+
+    /**
+     * @brief Open a UDP socket and an io_uring to send through it.
+     *
+     * @param [in] options : options of the socket
+     * @param [in] ring_entries : sends that can be in flight at the same time
+     * @param [in] sqpoll : whether the kernel polls the submission queue from a thread of its own
+     *
+     * @throw \c InitializationException if the socket or the ring cannot be created
+     */
+    DDSROUTER_CORE_DllAPI IoUringUdpSender(
+            const UdpSocketOptions& options,
+            const uint32_t ring_entries = IO_URING_DEFAULT_RING_ENTRIES,
+            const bool sqpoll = false);
+
+    //! Wait for the sends in flight and close the ring and the socket
+    DDSROUTER_CORE_DllAPI ~IoUringUdpSender();
+
+    IoUringUdpSender(
+            const IoUringUdpSender&) = delete;
+
+    IoUringUdpSender& operator =(
+            const IoUringUdpSender&) = delete;
+
+    //! Queue a send per destination and submit them, without waiting for them to complete
+    DDSROUTER_CORE_DllAPI bool send_to(
+            const void* data,
+            const uint32_t size,
+            const std::vector<UdpEndpoint>& destinations) noexcept override;
+
+protected:
+
+    //! Arguments of a send in flight, that must outlive it
+    struct SendOperation;
+
+    //! Release the operations and buffers of the sends completed
+    void reap_completions_() noexcept;
+
+    //! Wait until an operation is free. Return false if the sends in flight do not complete
+    bool wait_free_operation_() noexcept;
+
+    //! Native socket handle
+    int socket_ {-1};
+
+    //! Ring where the sends are queued
+    std::unique_ptr<IoUring> ring_;
+
+    //! Arguments of each send, indexed by the user data of its entry
+    std::unique_ptr<SendOperation[]> operations_;
+
+    //! Indexes of the operations not in flight
+    std::vector<uint32_t> free_operations_;
+
+    //! Copies of the datagrams in flight, indexed as the operations
+    std::vector<std::vector<uint8_t>> buffers_;
+
+    //! Sends in flight of each buffer
+    std::vector<uint32_t> buffer_references_;
+
+    //! Indexes of the buffers not in flight
+    std::vector<uint32_t> free_buffers_;
+
+    //! Protects the ring and the operations
+    std::mutex mutex_;
+};
+
+/**
+ * Receives the datagrams of an address through an io_uring, from an internal thread.
+ *
+ * A single multishot receive operation produces a completion per datagram, each in one of a ring of buffers
+ * provided to the kernel beforehand, so no system call is needed per datagram while datagrams keep arriving.
+ * The buffer is given back to the kernel once the callback returns.
+ *
+ * It is only available in Linux 6.0 or higher.
+ */
+class IoUringUdpReceiver : public IUdpReceiver
+{
+public:
+
+    /**
+     * @brief Bind a UDP socket to \c endpoint and start receiving its datagrams.
+     *
+     * @param [in] endpoint : address and port to bind (port 0 binds any free port)
+     * @param [in] interfaces : interfaces where a multicast \c endpoint is joined
+     * @param [in] max_datagram_size : bytes above which datagrams are discarded
+     * @param [in] options : options of the socket
+     * @param [in] ring_entries : buffers provided to the kernel
+     * @param [in] callback : function called with each datagram received
+     *
+     * @throw \c InitializationException if the socket cannot be bound or the kernel does not support the ring
+     */
+    DDSROUTER_CORE_DllAPI IoUringUdpReceiver(
+            const UdpEndpoint& endpoint,
+            const std::vector<UdpEndpoint>& interfaces,
+            const uint32_t max_datagram_size,
+            const UdpSocketOptions& options,
+            const uint32_t ring_entries,
+            const DatagramCallback& callback);
+
+    //! Stop receiving datagrams and close the ring and the socket
+    DDSROUTER_CORE_DllAPI ~IoUringUdpReceiver();
+
+    IoUringUdpReceiver(
+            const IoUringUdpReceiver&) = delete;
+
+    IoUringUdpReceiver& operator =(
+            const IoUringUdpReceiver&) = delete;
+
+    DDSROUTER_CORE_DllAPI uint16_t port() const noexcept override;
+
+protected:
+
+    //! Internal thread routine
+    void run_() noexcept;
+
+    //! Queue the multishot receive operation. Return false if it cannot be queued
+    bool arm_() noexcept;
+
+    //! Handle the completions available. Return false if the receive operation has failed
+    bool process_completions_() noexcept;
+
+    //! Native socket handle
+    int socket_ {-1};
+
+    //! Port the socket is bound to
+    uint16_t port_ {0};
+
+    //! Callback called with each datagram received
+    DatagramCallback callback_;
+
+    //! Ring where the receive operation runs
+    std::unique_ptr<IoUring> ring_;
+
+    //! Whether the receive operation must be submitted again
+    bool rearm_ {false};
+
+    //! Whether the internal thread must stop
+    std::atomic<bool> stop_ {false};
+
+    //! Internal thread
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
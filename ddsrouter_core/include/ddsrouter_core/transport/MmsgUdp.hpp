@@ -0,0 +1,209 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/transport/UdpBackend.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Default number of datagrams sent or received in each system call of the mmsg backend
+constexpr uint32_t MMSG_DEFAULT_BATCH_SIZE = 32;
+
+/**
+ * Sends datagrams in batches with \c sendmmsg .
+ *
+ * A datagram is sent to every destination in a single system call.
+ * While a thread is sending, the datagrams of other threads are queued, and that thread sends them all in its next
+ * system call, so the batches grow with the load without delaying any datagram.
+ * With UDP segmentation offload (GSO), the datagrams of a batch to the same destination are coalesced in a single
+ * message that the kernel (or the network card) splits, as long as they fit in an Ethernet frame.
+ *
+ * It is only available in Linux.
+ */
+class MmsgUdpSender : public IUdpSender
+{
+public:
+
+    /**
+     * @brief Open a UDP socket to send datagrams in batches.
+     *
+     * @param [in] options : options of the socket
+     * @param [in] batch_size : maximum messages per system call
+     * @param [in] offload : whether to use UDP segmentation offload if the kernel supports it
+     *
+     * @throw \c InitializationException if the socket cannot be created
+     */
+    DDSROUTER_CORE_DllAPI MmsgUdpSender(
+            const UdpSocketOptions& options,
+            const uint32_t batch_size = MMSG_DEFAULT_BATCH_SIZE,
+            const bool offload = true);
+
+    //! Close the socket
+    DDSROUTER_CORE_DllAPI ~MmsgUdpSender();
+
+    MmsgUdpSender(
+            const MmsgUdpSender&) = delete;
+
+    MmsgUdpSender& operator =(
+            const MmsgUdpSender&) = delete;
+
+    //! Send the datagram, and the ones queued meanwhile by other threads, or queue it if another thread is sending
+    DDSROUTER_CORE_DllAPI bool send_to(
+            const void* data,
+            const uint32_t size,
+            const std::vector<UdpEndpoint>& destinations) noexcept override;
+
+    //! Whether the datagrams are coalesced with UDP segmentation offload
+    DDSROUTER_CORE_DllAPI bool offload() const noexcept;
+
+protected:
+
+    //! Copy of a datagram queued to be sent
+    struct Datagram
+    {
+        std::vector<uint8_t> data;
+        std::vector<UdpEndpoint> destinations;
+    };
+
+    //! Send \c datagrams in as few system calls as possible. Return false if any send fails
+    bool send_datagrams_(
+            const std::vector<Datagram>& datagrams) noexcept;
+
+    //! Native socket handle
+    int socket_ {-1};
+
+    //! Maximum messages per system call
+    uint32_t batch_size_;
+
+    //! Whether the datagrams are coalesced with UDP segmentation offload
+    std::atomic<bool> offload_ {false};
+
+    //! Datagrams queued while another thread is sending
+    std::vector<Datagram> pending_;
+
+    //! Datagrams already sent, kept to reuse their memory
+    std::vector<Datagram> free_datagrams_;
+
+    //! Whether a thread is sending
+    bool sending_ {false};
+
+    //! Notified each time the sending thread takes the pending datagrams
+    std::condition_variable pending_taken_;
+
+    //! Protects the pending and free datagrams
+    std::mutex mutex_;
+};
+
+/**
+ * Receives the datagrams of an address in batches with \c recvmmsg , from an internal thread.
+ *
+ * Every datagram waiting in the socket, up to the batch size, is read in a single system call.
+ * With UDP receive offload (GRO), the kernel delivers the datagrams of the same flow coalesced, so a single read
+ * may bring several of them, that are split again before calling the callback.
+ *
+ * It is only available in Linux.
+ */
+class MmsgUdpReceiver : public IUdpReceiver
+{
+public:
+
+    /**
+     * @brief Bind a UDP socket to \c endpoint and start receiving its datagrams.
+     *
+     * @param [in] endpoint : address and port to bind (port 0 binds any free port)
+     * @param [in] interfaces : interfaces where a multicast \c endpoint is joined
+     * @param [in] max_datagram_size : bytes above which datagrams are discarded
+     * @param [in] options : options of the socket
+     * @param [in] batch_size : maximum datagrams per system call
+     * @param [in] offload : whether to use UDP receive offload if the kernel supports it
+     * @param [in] callback : function called with each datagram received
+     *
+     * @throw \c InitializationException if the socket cannot be bound
+     */
+    DDSROUTER_CORE_DllAPI MmsgUdpReceiver(
+            const UdpEndpoint& endpoint,
+            const std::vector<UdpEndpoint>& interfaces,
+            const uint32_t max_datagram_size,
+            const UdpSocketOptions& options,
+            const uint32_t batch_size,
+            const bool offload,
+            const DatagramCallback& callback);
+
+    //! Stop receiving datagrams and close the socket
+    DDSROUTER_CORE_DllAPI ~MmsgUdpReceiver();
+
+    MmsgUdpReceiver(
+            const MmsgUdpReceiver&) = delete;
+
+    MmsgUdpReceiver& operator =(
+            const MmsgUdpReceiver&) = delete;
+
+    DDSROUTER_CORE_DllAPI uint16_t port() const noexcept override;
+
+    //! Whether the datagrams are received with UDP receive offload
+    DDSROUTER_CORE_DllAPI bool offload() const noexcept;
+
+protected:
+
+    //! Headers and buffers of a batch, defined in the source file
+    struct Batch;
+
+    //! Internal thread routine
+    void run_() noexcept;
+
+    //! Call the callback with each datagram of the first \c received messages of the batch
+    void process_batch_(
+            const uint32_t received) noexcept;
+
+    //! Native socket handle
+    int socket_ {-1};
+
+    //! Port the socket is bound to
+    uint16_t port_ {0};
+
+    //! Bytes above which datagrams are discarded
+    uint32_t max_datagram_size_;
+
+    //! Whether the datagrams are received with UDP receive offload
+    bool offload_ {false};
+
+    //! Callback called with each datagram received
+    DatagramCallback callback_;
+
+    //! Messages read in each system call
+    std::unique_ptr<Batch> batch_;
+
+    //! Whether the internal thread must stop
+    std::atomic<bool> stop_ {false};
+
+    //! Internal thread
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
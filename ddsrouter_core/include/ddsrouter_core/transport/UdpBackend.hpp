@@ -0,0 +1,150 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! I/O backend of the UDP transport of a participant
+enum class UdpIoBackend : uint8_t
+{
+    //! Builtin UDP transport of Fast DDS
+    fastdds,
+
+    //! io_uring, with batched submissions and multishot receive (\c IoUringUdpSender and \c IoUringUdpReceiver )
+    io_uring,
+
+    //! Batched system calls, with UDP segmentation and receive offload (\c MmsgUdpSender and \c MmsgUdpReceiver )
+    mmsg,
+};
+
+//! IPv4 address and port of a datagram
+struct UdpEndpoint
+{
+    //! Whether the address is a multicast group
+    DDSROUTER_CORE_DllAPI bool is_multicast() const noexcept;
+
+    //! Whether the address is 0.0.0.0
+    DDSROUTER_CORE_DllAPI bool is_any() const noexcept;
+
+    DDSROUTER_CORE_DllAPI bool operator ==(
+            const UdpEndpoint& other) const noexcept;
+
+    //! IPv4 address, in network order
+    std::array<uint8_t, 4> address {};
+
+    //! Port
+    uint16_t port {0};
+};
+
+//! Options of the sockets of a UDP backend
+struct UdpSocketOptions
+{
+    //! Bytes of the send buffer of the socket (0 keeps the system default)
+    uint32_t send_buffer_size {0};
+
+    //! Bytes of the receive buffer of the socket (0 keeps the system default)
+    uint32_t receive_buffer_size {0};
+
+    //! Time to live of the multicast datagrams sent
+    uint8_t multicast_ttl {1};
+
+    //! Microseconds the socket busy polls the device while waiting for datagrams (0 keeps the system default)
+    uint32_t busy_poll {0};
+
+    //! Type of service of the datagrams sent (0 keeps the system default)
+    uint8_t type_of_service {0};
+};
+
+/**
+ * Sends datagrams through an I/O backend other than the Fast DDS one.
+ *
+ * It is thread safe.
+ */
+class IUdpSender
+{
+public:
+
+    virtual ~IUdpSender() = default;
+
+    /**
+     * @brief Send the same datagram to every destination.
+     *
+     * The datagram may be lost, as with any UDP socket.
+     *
+     * @return whether the datagram has been handed to the system for every destination
+     */
+    virtual bool send_to(
+            const void* data,
+            const uint32_t size,
+            const std::vector<UdpEndpoint>& destinations) noexcept = 0;
+};
+
+/**
+ * Receives the datagrams of an address from an internal thread, through an I/O backend other than the Fast DDS one.
+ *
+ * The thread is stopped when the receiver is destroyed.
+ */
+class IUdpReceiver
+{
+public:
+
+    //! Callback called with each datagram received, only valid during the call
+    using DatagramCallback = std::function<void (const uint8_t* data, uint32_t size, const UdpEndpoint& source)>;
+
+    virtual ~IUdpReceiver() = default;
+
+    //! Port the socket is bound to
+    virtual uint16_t port() const noexcept = 0;
+};
+
+/**
+ * @brief Open a UDP socket to send datagrams.
+ *
+ * @return native socket handle
+ *
+ * @throw \c InitializationException if the socket cannot be created
+ */
+DDSROUTER_CORE_DllAPI int open_udp_sender_socket(
+        const UdpSocketOptions& options);
+
+/**
+ * @brief Open a UDP socket bound to \c endpoint to receive datagrams.
+ *
+ * If \c endpoint is a multicast group, the socket is bound to its port in every interface, shared with other
+ * sockets, and joins the group in each of \c interfaces (or in the default one if empty).
+ *
+ * @return native socket handle
+ *
+ * @throw \c InitializationException if the socket cannot be bound
+ */
+DDSROUTER_CORE_DllAPI int open_udp_receiver_socket(
+        const UdpEndpoint& endpoint,
+        const std::vector<UdpEndpoint>& interfaces,
+        const UdpSocketOptions& options);
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
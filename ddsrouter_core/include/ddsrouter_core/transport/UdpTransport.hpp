@@ -0,0 +1,172 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <fastdds/rtps/transport/TransportInterface.h>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/transport/UdpBackend.hpp>
+#include <ddsrouter_core/transport/UdpTransportDescriptor.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Fast DDS UDPv4 transport whose sockets use the I/O backend of a \c UdpTransportDescriptor .
+ *
+ * Each input channel is an \c IUdpReceiver bound to its port (and joined to its group if multicast), and every output
+ * channel shares an \c IUdpSender , so an RTPS message is sent to all its destinations at once.
+ * Its locators are the same as those of the Fast DDS UDPv4 transport, so it interoperates with it.
+ */
+class UdpTransport : public fastdds::rtps::TransportInterface
+{
+public:
+
+    DDSROUTER_CORE_DllAPI UdpTransport(
+            const UdpTransportDescriptor& descriptor);
+
+    DDSROUTER_CORE_DllAPI ~UdpTransport() override;
+
+    DDSROUTER_CORE_DllAPI bool init(
+            const fastrtps::rtps::PropertyPolicy* properties = nullptr) override;
+
+    DDSROUTER_CORE_DllAPI bool IsInputChannelOpen(
+            const fastrtps::rtps::Locator_t& locator) const override;
+
+    DDSROUTER_CORE_DllAPI bool IsLocatorSupported(
+            const fastrtps::rtps::Locator_t& locator) const override;
+
+    DDSROUTER_CORE_DllAPI bool is_locator_allowed(
+            const fastrtps::rtps::Locator_t& locator) const override;
+
+    DDSROUTER_CORE_DllAPI fastrtps::rtps::Locator_t RemoteToMainLocal(
+            const fastrtps::rtps::Locator_t& remote) const override;
+
+    DDSROUTER_CORE_DllAPI bool OpenOutputChannel(
+            fastdds::rtps::SendResourceList& sender_resource_list,
+            const fastrtps::rtps::Locator_t& locator) override;
+
+    DDSROUTER_CORE_DllAPI bool OpenInputChannel(
+            const fastrtps::rtps::Locator_t& locator,
+            fastdds::rtps::TransportReceiverInterface* receiver,
+            uint32_t max_message_size) override;
+
+    DDSROUTER_CORE_DllAPI bool CloseInputChannel(
+            const fastrtps::rtps::Locator_t& locator) override;
+
+    DDSROUTER_CORE_DllAPI bool DoInputLocatorsMatch(
+            const fastrtps::rtps::Locator_t& left,
+            const fastrtps::rtps::Locator_t& right) const override;
+
+    DDSROUTER_CORE_DllAPI fastrtps::rtps::LocatorList_t NormalizeLocator(
+            const fastrtps::rtps::Locator_t& locator) override;
+
+    DDSROUTER_CORE_DllAPI bool is_local_locator(
+            const fastrtps::rtps::Locator_t& locator) const override;
+
+    DDSROUTER_CORE_DllAPI fastdds::rtps::TransportDescriptorInterface* get_configuration() override;
+
+    DDSROUTER_CORE_DllAPI void AddDefaultOutputLocator(
+            fastrtps::rtps::LocatorList_t& default_list) override;
+
+    DDSROUTER_CORE_DllAPI bool getDefaultMetatrafficMulticastLocators(
+            fastrtps::rtps::LocatorList_t& locators,
+            uint32_t metatraffic_multicast_port) const override;
+
+    DDSROUTER_CORE_DllAPI bool getDefaultMetatrafficUnicastLocators(
+            fastrtps::rtps::LocatorList_t& locators,
+            uint32_t metatraffic_unicast_port) const override;
+
+    DDSROUTER_CORE_DllAPI bool getDefaultUnicastLocators(
+            fastrtps::rtps::LocatorList_t& locators,
+            uint32_t unicast_port) const override;
+
+    DDSROUTER_CORE_DllAPI bool fillMetatrafficMulticastLocator(
+            fastrtps::rtps::Locator_t& locator,
+            uint32_t metatraffic_multicast_port) const override;
+
+    DDSROUTER_CORE_DllAPI bool fillMetatrafficUnicastLocator(
+            fastrtps::rtps::Locator_t& locator,
+            uint32_t metatraffic_unicast_port) const override;
+
+    DDSROUTER_CORE_DllAPI bool configureInitialPeerLocator(
+            fastrtps::rtps::Locator_t& locator,
+            const fastrtps::rtps::PortParameters& port_params,
+            uint32_t domain_id,
+            fastrtps::rtps::LocatorList_t& list) const override;
+
+    DDSROUTER_CORE_DllAPI bool fillUnicastLocator(
+            fastrtps::rtps::Locator_t& locator,
+            uint32_t well_known_port) const override;
+
+    DDSROUTER_CORE_DllAPI uint32_t max_recv_buffer_size() const override;
+
+    DDSROUTER_CORE_DllAPI void select_locators(
+            fastrtps::rtps::LocatorSelector& selector) const override;
+
+    /**
+     * @brief Send a message to every UDPv4 locator between \c begin and \c end .
+     *
+     * A message that cannot be delivered is lost, and recovered by the RTPS reliability if any.
+     *
+     * @return whether the transport is initialized
+     */
+    DDSROUTER_CORE_DllAPI bool send(
+            const fastrtps::rtps::octet* data,
+            uint32_t size,
+            fastrtps::rtps::LocatorsIterator* begin,
+            fastrtps::rtps::LocatorsIterator* end) noexcept;
+
+protected:
+
+    //! Options of the sockets, from the configuration
+    UdpSocketOptions socket_options_() const;
+
+    //! Index of the input channel of \c locator
+    static std::pair<uint32_t, std::array<uint8_t, 4>> input_channel_key_(
+            const fastrtps::rtps::Locator_t& locator);
+
+    //! Whether \c locator is the address of an interface of the whitelist (every address if it is empty)
+    bool is_interface_allowed_(
+            const fastrtps::rtps::Locator_t& locator) const;
+
+    //! Configuration of the transport
+    UdpTransportDescriptor configuration_;
+
+    //! Addresses of the interfaces of the whitelist
+    std::vector<UdpEndpoint> interfaces_;
+
+    //! Socket shared by every output channel
+    std::unique_ptr<IUdpSender> sender_;
+
+    //! Input channels indexed by port and group (0.0.0.0 for unicast, that is received in every interface)
+    std::map<std::pair<uint32_t, std::array<uint8_t, 4>>, std::unique_ptr<IUdpReceiver>> input_channels_;
+
+    //! Protects \c input_channels_
+    mutable std::mutex input_channels_mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,70 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/transport/IoUringUdp.hpp>
+#include <ddsrouter_core/transport/MmsgUdp.hpp>
+#include <ddsrouter_core/transport/UdpBackend.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Descriptor of a UDPv4 transport whose sockets use an I/O backend other than the Fast DDS one.
+ *
+ * It keeps every setting of the Fast DDS descriptor it is created from (buffer sizes, whitelist, TTL, etc.), and
+ * creates the Fast DDS transport itself if \c backend is \c UdpIoBackend::fastdds .
+ */
+struct UdpTransportDescriptor : public fastdds::rtps::UDPv4TransportDescriptor
+{
+    DDSROUTER_CORE_DllAPI UdpTransportDescriptor() = default;
+
+    //! Descriptor with the settings of \c descriptor
+    DDSROUTER_CORE_DllAPI UdpTransportDescriptor(
+            const fastdds::rtps::UDPv4TransportDescriptor& descriptor);
+
+    DDSROUTER_CORE_DllAPI fastdds::rtps::TransportInterface* create_transport() const override;
+
+    //! I/O backend of the sockets
+    UdpIoBackend backend {UdpIoBackend::io_uring};
+
+    //! Entries of the io_uring of each socket
+    uint32_t ring_entries {IO_URING_DEFAULT_RING_ENTRIES};
+
+    //! Whether a kernel thread polls the submission queue of the io_uring of the sender
+    bool sqpoll {false};
+
+    //! Datagrams sent or received in each system call of the mmsg backend
+    uint32_t batch_size {MMSG_DEFAULT_BATCH_SIZE};
+
+    //! Whether the mmsg backend uses UDP segmentation and receive offload
+    bool offload {true};
+
+    //! Microseconds the sockets busy poll the device while waiting for datagrams (0 keeps the system default)
+    uint32_t busy_poll {0};
+
+    //! Type of service of the datagrams sent (0 keeps the system default)
+    uint8_t type_of_service {0};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
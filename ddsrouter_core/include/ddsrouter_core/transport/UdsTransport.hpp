@@ -0,0 +1,162 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <fastdds/rtps/transport/TransportInterface.h>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/transport/UdsTransportDescriptor.hpp>
+#include <ddsrouter_core/transport/UnixSocket.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Fast DDS transport over Unix domain datagram sockets, created from a \c UdsTransportDescriptor .
+ *
+ * Each input channel is a \c UnixSocketReceiver bound to the socket file of its port, and every output channel shares
+ * a \c UnixSocketSender .
+ * An RTPS message larger than the memory file threshold (e.g. every fragment of a large sample grouped together) is
+ * passed in a memory file, and Fast DDS reads it from the mapping without copying it out of the socket.
+ */
+class UdsTransport : public fastdds::rtps::TransportInterface
+{
+public:
+
+    DDSROUTER_CORE_DllAPI UdsTransport(
+            const UdsTransportDescriptor& descriptor);
+
+    DDSROUTER_CORE_DllAPI ~UdsTransport() override;
+
+    DDSROUTER_CORE_DllAPI bool init(
+            const fastrtps::rtps::PropertyPolicy* properties = nullptr) override;
+
+    DDSROUTER_CORE_DllAPI bool IsInputChannelOpen(
+            const fastrtps::rtps::Locator_t& locator) const override;
+
+    DDSROUTER_CORE_DllAPI bool IsLocatorSupported(
+            const fastrtps::rtps::Locator_t& locator) const override;
+
+    DDSROUTER_CORE_DllAPI bool is_locator_allowed(
+            const fastrtps::rtps::Locator_t& locator) const override;
+
+    DDSROUTER_CORE_DllAPI fastrtps::rtps::Locator_t RemoteToMainLocal(
+            const fastrtps::rtps::Locator_t& remote) const override;
+
+    DDSROUTER_CORE_DllAPI bool OpenOutputChannel(
+            fastdds::rtps::SendResourceList& sender_resource_list,
+            const fastrtps::rtps::Locator_t& locator) override;
+
+    DDSROUTER_CORE_DllAPI bool OpenInputChannel(
+            const fastrtps::rtps::Locator_t& locator,
+            fastdds::rtps::TransportReceiverInterface* receiver,
+            uint32_t max_message_size) override;
+
+    DDSROUTER_CORE_DllAPI bool CloseInputChannel(
+            const fastrtps::rtps::Locator_t& locator) override;
+
+    DDSROUTER_CORE_DllAPI bool DoInputLocatorsMatch(
+            const fastrtps::rtps::Locator_t& left,
+            const fastrtps::rtps::Locator_t& right) const override;
+
+    DDSROUTER_CORE_DllAPI fastrtps::rtps::LocatorList_t NormalizeLocator(
+            const fastrtps::rtps::Locator_t& locator) override;
+
+    DDSROUTER_CORE_DllAPI bool is_local_locator(
+            const fastrtps::rtps::Locator_t& locator) const override;
+
+    DDSROUTER_CORE_DllAPI fastdds::rtps::TransportDescriptorInterface* get_configuration() override;
+
+    DDSROUTER_CORE_DllAPI void AddDefaultOutputLocator(
+            fastrtps::rtps::LocatorList_t& default_list) override;
+
+    DDSROUTER_CORE_DllAPI bool getDefaultMetatrafficMulticastLocators(
+            fastrtps::rtps::LocatorList_t& locators,
+            uint32_t metatraffic_multicast_port) const override;
+
+    DDSROUTER_CORE_DllAPI bool getDefaultMetatrafficUnicastLocators(
+            fastrtps::rtps::LocatorList_t& locators,
+            uint32_t metatraffic_unicast_port) const override;
+
+    DDSROUTER_CORE_DllAPI bool getDefaultUnicastLocators(
+            fastrtps::rtps::LocatorList_t& locators,
+            uint32_t unicast_port) const override;
+
+    DDSROUTER_CORE_DllAPI bool fillMetatrafficMulticastLocator(
+            fastrtps::rtps::Locator_t& locator,
+            uint32_t metatraffic_multicast_port) const override;
+
+    DDSROUTER_CORE_DllAPI bool fillMetatrafficUnicastLocator(
+            fastrtps::rtps::Locator_t& locator,
+            uint32_t metatraffic_unicast_port) const override;
+
+    DDSROUTER_CORE_DllAPI bool configureInitialPeerLocator(
+            fastrtps::rtps::Locator_t& locator,
+            const fastrtps::rtps::PortParameters& port_params,
+            uint32_t domain_id,
+            fastrtps::rtps::LocatorList_t& list) const override;
+
+    DDSROUTER_CORE_DllAPI bool fillUnicastLocator(
+            fastrtps::rtps::Locator_t& locator,
+            uint32_t well_known_port) const override;
+
+    DDSROUTER_CORE_DllAPI uint32_t max_recv_buffer_size() const override;
+
+    DDSROUTER_CORE_DllAPI void select_locators(
+            fastrtps::rtps::LocatorSelector& selector) const override;
+
+    /**
+     * @brief Send a message to every Unix domain socket locator between \c begin and \c end .
+     *
+     * A message that cannot be delivered (e.g. to a locator without receiver, or with its queue full) is lost, as an
+     * UDP datagram would, and recovered by the RTPS reliability if any.
+     *
+     * @return whether the transport is initialized
+     */
+    DDSROUTER_CORE_DllAPI bool send(
+            const fastrtps::rtps::octet* data,
+            uint32_t size,
+            fastrtps::rtps::LocatorsIterator* begin,
+            fastrtps::rtps::LocatorsIterator* end) noexcept;
+
+    //! Path of the socket file of \c port
+    DDSROUTER_CORE_DllAPI std::string socket_path(
+            const uint32_t port) const;
+
+protected:
+
+    //! Configuration of the transport
+    UdsTransportDescriptor configuration_;
+
+    //! Socket shared by every output channel
+    std::unique_ptr<UnixSocketSender> sender_;
+
+    //! Input channels indexed by port
+    std::map<uint32_t, std::unique_ptr<UnixSocketReceiver>> input_channels_;
+
+    //! Protects \c input_channels_
+    mutable std::mutex input_channels_mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,62 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <fastdds/rtps/transport/TransportDescriptorInterface.h>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/transport/UnixSocket.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Locator kind of the Unix domain socket transport ("UDS" in ASCII)
+constexpr int32_t LOCATOR_KIND_UDS = 0x00554453;
+
+/**
+ * Descriptor of a Fast DDS transport over Unix domain sockets, to communicate participants in the same host
+ * (or in containers sharing \c socket_directory ) without going through the network stack.
+ *
+ * Each locator is a socket file in \c socket_directory named after its port, so participants are discovered through
+ * the initial peers of their domain, as with UDP.
+ */
+struct UdsTransportDescriptor : public fastdds::rtps::TransportDescriptorInterface
+{
+    //! Default bytes of the largest message sent
+    static constexpr uint32_t DEFAULT_MAX_MESSAGE_SIZE = 1024 * 1024;
+
+    //! Default number of participants of the domain reached through the initial peers
+    static constexpr uint32_t DEFAULT_MAX_INITIAL_PEERS_RANGE = 16;
+
+    DDSROUTER_CORE_DllAPI UdsTransportDescriptor();
+
+    DDSROUTER_CORE_DllAPI fastdds::rtps::TransportInterface* create_transport() const override;
+
+    DDSROUTER_CORE_DllAPI uint32_t min_send_buffer_size() const override;
+
+    //! Directory where the socket files are created
+    std::string socket_directory {"/tmp"};
+
+    //! Bytes above which messages are passed in a memory file instead of inline in the datagram
+    uint32_t memfd_threshold {UNIX_SOCKET_MAX_INLINE_SIZE};
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
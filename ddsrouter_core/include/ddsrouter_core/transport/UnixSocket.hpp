@@ -0,0 +1,165 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Largest message sent inline in a datagram, bigger ones are passed in a memory file
+constexpr uint32_t UNIX_SOCKET_MAX_INLINE_SIZE = 65536;
+
+//! Longest path of a socket file
+constexpr std::size_t UNIX_SOCKET_MAX_PATH_SIZE = 107;
+
+//! Path of the socket file of \c port in \c directory
+DDSROUTER_CORE_DllAPI std::string unix_socket_path(
+        const std::string& directory,
+        const uint32_t port);
+
+/**
+ * Sends messages to the \c UnixSocketReceiver bound to a path, through Unix domain datagram sockets.
+ *
+ * Messages larger than a threshold are written in a sealed memory file whose descriptor is passed to the receiver
+ * (SCM_RIGHTS), that maps it instead of copying the message out of the socket.
+ * The message is never fragmented, whatever its size.
+ *
+ * It is only available in Linux.
+ */
+class UnixSocketSender
+{
+public:
+
+    /**
+     * @brief Open a new Unix domain datagram socket.
+     *
+     * @param [in] memfd_threshold : bytes above which messages are passed in a memory file
+     *
+     * @throw \c InitializationException if the socket cannot be created
+     */
+    DDSROUTER_CORE_DllAPI UnixSocketSender(
+            const uint32_t memfd_threshold = UNIX_SOCKET_MAX_INLINE_SIZE);
+
+    //! Close the socket
+    DDSROUTER_CORE_DllAPI ~UnixSocketSender();
+
+    UnixSocketSender(
+            const UnixSocketSender&) = delete;
+
+    UnixSocketSender& operator =(
+            const UnixSocketSender&) = delete;
+
+    /**
+     * @brief Send a message to the receiver bound to \c path .
+     *
+     * It does not block: if the queue of the receiver is full the message is dropped, as an UDP datagram would.
+     *
+     * @return whether the message has been sent
+     */
+    DDSROUTER_CORE_DllAPI bool send_to(
+            const void* data,
+            const uint32_t size,
+            const std::string& path) noexcept;
+
+protected:
+
+    //! Native socket handle
+    int socket_ {-1};
+
+    //! Bytes above which messages are passed in a memory file
+    uint32_t memfd_threshold_;
+};
+
+/**
+ * Receives the messages sent by \c UnixSocketSender to a path, from an internal thread.
+ *
+ * It is only available in Linux.
+ */
+class UnixSocketReceiver
+{
+public:
+
+    //! Callback called with each message received, only valid during the call
+    using MessageCallback = std::function<void (const uint8_t* data, uint32_t size)>;
+
+    /**
+     * @brief Bind a Unix domain datagram socket to \c path and start receiving messages.
+     *
+     * A socket file left in \c path by a process that has finished is replaced.
+     *
+     * @param [in] path : path of the socket file
+     * @param [in] max_message_size : bytes above which messages are discarded
+     * @param [in] callback : function called with each message received
+     *
+     * @throw \c InitializationException if the path is in use or cannot be bound
+     */
+    DDSROUTER_CORE_DllAPI UnixSocketReceiver(
+            const std::string& path,
+            const uint32_t max_message_size,
+            const MessageCallback& callback);
+
+    //! Stop receiving messages and remove the socket file
+    DDSROUTER_CORE_DllAPI ~UnixSocketReceiver();
+
+    //! Path of the socket file
+    DDSROUTER_CORE_DllAPI const std::string& path() const noexcept;
+
+protected:
+
+    //! Internal thread routine
+    void run_() noexcept;
+
+    //! Read a message, if any, and call the callback with it. Return whether a message has been read
+    bool receive_() noexcept;
+
+    //! Call the callback with the message in the memory file \c fd , and close it
+    void receive_memfd_(
+            const int fd) noexcept;
+
+    //! Path of the socket file
+    std::string path_;
+
+    //! Bytes above which messages are discarded
+    uint32_t max_message_size_;
+
+    //! Callback called with each message received
+    MessageCallback callback_;
+
+    //! Native socket handle
+    int socket_ {-1};
+
+    //! Buffer where the inline messages are read
+    std::vector<uint8_t> buffer_;
+
+    //! Whether the internal thread must stop
+    std::atomic<bool> stop_ {false};
+
+    //! Internal thread
+    std::thread thread_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
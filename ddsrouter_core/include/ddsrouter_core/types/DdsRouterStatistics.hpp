@@ -0,0 +1,121 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+#include <cpp_utils/macros/custom_enumeration.hpp>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/LatencyHistogram.hpp>
+#include <ddsrouter_core/types/LinkStatistics.hpp>
+#include <ddsrouter_core/types/RedundancyPathStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+//! Reasons why the DDS Router does not forward a sample
+ENUMERATION_BUILDER(
+    DropReason,
+    expired,            //! Exceeds the latency budget of its topic (see max age)
+    duplicated,         //! Already received (see deduplication and redundancy groups)
+    uninterested,       //! Nobody reads its topic behind the remote DDS Router (see interest)
+    inactive_link,      //! Sent through another link of the link group
+    write_error         //! The writer failed to send it
+    );
+
+/**
+ * Traffic of a topic in a participant (or an aggregation of several of them).
+ */
+struct TrafficStatistics
+{
+    //! Add the traffic of \c other to this one
+    DDSROUTER_CORE_DllAPI TrafficStatistics& operator +=(
+            const TrafficStatistics& other) noexcept;
+
+    //! Samples received by the readers
+    uint64_t samples_received {0};
+
+    //! Bytes of the samples received by the readers
+    uint64_t bytes_received {0};
+
+    //! Samples sent by the writers
+    uint64_t samples_sent {0};
+
+    //! Bytes of the samples sent by the writers
+    uint64_t bytes_sent {0};
+
+    //! Samples not forwarded, indexed by \c DropReason
+    std::array<uint64_t, N_VALUES_DropReason> dropped_samples {};
+
+    //! Samples waiting in the readers to be forwarded when the statistics were taken
+    uint64_t unread_samples {0};
+};
+
+//! Participant a sample is received from and participant it is written in
+using Route = std::pair<ddspipe::core::types::ParticipantId, ddspipe::core::types::ParticipantId>;
+
+/**
+ * Latencies of the samples of a topic forwarded through a route.
+ */
+struct RouteLatencyStatistics
+{
+    //! Latency (in nanoseconds) from the reception of the samples in the DDS Router until they are written
+    LatencySummary router {};
+
+    //! Latency (in nanoseconds) from the source timestamp of the samples until they are written (if enabled)
+    LatencySummary source {};
+};
+
+/**
+ * Snapshot of the statistics of a DDS Router.
+ */
+struct DdsRouterStatistics
+{
+    //! Traffic of each topic, adding every participant
+    DDSROUTER_CORE_DllAPI std::map<std::string, TrafficStatistics> topics() const;
+
+    //! Traffic of each participant, adding every topic
+    DDSROUTER_CORE_DllAPI std::map<ddspipe::core::types::ParticipantId, TrafficStatistics> participants() const;
+
+    //! Traffic of each topic in each participant, indexed by topic name and participant id
+    std::map<std::string, std::map<ddspipe::core::types::ParticipantId, TrafficStatistics>> traffic {};
+
+    //! Latencies of each route of each topic, indexed by topic name and route
+    std::map<std::string, std::map<Route, RouteLatencyStatistics>> latencies {};
+
+    //! Payloads currently held by the payload pool (samples being forwarded or stored in histories)
+    uint64_t payloads_in_use {0};
+
+    //! Statistics of the participants (paths) of every redundancy group, indexed by participant id
+    std::map<ddspipe::core::types::ParticipantId, RedundancyPathStatistics> redundancy_paths {};
+
+    //! Statistics of the links of every link group, indexed by participant id
+    std::map<ddspipe::core::types::ParticipantId, LinkStatistics> links {};
+};
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
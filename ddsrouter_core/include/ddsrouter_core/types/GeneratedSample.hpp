@@ -0,0 +1,107 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Serialized sample emitted by the generator participants.
+ *
+ * It is the CDR (little endian) serialization of the type:
+ *
+ * @code
+ * struct GeneratedSample
+ * {
+ *     @key unsigned long key;
+ *     unsigned long long sequence;
+ *     unsigned long checksum;
+ *     sequence<octet> data;
+ * };
+ * @endcode
+ *
+ * The data is pseudo-random, but deterministic for a given seed and size, and the checksum is its FNV-1a hash,
+ * so the integrity of a sample can be verified by anyone that receives it.
+ * Its key is only declared as key in the topic if it has more than one instance.
+ */
+class GeneratedSample
+{
+public:
+
+    //! Default name of the type of the generated samples
+    DDSROUTER_CORE_DllAPI static const char* TYPE_NAME;
+
+    //! Bytes of a serialized sample with no data: encapsulation, key, padding, sequence, checksum and data length
+    static constexpr uint32_t HEADER_SIZE = 28;
+
+    /**
+     * @brief Construct a new GeneratedSample object
+     *
+     * @param [in] seed : string that determines the data of the samples (e.g. the name of the topic)
+     * @param [in] size : bytes of the serialized sample. It cannot be lower than \c HEADER_SIZE .
+     */
+    DDSROUTER_CORE_DllAPI GeneratedSample(
+            const std::string& seed,
+            const uint32_t size);
+
+    //! Bytes of the serialized sample
+    DDSROUTER_CORE_DllAPI uint32_t size() const noexcept;
+
+    /**
+     * @brief Serialize the sample with a given key and sequence in \c buffer .
+     *
+     * @param [in] key : key of the sample
+     * @param [in] sequence : sequence of the sample
+     * @param [out] buffer : buffer of at least \c size() bytes
+     */
+    DDSROUTER_CORE_DllAPI void serialize(
+            const uint32_t key,
+            const uint64_t sequence,
+            unsigned char* buffer) const noexcept;
+
+    /**
+     * @brief Check whether \c buffer holds a generated sample with a correct checksum.
+     *
+     * @param [in] buffer : serialized sample
+     * @param [in] size : bytes of the serialized sample
+     */
+    DDSROUTER_CORE_DllAPI static bool check(
+            const unsigned char* buffer,
+            const uint32_t size) noexcept;
+
+    //! FNV-1a hash of \c size bytes
+    DDSROUTER_CORE_DllAPI static uint32_t checksum(
+            const unsigned char* data,
+            const uint32_t size) noexcept;
+
+protected:
+
+    //! Serialized sample with key and sequence 0
+    std::vector<unsigned char> sample_;
+};
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,130 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Summary of the values recorded in a \c LatencyHistogram .
+ */
+struct LatencySummary
+{
+    //! Number of values recorded
+    uint64_t count {0};
+
+    //! Median
+    uint64_t p50 {0};
+
+    //! 99th percentile
+    uint64_t p99 {0};
+
+    //! 99.9th percentile
+    uint64_t p999 {0};
+
+    //! Maximum value recorded
+    uint64_t max {0};
+};
+
+/**
+ * Histogram of latencies with logarithmic buckets (HDR style).
+ *
+ * Each power of two is divided in \c SUB_BUCKETS linear buckets, so every value up to \c MAX_VALUE is stored with a
+ * relative error lower than 1 / \c SUB_BUCKETS .
+ * Higher values are counted in the highest bucket, whose percentiles are bounded by the maximum value recorded.
+ * The range is capped so each histogram takes ~4 KB, as there is one per route and reader.
+ *
+ * Recording a value is lock free, so it can be done from the data path of several threads at the same time.
+ * Reading the percentiles while recording is allowed, although the result may not include the last values.
+ */
+class LatencyHistogram
+{
+public:
+
+    //! Number of bits used to divide each power of two
+    static constexpr unsigned int SUB_BUCKET_BITS = 4;
+
+    //! Number of linear buckets in each power of two
+    static constexpr unsigned int SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+
+    //! Number of bits of the highest value stored with bounded error (2^36 ns is ~68.7 s)
+    static constexpr unsigned int MAX_VALUE_BITS = 36;
+
+    //! Highest value stored with bounded error
+    static constexpr uint64_t MAX_VALUE = (uint64_t(1) << MAX_VALUE_BITS) - 1;
+
+    //! Total number of buckets needed to cover every value up to \c MAX_VALUE
+    static constexpr unsigned int BUCKETS = SUB_BUCKETS + (MAX_VALUE_BITS - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+    DDSROUTER_CORE_DllAPI LatencyHistogram();
+
+    //! Record a new value
+    DDSROUTER_CORE_DllAPI void record(
+            const uint64_t value) noexcept;
+
+    /**
+     * @brief Value under which \c percentile of the recorded values are.
+     *
+     * @param [in] percentile : value in range [0, 1]
+     *
+     * @return upper bound of the bucket of the percentile (or 0 if no value has been recorded)
+     */
+    DDSROUTER_CORE_DllAPI uint64_t percentile(
+            const double percentile) const noexcept;
+
+    //! Number of values recorded
+    DDSROUTER_CORE_DllAPI uint64_t count() const noexcept;
+
+    //! Maximum value recorded
+    DDSROUTER_CORE_DllAPI uint64_t max() const noexcept;
+
+    //! Count, p50, p99, p99.9 and max of the recorded values
+    DDSROUTER_CORE_DllAPI LatencySummary summary() const noexcept;
+
+    //! Forget every value recorded
+    DDSROUTER_CORE_DllAPI void reset() noexcept;
+
+protected:
+
+    //! Bucket where \c value is stored (the highest one for values over \c MAX_VALUE )
+    static unsigned int bucket_index_(
+            const uint64_t value) noexcept;
+
+    //! Highest value stored in bucket \c index
+    static uint64_t bucket_upper_bound_(
+            const unsigned int index) noexcept;
+
+    //! Number of values recorded in each bucket
+    std::array<std::atomic<uint64_t>, BUCKETS> buckets_;
+
+    //! Number of values recorded
+    std::atomic<uint64_t> count_ {0};
+
+    //! Maximum value recorded
+    std::atomic<uint64_t> max_ {0};
+};
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
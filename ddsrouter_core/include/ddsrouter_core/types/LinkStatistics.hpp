@@ -0,0 +1,52 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Statistics of a link of a link group.
+ */
+struct LinkStatistics
+{
+    //! Whether the remote DDS Router has answered the probes within the detection time
+    bool alive {false};
+
+    //! Whether the data is currently sent through this link
+    bool active {false};
+
+    //! Smoothed round trip time in nanoseconds (0 if no probe has been answered yet)
+    uint64_t round_trip_time {0};
+
+    //! Number of probes sent
+    uint64_t probes_sent {0};
+
+    //! Number of probes answered
+    uint64_t probes_received {0};
+
+    //! Number of times this link has become the active one
+    uint64_t activations {0};
+};
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -28,7 +28,13 @@ ENUMERATION_BUILDER(
     initial_peers,
     discovery_server,
     echo,
-    xml
+    xml,
+    generator,
+    sink,
+    recorder,
+    replayer,
+    shm,
+    uds
     );
 
 eProsima_ENUMERATION_BUILDER(
@@ -39,7 +45,13 @@ eProsima_ENUMERATION_BUILDER(
                     { ParticipantKind::initial_peers COMMA {"wan" COMMA "router" COMMA "initial-peers"} } COMMA
                     { ParticipantKind::discovery_server COMMA {"discovery-server" COMMA "ds" COMMA "local-ds" COMMA "local-discovery-server" COMMA "wan-ds" COMMA "wan-discovery-server"} } COMMA
                     { ParticipantKind::echo COMMA {"echo"} } COMMA
-                    { ParticipantKind::xml COMMA {"xml" COMMA "XML"} }
+                    { ParticipantKind::xml COMMA {"xml" COMMA "XML"} } COMMA
+                    { ParticipantKind::generator COMMA {"generator"} } COMMA
+                    { ParticipantKind::sink COMMA {"sink"} } COMMA
+                    { ParticipantKind::recorder COMMA {"recorder"} } COMMA
+                    { ParticipantKind::replayer COMMA {"replayer"} } COMMA
+                    { ParticipantKind::shm COMMA {"shm" COMMA "local-shm" COMMA "shared-memory"} } COMMA
+                    { ParticipantKind::uds COMMA {"uds" COMMA "unix-socket"} }
                 }
     );
 
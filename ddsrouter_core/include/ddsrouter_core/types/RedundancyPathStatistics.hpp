@@ -0,0 +1,44 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include <ddsrouter_core/types/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Statistics of a participant (path) of a redundancy group.
+ */
+struct RedundancyPathStatistics
+{
+    //! Samples received first through this path (and so forwarded)
+    uint64_t first_arrivals {0};
+
+    //! Samples received through this path after another path of the group (and so discarded)
+    uint64_t late_arrivals {0};
+
+    //! Latency (in nanoseconds) from the source timestamp to the reception in this path
+    LatencySummary latency {};
+};
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,84 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Sliding window of the last sequence numbers received from a writer.
+ *
+ * It stores one bit per sequence number in a fixed size bitmap, so its memory does not grow with the number of
+ * samples received.
+ * The window moves forward with the highest sequence number received.
+ * Sequence numbers older than the window are considered already received.
+ */
+class SequenceWindow
+{
+public:
+
+    /**
+     * @brief Construct a new SequenceWindow object
+     *
+     * @param [in] size : number of sequence numbers tracked. It is rounded up to a multiple of 64.
+     */
+    DDSROUTER_CORE_DllAPI SequenceWindow(
+            const unsigned int size);
+
+    /**
+     * @brief Register a sequence number in the window.
+     *
+     * @return true if the sequence number had not been received before
+     * @return false if it had been received before or it is older than the window
+     */
+    DDSROUTER_CORE_DllAPI bool insert(
+            const uint64_t sequence_number) noexcept;
+
+    //! Number of sequence numbers tracked
+    DDSROUTER_CORE_DllAPI unsigned int size() const noexcept;
+
+protected:
+
+    //! Whether \c sequence_number is marked as received
+    bool is_set_(
+            const uint64_t sequence_number) const noexcept;
+
+    void set_(
+            const uint64_t sequence_number) noexcept;
+
+    void clear_(
+            const uint64_t sequence_number) noexcept;
+
+    //! One bit per sequence number, indexed by sequence number modulo the size of the window
+    std::vector<uint64_t> bitmap_;
+
+    //! Highest sequence number received
+    uint64_t highest_ {0};
+
+    //! Whether any sequence number has been received
+    bool empty_ {true};
+};
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
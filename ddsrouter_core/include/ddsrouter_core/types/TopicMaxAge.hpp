@@ -0,0 +1,74 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <set>
+#include <string>
+
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddspipe_core/types/participant/ParticipantId.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Latency budget configured for a set of topics.
+ *
+ * Samples received in a topic that matches \c topic_name and \c type_name patterns older than \c max_age
+ * are discarded by the readers of the participants listed in \c participants.
+ */
+struct TopicMaxAge
+{
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    /**
+     * @brief Whether this budget applies to the readers of \c participant_id in the given topic.
+     *
+     * Name patterns accept wildcard characters.
+     * An empty set of participants applies to every participant.
+     */
+    DDSROUTER_CORE_DllAPI bool matches(
+            const std::string& topic_name,
+            const std::string& type_name,
+            const ddspipe::core::types::ParticipantId& participant_id) const noexcept;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Topic name pattern
+    std::string topic_name {"*"};
+
+    //! Type name pattern
+    std::string type_name {"*"};
+
+    //! Participants whose readers apply this budget. Empty means every participant.
+    std::set<ddspipe::core::types::ParticipantId> participants {};
+
+    //! Maximum age (in milliseconds) of a sample to be forwarded. 0 means unlimited.
+    utils::Duration_ms max_age {0};
+};
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
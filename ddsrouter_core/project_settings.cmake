@@ -32,5 +32,5 @@ set(MODULE_FIND_PACKAGES
 set(fastrtps_MINIMUM_VERSION "2.8")
 
 set(MODULE_DEPENDENCIES
-    $<$<BOOL:${WIN32}>:iphlpapi$<SEMICOLON>Shlwapi>
+    $<$<BOOL:${WIN32}>:iphlpapi$<SEMICOLON>Shlwapi$<SEMICOLON>ws2_32>
     ${MODULE_FIND_PACKAGES})
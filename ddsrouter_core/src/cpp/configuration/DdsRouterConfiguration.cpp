@@ -25,6 +25,12 @@
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
 
 #include <ddsrouter_core/configuration/DdsRouterConfiguration.hpp>
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ShmParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/UdsParticipantConfiguration.hpp>
 #include <ddsrouter_core/types/ParticipantKind.hpp>
 
 namespace eprosima {
@@ -98,6 +104,123 @@ bool DdsRouterConfiguration::is_valid(
         return false;
     }
 
+    // Check that latency budgets only refer to existing participants
+    for (const auto& topic_max_age : topic_max_ages)
+    {
+        for (const auto& participant_id : topic_max_age.participants)
+        {
+            if (ids.find(participant_id) == ids.end())
+            {
+                error_msg << "Max age of topic " << topic_max_age.topic_name << " refers to non existing participant "
+                          << participant_id << ". ";
+                return false;
+            }
+        }
+    }
+
+    // Check that duplicate suppression is only enabled in existing participants
+    for (const auto& it : deduplication_configurations)
+    {
+        if (ids.find(it.first) == ids.end())
+        {
+            error_msg << "Deduplication configured for non existing participant " << it.first << ". ";
+            return false;
+        }
+
+        if (!it.second.is_valid(error_msg))
+        {
+            error_msg << "Error in deduplication of Participant " << it.first << ". ";
+            return false;
+        }
+    }
+
+    // Check that redundancy groups are valid and each participant belongs to one group at most
+    std::set<ddspipe::core::types::ParticipantId> grouped_participants;
+    for (const auto& redundancy_group : redundancy_groups)
+    {
+        if (!redundancy_group.is_valid(error_msg))
+        {
+            error_msg << "Error in redundancy group " << redundancy_group.name << ". ";
+            return false;
+        }
+
+        for (const auto& participant_id : redundancy_group.participants)
+        {
+            if (ids.find(participant_id) == ids.end())
+            {
+                error_msg << "Redundancy group " << redundancy_group.name << " refers to non existing participant "
+                          << participant_id << ". ";
+                return false;
+            }
+
+            if (!grouped_participants.insert(participant_id).second)
+            {
+                error_msg << "Participant " << participant_id << " belongs to more than one redundancy group. ";
+                return false;
+            }
+        }
+    }
+
+    // Check that link groups are valid and each participant belongs to one group at most
+    std::set<ddspipe::core::types::ParticipantId> linked_participants;
+    for (const auto& link_group : link_groups)
+    {
+        if (!link_group.is_valid(error_msg))
+        {
+            error_msg << "Error in link group " << link_group.name << ". ";
+            return false;
+        }
+
+        for (const auto& link : link_group.links)
+        {
+            if (ids.find(link.participant) == ids.end())
+            {
+                error_msg << "Link group " << link_group.name << " refers to non existing participant "
+                          << link.participant << ". ";
+                return false;
+            }
+
+            if (!linked_participants.insert(link.participant).second)
+            {
+                error_msg << "Participant " << link.participant << " belongs to more than one link group. ";
+                return false;
+            }
+        }
+    }
+
+    // Check that interest-based forwarding is only enabled in existing participants
+    for (const auto& it : interest_configurations)
+    {
+        if (ids.find(it.first) == ids.end())
+        {
+            error_msg << "Interest configured for non existing participant " << it.first << ". ";
+            return false;
+        }
+
+        if (!it.second.is_valid(error_msg))
+        {
+            error_msg << "Error in interest of Participant " << it.first << ". ";
+            return false;
+        }
+    }
+
+    // Check that router links are only set for existing participants
+    for (const auto& it : router_links)
+    {
+        if (ids.find(it.first) == ids.end())
+        {
+            error_msg << "Router link set for non existing participant " << it.first << ". ";
+            return false;
+        }
+    }
+
+    // Check that the publication of the statistics is valid
+    if (!monitor_configuration.is_valid(error_msg))
+    {
+        error_msg << "Monitor configuration is not valid. ";
+        return false;
+    }
+
     // Check that xml configuration files are accessible
     if (!xml_configuration.is_valid(error_msg))
     {
@@ -108,6 +231,36 @@ bool DdsRouterConfiguration::is_valid(
     return true;
 }
 
+std::set<ddspipe::core::types::ParticipantId> DdsRouterConfiguration::router_link_participants() const
+{
+    std::set<ddspipe::core::types::ParticipantId> result;
+
+    for (const auto& configuration : participants_configurations)
+    {
+        const auto& id = configuration.second->id;
+
+        auto it = router_links.find(id);
+        if (it != router_links.end())
+        {
+            if (it->second)
+            {
+                result.insert(id);
+            }
+            continue;
+        }
+
+        if (configuration.first == types::ParticipantKind::initial_peers ||
+                configuration.first == types::ParticipantKind::discovery_server ||
+                configuration.first == types::ParticipantKind::uds ||
+                interest_configurations.count(id) > 0)
+        {
+            result.insert(id);
+        }
+    }
+
+    return result;
+}
+
 template <typename T>
 bool check_correct_configuration_object_by_type_(
         const std::shared_ptr<ddspipe::participants::ParticipantConfiguration> configuration)
@@ -137,6 +290,30 @@ bool DdsRouterConfiguration::check_correct_configuration_object_(
             return check_correct_configuration_object_by_type_<ddspipe::participants::EchoParticipantConfiguration>(
                 configuration.second);
 
+        case types::ParticipantKind::generator:
+            return check_correct_configuration_object_by_type_<GeneratorParticipantConfiguration>(
+                configuration.second);
+
+        case types::ParticipantKind::sink:
+            return check_correct_configuration_object_by_type_<SinkParticipantConfiguration>(
+                configuration.second);
+
+        case types::ParticipantKind::recorder:
+            return check_correct_configuration_object_by_type_<RecorderParticipantConfiguration>(
+                configuration.second);
+
+        case types::ParticipantKind::replayer:
+            return check_correct_configuration_object_by_type_<ReplayerParticipantConfiguration>(
+                configuration.second);
+
+        case types::ParticipantKind::shm:
+            return check_correct_configuration_object_by_type_<ShmParticipantConfiguration>(
+                configuration.second);
+
+        case types::ParticipantKind::uds:
+            return check_correct_configuration_object_by_type_<UdsParticipantConfiguration>(
+                configuration.second);
+
         default:
             return check_correct_configuration_object_by_type_<ddspipe::participants::ParticipantConfiguration>(
                 configuration.second);
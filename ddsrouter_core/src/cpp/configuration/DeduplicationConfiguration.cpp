@@ -0,0 +1,48 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DeduplicationConfiguration.cpp
+ *
+ */
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/configuration/DeduplicationConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool DeduplicationConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (window < 1)
+    {
+        error_msg << "Deduplication window must be at least 1.";
+        return false;
+    }
+
+    if (lease < 1)
+    {
+        error_msg << "Deduplication lease must be at least 1 millisecond.";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
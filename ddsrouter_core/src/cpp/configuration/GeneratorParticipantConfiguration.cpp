@@ -0,0 +1,105 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file GeneratorParticipantConfiguration.cpp
+ *
+ */
+
+#include <set>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool GeneratedTopicConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (topic_name.empty())
+    {
+        error_msg << "Generated topics must have a name. ";
+        return false;
+    }
+
+    if (type_name.empty())
+    {
+        error_msg << "Generated topic " << topic_name << " must have a type name. ";
+        return false;
+    }
+
+    if (!(rate > 0))
+    {
+        error_msg << "Rate of generated topic " << topic_name << " must be positive. ";
+        return false;
+    }
+
+    if (payload_size < types::GeneratedSample::HEADER_SIZE)
+    {
+        error_msg << "Payload size of generated topic " << topic_name << " must be at least "
+                  << types::GeneratedSample::HEADER_SIZE << " bytes. ";
+        return false;
+    }
+
+    return true;
+}
+
+ddspipe::core::types::DdsTopic GeneratedTopicConfiguration::dds_topic() const
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = topic_name;
+    topic.type_name = type_name;
+    topic.topic_qos.keyed = keys > 0;
+    return topic;
+}
+
+bool GeneratorParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ddspipe::participants::ParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (topics.empty())
+    {
+        error_msg << "Generator participant " << id << " must publish at least one topic. ";
+        return false;
+    }
+
+    std::set<std::string> topic_names;
+    for (const auto& topic : topics)
+    {
+        if (!topic.is_valid(error_msg))
+        {
+            return false;
+        }
+
+        if (!topic_names.insert(topic.topic_name).second)
+        {
+            error_msg << "Generator participant " << id << " publishes topic " << topic.topic_name << " twice. ";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
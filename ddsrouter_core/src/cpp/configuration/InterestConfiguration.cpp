@@ -0,0 +1,44 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file InterestConfiguration.cpp
+ *
+ */
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/configuration/InterestConfiguration.hpp>
+#include <ddsrouter_core/link/UdpSocket.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool InterestConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!UdpSocket::is_valid_ip(ip) || port == 0)
+    {
+        error_msg << "Invalid interest address " << ip << ":" << port << ".";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,75 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file LinkGroupConfiguration.cpp
+ *
+ */
+
+#include <set>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/configuration/LinkGroupConfiguration.hpp>
+#include <ddsrouter_core/link/UdpSocket.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool LinkGroupConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (links.size() < 2)
+    {
+        error_msg << "Link group " << name << " must have at least 2 links.";
+        return false;
+    }
+
+    std::set<ddspipe::core::types::ParticipantId> participants;
+    for (const auto& link : links)
+    {
+        if (!participants.insert(link.participant).second)
+        {
+            error_msg << "Participant " << link.participant << " is repeated in link group " << name << ".";
+            return false;
+        }
+
+        if (!UdpSocket::is_valid_ip(link.probe_ip) || link.probe_port == 0)
+        {
+            error_msg << "Invalid probe address " << link.probe_ip << ":" << link.probe_port
+                      << " for participant " << link.participant << " in link group " << name << ".";
+            return false;
+        }
+    }
+
+    if (probe_period == 0)
+    {
+        error_msg << "Probe period of link group " << name << " must be greater than 0.";
+        return false;
+    }
+
+    if (detection_time <= probe_period)
+    {
+        error_msg << "Detection time of link group " << name << " must be greater than its probe period.";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
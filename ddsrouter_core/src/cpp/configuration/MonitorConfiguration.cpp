@@ -0,0 +1,66 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MonitorConfiguration.cpp
+ *
+ */
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/configuration/MonitorConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Highest domain id allowed by the RTPS port mapping
+constexpr uint32_t MAX_DOMAIN = 232;
+
+} /* namespace */
+
+bool MonitorConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!enable)
+    {
+        return true;
+    }
+
+    if (domain > MAX_DOMAIN)
+    {
+        error_msg << "Monitor domain must be at most " << MAX_DOMAIN << ".";
+        return false;
+    }
+
+    if (topic_name.empty())
+    {
+        error_msg << "Monitor topic name must not be empty.";
+        return false;
+    }
+
+    if (period == 0)
+    {
+        error_msg << "Monitor period must be at least 1 ms.";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,58 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file RecorderParticipantConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool RecorderParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ddspipe::participants::ParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (file_prefix.empty())
+    {
+        error_msg << "Recorder participant " << id << " must have a file prefix. ";
+        return false;
+    }
+
+    if (chunk_size == 0)
+    {
+        error_msg << "Chunk size of recorder participant " << id << " must be positive. ";
+        return false;
+    }
+
+    if (max_pending_size == 0)
+    {
+        error_msg << "Maximum pending size of recorder participant " << id << " must be positive. ";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
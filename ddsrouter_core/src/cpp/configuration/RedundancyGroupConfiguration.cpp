@@ -0,0 +1,42 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RedundancyGroupConfiguration.cpp
+ *
+ */
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/configuration/RedundancyGroupConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool RedundancyGroupConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (participants.size() < 2)
+    {
+        error_msg << "Redundancy group " << name << " must have at least 2 participants.";
+        return false;
+    }
+
+    return deduplication.is_valid(error_msg);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
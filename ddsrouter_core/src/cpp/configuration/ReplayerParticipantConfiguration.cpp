@@ -0,0 +1,52 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file ReplayerParticipantConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool ReplayerParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ddspipe::participants::ParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (files.empty())
+    {
+        error_msg << "Replayer participant " << id << " must replay at least one file. ";
+        return false;
+    }
+
+    if (!(playback_rate >= 0))
+    {
+        error_msg << "Playback rate of replayer participant " << id << " cannot be negative. ";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,52 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ShmParticipantConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/ShmParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool ShmParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ddspipe::participants::SimpleParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (segment_size == 0)
+    {
+        error_msg << "Segment size of shared memory participant " << id << " must be positive. ";
+        return false;
+    }
+
+    if (max_message_size > segment_size)
+    {
+        error_msg << "Maximum message size of shared memory participant " << id
+                  << " must not be larger than its segment size. ";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
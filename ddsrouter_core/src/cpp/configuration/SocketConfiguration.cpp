@@ -0,0 +1,72 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+/**
+ * @file SocketConfiguration.cpp
+ *
+ */
+
+#include <cstdint>
+#include <limits>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/configuration/SocketConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Largest value of a socket option, which the system takes as an int
+constexpr uint32_t MAX_SOCKET_OPTION = static_cast<uint32_t>(std::numeric_limits<int>::max());
+
+} /* namespace */
+
+bool SocketConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (send_buffer_size > MAX_SOCKET_OPTION || receive_buffer_size > MAX_SOCKET_OPTION ||
+            busy_poll > MAX_SOCKET_OPTION)
+    {
+        error_msg << "Buffer sizes and busy poll must not be greater than " << MAX_SOCKET_OPTION << ". ";
+        return false;
+    }
+
+    if (dscp > MAX_DSCP)
+    {
+        error_msg << "DSCP must be between 0 and " << static_cast<unsigned int>(MAX_DSCP) << ". ";
+        return false;
+    }
+
+    if (rtps_keep_alive_period > 0 && rtps_keep_alive_timeout > 0 && rtps_keep_alive_timeout < rtps_keep_alive_period)
+    {
+        error_msg << "RTPS keep alive timeout must not be lower than the RTPS keep alive period. ";
+        return false;
+    }
+
+    return true;
+}
+
+bool SocketConfiguration::requires_io_backend() const noexcept
+{
+    return busy_poll > 0 || dscp > 0;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -21,6 +21,7 @@
 #include <cpp_utils/Log.hpp>
 
 #include <ddsrouter_core/configuration/SpecsConfiguration.hpp>
+#include <ddsrouter_core/link/UdpSocket.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -35,6 +36,24 @@ bool SpecsConfiguration::is_valid(
         return false;
     }
 
+    for (const auto& peer : link_probe_peers)
+    {
+        if (!UdpSocket::is_valid_ip(peer))
+        {
+            error_msg << "Link probe peer " << peer << " is not a valid IPv4 address.";
+            return false;
+        }
+    }
+
+    for (const auto& peer : interest_peers)
+    {
+        if (!UdpSocket::is_valid_ip(peer))
+        {
+            error_msg << "Interest peer " << peer << " is not a valid IPv4 address.";
+            return false;
+        }
+    }
+
     if (topic_qos.history_depth == 0U)
     {
         logWarning(DDSROUTER_SPECS, "Using non limited histories could lead to memory exhaustion in long executions.");
@@ -0,0 +1,66 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file UdpIoConfiguration.cpp
+ *
+ */
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/configuration/UdpIoConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Largest number of entries of an io_uring
+constexpr uint32_t MAX_RING_ENTRIES = 32768;
+
+//! Largest number of messages of a sendmmsg or recvmmsg call (UIO_MAXIOV)
+constexpr uint32_t MAX_BATCH_SIZE = 1024;
+
+} /* namespace */
+
+bool UdpIoConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (ring_entries < 1 || ring_entries > MAX_RING_ENTRIES)
+    {
+        error_msg << "Ring entries must be between 1 and " << MAX_RING_ENTRIES << ". ";
+        return false;
+    }
+
+    if (batch_size < 1 || batch_size > MAX_BATCH_SIZE)
+    {
+        error_msg << "Batch size must be between 1 and " << MAX_BATCH_SIZE << ". ";
+        return false;
+    }
+
+#if !defined(__linux__)
+    if (backend != UdpIoBackend::fastdds)
+    {
+        error_msg << "UDP I/O backends other than Fast DDS are only available in Linux. ";
+        return false;
+    }
+#endif // if !defined(__linux__)
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,64 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file UdsParticipantConfiguration.cpp
+ *
+ */
+
+#include <limits>
+
+#include <ddsrouter_core/configuration/UdsParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool UdsParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ddspipe::participants::SimpleParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (socket_directory.empty() ||
+            unix_socket_path(socket_directory, std::numeric_limits<uint32_t>::max()).size() > UNIX_SOCKET_MAX_PATH_SIZE)
+    {
+        error_msg << "Socket directory of Unix domain socket participant " << id
+                  << " must not be empty nor longer than "
+                  << UNIX_SOCKET_MAX_PATH_SIZE - unix_socket_path("", std::numeric_limits<uint32_t>::max()).size()
+                  << " characters. ";
+        return false;
+    }
+
+    if (memfd_threshold > UNIX_SOCKET_MAX_INLINE_SIZE)
+    {
+        error_msg << "Memory file threshold of Unix domain socket participant " << id
+                  << " must not be larger than " << UNIX_SOCKET_MAX_INLINE_SIZE << ". ";
+        return false;
+    }
+
+    if (max_message_size == 0)
+    {
+        error_msg << "Maximum message size of Unix domain socket participant " << id << " must be positive. ";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
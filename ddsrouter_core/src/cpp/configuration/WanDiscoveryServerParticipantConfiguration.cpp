@@ -0,0 +1,57 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WanDiscoveryServerParticipantConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/WanDiscoveryServerParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool WanDiscoveryServerParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ddspipe::participants::DiscoveryServerParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (!io.is_valid(error_msg))
+    {
+        error_msg << "Error in I/O of participant " << id << ". ";
+        return false;
+    }
+
+    if (!socket.is_valid(error_msg))
+    {
+        error_msg << "Error in socket options of participant " << id << ". ";
+        return false;
+    }
+
+    if (socket.requires_io_backend() && io.backend == UdpIoBackend::fastdds)
+    {
+        error_msg << "Busy poll and DSCP of participant " << id << " require an I/O backend other than Fast DDS. ";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
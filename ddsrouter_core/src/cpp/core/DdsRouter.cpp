@@ -17,29 +17,92 @@
  *
  */
 
+#include <set>
+
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/exception/ConfigurationException.hpp>
 #include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/types/Heritable.hpp>
 
 #include <ddspipe_core/core/DdsPipe.hpp>
 #include <ddspipe_core/dynamic/AllowedTopicList.hpp>
-#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/types/dds/Endpoint.hpp>
 #include <ddspipe_core/types/dds/TopicQoS.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 
 #include <ddsrouter_core/configuration/DdsRouterConfiguration.hpp>
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
 #include <ddsrouter_core/core/DdsRouter.hpp>
+#include <ddsrouter_core/metrics/PrometheusSerializer.hpp>
+#include <ddsrouter_core/recorder/McapReplayer.hpp>
+#include <ddsrouter_core/tracing/FlightRecorder.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
 namespace core {
 
+namespace {
+
+//! Record a discovery event of \c endpoint in the \c FlightRecorder
+void record_discovery(
+        const ddspipe::core::types::Endpoint& endpoint,
+        const std::string& state)
+{
+    const std::string subject = (utils::Formatter() << "topic=" << endpoint.topic.topic_name()
+                                                    << " participant=" << endpoint.discoverer_participant_id
+                                                    << " guid=" << endpoint.guid).to_string();
+    const std::string note = (endpoint.is_reader() ? "endpoint=reader state=" : "endpoint=writer state=") + state;
+
+    FlightRecorder::record(FlightEventKind::discovery, subject, note.c_str());
+}
+
+/**
+ * Add the topics of the generator and replayer participants to the builtin topics.
+ *
+ * Their writers are internal to the DDS Router and are never discovered, so their bridges must exist from start.
+ */
+void add_generated_topics(
+        DdsRouterConfiguration& configuration)
+{
+    for (const auto& participant_configuration : configuration.participants_configurations)
+    {
+        auto generator_configuration =
+                std::dynamic_pointer_cast<GeneratorParticipantConfiguration>(participant_configuration.second);
+        if (generator_configuration)
+        {
+            for (const auto& topic : generator_configuration->topics)
+            {
+                configuration.ddspipe_configuration.builtin_topics.insert(
+                    utils::Heritable<ddspipe::core::types::DdsTopic>::make_heritable(topic.dds_topic()));
+            }
+        }
+
+        auto replayer_configuration =
+                std::dynamic_pointer_cast<ReplayerParticipantConfiguration>(participant_configuration.second);
+        if (replayer_configuration)
+        {
+            for (const auto& topic : McapReplayer::read_topics(replayer_configuration->files))
+            {
+                configuration.ddspipe_configuration.builtin_topics.insert(
+                    utils::Heritable<ddspipe::core::types::DdsTopic>::make_heritable(topic));
+            }
+        }
+    }
+}
+
+} /* namespace */
+
 DdsRouter::DdsRouter(
         const DdsRouterConfiguration& configuration)
     : configuration_(configuration)
     , discovery_database_(new ddspipe::core::DiscoveryDatabase())
-    , payload_pool_(new ddspipe::core::FastPayloadPool())
+    , payload_pool_(new CountingPayloadPool())
     , participants_database_(new ddspipe::core::ParticipantsDatabase())
     , thread_pool_(std::make_shared<utils::SlotThreadPool>(configuration_.advanced_options.number_of_threads))
+    , metrics_(std::make_shared<MetricsRegistry>(
+                configuration_.advanced_options.source_latency,
+                configuration_.advanced_options.route_latency))
 {
     logDebug(DDSROUTER, "Creating DDS Router.");
 
@@ -52,6 +115,32 @@ DdsRouter::DdsRouter(
                       "Configuration for DDS Router is invalid: " << error_msg);
     }
 
+    // Create the bridges of the generated topics
+    add_generated_topics(configuration_);
+
+    // Keep the discovery events, to diagnose incidents
+    init_discovery_recording_();
+
+    // Answer the probes of remote DDS Routers
+    if (configuration_.advanced_options.link_probe_port != 0)
+    {
+        link_probe_responder_.reset(new LinkProbeResponder(
+                    configuration_.advanced_options.link_probe_port,
+                    configuration_.advanced_options.link_probe_peers));
+    }
+
+    // Subscribe to the interest of remote DDS Routers
+    for (const auto& it : configuration_.interest_configurations)
+    {
+        remote_interests_[it.first] = std::make_shared<InterestSubscriber>(it.second);
+    }
+
+    // Announce the topics with readers to remote DDS Routers
+    if (configuration_.advanced_options.interest_port != 0)
+    {
+        init_local_interest_();
+    }
+
     // Load Participants
     init_participants_();
 
@@ -63,11 +152,82 @@ DdsRouter::DdsRouter(
                         participants_database_,
                         thread_pool_));
 
+    // Publish the statistics in a DDS topic
+    if (configuration_.monitor_configuration.enable)
+    {
+        statistics_publisher_.reset(new StatisticsPublisher(
+                    configuration_.monitor_configuration,
+                    [this]()
+                    {
+                        return to_prometheus_text(get_statistics());
+                    }));
+    }
+
     logDebug(DDSROUTER, "DDS Router created.");
 }
 
 void DdsRouter::init_participants_()
 {
+    // Participants of the same redundancy group share their duplicate filters
+    std::map<ddspipe::core::types::ParticipantId, std::shared_ptr<DuplicateFilterDatabase>> duplicate_filters;
+    for (const auto& redundancy_group : configuration_.redundancy_groups)
+    {
+        auto group_filters = std::make_shared<DuplicateFilterDatabase>(redundancy_group.deduplication);
+
+        for (const auto& participant_id : redundancy_group.participants)
+        {
+            duplicate_filters[participant_id] = group_filters;
+            redundancy_paths_[participant_id] = std::make_shared<RedundancyPathCounters>();
+        }
+    }
+
+    // The rest of participants with duplicate suppression have their own filters
+    for (const auto& it : configuration_.deduplication_configurations)
+    {
+        if (duplicate_filters.find(it.first) == duplicate_filters.end())
+        {
+            duplicate_filters[it.first] = std::make_shared<DuplicateFilterDatabase>(it.second);
+        }
+    }
+
+    // The windows of the origins delivered only by writers undiscovered are erased right away,
+    // instead of waiting for their lease
+    if (!duplicate_filters.empty())
+    {
+        std::set<std::shared_ptr<DuplicateFilterDatabase>> filter_databases;
+        for (const auto& it : duplicate_filters)
+        {
+            filter_databases.insert(it.second);
+        }
+
+        // The callback keeps its own reference, as the database may outlive this object
+        discovery_database_->add_endpoint_erased_callback(
+            [filter_databases](ddspipe::core::types::Endpoint endpoint)
+            {
+                if (endpoint.is_writer())
+                {
+                    for (const auto& filter_database : filter_databases)
+                    {
+                        filter_database->erase_writer(endpoint.guid);
+                    }
+                }
+            });
+    }
+
+    // Participants of the same link group share their selector
+    for (const auto& link_group : configuration_.link_groups)
+    {
+        auto link_selector = std::make_shared<LinkSelector>(link_group);
+
+        for (const auto& link : link_group.links)
+        {
+            link_selectors_[link.participant] = link_selector;
+        }
+    }
+
+    // The origin of the samples is only exchanged with other DDS Routers
+    const std::set<ddspipe::core::types::ParticipantId> router_links = configuration_.router_link_participants();
+
     for (std::pair<types::ParticipantKind,
             std::shared_ptr<ddspipe::participants::ParticipantConfiguration>> participant_config :
             configuration_.participants_configurations)
@@ -90,6 +250,26 @@ void DdsRouter::init_participants_()
         logInfo(DDSROUTER, "Participant created with id: " << new_participant->id()
                                                            << " and kind " << participant_config.first << ".");
 
+        // Wrap the participant to add the router specific logic to its endpoints
+        auto filters_it = duplicate_filters.find(new_participant->id());
+        auto path_it = redundancy_paths_.find(new_participant->id());
+        auto selector_it = link_selectors_.find(new_participant->id());
+        auto interest_it = remote_interests_.find(new_participant->id());
+
+        auto router_participant = std::make_shared<RouterParticipant>(
+            new_participant,
+            metrics_,
+            configuration_.advanced_options.max_age,
+            configuration_.topic_max_ages,
+            filters_it != duplicate_filters.end() ? filters_it->second : nullptr,
+            path_it != redundancy_paths_.end() ? path_it->second : nullptr,
+            selector_it != link_selectors_.end() ? selector_it->second : nullptr,
+            interest_it != remote_interests_.end() ? interest_it->second : nullptr,
+            router_links.count(new_participant->id()) > 0,
+            filters_it != duplicate_filters.end());
+        router_participants_.push_back(router_participant);
+        new_participant = router_participant;
+
         // Add this participant to the database. If it is repeated it will cause an exception
         try
         {
@@ -105,6 +285,54 @@ void DdsRouter::init_participants_()
     }
 }
 
+void DdsRouter::init_local_interest_()
+{
+    // Readers discovered by router links are interest too (multi-hop), but never announced back to their DDS Router
+    local_interest_ = std::make_shared<LocalInterest>(configuration_.router_link_participants(), remote_interests_);
+
+    // The callbacks keep their own reference, as the database may outlive this object
+    auto local_interest = local_interest_;
+    discovery_database_->add_endpoint_discovered_callback(
+        [local_interest](ddspipe::core::types::Endpoint endpoint)
+        {
+            local_interest->update_endpoint(endpoint);
+        });
+    discovery_database_->add_endpoint_updated_callback(
+        [local_interest](ddspipe::core::types::Endpoint endpoint)
+        {
+            local_interest->update_endpoint(endpoint);
+        });
+    discovery_database_->add_endpoint_erased_callback(
+        [local_interest](ddspipe::core::types::Endpoint endpoint)
+        {
+            local_interest->erase_endpoint(endpoint);
+        });
+
+    interest_publisher_.reset(new InterestPublisher(
+                configuration_.advanced_options.interest_port,
+                local_interest_,
+                configuration_.advanced_options.interest_peers));
+}
+
+void DdsRouter::init_discovery_recording_()
+{
+    discovery_database_->add_endpoint_discovered_callback(
+        [](ddspipe::core::types::Endpoint endpoint)
+        {
+            record_discovery(endpoint, "discovered");
+        });
+    discovery_database_->add_endpoint_updated_callback(
+        [](ddspipe::core::types::Endpoint endpoint)
+        {
+            record_discovery(endpoint, "updated");
+        });
+    discovery_database_->add_endpoint_erased_callback(
+        [](ddspipe::core::types::Endpoint endpoint)
+        {
+            record_discovery(endpoint, "removed");
+        });
+}
+
 utils::ReturnCode DdsRouter::reload_configuration(
         const DdsRouterConfiguration& new_configuration)
 {
@@ -117,8 +345,19 @@ utils::ReturnCode DdsRouter::reload_configuration(
                       "Configuration for Reload DDS Router is invalid: " << error_msg);
     }
 
-    // Reload the DdsPipe configuration, since it is the only reconfigurable attribute.
-    return ddspipe_->reload_configuration(new_configuration.ddspipe_configuration);
+    // The accounting of the route latencies is switched in every writer at once
+    metrics_->set_route_latency(new_configuration.advanced_options.route_latency);
+
+    // Reload the DdsPipe configuration, since it is the rest of reconfigurable attributes.
+    const utils::ReturnCode ret = ddspipe_->reload_configuration(new_configuration.ddspipe_configuration);
+
+    FlightRecorder::record(
+        FlightEventKind::reload,
+        "",
+        ret == utils::ReturnCode::RETCODE_OK ? "result=updated" :
+        (ret == utils::ReturnCode::RETCODE_NO_DATA ? "result=unchanged" : "result=error"));
+
+    return ret;
 }
 
 utils::ReturnCode DdsRouter::start() noexcept
@@ -143,6 +382,71 @@ utils::ReturnCode DdsRouter::stop() noexcept
     return ret;
 }
 
+types::DdsRouterStatistics DdsRouter::get_statistics() const
+{
+    types::DdsRouterStatistics statistics;
+
+    statistics.traffic = metrics_->traffic();
+    statistics.latencies = metrics_->latencies();
+    statistics.payloads_in_use = payload_pool_->payloads_in_use();
+    statistics.redundancy_paths = redundancy_statistics();
+    statistics.links = link_statistics();
+
+    return statistics;
+}
+
+std::map<std::string, uint64_t> DdsRouter::expired_samples() const
+{
+    std::map<std::string, uint64_t> result;
+
+    for (const auto& it : get_statistics().topics())
+    {
+        result[it.first] = it.second.dropped_samples[static_cast<std::size_t>(types::DropReason::expired)];
+    }
+
+    return result;
+}
+
+std::map<std::string, uint64_t> DdsRouter::duplicated_samples() const
+{
+    std::map<std::string, uint64_t> result;
+
+    for (const auto& it : get_statistics().topics())
+    {
+        result[it.first] = it.second.dropped_samples[static_cast<std::size_t>(types::DropReason::duplicated)];
+    }
+
+    return result;
+}
+
+std::map<ddspipe::core::types::ParticipantId, types::RedundancyPathStatistics> DdsRouter::redundancy_statistics() const
+{
+    std::map<ddspipe::core::types::ParticipantId, types::RedundancyPathStatistics> result;
+
+    for (const auto& it : redundancy_paths_)
+    {
+        types::RedundancyPathStatistics& path_statistics = result[it.first];
+        path_statistics.first_arrivals = it.second->first_arrivals.load(std::memory_order_relaxed);
+        path_statistics.late_arrivals = it.second->late_arrivals.load(std::memory_order_relaxed);
+        path_statistics.latency = it.second->latency.summary();
+    }
+
+    return result;
+}
+
+std::map<ddspipe::core::types::ParticipantId, types::LinkStatistics> DdsRouter::link_statistics() const
+{
+    std::map<ddspipe::core::types::ParticipantId, types::LinkStatistics> result;
+
+    // Every selector is stored once per participant of its group, so take only the statistics of each participant
+    for (const auto& it : link_selectors_)
+    {
+        result[it.first] = it.second->statistics().at(it.first);
+    }
+
+    return result;
+}
+
 } /* namespace core */
 } /* namespace ddsrouter */
 } /* namespace eprosima */
@@ -36,6 +36,22 @@
 #include <ddspipe_participants/participant/rtps/SimpleParticipant.hpp>
 #include <ddspipe_participants/participant/dds/XmlParticipant.hpp>
 
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ShmParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/UdsParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/WanDiscoveryServerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/WanInitialPeersParticipantConfiguration.hpp>
+#include <ddsrouter_core/participant/GeneratorParticipant.hpp>
+#include <ddsrouter_core/participant/RecorderParticipant.hpp>
+#include <ddsrouter_core/participant/ReplayerParticipant.hpp>
+#include <ddsrouter_core/participant/ShmParticipant.hpp>
+#include <ddsrouter_core/participant/SinkParticipant.hpp>
+#include <ddsrouter_core/participant/UdsParticipant.hpp>
+#include <ddsrouter_core/participant/WanDiscoveryServerParticipant.hpp>
+#include <ddsrouter_core/participant/WanInitialPeersParticipant.hpp>
 #include <ddsrouter_core/types/ParticipantKind.hpp>
 #include <ddsrouter_core/core/ParticipantFactory.hpp>
 
@@ -110,6 +126,20 @@ std::shared_ptr<ddspipe::core::IParticipant> ParticipantFactory::create_particip
                    );
 
         case types::ParticipantKind::discovery_server:
+            // The I/O backend and socket options are only configurable in the DDS Router configuration
+            if (std::dynamic_pointer_cast<WanDiscoveryServerParticipantConfiguration>(participant_configuration))
+            {
+                return generic_create_participant_with_init<
+                    WanDiscoveryServerParticipantConfiguration,
+                    WanDiscoveryServerParticipant>
+                       (
+                    kind,
+                    participant_configuration,
+                    payload_pool,
+                    discovery_database
+                       );
+            }
+
             return generic_create_participant_with_init<
                 ddspipe::participants::DiscoveryServerParticipantConfiguration,
                 ddspipe::participants::rtps::DiscoveryServerParticipant>
@@ -121,6 +151,20 @@ std::shared_ptr<ddspipe::core::IParticipant> ParticipantFactory::create_particip
                    );
 
         case types::ParticipantKind::initial_peers:
+            // The I/O backend and socket options are only configurable in the DDS Router configuration
+            if (std::dynamic_pointer_cast<WanInitialPeersParticipantConfiguration>(participant_configuration))
+            {
+                return generic_create_participant_with_init<
+                    WanInitialPeersParticipantConfiguration,
+                    WanInitialPeersParticipant>
+                       (
+                    kind,
+                    participant_configuration,
+                    payload_pool,
+                    discovery_database
+                       );
+            }
+
             return generic_create_participant_with_init<
                 ddspipe::participants::InitialPeersParticipantConfiguration,
                 ddspipe::participants::rtps::InitialPeersParticipant>
@@ -142,6 +186,67 @@ std::shared_ptr<ddspipe::core::IParticipant> ParticipantFactory::create_particip
                 discovery_database
                    );
 
+        case types::ParticipantKind::generator:
+            return generic_create_participant<
+                GeneratorParticipantConfiguration,
+                GeneratorParticipant>
+                   (
+                kind,
+                participant_configuration,
+                payload_pool
+                   );
+
+        case types::ParticipantKind::sink:
+            return generic_create_participant<
+                SinkParticipantConfiguration,
+                SinkParticipant>
+                   (
+                kind,
+                participant_configuration
+                   );
+
+        case types::ParticipantKind::recorder:
+            return generic_create_participant<
+                RecorderParticipantConfiguration,
+                RecorderParticipant>
+                   (
+                kind,
+                participant_configuration,
+                payload_pool
+                   );
+
+        case types::ParticipantKind::replayer:
+            return generic_create_participant<
+                ReplayerParticipantConfiguration,
+                ReplayerParticipant>
+                   (
+                kind,
+                participant_configuration,
+                payload_pool
+                   );
+
+        case types::ParticipantKind::shm:
+            return generic_create_participant_with_init<
+                ShmParticipantConfiguration,
+                ShmParticipant>
+                   (
+                kind,
+                participant_configuration,
+                payload_pool,
+                discovery_database
+                   );
+
+        case types::ParticipantKind::uds:
+            return generic_create_participant_with_init<
+                UdsParticipantConfiguration,
+                UdsParticipant>
+                   (
+                kind,
+                participant_configuration,
+                payload_pool,
+                discovery_database
+                   );
+
         default:
             // This should not happen as every kind must be in the switch
             utils::tsnh(
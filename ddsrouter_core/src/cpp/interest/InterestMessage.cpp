@@ -0,0 +1,189 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file InterestMessage.cpp
+ *
+ */
+
+#include <ddsrouter_core/interest/InterestMessage.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+// Every field is serialized in little endian, so DDS Routers in different architectures understand each other
+
+constexpr std::size_t HEADER_SIZE = 4 + 1 + 1 + 4;
+
+constexpr uint8_t ALL_TOPICS_FLAG = 0x01;
+
+constexpr std::size_t GUID_PREFIX_SIZE = 12;
+
+void write_uint(
+        std::vector<uint8_t>& buffer,
+        uint64_t value,
+        const std::size_t bytes)
+{
+    for (std::size_t i = 0; i < bytes; ++i)
+    {
+        buffer.push_back(static_cast<uint8_t>(value & 0xFF));
+        value >>= 8;
+    }
+}
+
+uint64_t read_uint(
+        const uint8_t* data,
+        const std::size_t bytes)
+{
+    uint64_t value = 0;
+    for (std::size_t i = bytes; i > 0; --i)
+    {
+        value = (value << 8) | data[i - 1];
+    }
+    return value;
+}
+
+} /* namespace */
+
+std::vector<uint8_t> InterestMessage::serialize() const
+{
+    std::size_t size = HEADER_SIZE;
+    bool fits = true;
+    for (const auto& topic : topics)
+    {
+        size += 2 + topic.size();
+        fits = fits && topic.size() <= UINT16_MAX;
+    }
+
+    const bool send_all_topics = all_topics || !fits || size > MAX_SIZE;
+
+    // The participants are only sent if there is any, so the messages are understood by older DDS Routers
+    const std::size_t participants_size =
+            participants.empty() ? 0 : 2 + participants.size() * GUID_PREFIX_SIZE;
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve((send_all_topics ? HEADER_SIZE : size) + participants_size);
+
+    write_uint(buffer, MAGIC, 4);
+    write_uint(buffer, static_cast<uint8_t>(kind), 1);
+    write_uint(buffer, send_all_topics ? ALL_TOPICS_FLAG : 0, 1);
+    write_uint(buffer, send_all_topics ? 0 : topics.size(), 4);
+
+    if (!send_all_topics)
+    {
+        for (const auto& topic : topics)
+        {
+            write_uint(buffer, topic.size(), 2);
+            buffer.insert(buffer.end(), topic.begin(), topic.end());
+        }
+    }
+
+    if (!participants.empty())
+    {
+        write_uint(buffer, participants.size(), 2);
+        for (const auto& prefix : participants)
+        {
+            for (std::size_t i = 0; i < GUID_PREFIX_SIZE; ++i)
+            {
+                buffer.push_back(static_cast<uint8_t>(prefix.value[i]));
+            }
+        }
+    }
+
+    return buffer;
+}
+
+bool InterestMessage::deserialize(
+        const uint8_t* data,
+        const std::size_t size,
+        InterestMessage& message)
+{
+    if (size < HEADER_SIZE || read_uint(data, 4) != MAGIC)
+    {
+        return false;
+    }
+
+    const uint8_t kind = data[4];
+    if (kind != static_cast<uint8_t>(Kind::request) && kind != static_cast<uint8_t>(Kind::interest))
+    {
+        return false;
+    }
+
+    message.kind = static_cast<Kind>(kind);
+    message.all_topics = (data[5] & ALL_TOPICS_FLAG) != 0;
+    message.topics.clear();
+    message.participants.clear();
+
+    const uint64_t topic_count = read_uint(data + 6, 4);
+    std::size_t position = HEADER_SIZE;
+
+    for (uint64_t i = 0; i < topic_count; ++i)
+    {
+        if (position + 2 > size)
+        {
+            return false;
+        }
+
+        const std::size_t topic_size = static_cast<std::size_t>(read_uint(data + position, 2));
+        position += 2;
+
+        if (position + topic_size > size)
+        {
+            return false;
+        }
+
+        message.topics.emplace(reinterpret_cast<const char*>(data + position), topic_size);
+        position += topic_size;
+    }
+
+    if (position == size)
+    {
+        // Message without participants
+        return true;
+    }
+
+    if (position + 2 > size)
+    {
+        return false;
+    }
+
+    const std::size_t participant_count = static_cast<std::size_t>(read_uint(data + position, 2));
+    position += 2;
+
+    if (position + participant_count * GUID_PREFIX_SIZE != size)
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < participant_count; ++i)
+    {
+        ddspipe::core::types::GuidPrefix prefix;
+        for (std::size_t j = 0; j < GUID_PREFIX_SIZE; ++j)
+        {
+            prefix.value[j] = data[position + j];
+        }
+        message.participants.insert(prefix);
+        position += GUID_PREFIX_SIZE;
+    }
+
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
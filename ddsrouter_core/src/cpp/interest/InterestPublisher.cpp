@@ -0,0 +1,152 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file InterestPublisher.cpp
+ *
+ */
+
+#include <utility>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/interest/InterestMessage.hpp>
+#include <ddsrouter_core/interest/InterestPublisher.hpp>
+#include <ddsrouter_core/interest/InterestSubscriber.hpp>
+
+#include "../utils/clock.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+constexpr utils::Duration_ms POLL_PERIOD = 50;
+
+} /* namespace */
+
+InterestPublisher::InterestPublisher(
+        const uint16_t port,
+        const std::shared_ptr<LocalInterest>& local_interest,
+        const std::set<std::string>& peers)
+    : local_interest_(local_interest)
+    , peers_(peers)
+    , buffer_(InterestMessage::MAX_SIZE)
+{
+    socket_.bind(port);
+
+    thread_ = std::thread(&InterestPublisher::run_, this);
+
+    logInfo(DDSROUTER_INTEREST, "Announcing local interest in port " << socket_.port() << ".");
+}
+
+InterestPublisher::~InterestPublisher()
+{
+    stop_.store(true);
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+uint16_t InterestPublisher::port() const noexcept
+{
+    return socket_.port();
+}
+
+void InterestPublisher::run_() noexcept
+{
+    uint64_t announced_version = local_interest_->version();
+
+    while (!stop_.load())
+    {
+        // Answer the requests
+        if (socket_.wait_readable(POLL_PERIOD))
+        {
+            Address sender;
+            int size;
+            while ((size = socket_.receive_from(buffer_.data(), buffer_.size(), sender.first, sender.second)) >= 0)
+            {
+                if (!peers_.empty() && peers_.find(sender.first) == peers_.end())
+                {
+                    logDebug(DDSROUTER_INTEREST,
+                            "Ignoring interest request of " << sender.first << ":" << sender.second
+                                                            << ", which is not a configured peer.");
+                    continue;
+                }
+
+                InterestMessage message;
+                if (InterestMessage::deserialize(buffer_.data(), static_cast<std::size_t>(size), message) &&
+                        message.kind == InterestMessage::Kind::request)
+                {
+                    if (subscribers_.find(sender) == subscribers_.end())
+                    {
+                        logInfo(DDSROUTER_INTEREST,
+                                "Remote DDS Router " << sender.first << ":" << sender.second
+                                                     << " subscribed to local interest.");
+                    }
+
+                    Subscriber& subscriber = subscribers_[sender];
+                    subscriber.last_request = steady_now_ms();
+                    subscriber.participants = std::move(message.participants);
+                    send_interest_(sender, subscriber);
+                }
+            }
+        }
+
+        // Forget the subscribers that stopped sending requests
+        const int64_t now = steady_now_ms();
+        for (auto it = subscribers_.begin(); it != subscribers_.end();)
+        {
+            if (now - it->second.last_request > static_cast<int64_t>(InterestSubscriber::LEASE_DURATION))
+            {
+                it = subscribers_.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Send the changes of the local interest as soon as they happen
+        const uint64_t version = local_interest_->version();
+        if (version != announced_version)
+        {
+            announced_version = version;
+
+            for (const auto& subscriber : subscribers_)
+            {
+                send_interest_(subscriber.first, subscriber.second);
+            }
+        }
+    }
+}
+
+void InterestPublisher::send_interest_(
+        const Address& address,
+        const Subscriber& subscriber) noexcept
+{
+    InterestMessage message;
+    message.kind = InterestMessage::Kind::interest;
+    message.topics = local_interest_->topics(subscriber.participants);
+
+    const std::vector<uint8_t> data = message.serialize();
+    socket_.send_to(data.data(), data.size(), address.first, address.second);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,194 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file InterestSubscriber.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/interest/InterestMessage.hpp>
+#include <ddsrouter_core/interest/InterestSubscriber.hpp>
+
+#include "../utils/clock.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+constexpr utils::Duration_ms InterestSubscriber::REQUEST_PERIOD;
+constexpr utils::Duration_ms InterestSubscriber::LEASE_DURATION;
+
+InterestSubscriber::InterestSubscriber(
+        const InterestConfiguration& configuration)
+    : configuration_(configuration)
+    , buffer_(InterestMessage::MAX_SIZE)
+{
+    // Any local port is valid, the answers are sent back to it
+    socket_.bind(0);
+
+    thread_ = std::thread(&InterestSubscriber::run_, this);
+
+    logInfo(DDSROUTER_INTEREST,
+            "Requesting interest of remote DDS Router " << configuration_.ip << ":" << configuration_.port << ".");
+}
+
+InterestSubscriber::~InterestSubscriber()
+{
+    stop_.store(true);
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+std::shared_ptr<const std::atomic<bool>> InterestSubscriber::interest_flag(
+        const std::string& topic_name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& flag = flags_[topic_name];
+    if (!flag)
+    {
+        flag = std::make_shared<std::atomic<bool>>(
+            !known_.load() || topics_.find(topic_name) != topics_.end());
+    }
+
+    return flag;
+}
+
+bool InterestSubscriber::is_known() const noexcept
+{
+    return known_.load();
+}
+
+std::set<std::string> InterestSubscriber::topics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return topics_;
+}
+
+uint64_t InterestSubscriber::version() const noexcept
+{
+    return version_.load(std::memory_order_acquire);
+}
+
+void InterestSubscriber::add_participant(
+        const ddspipe::core::types::GuidPrefix& prefix)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    participants_.insert(prefix);
+}
+
+void InterestSubscriber::run_() noexcept
+{
+    InterestMessage request;
+
+    int64_t next_request = steady_now_ms();
+
+    while (!stop_.load())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            request.participants = participants_;
+        }
+
+        const std::vector<uint8_t> data = request.serialize();
+        socket_.send_to(data.data(), data.size(), configuration_.ip, configuration_.port);
+
+        next_request += REQUEST_PERIOD;
+        receive_interest_(next_request);
+
+        if (known_.load() && steady_now_ms() - last_interest_ > static_cast<int64_t>(LEASE_DURATION))
+        {
+            logWarning(DDSROUTER_INTEREST,
+                    "Remote DDS Router " << configuration_.ip << ":" << configuration_.port
+                                         << " does not announce its interest. Forwarding every topic.");
+
+            update_interest_(false, {});
+        }
+    }
+}
+
+void InterestSubscriber::receive_interest_(
+        const int64_t deadline) noexcept
+{
+    int64_t now = steady_now_ms();
+
+    while (now < deadline && !stop_.load())
+    {
+        if (socket_.wait_readable(static_cast<utils::Duration_ms>(deadline - now)))
+        {
+            std::string sender_ip;
+            uint16_t sender_port = 0;
+            const int size = socket_.receive_from(buffer_.data(), buffer_.size(), sender_ip, sender_port);
+
+            // Only the remote DDS Router configured can announce its interest (the socket is reachable by anyone)
+            InterestMessage message;
+            if (size >= 0 &&
+                    sender_ip == configuration_.ip &&
+                    sender_port == configuration_.port &&
+                    InterestMessage::deserialize(buffer_.data(), static_cast<std::size_t>(size), message) &&
+                    message.kind == InterestMessage::Kind::interest)
+            {
+                last_interest_ = steady_now_ms();
+
+                if (message.all_topics)
+                {
+                    update_interest_(false, {});
+                }
+                else
+                {
+                    if (!known_.load())
+                    {
+                        logInfo(DDSROUTER_INTEREST,
+                                "Forwarding only the topics of interest of remote DDS Router "
+                                << configuration_.ip << ":" << configuration_.port << ".");
+                    }
+
+                    update_interest_(true, message.topics);
+                }
+            }
+        }
+
+        now = steady_now_ms();
+    }
+}
+
+void InterestSubscriber::update_interest_(
+        const bool known,
+        const std::set<std::string>& topics)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (known == known_.load() && topics == topics_)
+    {
+        return;
+    }
+
+    known_.store(known);
+    topics_ = topics;
+    version_.fetch_add(1, std::memory_order_release);
+
+    for (auto& it : flags_)
+    {
+        it.second->store(!known || topics_.find(it.first) != topics_.end(), std::memory_order_relaxed);
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
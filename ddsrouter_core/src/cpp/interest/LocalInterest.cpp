@@ -0,0 +1,154 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file LocalInterest.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/interest/LocalInterest.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+LocalInterest::LocalInterest(
+        const std::set<ddspipe::core::types::ParticipantId>& router_links,
+        const std::map<ddspipe::core::types::ParticipantId, std::shared_ptr<InterestSubscriber>>& remote_interests)
+    : router_links_(router_links)
+    , remote_interests_(remote_interests)
+{
+}
+
+void LocalInterest::update_endpoint(
+        const ddspipe::core::types::Endpoint& endpoint)
+{
+    if (!endpoint.is_reader())
+    {
+        return;
+    }
+
+    update_reader_(endpoint, endpoint.active);
+}
+
+void LocalInterest::erase_endpoint(
+        const ddspipe::core::types::Endpoint& endpoint)
+{
+    if (!endpoint.is_reader())
+    {
+        return;
+    }
+
+    update_reader_(endpoint, false);
+}
+
+std::set<std::string> LocalInterest::topics(
+        const std::set<ddspipe::core::types::GuidPrefix>& requester) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Router links connected to the requester, whose announced interest would come back to it
+    std::set<ddspipe::core::types::ParticipantId> requester_links;
+    for (const auto& it : readers_)
+    {
+        if (requester.count(it.first.guidPrefix) > 0)
+        {
+            requester_links.insert(it.second.participant);
+        }
+    }
+
+    std::set<std::string> result;
+
+    for (const auto& it : readers_)
+    {
+        if (requester.count(it.first.guidPrefix) > 0 || is_remote_interest_known_(it.second.participant))
+        {
+            continue;
+        }
+
+        result.insert(it.second.topic_name);
+    }
+
+    for (const auto& it : remote_interests_)
+    {
+        if (requester_links.count(it.first) > 0 || !it.second->is_known())
+        {
+            continue;
+        }
+
+        const std::set<std::string> remote_topics = it.second->topics();
+        result.insert(remote_topics.begin(), remote_topics.end());
+    }
+
+    return result;
+}
+
+uint64_t LocalInterest::version() const noexcept
+{
+    // The interest announced by remote DDS Routers changes the topics too
+    uint64_t version = version_.load(std::memory_order_acquire);
+    for (const auto& it : remote_interests_)
+    {
+        version += it.second->version();
+    }
+
+    return version;
+}
+
+void LocalInterest::update_reader_(
+        const ddspipe::core::types::Endpoint& endpoint,
+        const bool alive)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = readers_.find(endpoint.guid);
+
+    if (alive && it == readers_.end())
+    {
+        readers_[endpoint.guid] = Reader{endpoint.discoverer_participant_id, endpoint.topic.topic_name()};
+        version_.fetch_add(1, std::memory_order_release);
+
+        logDebug(DDSROUTER_INTEREST,
+                "Reader in topic " << endpoint.topic.topic_name() << " discovered by participant "
+                                   << endpoint.discoverer_participant_id << ".");
+    }
+    else if (!alive && it != readers_.end())
+    {
+        readers_.erase(it);
+        version_.fetch_add(1, std::memory_order_release);
+
+        logDebug(DDSROUTER_INTEREST,
+                "Reader in topic " << endpoint.topic.topic_name() << " discovered by participant "
+                                   << endpoint.discoverer_participant_id << " is gone.");
+    }
+}
+
+bool LocalInterest::is_remote_interest_known_(
+        const ddspipe::core::types::ParticipantId& participant) const
+{
+    if (router_links_.count(participant) == 0)
+    {
+        return false;
+    }
+
+    auto it = remote_interests_.find(participant);
+    return it != remote_interests_.end() && it->second->is_known();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
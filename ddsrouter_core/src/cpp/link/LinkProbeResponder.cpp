@@ -0,0 +1,112 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file LinkProbeResponder.cpp
+ *
+ */
+
+#include <cstring>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/link/LinkProbe.hpp>
+#include <ddsrouter_core/link/LinkProbeResponder.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Maximum time the internal thread waits before checking whether it must stop
+constexpr utils::Duration_ms POLL_PERIOD = 100;
+
+} /* namespace */
+
+LinkProbeResponder::LinkProbeResponder(
+        const uint16_t port,
+        const std::set<std::string>& peers)
+    : peers_(peers)
+{
+    socket_.bind(port);
+
+    thread_ = std::thread(&LinkProbeResponder::run_, this);
+
+    logInfo(DDSROUTER_LINK_SELECTOR, "Answering link probes in port " << socket_.port() << ".");
+}
+
+LinkProbeResponder::~LinkProbeResponder()
+{
+    stop_.store(true);
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+uint16_t LinkProbeResponder::port() const noexcept
+{
+    return socket_.port();
+}
+
+void LinkProbeResponder::run_() noexcept
+{
+    while (!stop_.load())
+    {
+        if (socket_.wait_readable(POLL_PERIOD))
+        {
+            answer_probes_();
+        }
+    }
+}
+
+void LinkProbeResponder::answer_probes_() noexcept
+{
+    // One byte more than a probe, so bigger datagrams are detected instead of truncated
+    char buffer[sizeof(LinkProbe) + 1];
+    std::string sender_ip;
+    uint16_t sender_port = 0;
+
+    int size;
+    while ((size = socket_.receive_from(buffer, sizeof(buffer), sender_ip, sender_port)) >= 0)
+    {
+        if (!peers_.empty() && peers_.find(sender_ip) == peers_.end())
+        {
+            logDebug(DDSROUTER_LINK_SELECTOR,
+                    "Ignoring link probe of " << sender_ip << ":" << sender_port
+                                              << ", which is not a configured peer.");
+            continue;
+        }
+
+        LinkProbe probe;
+        if (static_cast<std::size_t>(size) != sizeof(probe))
+        {
+            continue;
+        }
+
+        std::memcpy(&probe, buffer, sizeof(probe));
+        if (!probe.is_valid())
+        {
+            continue;
+        }
+
+        socket_.send_to(buffer, sizeof(probe), sender_ip, sender_port);
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,256 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file LinkSelector.cpp
+ *
+ */
+
+#include <cstring>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/link/LinkProbe.hpp>
+#include <ddsrouter_core/link/LinkSelector.hpp>
+
+#include "../utils/clock.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+constexpr int64_t NS_PER_MS = 1000000;
+
+} /* namespace */
+
+LinkSelector::LinkSelector(
+        const LinkGroupConfiguration& configuration)
+    : configuration_(configuration)
+{
+    for (const auto& link_configuration : configuration_.links)
+    {
+        auto link = std::unique_ptr<Link>(new Link());
+        link->configuration = link_configuration;
+        links_.push_back(std::move(link));
+    }
+
+    // Any local port is valid, the answers are sent back to it
+    socket_.bind(0);
+
+    thread_ = std::thread(&LinkSelector::run_, this);
+
+    logInfo(DDSROUTER_LINK_SELECTOR,
+            "Link group " << configuration_.name << " probing " << links_.size()
+                          << " links from port " << socket_.port() << ".");
+}
+
+LinkSelector::~LinkSelector()
+{
+    stop_.store(true);
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+int LinkSelector::link_index(
+        const ddspipe::core::types::ParticipantId& participant_id) const noexcept
+{
+    for (std::size_t i = 0; i < links_.size(); ++i)
+    {
+        if (links_[i]->configuration.participant == participant_id)
+        {
+            return static_cast<int>(i);
+        }
+    }
+
+    return -1;
+}
+
+bool LinkSelector::is_active(
+        const int link_index) const noexcept
+{
+    const int active_link = active_link_.load(std::memory_order_relaxed);
+    return active_link == ALL_LINKS || active_link == link_index;
+}
+
+std::map<ddspipe::core::types::ParticipantId, types::LinkStatistics> LinkSelector::statistics() const
+{
+    std::map<ddspipe::core::types::ParticipantId, types::LinkStatistics> result;
+
+    for (std::size_t i = 0; i < links_.size(); ++i)
+    {
+        const Link& link = *links_[i];
+        types::LinkStatistics& link_statistics = result[link.configuration.participant];
+
+        link_statistics.alive = link.alive.load(std::memory_order_relaxed);
+        link_statistics.active = is_active(static_cast<int>(i));
+        link_statistics.round_trip_time = static_cast<uint64_t>(link.round_trip_time.load(std::memory_order_relaxed));
+        link_statistics.probes_sent = link.probes_sent.load(std::memory_order_relaxed);
+        link_statistics.probes_received = link.probes_received.load(std::memory_order_relaxed);
+        link_statistics.activations = link.activations.load(std::memory_order_relaxed);
+    }
+
+    return result;
+}
+
+void LinkSelector::run_() noexcept
+{
+    const int64_t probe_period_ns = static_cast<int64_t>(configuration_.probe_period) * NS_PER_MS;
+
+    int64_t next_probe = steady_now_ns();
+
+    while (!stop_.load())
+    {
+        send_probes_();
+
+        next_probe += probe_period_ns;
+        receive_answers_(next_probe);
+
+        select_link_();
+    }
+}
+
+void LinkSelector::send_probes_() noexcept
+{
+    for (std::size_t i = 0; i < links_.size(); ++i)
+    {
+        Link& link = *links_[i];
+
+        LinkProbe probe;
+        probe.link_index = static_cast<uint32_t>(i);
+        probe.timestamp = steady_now_ns();
+
+        if (socket_.send_to(&probe, sizeof(probe), link.configuration.probe_ip, link.configuration.probe_port))
+        {
+            link.probes_sent.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void LinkSelector::receive_answers_(
+        const int64_t deadline) noexcept
+{
+    int64_t now = steady_now_ns();
+
+    while (now < deadline && !stop_.load())
+    {
+        if (socket_.wait_readable(static_cast<utils::Duration_ms>((deadline - now + NS_PER_MS - 1) / NS_PER_MS)))
+        {
+            LinkProbe probe;
+            const int size = socket_.receive(&probe, sizeof(probe));
+
+            now = steady_now_ns();
+
+            if (size == static_cast<int>(sizeof(probe)) && probe.is_valid() && probe.link_index < links_.size())
+            {
+                Link& link = *links_[probe.link_index];
+
+                // Smooth the round trip time as TCP does (RFC 6298)
+                const int64_t sample = now - probe.timestamp;
+                const int64_t previous = link.round_trip_time.load(std::memory_order_relaxed);
+                link.round_trip_time.store(
+                    previous == 0 ? sample : (7 * previous + sample) / 8,
+                    std::memory_order_relaxed);
+
+                link.last_answer.store(now, std::memory_order_relaxed);
+                link.probes_received.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        now = steady_now_ns();
+    }
+}
+
+void LinkSelector::select_link_() noexcept
+{
+    const int64_t now = steady_now_ns();
+    const int64_t detection_time_ns = static_cast<int64_t>(configuration_.detection_time) * NS_PER_MS;
+    const int64_t hysteresis_ns = static_cast<int64_t>(configuration_.hysteresis) * NS_PER_MS;
+
+    // Update the state of each link and find the best one
+    int best_link = ALL_LINKS;
+    for (std::size_t i = 0; i < links_.size(); ++i)
+    {
+        Link& link = *links_[i];
+
+        const int64_t last_answer = link.last_answer.load(std::memory_order_relaxed);
+        const bool alive = last_answer != 0 && now - last_answer <= detection_time_ns;
+
+        if (link.alive.exchange(alive) != alive)
+        {
+            logInfo(DDSROUTER_LINK_SELECTOR,
+                    "Link " << link.configuration.participant << " of link group " << configuration_.name
+                            << (alive ? " is up." : " is down."));
+
+            if (!alive)
+            {
+                // Forget the round trip time, so the link does not become active again until it answers
+                link.round_trip_time.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        if (alive &&
+                (best_link == ALL_LINKS ||
+                link.round_trip_time.load(std::memory_order_relaxed) <
+                links_[best_link]->round_trip_time.load(std::memory_order_relaxed)))
+        {
+            best_link = static_cast<int>(i);
+        }
+    }
+
+    // Change the active link only if it is down, or the best one improves it by more than the hysteresis
+    const int active_link = active_link_.load(std::memory_order_relaxed);
+    int new_active_link = active_link;
+
+    if (best_link == ALL_LINKS)
+    {
+        new_active_link = ALL_LINKS;
+    }
+    else if (active_link == ALL_LINKS || !links_[active_link]->alive.load(std::memory_order_relaxed))
+    {
+        new_active_link = best_link;
+    }
+    else if (links_[best_link]->round_trip_time.load(std::memory_order_relaxed) + hysteresis_ns <
+            links_[active_link]->round_trip_time.load(std::memory_order_relaxed))
+    {
+        new_active_link = best_link;
+    }
+
+    if (new_active_link != active_link)
+    {
+        active_link_.store(new_active_link, std::memory_order_relaxed);
+
+        if (new_active_link == ALL_LINKS)
+        {
+            logWarning(DDSROUTER_LINK_SELECTOR,
+                    "Every link of link group " << configuration_.name << " is down. Sending through all of them.");
+        }
+        else
+        {
+            links_[new_active_link]->activations.fetch_add(1, std::memory_order_relaxed);
+
+            logInfo(DDSROUTER_LINK_SELECTOR,
+                    "Link " << links_[new_active_link]->configuration.participant << " is now the active link of "
+                            << "link group " << configuration_.name << ".");
+        }
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,164 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file UdpSocket.cpp
+ *
+ */
+
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+
+#include <ddsrouter_core/link/UdpSocket.hpp>
+
+#include "../utils/native_socket.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+UdpSocket::UdpSocket()
+{
+    initialize_sockets();
+
+    native_socket_t new_socket = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (new_socket == INVALID_NATIVE_SOCKET)
+    {
+        throw utils::InitializationException("Failed to create UDP socket.");
+    }
+
+    socket_ = static_cast<intptr_t>(new_socket);
+}
+
+UdpSocket::~UdpSocket()
+{
+    close_native_socket(native(socket_));
+}
+
+void UdpSocket::bind(
+        const uint16_t port)
+{
+    sockaddr_in address {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+
+    if (::bind(native(socket_), reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Failed to bind UDP socket to port " << port << ".");
+    }
+
+    // Get the actual port (in case port 0 was requested)
+    socklen_t length = sizeof(address);
+    getsockname(native(socket_), reinterpret_cast<sockaddr*>(&address), &length);
+    port_ = ntohs(address.sin_port);
+}
+
+uint16_t UdpSocket::port() const noexcept
+{
+    return port_;
+}
+
+bool UdpSocket::wait_readable(
+        const utils::Duration_ms timeout) const noexcept
+{
+    return poll_native_socket(native(socket_), static_cast<int>(timeout)) > 0;
+}
+
+bool UdpSocket::send_to(
+        const void* data,
+        const std::size_t size,
+        const std::string& ip,
+        const uint16_t port) noexcept
+{
+    sockaddr_in address {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    if (inet_pton(AF_INET, ip.c_str(), &address.sin_addr) != 1)
+    {
+        return false;
+    }
+
+    const auto sent = ::sendto(
+        native(socket_),
+        static_cast<const char*>(data),
+        static_cast<int>(size),
+        0,
+        reinterpret_cast<sockaddr*>(&address),
+        sizeof(address));
+
+    return sent >= 0 && static_cast<std::size_t>(sent) == size;
+}
+
+int UdpSocket::receive(
+        void* buffer,
+        const std::size_t size) noexcept
+{
+    if (!wait_readable(0))
+    {
+        return -1;
+    }
+
+    const auto received = ::recv(native(socket_), static_cast<char*>(buffer), static_cast<int>(size), 0);
+    return received < 0 ? -1 : static_cast<int>(received);
+}
+
+int UdpSocket::receive_from(
+        void* buffer,
+        const std::size_t size,
+        std::string& ip,
+        uint16_t& port) noexcept
+{
+    if (!wait_readable(0))
+    {
+        return -1;
+    }
+
+    sockaddr_in sender {};
+    socklen_t sender_length = sizeof(sender);
+
+    const auto received = ::recvfrom(
+        native(socket_),
+        static_cast<char*>(buffer),
+        static_cast<int>(size),
+        0,
+        reinterpret_cast<sockaddr*>(&sender),
+        &sender_length);
+
+    if (received < 0)
+    {
+        return -1;
+    }
+
+    char sender_ip[INET_ADDRSTRLEN] = {};
+    inet_ntop(AF_INET, &sender.sin_addr, sender_ip, sizeof(sender_ip));
+    ip = sender_ip;
+    port = ntohs(sender.sin_port);
+
+    return static_cast<int>(received);
+}
+
+bool UdpSocket::is_valid_ip(
+        const std::string& ip) noexcept
+{
+    in_addr address {};
+    return inet_pton(AF_INET, ip.c_str(), &address) == 1;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
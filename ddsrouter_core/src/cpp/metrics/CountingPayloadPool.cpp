@@ -0,0 +1,128 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file CountingPayloadPool.cpp
+ *
+ */
+
+#include <ddsrouter_core/metrics/CountingPayloadPool.hpp>
+#include <ddsrouter_core/metrics/IngressStamp.hpp>
+#include <ddsrouter_core/tracing/Tracer.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+/**
+ * Stamp of the traced sample being forwarded by the current thread, nullptr if it is not traced.
+ *
+ * The payloads requested while a sample is taken have no stamp yet, so only the requests of the writers are traced.
+ */
+const IngressStamp* traced_stamp() noexcept
+{
+#if defined(DDSROUTER_TRACING_ENABLED)
+    const IngressStamp* stamp = IngressStamp::current();
+    return stamp && stamp->trace_sample ? stamp : nullptr;
+#else
+    return nullptr;
+#endif // if defined(DDSROUTER_TRACING_ENABLED)
+}
+
+//! Record the span of a payload request of the sample of \c stamp that started at \c start_ns
+void trace_payload_request(
+        const IngressStamp& stamp,
+        const int64_t start_ns) noexcept
+{
+    TraceEvent event;
+    event.name = "payload.get";
+    event.topic = stamp.trace_topic;
+    event.participant = stamp.trace_participant;
+    event.sample = stamp.trace_sample;
+    event.start_ns = start_ns;
+    event.duration_ns = Tracer::now() - start_ns;
+    DDSROUTER_TRACE_SPAN(event);
+}
+
+} /* namespace */
+
+bool CountingPayloadPool::get_payload(
+        uint32_t size,
+        ddspipe::core::types::Payload& target_payload)
+{
+    const IngressStamp* stamp = traced_stamp();
+    const int64_t start_ns = stamp ? Tracer::now() : 0;
+
+    const bool ret = ddspipe::core::FastPayloadPool::get_payload(size, target_payload);
+    if (ret)
+    {
+        acquired_payloads_.add();
+    }
+
+    if (stamp)
+    {
+        trace_payload_request(*stamp, start_ns);
+    }
+    return ret;
+}
+
+bool CountingPayloadPool::get_payload(
+        const ddspipe::core::types::Payload& src_payload,
+        ddspipe::core::PayloadPool*& data_owner,
+        ddspipe::core::types::Payload& target_payload)
+{
+    const IngressStamp* stamp = traced_stamp();
+    const int64_t start_ns = stamp ? Tracer::now() : 0;
+
+    // Payloads of other owners are copied in a payload requested through the size overload, which counts it
+    const bool referenced = data_owner == this;
+
+    const bool ret = ddspipe::core::FastPayloadPool::get_payload(src_payload, data_owner, target_payload);
+    if (ret && referenced)
+    {
+        acquired_payloads_.add();
+    }
+
+    if (stamp)
+    {
+        trace_payload_request(*stamp, start_ns);
+    }
+    return ret;
+}
+
+bool CountingPayloadPool::release_payload(
+        ddspipe::core::types::Payload& target_payload)
+{
+    const bool ret = ddspipe::core::FastPayloadPool::release_payload(target_payload);
+    if (ret)
+    {
+        released_payloads_.add();
+    }
+    return ret;
+}
+
+uint64_t CountingPayloadPool::payloads_in_use() const noexcept
+{
+    // Read the releases first, so a payload released in between is never counted as released but not acquired
+    const uint64_t released = released_payloads_.value();
+    const uint64_t acquired = acquired_payloads_.value();
+    return acquired > released ? acquired - released : 0;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
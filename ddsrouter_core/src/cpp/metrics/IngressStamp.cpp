@@ -0,0 +1,68 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file IngressStamp.cpp
+ *
+ */
+
+#include <ddsrouter_core/metrics/IngressStamp.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Stamp of the last sample taken by the current thread
+thread_local IngressStamp current_stamp;
+
+} /* namespace */
+
+void IngressStamp::set(
+        const IngressStamp& stamp) noexcept
+{
+    current_stamp = stamp;
+}
+
+const IngressStamp* IngressStamp::get(
+        const ddspipe::core::IRoutingData& data) noexcept
+{
+    if (current_stamp.data != &data)
+    {
+        return nullptr;
+    }
+
+    return &current_stamp;
+}
+
+const IngressStamp* IngressStamp::current() noexcept
+{
+    if (current_stamp.data == nullptr)
+    {
+        return nullptr;
+    }
+
+    return &current_stamp;
+}
+
+void IngressStamp::reset() noexcept
+{
+    current_stamp = IngressStamp();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,235 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file MetricsHttpServer.cpp
+ *
+ */
+
+#include <chrono>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/metrics/MetricsHttpServer.hpp>
+
+#include "../utils/native_socket.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Time (in milliseconds) between checks of the stop flag
+constexpr int STOP_CHECK_PERIOD = 100;
+
+//! Do not raise SIGPIPE if the client closes the connection before the response is sent
+#if defined(MSG_NOSIGNAL)
+constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+constexpr int SEND_FLAGS = 0;
+#endif // if defined(MSG_NOSIGNAL)
+
+//! Send a whole buffer through a connection
+bool send_all(
+        native_socket_t connection,
+        const std::string& data) noexcept
+{
+    std::size_t sent = 0;
+    while (sent < data.size())
+    {
+        const auto result = ::send(connection, data.data() + sent, static_cast<int>(data.size() - sent), SEND_FLAGS);
+        if (result <= 0)
+        {
+            return false;
+        }
+        sent += static_cast<std::size_t>(result);
+    }
+    return true;
+}
+
+//! Build an HTTP response
+std::string response(
+        const char* status,
+        const char* content_type,
+        const std::string& body)
+{
+    std::string result;
+    result.reserve(body.size() + 128);
+    result += "HTTP/1.1 ";
+    result += status;
+    result += "\r\nContent-Type: ";
+    result += content_type;
+    result += "\r\nContent-Length: ";
+    result += std::to_string(body.size());
+    result += "\r\nConnection: close\r\n\r\n";
+    result += body;
+    return result;
+}
+
+} /* namespace */
+
+MetricsHttpServer::MetricsHttpServer(
+        const uint16_t port,
+        ContentCallback content)
+    : content_(std::move(content))
+{
+    initialize_sockets();
+
+    native_socket_t new_socket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (new_socket == INVALID_NATIVE_SOCKET)
+    {
+        throw utils::InitializationException("Failed to create metrics server socket.");
+    }
+
+    // Allow restarting the server right after stopping it
+    int reuse = 1;
+    setsockopt(new_socket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+    sockaddr_in address {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+
+    if (::bind(new_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+            ::listen(new_socket, SOMAXCONN) != 0)
+    {
+        close_native_socket(new_socket);
+        throw utils::InitializationException(
+                  utils::Formatter() << "Failed to listen for metrics requests in port " << port << ".");
+    }
+
+    // Get the actual port (in case port 0 was requested)
+    socklen_t length = sizeof(address);
+    getsockname(new_socket, reinterpret_cast<sockaddr*>(&address), &length);
+    port_ = ntohs(address.sin_port);
+
+    socket_ = static_cast<intptr_t>(new_socket);
+
+    thread_ = std::thread(&MetricsHttpServer::run_, this);
+
+    logInfo(DDSROUTER_METRICS, "Serving metrics in port " << port_ << ".");
+}
+
+MetricsHttpServer::~MetricsHttpServer()
+{
+    stop_ = true;
+    thread_.join();
+    close_native_socket(native(socket_));
+}
+
+uint16_t MetricsHttpServer::port() const noexcept
+{
+    return port_;
+}
+
+void MetricsHttpServer::run_() noexcept
+{
+    while (!stop_)
+    {
+        if (poll_native_socket(native(socket_), STOP_CHECK_PERIOD) <= 0)
+        {
+            continue;
+        }
+
+        native_socket_t connection = ::accept(native(socket_), nullptr, nullptr);
+        if (connection == INVALID_NATIVE_SOCKET)
+        {
+            continue;
+        }
+
+        serve_(static_cast<intptr_t>(connection));
+        close_native_socket(connection);
+    }
+}
+
+void MetricsHttpServer::serve_(
+        intptr_t connection) noexcept
+{
+    // Read until the end of the headers (the body of a GET request is ignored)
+    std::string request;
+    char buffer[1024];
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(REQUEST_TIMEOUT);
+
+    while (request.find("\r\n\r\n") == std::string::npos)
+    {
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()).count();
+
+        if (remaining <= 0 || request.size() > MAX_REQUEST_SIZE || stop_)
+        {
+            return;
+        }
+
+        if (poll_native_socket(native(connection), static_cast<int>(remaining)) <= 0)
+        {
+            continue;
+        }
+
+        const auto received = ::recv(native(connection), buffer, sizeof(buffer), 0);
+        if (received <= 0)
+        {
+            return;
+        }
+
+        request.append(buffer, static_cast<std::size_t>(received));
+    }
+
+    // Parse the request line: <method> <target> <version>
+    const auto method_end = request.find(' ');
+    const auto target_end = request.find(' ', method_end + 1);
+    if (method_end == std::string::npos || target_end == std::string::npos)
+    {
+        send_all(native(connection), response("400 Bad Request", "text/plain", "Bad Request\n"));
+        return;
+    }
+
+    const std::string method = request.substr(0, method_end);
+    std::string target = request.substr(method_end + 1, target_end - method_end - 1);
+
+    // Ignore the query string
+    target = target.substr(0, target.find('?'));
+
+    if (method != "GET")
+    {
+        send_all(native(connection), response("405 Method Not Allowed", "text/plain", "Method Not Allowed\n"));
+        return;
+    }
+
+    if (target != METRICS_PATH)
+    {
+        send_all(native(connection), response("404 Not Found", "text/plain", "Not Found\n"));
+        return;
+    }
+
+    std::string body;
+    try
+    {
+        body = content_();
+    }
+    catch (const std::exception& e)
+    {
+        logWarning(DDSROUTER_METRICS, "Failed to get metrics: " << e.what());
+        send_all(native(connection), response("500 Internal Server Error", "text/plain", "Internal Server Error\n"));
+        return;
+    }
+
+    send_all(native(connection), response("200 OK", "text/plain; version=0.0.4; charset=utf-8", body));
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,202 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file MetricsRegistry.cpp
+ *
+ */
+
+#include <ddsrouter_core/metrics/MetricsRegistry.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+MetricsRegistry::MetricsRegistry(
+        const bool source_latency,
+        const bool route_latency)
+    : source_latency_(source_latency)
+    , route_latency_(std::make_shared<std::atomic<bool>>(route_latency))
+{
+}
+
+bool MetricsRegistry::source_latency() const noexcept
+{
+    return source_latency_;
+}
+
+std::shared_ptr<const std::atomic<bool>> MetricsRegistry::route_latency() const noexcept
+{
+    return route_latency_;
+}
+
+void MetricsRegistry::set_route_latency(
+        const bool enabled) noexcept
+{
+    route_latency_->store(enabled, std::memory_order_relaxed);
+}
+
+uint32_t MetricsRegistry::participant_index(
+        const ddspipe::core::types::ParticipantId& participant_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const auto it = participant_indexes_.emplace(participant_id, static_cast<uint32_t>(participant_indexes_.size()));
+    return it.first->second;
+}
+
+std::shared_ptr<RouterReaderCounters> MetricsRegistry::reader_counters(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const std::string& topic_name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& counters = entries_[{topic_name, participant_id}].reader_counters;
+    if (!counters)
+    {
+        counters = std::make_shared<RouterReaderCounters>();
+    }
+
+    return counters;
+}
+
+std::shared_ptr<RouterWriterCounters> MetricsRegistry::writer_counters(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const std::string& topic_name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& counters = entries_[{topic_name, participant_id}].writer_counters;
+    if (!counters)
+    {
+        counters = std::make_shared<RouterWriterCounters>(source_latency_);
+    }
+
+    return counters;
+}
+
+void MetricsRegistry::register_reader(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const std::string& topic_name,
+        const std::shared_ptr<ddspipe::core::IReader>& reader)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& readers = entries_[{topic_name, participant_id}].readers;
+
+    // Forget the readers already destroyed
+    for (auto it = readers.begin(); it != readers.end();)
+    {
+        it = it->expired() ? readers.erase(it) : it + 1;
+    }
+
+    readers.push_back(reader);
+}
+
+std::map<std::string, std::map<ddspipe::core::types::ParticipantId,
+        types::TrafficStatistics>> MetricsRegistry::traffic() const
+{
+    std::map<std::string, std::map<ddspipe::core::types::ParticipantId, types::TrafficStatistics>> result;
+    std::vector<std::pair<types::TrafficStatistics*, std::shared_ptr<ddspipe::core::IReader>>> readers;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (const auto& it : entries_)
+    {
+        types::TrafficStatistics& traffic = result[it.first.first][it.first.second];
+        const Entry& entry = it.second;
+
+        if (entry.reader_counters)
+        {
+            traffic.samples_received = entry.reader_counters->samples_received.value();
+            traffic.bytes_received = entry.reader_counters->bytes_received.value();
+            traffic.dropped_samples[static_cast<std::size_t>(types::DropReason::expired)] =
+                    entry.reader_counters->expired_samples.value();
+            traffic.dropped_samples[static_cast<std::size_t>(types::DropReason::duplicated)] =
+                    entry.reader_counters->duplicated_samples.value();
+        }
+
+        if (entry.writer_counters)
+        {
+            traffic.samples_sent = entry.writer_counters->samples_sent.value();
+            traffic.bytes_sent = entry.writer_counters->bytes_sent.value();
+            traffic.dropped_samples[static_cast<std::size_t>(types::DropReason::uninterested)] =
+                    entry.writer_counters->uninterested_samples.value();
+            traffic.dropped_samples[static_cast<std::size_t>(types::DropReason::inactive_link)] =
+                    entry.writer_counters->inactive_link_samples.value();
+            traffic.dropped_samples[static_cast<std::size_t>(types::DropReason::write_error)] =
+                    entry.writer_counters->failed_writes.value();
+        }
+
+        for (const auto& weak_reader : entry.readers)
+        {
+            auto reader = weak_reader.lock();
+            if (reader)
+            {
+                readers.emplace_back(&traffic, reader);
+            }
+        }
+    }
+
+    lock.unlock();
+
+    // Query the readers without holding the mutex, as they lock their own ones
+    for (const auto& it : readers)
+    {
+        it.first->unread_samples += it.second->get_unread_count();
+    }
+
+    return result;
+}
+
+std::map<std::string, std::map<types::Route, types::RouteLatencyStatistics>> MetricsRegistry::latencies() const
+{
+    std::map<std::string, std::map<types::Route, types::RouteLatencyStatistics>> result;
+    std::vector<std::pair<std::pair<std::string, ddspipe::core::types::ParticipantId>,
+            std::shared_ptr<RouterWriterCounters>>> writers;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (const auto& it : entries_)
+        {
+            if (it.second.writer_counters)
+            {
+                writers.emplace_back(it.first, it.second.writer_counters);
+            }
+        }
+    }
+
+    // Compute the percentiles without holding the mutex
+    for (const auto& writer : writers)
+    {
+        for (const auto& route : writer.second->route_latencies.all())
+        {
+            types::RouteLatencyStatistics& statistics =
+                    result[writer.first.first][{route.first, writer.first.second}];
+            statistics.router = route.second->router.summary();
+            if (route.second->source)
+            {
+                statistics.source = route.second->source->summary();
+            }
+        }
+    }
+
+    return result;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,328 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file PrometheusSerializer.cpp
+ *
+ */
+
+#include <sstream>
+
+#include <ddsrouter_core/metrics/PrometheusSerializer.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+constexpr double NS_PER_SECOND = 1e9;
+
+//! Escape a label value as required by the exposition format
+std::string escape(
+        const std::string& value)
+{
+    std::string result;
+    result.reserve(value.size());
+
+    for (const char c : value)
+    {
+        switch (c)
+        {
+            case '\\':
+                result += "\\\\";
+                break;
+
+            case '"':
+                result += "\\\"";
+                break;
+
+            case '\n':
+                result += "\\n";
+                break;
+
+            default:
+                result += c;
+                break;
+        }
+    }
+
+    return result;
+}
+
+//! Write the HELP and TYPE lines of a metric
+void header(
+        std::ostream& output,
+        const char* name,
+        const char* type,
+        const char* help)
+{
+    output << "# HELP " << name << " " << help << "\n";
+    output << "# TYPE " << name << " " << type << "\n";
+}
+
+//! Write a traffic metric for every topic and participant
+template <typename Getter>
+void traffic_metric(
+        std::ostream& output,
+        const types::DdsRouterStatistics& statistics,
+        const char* name,
+        const char* type,
+        const char* help,
+        Getter getter)
+{
+    header(output, name, type, help);
+
+    for (const auto& topic_it : statistics.traffic)
+    {
+        for (const auto& participant_it : topic_it.second)
+        {
+            output << name << "{topic=\"" << escape(topic_it.first) << "\",participant=\""
+                   << escape(participant_it.first) << "\"} " << getter(participant_it.second) << "\n";
+        }
+    }
+}
+
+//! Write a metric for every element of a map indexed by participant id
+template <typename Map, typename Getter>
+void participant_metric(
+        std::ostream& output,
+        const Map& map,
+        const char* name,
+        const char* type,
+        const char* help,
+        Getter getter)
+{
+    if (map.empty())
+    {
+        return;
+    }
+
+    header(output, name, type, help);
+
+    for (const auto& it : map)
+    {
+        output << name << "{participant=\"" << escape(it.first) << "\"} " << getter(it.second) << "\n";
+    }
+}
+
+//! Write the quantiles and count of a latency summary with \c labels (without braces)
+void latency_summary(
+        std::ostream& output,
+        const char* name,
+        const std::string& labels,
+        const types::LatencySummary& latency)
+{
+    output << name << "{" << labels << ",quantile=\"0.5\"} " << latency.p50 / NS_PER_SECOND << "\n";
+    output << name << "{" << labels << ",quantile=\"0.99\"} " << latency.p99 / NS_PER_SECOND << "\n";
+    output << name << "{" << labels << ",quantile=\"0.999\"} " << latency.p999 / NS_PER_SECOND << "\n";
+    output << name << "{" << labels << ",quantile=\"1\"} " << latency.max / NS_PER_SECOND << "\n";
+    output << name << "_count{" << labels << "} " << latency.count << "\n";
+}
+
+//! Write a latency summary for every route of every topic
+template <typename Getter>
+void route_latency_metric(
+        std::ostream& output,
+        const types::DdsRouterStatistics& statistics,
+        const char* name,
+        const char* help,
+        Getter getter)
+{
+    bool header_written = false;
+
+    for (const auto& topic_it : statistics.latencies)
+    {
+        for (const auto& route_it : topic_it.second)
+        {
+            const types::LatencySummary& latency = getter(route_it.second);
+            if (latency.count == 0)
+            {
+                continue;
+            }
+
+            if (!header_written)
+            {
+                header(output, name, "summary", help);
+                header_written = true;
+            }
+
+            latency_summary(output, name,
+                    "topic=\"" + escape(topic_it.first) + "\",source=\"" + escape(route_it.first.first) +
+                    "\",destination=\"" + escape(route_it.first.second) + "\"",
+                    latency);
+        }
+    }
+}
+
+} /* namespace */
+
+std::string to_prometheus_text(
+        const types::DdsRouterStatistics& statistics)
+{
+    std::ostringstream output;
+
+    /////
+    // Traffic
+    traffic_metric(output, statistics, "ddsrouter_samples_received_total", "counter",
+            "Samples received by the readers of a topic in a participant.",
+            [](const types::TrafficStatistics& traffic)
+            {
+                return traffic.samples_received;
+            });
+
+    traffic_metric(output, statistics, "ddsrouter_bytes_received_total", "counter",
+            "Bytes of the samples received by the readers of a topic in a participant.",
+            [](const types::TrafficStatistics& traffic)
+            {
+                return traffic.bytes_received;
+            });
+
+    traffic_metric(output, statistics, "ddsrouter_samples_sent_total", "counter",
+            "Samples sent by the writers of a topic in a participant.",
+            [](const types::TrafficStatistics& traffic)
+            {
+                return traffic.samples_sent;
+            });
+
+    traffic_metric(output, statistics, "ddsrouter_bytes_sent_total", "counter",
+            "Bytes of the samples sent by the writers of a topic in a participant.",
+            [](const types::TrafficStatistics& traffic)
+            {
+                return traffic.bytes_sent;
+            });
+
+    traffic_metric(output, statistics, "ddsrouter_unread_samples", "gauge",
+            "Samples waiting in the readers of a topic in a participant to be forwarded.",
+            [](const types::TrafficStatistics& traffic)
+            {
+                return traffic.unread_samples;
+            });
+
+    header(output, "ddsrouter_dropped_samples_total", "counter",
+            "Samples of a topic in a participant not forwarded, by reason.");
+    for (const auto& topic_it : statistics.traffic)
+    {
+        for (const auto& participant_it : topic_it.second)
+        {
+            for (const auto reason : types::VALUES_DropReason)
+            {
+                output << "ddsrouter_dropped_samples_total{topic=\"" << escape(topic_it.first)
+                       << "\",participant=\"" << escape(participant_it.first)
+                       << "\",reason=\"" << types::to_string(reason) << "\"} "
+                       << participant_it.second.dropped_samples[static_cast<std::size_t>(reason)] << "\n";
+            }
+        }
+    }
+
+    /////
+    // Latencies
+    route_latency_metric(output, statistics, "ddsrouter_router_latency_seconds",
+            "Latency from the reception of the samples of a topic in a participant until they are written in another.",
+            [](const types::RouteLatencyStatistics& latency) -> const types::LatencySummary&
+            {
+                return latency.router;
+            });
+
+    route_latency_metric(output, statistics, "ddsrouter_source_latency_seconds",
+            "Latency from the source timestamp of the samples of a topic until they are written in a participant.",
+            [](const types::RouteLatencyStatistics& latency) -> const types::LatencySummary&
+            {
+                return latency.source;
+            });
+
+    /////
+    // Payload pool
+    header(output, "ddsrouter_payloads_in_use", "gauge",
+            "Payloads currently held by the payload pool.");
+    output << "ddsrouter_payloads_in_use " << statistics.payloads_in_use << "\n";
+
+    /////
+    // Redundancy groups
+    participant_metric(output, statistics.redundancy_paths, "ddsrouter_redundancy_first_arrivals_total", "counter",
+            "Samples received first through a path of a redundancy group.",
+            [](const types::RedundancyPathStatistics& path)
+            {
+                return path.first_arrivals;
+            });
+
+    participant_metric(output, statistics.redundancy_paths, "ddsrouter_redundancy_late_arrivals_total", "counter",
+            "Samples received through a path of a redundancy group after another path.",
+            [](const types::RedundancyPathStatistics& path)
+            {
+                return path.late_arrivals;
+            });
+
+    if (!statistics.redundancy_paths.empty())
+    {
+        header(output, "ddsrouter_redundancy_latency_seconds", "summary",
+                "Latency from the source timestamp to the reception through a path of a redundancy group.");
+        for (const auto& it : statistics.redundancy_paths)
+        {
+            latency_summary(output, "ddsrouter_redundancy_latency_seconds",
+                    "participant=\"" + escape(it.first) + "\"", it.second.latency);
+        }
+    }
+
+    /////
+    // Link groups
+    participant_metric(output, statistics.links, "ddsrouter_link_alive", "gauge",
+            "Whether a link of a link group answers the probes (1) or not (0).",
+            [](const types::LinkStatistics& link)
+            {
+                return link.alive ? 1 : 0;
+            });
+
+    participant_metric(output, statistics.links, "ddsrouter_link_active", "gauge",
+            "Whether the data is sent through a link of a link group (1) or not (0).",
+            [](const types::LinkStatistics& link)
+            {
+                return link.active ? 1 : 0;
+            });
+
+    participant_metric(output, statistics.links, "ddsrouter_link_round_trip_time_seconds", "gauge",
+            "Smoothed round trip time of a link of a link group.",
+            [](const types::LinkStatistics& link)
+            {
+                return link.round_trip_time / NS_PER_SECOND;
+            });
+
+    participant_metric(output, statistics.links, "ddsrouter_link_probes_sent_total", "counter",
+            "Probes sent through a link of a link group.",
+            [](const types::LinkStatistics& link)
+            {
+                return link.probes_sent;
+            });
+
+    participant_metric(output, statistics.links, "ddsrouter_link_probes_received_total", "counter",
+            "Probes answered through a link of a link group.",
+            [](const types::LinkStatistics& link)
+            {
+                return link.probes_received;
+            });
+
+    participant_metric(output, statistics.links, "ddsrouter_link_activations_total", "counter",
+            "Times a link of a link group has become the active one.",
+            [](const types::LinkStatistics& link)
+            {
+                return link.activations;
+            });
+
+    return output.str();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
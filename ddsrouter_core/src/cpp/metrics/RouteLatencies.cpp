@@ -0,0 +1,80 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file RouteLatencies.cpp
+ *
+ */
+
+#include <ddsrouter_core/metrics/RouteLatencies.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+RouteLatency::RouteLatency(
+        const bool source_latency)
+    : source(source_latency ? new types::LatencyHistogram() : nullptr)
+{
+}
+
+RouteLatencies::RouteLatencies(
+        const bool source_latency)
+    : source_latency_(source_latency)
+{
+}
+
+std::shared_ptr<RouteLatency> RouteLatencies::get(
+        const ddspipe::core::types::ParticipantId& source)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& latency = latencies_[source];
+    if (!latency)
+    {
+        latency = std::make_shared<RouteLatency>(source_latency_);
+    }
+
+    return latency;
+}
+
+RouteLatency* RouteLatencies::get(
+        const ddspipe::core::types::ParticipantId& source,
+        const uint32_t source_index)
+{
+    if (source_index >= CACHED_SOURCES)
+    {
+        return get(source).get();
+    }
+
+    RouteLatency* latency = cached_[source_index].load(std::memory_order_acquire);
+    if (latency == nullptr)
+    {
+        latency = get(source).get();
+        cached_[source_index].store(latency, std::memory_order_release);
+    }
+
+    return latency;
+}
+
+std::map<ddspipe::core::types::ParticipantId, std::shared_ptr<RouteLatency>> RouteLatencies::all() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return latencies_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
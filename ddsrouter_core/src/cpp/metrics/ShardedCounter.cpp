@@ -0,0 +1,57 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file ShardedCounter.cpp
+ *
+ */
+
+#include <ddsrouter_core/metrics/ShardedCounter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+constexpr std::size_t ShardedCounter::SHARDS;
+
+uint64_t ShardedCounter::value() const noexcept
+{
+    uint64_t result = 0;
+    for (const auto& shard : shards_)
+    {
+        result += shard.value.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+void ShardedCounter::reset() noexcept
+{
+    for (auto& shard : shards_)
+    {
+        shard.value.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::size_t ShardedCounter::shard_index_() noexcept
+{
+    // Threads are assigned shards in round robin, so the first SHARDS threads do not share any
+    static std::atomic<std::size_t> next_index {0};
+    thread_local const std::size_t index = next_index.fetch_add(1, std::memory_order_relaxed) % SHARDS;
+    return index;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,135 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsPubSubType.cpp
+ *
+ */
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+#include <fastcdr/exceptions/Exception.h>
+
+#include <ddsrouter_core/metrics/StatisticsPubSubType.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Size of the encapsulation header of the serialized payload
+constexpr uint32_t ENCAPSULATION_SIZE = 4;
+
+//! Serialized size of a sample with an empty metrics string (timestamp, string length and null terminator)
+constexpr uint32_t MIN_SERIALIZED_SIZE = ENCAPSULATION_SIZE + 8 + 4 + 1;
+
+} /* namespace */
+
+StatisticsPubSubType::StatisticsPubSubType()
+{
+    setName(TYPE_NAME);
+    // The metrics string is unbounded, so payloads are resized to each sample (see getSerializedSizeProvider)
+    m_typeSize = MIN_SERIALIZED_SIZE;
+    m_isGetKeyDefined = false;
+}
+
+bool StatisticsPubSubType::serialize(
+        void* data,
+        fastrtps::rtps::SerializedPayload_t* payload)
+{
+    const StatisticsSample* sample = static_cast<StatisticsSample*>(data);
+
+    fastcdr::FastBuffer buffer(reinterpret_cast<char*>(payload->data), payload->max_size);
+    fastcdr::Cdr ser(buffer, fastcdr::Cdr::DEFAULT_ENDIAN, fastcdr::Cdr::DDS_CDR);
+    payload->encapsulation = ser.endianness() == fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+    ser.serialize_encapsulation();
+
+    try
+    {
+        ser << sample->timestamp;
+        ser << sample->metrics;
+    }
+    catch (const fastcdr::exception::Exception&)
+    {
+        return false;
+    }
+
+    payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+    return true;
+}
+
+bool StatisticsPubSubType::deserialize(
+        fastrtps::rtps::SerializedPayload_t* payload,
+        void* data)
+{
+    StatisticsSample* sample = static_cast<StatisticsSample*>(data);
+
+    fastcdr::FastBuffer buffer(reinterpret_cast<char*>(payload->data), payload->length);
+    fastcdr::Cdr deser(buffer, fastcdr::Cdr::DEFAULT_ENDIAN, fastcdr::Cdr::DDS_CDR);
+
+    try
+    {
+        deser.read_encapsulation();
+        payload->encapsulation = deser.endianness() == fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+        deser >> sample->timestamp;
+        deser >> sample->metrics;
+    }
+    catch (const fastcdr::exception::Exception&)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+std::function<uint32_t()> StatisticsPubSubType::getSerializedSizeProvider(
+        void* data)
+{
+    return [data]() -> uint32_t
+           {
+               return serialized_size(*static_cast<StatisticsSample*>(data));
+           };
+}
+
+bool StatisticsPubSubType::getKey(
+        void*,
+        fastrtps::rtps::InstanceHandle_t*,
+        bool)
+{
+    return false;
+}
+
+void* StatisticsPubSubType::createData()
+{
+    return new StatisticsSample();
+}
+
+void StatisticsPubSubType::deleteData(
+        void* data)
+{
+    delete static_cast<StatisticsSample*>(data);
+}
+
+uint32_t StatisticsPubSubType::serialized_size(
+        const StatisticsSample& sample) noexcept
+{
+    // The timestamp is aligned to 8 from the beginning of the data, so no padding is needed before the string
+    return MIN_SERIALIZED_SIZE + static_cast<uint32_t>(sample.metrics.size());
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
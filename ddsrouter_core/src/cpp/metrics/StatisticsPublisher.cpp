@@ -0,0 +1,194 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsPublisher.cpp
+ *
+ */
+
+#include <chrono>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+
+#include <ddsrouter_core/metrics/StatisticsPubSubType.hpp>
+#include <ddsrouter_core/metrics/StatisticsPublisher.hpp>
+
+#include "../utils/clock.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Name of the participant that publishes the statistics
+constexpr const char* PARTICIPANT_NAME = "ddsrouter_monitor";
+
+} /* namespace */
+
+StatisticsPublisher::StatisticsPublisher(
+        const MonitorConfiguration& configuration,
+        const ContentCallback& content)
+    : configuration_(configuration)
+    , content_(content)
+    , type_(new StatisticsPubSubType())
+{
+    fastdds::dds::DomainParticipantQos participant_qos =
+            fastdds::dds::DomainParticipantFactory::get_instance()->get_default_participant_qos();
+    participant_qos.name(PARTICIPANT_NAME);
+
+    participant_ = fastdds::dds::DomainParticipantFactory::get_instance()->create_participant(
+        configuration_.domain, participant_qos);
+
+    if (participant_ != nullptr && type_.register_type(participant_) == fastrtps::types::ReturnCode_t::RETCODE_OK)
+    {
+        publisher_ = participant_->create_publisher(fastdds::dds::PUBLISHER_QOS_DEFAULT);
+        topic_ = participant_->create_topic(
+            configuration_.topic_name, type_.get_type_name(), fastdds::dds::TOPIC_QOS_DEFAULT);
+    }
+
+    if (publisher_ != nullptr && topic_ != nullptr)
+    {
+        // Late joiners get the last snapshot
+        fastdds::dds::DataWriterQos writer_qos = publisher_->get_default_datawriter_qos();
+        writer_qos.reliability().kind = fastdds::dds::RELIABLE_RELIABILITY_QOS;
+        writer_qos.durability().kind = fastdds::dds::TRANSIENT_LOCAL_DURABILITY_QOS;
+        writer_qos.history().kind = fastdds::dds::KEEP_LAST_HISTORY_QOS;
+        writer_qos.history().depth = 1;
+
+        writer_ = publisher_->create_datawriter(topic_, writer_qos);
+    }
+
+    if (writer_ == nullptr)
+    {
+        destroy_entities_();
+        throw utils::InitializationException(
+                  utils::Formatter() << "Failed to create the DDS entities to publish the statistics in topic "
+                                     << configuration_.topic_name << " of domain " << configuration_.domain << ".");
+    }
+
+    thread_ = std::thread(&StatisticsPublisher::run_, this);
+
+    logInfo(DDSROUTER_MONITOR,
+            "Publishing statistics in topic " << configuration_.topic_name << " of domain " << configuration_.domain
+                                              << " every " << configuration_.period << "ms.");
+}
+
+StatisticsPublisher::~StatisticsPublisher()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    stop_condition_.notify_all();
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    destroy_entities_();
+}
+
+uint64_t StatisticsPublisher::published() const noexcept
+{
+    return published_.load(std::memory_order_relaxed);
+}
+
+void StatisticsPublisher::run_() noexcept
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!stop_condition_.wait_for(
+                lock,
+                std::chrono::milliseconds(configuration_.period),
+                [this]()
+                {
+                    return stop_;
+                }))
+    {
+        // Publish without the lock, so stopping is not delayed by a slow snapshot
+        lock.unlock();
+        publish_();
+        lock.lock();
+    }
+}
+
+void StatisticsPublisher::publish_() noexcept
+{
+    StatisticsSample sample;
+
+    try
+    {
+        sample.metrics = content_();
+    }
+    catch (const std::exception& e)
+    {
+        logWarning(DDSROUTER_MONITOR, "Error taking the statistics to publish: " << e.what());
+        return;
+    }
+
+    sample.timestamp = static_cast<uint64_t>(system_now_ns());
+
+    if (writer_->write(&sample))
+    {
+        published_.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        logWarning(DDSROUTER_MONITOR, "Error publishing the statistics in topic " << configuration_.topic_name << ".");
+    }
+}
+
+void StatisticsPublisher::destroy_entities_() noexcept
+{
+    if (participant_ == nullptr)
+    {
+        return;
+    }
+
+    if (writer_ != nullptr)
+    {
+        publisher_->delete_datawriter(writer_);
+        writer_ = nullptr;
+    }
+
+    if (publisher_ != nullptr)
+    {
+        participant_->delete_publisher(publisher_);
+        publisher_ = nullptr;
+    }
+
+    if (topic_ != nullptr)
+    {
+        participant_->delete_topic(topic_);
+        topic_ = nullptr;
+    }
+
+    fastdds::dds::DomainParticipantFactory::get_instance()->delete_participant(participant_);
+    participant_ = nullptr;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,154 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DuplicateFilter.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <ddsrouter_core/participant/DuplicateFilter.hpp>
+
+#include "../utils/clock.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+DuplicateFilter::DuplicateFilter(
+        const unsigned int window_size,
+        const utils::Duration_ms lease)
+    : window_size_(window_size)
+    , lease_ms_(static_cast<int64_t>(lease))
+{
+}
+
+bool DuplicateFilter::insert(
+        const ddspipe::core::types::Guid& writer_guid,
+        const uint64_t sequence_number)
+{
+    return insert(writer_guid, sequence_number, writer_guid);
+}
+
+bool DuplicateFilter::insert(
+        const ddspipe::core::types::Guid& writer_guid,
+        const uint64_t sequence_number,
+        const ddspipe::core::types::Guid& sender_guid)
+{
+    const int64_t now_ms = steady_now_ms();
+
+    Shard& shard = shard_(writer_guid);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    // Erase the windows of the writers gone, at most once per lease
+    if (now_ms - shard.last_sweep_ms >= lease_ms_)
+    {
+        sweep_(shard, now_ms);
+    }
+
+    auto it = shard.windows.find(writer_guid);
+    if (it == shard.windows.end())
+    {
+        it = shard.windows.emplace(writer_guid, Entry{types::SequenceWindow(window_size_), now_ms, {}}).first;
+    }
+
+    auto& senders = it->second.senders;
+    if (std::find(senders.begin(), senders.end(), sender_guid) == senders.end())
+    {
+        senders.push_back(sender_guid);
+    }
+
+    it->second.last_insert_ms = now_ms;
+    return it->second.window.insert(sequence_number);
+}
+
+void DuplicateFilter::erase(
+        const ddspipe::core::types::Guid& sender_guid)
+{
+    // The windows are indexed by origin, that differs from the sender for the samples forwarded by other routers,
+    // so every shard is visited. This only happens when a writer is undiscovered.
+    for (auto& shard : shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        for (auto it = shard.windows.begin(); it != shard.windows.end();)
+        {
+            auto& senders = it->second.senders;
+            senders.erase(std::remove(senders.begin(), senders.end(), sender_guid), senders.end());
+
+            if (senders.empty())
+            {
+                it = shard.windows.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+}
+
+std::size_t DuplicateFilter::size() const
+{
+    std::size_t size = 0;
+
+    for (const auto& shard : shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        size += shard.windows.size();
+    }
+
+    return size;
+}
+
+DuplicateFilter::Shard& DuplicateFilter::shard_(
+        const ddspipe::core::types::Guid& writer_guid) noexcept
+{
+    // FNV-1a of the GUID, as the writers of the same participant only differ in the entity id
+    std::size_t hash = 2166136261u;
+    for (const auto byte : writer_guid.guidPrefix.value)
+    {
+        hash = (hash ^ byte) * 16777619u;
+    }
+    for (const auto byte : writer_guid.entityId.value)
+    {
+        hash = (hash ^ byte) * 16777619u;
+    }
+
+    return shards_[hash % SHARDS];
+}
+
+void DuplicateFilter::sweep_(
+        Shard& shard,
+        const int64_t now_ms) noexcept
+{
+    for (auto it = shard.windows.begin(); it != shard.windows.end();)
+    {
+        if (now_ms - it->second.last_insert_ms >= lease_ms_)
+        {
+            it = shard.windows.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    shard.last_sweep_ms = now_ms;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,59 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DuplicateFilterDatabase.cpp
+ *
+ */
+
+#include <ddsrouter_core/participant/DuplicateFilterDatabase.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+DuplicateFilterDatabase::DuplicateFilterDatabase(
+        const DeduplicationConfiguration& configuration)
+    : configuration_(configuration)
+{
+}
+
+std::shared_ptr<DuplicateFilter> DuplicateFilterDatabase::get_filter(
+        const std::string& topic_name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& filter = filters_[topic_name];
+    if (!filter)
+    {
+        filter = std::make_shared<DuplicateFilter>(configuration_.window, configuration_.lease);
+    }
+
+    return filter;
+}
+
+void DuplicateFilterDatabase::erase_writer(
+        const ddspipe::core::types::Guid& writer_guid)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (const auto& it : filters_)
+    {
+        it.second->erase(writer_guid);
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
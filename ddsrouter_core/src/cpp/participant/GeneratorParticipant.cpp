@@ -0,0 +1,115 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file GeneratorParticipant.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_participants/reader/auxiliar/BlankReader.hpp>
+#include <ddspipe_participants/writer/auxiliar/BlankWriter.hpp>
+
+#include <ddsrouter_core/participant/GeneratorParticipant.hpp>
+#include <ddsrouter_core/participant/GeneratorReader.hpp>
+#include <ddsrouter_core/types/GeneratedSample.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+GeneratorParticipant::GeneratorParticipant(
+        const std::shared_ptr<GeneratorParticipantConfiguration>& configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool)
+    : configuration_(configuration)
+    , payload_pool_(payload_pool)
+{
+}
+
+ddspipe::core::types::ParticipantId GeneratorParticipant::id() const noexcept
+{
+    return configuration_->id;
+}
+
+bool GeneratorParticipant::is_repeater() const noexcept
+{
+    return configuration_->is_repeater;
+}
+
+bool GeneratorParticipant::is_rtps_kind() const noexcept
+{
+    return false;
+}
+
+ddspipe::core::types::TopicQoS GeneratorParticipant::topic_qos() const noexcept
+{
+    return ddspipe::core::types::TopicQoS();
+}
+
+std::shared_ptr<ddspipe::core::IWriter> GeneratorParticipant::create_writer(
+        const ddspipe::core::ITopic& /* topic */)
+{
+    return std::make_shared<ddspipe::participants::BlankWriter>();
+}
+
+std::shared_ptr<ddspipe::core::IReader> GeneratorParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto& topics = configuration_->topics;
+    for (uint32_t index = 0; index < topics.size(); ++index)
+    {
+        if (topics[index].dds_topic().topic_unique_name() == topic.topic_unique_name())
+        {
+            return std::make_shared<GeneratorReader>(
+                configuration_->id,
+                generated_guid(configuration_->id, index, topics[index].keys > 0),
+                topics[index],
+                payload_pool_);
+        }
+    }
+
+    return std::make_shared<ddspipe::participants::BlankReader>();
+}
+
+ddspipe::core::types::Guid GeneratorParticipant::generated_guid(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const uint32_t index,
+        const bool keyed) noexcept
+{
+    ddspipe::core::types::Guid guid;
+
+    // eProsima vendor id, followed by the hash of the participant id
+    guid.guidPrefix.value[0] = 0x01;
+    guid.guidPrefix.value[1] = 0x0f;
+    const uint32_t hash = types::GeneratedSample::checksum(
+        reinterpret_cast<const unsigned char*>(participant_id.data()), static_cast<uint32_t>(participant_id.size()));
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        guid.guidPrefix.value[8 + i] = static_cast<uint8_t>(hash >> (8 * (3 - i)));
+    }
+
+    // User defined writer entity, with or without key
+    guid.entityId.value[0] = static_cast<uint8_t>(index >> 16);
+    guid.entityId.value[1] = static_cast<uint8_t>(index >> 8);
+    guid.entityId.value[2] = static_cast<uint8_t>(index);
+    guid.entityId.value[3] = keyed ? 0x02 : 0x03;
+
+    return guid;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
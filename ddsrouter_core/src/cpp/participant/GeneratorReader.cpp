@@ -0,0 +1,244 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file GeneratorReader.cpp
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddsrouter_core/participant/GeneratorReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+//! Minimum time between checks of the samples due, so high rates are generated in batches
+constexpr std::chrono::milliseconds MIN_PERIOD(1);
+
+} /* namespace */
+
+GeneratorReader::GeneratorReader(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const ddspipe::core::types::Guid& guid,
+        const GeneratedTopicConfiguration& configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool)
+    : participant_id_(participant_id)
+    , guid_(guid)
+    , topic_(configuration.dds_topic())
+    , rate_(configuration.rate)
+    , keys_(configuration.keys)
+    , sample_(configuration.topic_name, configuration.payload_size)
+    , payload_pool_(payload_pool)
+{
+}
+
+GeneratorReader::~GeneratorReader()
+{
+    disable();
+}
+
+void GeneratorReader::enable() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (enabled_)
+    {
+        return;
+    }
+
+    logInfo(DDSROUTER_GENERATOR,
+            "Generating topic " << topic_.topic_name() << " at " << rate_ << " samples/s in participant "
+                                << participant_id_ << ".");
+
+    enabled_ = true;
+    generation_thread_ = std::thread(&GeneratorReader::generation_routine_, this);
+}
+
+void GeneratorReader::disable() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!enabled_)
+        {
+            return;
+        }
+
+        enabled_ = false;
+        pending_samples_ = 0;
+    }
+
+    generation_cv_.notify_all();
+    generation_thread_.join();
+}
+
+void GeneratorReader::set_on_data_available_callback(
+        std::function<void()> on_data_available_lambda) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    on_data_available_lambda_ = on_data_available_lambda;
+}
+
+void GeneratorReader::unset_on_data_available_callback() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    on_data_available_lambda_ = nullptr;
+}
+
+utils::ReturnCode GeneratorReader::take(
+        std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept
+{
+    uint64_t sequence;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!enabled_ || pending_samples_ == 0)
+        {
+            return utils::ReturnCode::RETCODE_NO_DATA;
+        }
+
+        --pending_samples_;
+        sequence = next_sequence_++;
+    }
+
+    std::unique_ptr<ddspipe::core::types::RtpsPayloadData> rtps_data(new ddspipe::core::types::RtpsPayloadData());
+
+    if (!payload_pool_->get_payload(sample_.size(), rtps_data->payload))
+    {
+        logWarning(DDSROUTER_GENERATOR,
+                "Failed to allocate a sample of topic " << topic_.topic_name() << " in participant "
+                                                        << participant_id_ << ".");
+        return utils::ReturnCode::RETCODE_OUT_OF_RESOURCES;
+    }
+    rtps_data->payload_owner = payload_pool_.get();
+
+    const uint32_t key = keys_ > 0 ? static_cast<uint32_t>(sequence % keys_) : 0;
+    sample_.serialize(key, sequence, rtps_data->payload.data);
+    rtps_data->payload.length = sample_.size();
+    rtps_data->payload.encapsulation = CDR_LE;
+
+    // The instance handle of a key of at most 16 bytes is its big endian serialization
+    if (keys_ > 0)
+    {
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            rtps_data->instanceHandle.value[i] = static_cast<fastrtps::rtps::octet>(key >> (8 * (3 - i)));
+        }
+    }
+
+    rtps_data->kind = fastrtps::rtps::ALIVE;
+    rtps_data->source_guid = guid_;
+    rtps_data->participant_receiver = participant_id_;
+    rtps_data->origin_sequence_number = fastrtps::rtps::SequenceNumber_t(sequence + 1);
+    fastrtps::rtps::Time_t::now(rtps_data->source_timestamp);
+
+    data.reset(rtps_data.release());
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+uint64_t GeneratorReader::skipped_samples() const noexcept
+{
+    return skipped_samples_.load(std::memory_order_relaxed);
+}
+
+ddspipe::core::types::Guid GeneratorReader::guid() const
+{
+    return guid_;
+}
+
+fastrtps::RecursiveTimedMutex& GeneratorReader::get_rtps_mutex() const
+{
+    return rtps_mutex_;
+}
+
+uint64_t GeneratorReader::get_unread_count() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_samples_;
+}
+
+ddspipe::core::types::DdsTopic GeneratorReader::topic() const
+{
+    return topic_;
+}
+
+ddspipe::core::types::ParticipantId GeneratorReader::participant_id() const noexcept
+{
+    return participant_id_;
+}
+
+void GeneratorReader::generation_routine_() noexcept
+{
+    const Clock::time_point start = Clock::now();
+
+    // Samples due since the start (the first one is due right away)
+    uint64_t samples_due = 0;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (enabled_)
+    {
+        const double elapsed_s = std::chrono::duration<double>(Clock::now() - start).count();
+        const uint64_t now_due = static_cast<uint64_t>(elapsed_s * rate_) + 1;
+
+        if (now_due > samples_due)
+        {
+            pending_samples_ += now_due - samples_due;
+            samples_due = now_due;
+
+            if (pending_samples_ > MAX_PENDING_SAMPLES)
+            {
+                skipped_samples_.fetch_add(pending_samples_ - MAX_PENDING_SAMPLES, std::memory_order_relaxed);
+                pending_samples_ = MAX_PENDING_SAMPLES;
+            }
+
+            // Notify without the lock, as the callback may take the samples right away
+            auto on_data_available_lambda = on_data_available_lambda_;
+            if (on_data_available_lambda)
+            {
+                lock.unlock();
+                on_data_available_lambda();
+                lock.lock();
+            }
+        }
+
+        const Clock::time_point next_sample = start + std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(samples_due / rate_));
+
+        generation_cv_.wait_until(
+            lock,
+            std::max(next_sample, Clock::now() + MIN_PERIOD),
+            [this]()
+            {
+                return !enabled_;
+            });
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,86 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file RecorderParticipant.cpp
+ *
+ */
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_participants/reader/auxiliar/BlankReader.hpp>
+#include <ddspipe_participants/writer/auxiliar/BlankWriter.hpp>
+
+#include <ddsrouter_core/participant/RecorderParticipant.hpp>
+#include <ddsrouter_core/participant/RecorderWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+RecorderParticipant::RecorderParticipant(
+        const std::shared_ptr<RecorderParticipantConfiguration>& configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool)
+    : configuration_(configuration)
+    , recorder_(std::make_shared<McapRecorder>(configuration, payload_pool))
+{
+}
+
+ddspipe::core::types::ParticipantId RecorderParticipant::id() const noexcept
+{
+    return configuration_->id;
+}
+
+bool RecorderParticipant::is_repeater() const noexcept
+{
+    return configuration_->is_repeater;
+}
+
+bool RecorderParticipant::is_rtps_kind() const noexcept
+{
+    return false;
+}
+
+ddspipe::core::types::TopicQoS RecorderParticipant::topic_qos() const noexcept
+{
+    return ddspipe::core::types::TopicQoS();
+}
+
+std::shared_ptr<ddspipe::core::IWriter> RecorderParticipant::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    if (!dds_topic)
+    {
+        // Only DDS topics are recorded
+        return std::make_shared<ddspipe::participants::BlankWriter>();
+    }
+
+    return std::make_shared<RecorderWriter>(recorder_, recorder_->add_channel(*dds_topic));
+}
+
+std::shared_ptr<ddspipe::core::IReader> RecorderParticipant::create_reader(
+        const ddspipe::core::ITopic& /* topic */)
+{
+    return std::make_shared<ddspipe::participants::BlankReader>();
+}
+
+const McapRecorder& RecorderParticipant::recorder() const noexcept
+{
+    return *recorder_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,61 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file RecorderWriter.cpp
+ *
+ */
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddsrouter_core/participant/RecorderWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+RecorderWriter::RecorderWriter(
+        const std::shared_ptr<McapRecorder>& recorder,
+        const uint16_t channel_id)
+    : recorder_(recorder)
+    , channel_id_(channel_id)
+{
+}
+
+void RecorderWriter::enable() noexcept
+{
+    // Nothing to do
+}
+
+void RecorderWriter::disable() noexcept
+{
+    // Nothing to do
+}
+
+utils::ReturnCode RecorderWriter::write(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    auto* rtps_data = dynamic_cast<ddspipe::core::types::RtpsPayloadData*>(&data);
+    if (rtps_data)
+    {
+        recorder_->record(channel_id_, *rtps_data);
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
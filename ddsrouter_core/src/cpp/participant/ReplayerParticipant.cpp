@@ -0,0 +1,99 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file ReplayerParticipant.cpp
+ *
+ */
+
+#include <ddspipe_participants/reader/auxiliar/BlankReader.hpp>
+#include <ddspipe_participants/writer/auxiliar/BlankWriter.hpp>
+
+#include <ddsrouter_core/participant/GeneratorParticipant.hpp>
+#include <ddsrouter_core/participant/ReplayerParticipant.hpp>
+#include <ddsrouter_core/participant/ReplayerReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ReplayerParticipant::ReplayerParticipant(
+        const std::shared_ptr<ReplayerParticipantConfiguration>& configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool)
+    : configuration_(configuration)
+    , replayer_(std::make_shared<McapReplayer>(configuration, payload_pool))
+{
+}
+
+ReplayerParticipant::~ReplayerParticipant()
+{
+    replayer_->stop();
+}
+
+ddspipe::core::types::ParticipantId ReplayerParticipant::id() const noexcept
+{
+    return configuration_->id;
+}
+
+bool ReplayerParticipant::is_repeater() const noexcept
+{
+    return configuration_->is_repeater;
+}
+
+bool ReplayerParticipant::is_rtps_kind() const noexcept
+{
+    return false;
+}
+
+ddspipe::core::types::TopicQoS ReplayerParticipant::topic_qos() const noexcept
+{
+    return ddspipe::core::types::TopicQoS();
+}
+
+std::shared_ptr<ddspipe::core::IWriter> ReplayerParticipant::create_writer(
+        const ddspipe::core::ITopic& /* topic */)
+{
+    return std::make_shared<ddspipe::participants::BlankWriter>();
+}
+
+std::shared_ptr<ddspipe::core::IReader> ReplayerParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    const auto& topics = replayer_->topics();
+    for (uint32_t index = 0; index < topics.size(); ++index)
+    {
+        if (topics[index].topic_unique_name() == topic.topic_unique_name())
+        {
+            auto reader = std::make_shared<ReplayerReader>(
+                configuration_->id,
+                GeneratorParticipant::generated_guid(configuration_->id, index, topics[index].topic_qos.keyed),
+                topics[index],
+                replayer_);
+            replayer_->add_reader(reader);
+            return reader;
+        }
+    }
+
+    return std::make_shared<ddspipe::participants::BlankReader>();
+}
+
+std::shared_ptr<McapReplayer> ReplayerParticipant::replayer() const noexcept
+{
+    return replayer_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
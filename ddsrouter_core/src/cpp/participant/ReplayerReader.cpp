@@ -0,0 +1,150 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file ReplayerReader.cpp
+ *
+ */
+
+#include <ddsrouter_core/participant/ReplayerReader.hpp>
+#include <ddsrouter_core/recorder/McapReplayer.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ReplayerReader::ReplayerReader(
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const ddspipe::core::types::Guid& guid,
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<McapReplayer>& replayer)
+    : participant_id_(participant_id)
+    , guid_(guid)
+    , topic_(topic)
+    , replayer_(replayer)
+{
+}
+
+void ReplayerReader::enable() noexcept
+{
+    bool first_enable;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        enabled_ = true;
+        first_enable = !ever_enabled_;
+        ever_enabled_ = true;
+    }
+
+    if (first_enable)
+    {
+        replayer_->reader_enabled();
+    }
+}
+
+void ReplayerReader::disable() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_ = false;
+    pending_samples_.clear();
+}
+
+void ReplayerReader::set_on_data_available_callback(
+        std::function<void()> on_data_available_lambda) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    on_data_available_lambda_ = on_data_available_lambda;
+}
+
+void ReplayerReader::unset_on_data_available_callback() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    on_data_available_lambda_ = nullptr;
+}
+
+utils::ReturnCode ReplayerReader::take(
+        std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (!enabled_ || pending_samples_.empty())
+    {
+        return utils::ReturnCode::RETCODE_NO_DATA;
+    }
+
+    data.reset(pending_samples_.front().release());
+    pending_samples_.pop_front();
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+bool ReplayerReader::push(
+        std::unique_ptr<ddspipe::core::types::RtpsPayloadData>& data) noexcept
+{
+    std::function<void()> on_data_available_lambda;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!enabled_)
+        {
+            data.reset();
+            return true;
+        }
+
+        if (pending_samples_.size() >= MAX_PENDING_SAMPLES)
+        {
+            return false;
+        }
+
+        pending_samples_.push_back(std::move(data));
+        on_data_available_lambda = on_data_available_lambda_;
+    }
+
+    // Notify without the lock, as the callback may take the sample right away
+    if (on_data_available_lambda)
+    {
+        on_data_available_lambda();
+    }
+
+    return true;
+}
+
+ddspipe::core::types::Guid ReplayerReader::guid() const
+{
+    return guid_;
+}
+
+fastrtps::RecursiveTimedMutex& ReplayerReader::get_rtps_mutex() const
+{
+    return rtps_mutex_;
+}
+
+uint64_t ReplayerReader::get_unread_count() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_samples_.size();
+}
+
+ddspipe::core::types::DdsTopic ReplayerReader::topic() const
+{
+    return topic_;
+}
+
+ddspipe::core::types::ParticipantId ReplayerReader::participant_id() const noexcept
+{
+    return participant_id_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,179 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RouterParticipant.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_core/types/topic/rpc/RpcTopic.hpp>
+
+#include <ddsrouter_core/participant/RouterParticipant.hpp>
+#include <ddsrouter_core/participant/RouterWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+RouterParticipant::RouterParticipant(
+        const std::shared_ptr<ddspipe::core::IParticipant>& participant,
+        const std::shared_ptr<MetricsRegistry>& metrics,
+        const utils::Duration_ms default_max_age,
+        const std::vector<types::TopicMaxAge>& topic_max_ages,
+        const std::shared_ptr<DuplicateFilterDatabase>& duplicate_filters,
+        const std::shared_ptr<RedundancyPathCounters>& redundancy_path,
+        const std::shared_ptr<LinkSelector>& link_selector,
+        const std::shared_ptr<InterestSubscriber>& remote_interest,
+        const bool router_link,
+        const bool stamp_origin)
+    : participant_(participant)
+    , metrics_(metrics)
+    , default_max_age_(default_max_age)
+    , duplicate_filters_(duplicate_filters)
+    , redundancy_path_(redundancy_path)
+    , link_selector_(link_selector)
+    , remote_interest_(remote_interest)
+    , router_link_(router_link)
+    , stamp_origin_(stamp_origin)
+{
+    // Only store the budgets that apply to this participant
+    for (const auto& topic_max_age : topic_max_ages)
+    {
+        if (topic_max_age.participants.empty() ||
+                topic_max_age.participants.find(participant_->id()) != topic_max_age.participants.end())
+        {
+            topic_max_ages_.push_back(topic_max_age);
+        }
+    }
+}
+
+ddspipe::core::types::ParticipantId RouterParticipant::id() const noexcept
+{
+    return participant_->id();
+}
+
+bool RouterParticipant::is_repeater() const noexcept
+{
+    return participant_->is_repeater();
+}
+
+bool RouterParticipant::is_rtps_kind() const noexcept
+{
+    return participant_->is_rtps_kind();
+}
+
+ddspipe::core::types::TopicQoS RouterParticipant::topic_qos() const noexcept
+{
+    return participant_->topic_qos();
+}
+
+std::shared_ptr<ddspipe::core::IWriter> RouterParticipant::create_writer(
+        const ddspipe::core::ITopic& topic)
+{
+    std::shared_ptr<ddspipe::core::IWriter> writer = participant_->create_writer(topic);
+
+    // The samples of transient local topics must reach the history of the writer for late joiners
+    std::shared_ptr<const std::atomic<bool>> interest_flag;
+    if (remote_interest_ && !is_transient_local_(topic))
+    {
+        interest_flag = remote_interest_->interest_flag(topic.topic_name());
+    }
+
+    return std::make_shared<RouterWriter>(
+        writer,
+        participant_->id(),
+        topic.topic_name(),
+        metrics_->writer_counters(participant_->id(), topic.topic_name()),
+        interest_flag,
+        link_selector_,
+        link_selector_ ? link_selector_->link_index(participant_->id()) : -1,
+        metrics_->route_latency(),
+        exchanges_origin_(topic),
+        stamp_origin_);
+}
+
+std::shared_ptr<ddspipe::core::IReader> RouterParticipant::create_reader(
+        const ddspipe::core::ITopic& topic)
+{
+    std::shared_ptr<ddspipe::core::IReader> reader = participant_->create_reader(topic);
+
+    // Account the samples waiting in the internal reader
+    metrics_->register_reader(participant_->id(), topic.topic_name(), reader);
+
+    // The remote DDS Router must not be announced the interest of its own readers
+    if (remote_interest_ && participant_->is_rtps_kind())
+    {
+        remote_interest_->add_participant(reader->guid().guidPrefix);
+    }
+
+    std::shared_ptr<DuplicateFilter> duplicate_filter;
+    if (duplicate_filters_)
+    {
+        duplicate_filter = duplicate_filters_->get_filter(topic.topic_name());
+    }
+
+    return std::make_shared<RouterReader>(
+        reader,
+        topic.topic_name(),
+        max_age_(topic),
+        duplicate_filter,
+        metrics_->reader_counters(participant_->id(), topic.topic_name()),
+        redundancy_path_,
+        metrics_->participant_index(participant_->id()),
+        exchanges_origin_(topic));
+}
+
+bool RouterParticipant::is_transient_local_(
+        const ddspipe::core::ITopic& topic) const noexcept
+{
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    return dds_topic && dds_topic->topic_qos.is_transient_local();
+}
+
+utils::Duration_ms RouterParticipant::max_age_(
+        const ddspipe::core::ITopic& topic) const noexcept
+{
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    const std::string type_name = dds_topic ? dds_topic->type_name : "";
+
+    for (const auto& topic_max_age : topic_max_ages_)
+    {
+        if (topic_max_age.matches(topic.topic_name(), type_name, participant_->id()))
+        {
+            return topic_max_age.max_age;
+        }
+    }
+
+    return default_max_age_;
+}
+
+bool RouterParticipant::exchanges_origin_(
+        const ddspipe::core::ITopic& topic) const noexcept
+{
+    if (!router_link_)
+    {
+        return false;
+    }
+
+    // The related sample identity of RPC topics correlates replies with requests
+    const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic);
+    return dds_topic == nullptr || !ddspipe::core::types::RpcTopic::is_service_topic(*dds_topic);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,381 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RouterReader.cpp
+ *
+ */
+
+#include <fastdds/rtps/common/WriteParams.h>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddsrouter_core/metrics/IngressStamp.hpp>
+#include <ddsrouter_core/participant/RouterReader.hpp>
+#include <ddsrouter_core/tracing/FlightRecorder.hpp>
+#include <ddsrouter_core/tracing/Tracer.hpp>
+
+#include "../utils/clock.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+RouterReader::RouterReader(
+        const std::shared_ptr<ddspipe::core::IReader>& reader,
+        const std::string& topic_name,
+        const utils::Duration_ms max_age,
+        const std::shared_ptr<DuplicateFilter>& duplicate_filter,
+        const std::shared_ptr<RouterReaderCounters>& counters,
+        const std::shared_ptr<RedundancyPathCounters>& redundancy_path,
+        const uint32_t participant_index,
+        const bool router_link)
+    : topic_name_(topic_name)
+    , participant_id_(reader->participant_id())
+    , participant_index_(participant_index)
+    , trace_topic_(Tracer::label(topic_name))
+    , trace_participant_(Tracer::label(participant_id_))
+    , flight_subject_("topic=" + topic_name + " participant=" + participant_id_)
+    , max_age_ns_(static_cast<int64_t>(max_age) * 1000000)
+    , router_link_(router_link)
+    , duplicate_filter_(duplicate_filter)
+    , counters_(counters)
+    , redundancy_path_(redundancy_path)
+    , reader_(reader)
+{
+    logDebug(DDSROUTER_READER,
+            "Creating Router Reader in participant " << reader_->participant_id() << " for topic " << topic_name_
+                                                     << " with max age " << max_age << "ms"
+                                                     << (duplicate_filter_ ? " and duplicate filter." : "."));
+
+    FlightRecorder::record(FlightEventKind::bridge_created, flight_subject_, "endpoint=reader");
+}
+
+RouterReader::~RouterReader()
+{
+    FlightRecorder::record(FlightEventKind::bridge_destroyed, flight_subject_, "endpoint=reader");
+}
+
+void RouterReader::enable() noexcept
+{
+    reader_->enable();
+}
+
+void RouterReader::disable() noexcept
+{
+    reader_->disable();
+}
+
+void RouterReader::set_on_data_available_callback(
+        std::function<void()> on_data_available_lambda) noexcept
+{
+    reader_->set_on_data_available_callback(
+        [this, on_data_available_lambda]()
+        {
+            {
+                std::lock_guard<std::mutex> lock(receptions_mutex_);
+                receptions_ns_.push_back(steady_now_ns());
+                ++receptions_count_;
+            }
+            on_data_available_lambda();
+        });
+}
+
+void RouterReader::unset_on_data_available_callback() noexcept
+{
+    reader_->unset_on_data_available_callback();
+}
+
+utils::ReturnCode RouterReader::take(
+        std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept
+{
+    while (true)
+    {
+        // The stamp of the previous sample must not be applied to the payload of this one
+        IngressStamp::reset();
+
+        utils::ReturnCode ret = reader_->take(data);
+
+        if (ret != utils::ReturnCode::RETCODE_OK)
+        {
+            return ret;
+        }
+
+        const int64_t source_timestamp_ns = account_reception_(*data);
+        const int64_t reception_ns = take_reception_();
+
+        // Release the discarded samples before any copy or send and keep taking.
+        // NOTE: expired samples are not registered in the duplicate filter, so a valid copy can still be forwarded.
+        if (is_expired_(*data, reception_ns))
+        {
+            data.reset();
+            counters_->expired_samples.add();
+            FlightRecorder::record(FlightEventKind::sample_dropped, flight_subject_, "reason=expired");
+
+            logDebug(DDSROUTER_READER,
+                    "Discarding sample in topic " << topic_name_ << " as it exceeds its max age.");
+            continue;
+        }
+
+        ddspipe::core::types::Guid origin_writer_guid;
+        uint64_t origin_sequence_number = 0;
+        bool origin_stamped = false;
+        const bool duplicated =
+                identify_origin_(*data, origin_writer_guid, origin_sequence_number, origin_stamped) &&
+                is_duplicated_(*data, origin_writer_guid, origin_sequence_number);
+        account_redundancy_path_(*data, duplicated);
+
+        if (duplicated)
+        {
+            data.reset();
+            counters_->duplicated_samples.add();
+
+            logDebug(DDSROUTER_READER,
+                    "Discarding sample in topic " << topic_name_ << " as it has already been received.");
+            continue;
+        }
+
+        IngressStamp stamp;
+        stamp.data = data.get();
+        stamp.source = &participant_id_;
+        stamp.source_index = participant_index_;
+        stamp.time_ns = reception_ns;
+        stamp.source_timestamp_ns = source_timestamp_ns;
+        stamp.origin_writer_guid = origin_writer_guid;
+        stamp.origin_sequence_number = origin_sequence_number;
+        stamp.origin_stamped = origin_stamped;
+        stamp.trace_sample = DDSROUTER_TRACE_SAMPLE();
+        stamp.trace_topic = trace_topic_;
+        stamp.trace_participant = trace_participant_;
+        IngressStamp::set(stamp);
+
+        if (stamp.trace_sample)
+        {
+            // Time waiting in the internal reader and in the thread pool queue
+            TraceEvent event;
+            event.name = "reader.queue";
+            event.async = true;
+            event.topic = stamp.trace_topic;
+            event.participant = stamp.trace_participant;
+            event.sample = stamp.trace_sample;
+            event.start_ns = stamp.time_ns;
+            event.duration_ns = Tracer::now() - stamp.time_ns;
+            DDSROUTER_TRACE_SPAN(event);
+        }
+
+        return ret;
+    }
+}
+
+ddspipe::core::types::Guid RouterReader::guid() const
+{
+    return reader_->guid();
+}
+
+fastrtps::RecursiveTimedMutex& RouterReader::get_rtps_mutex() const
+{
+    return reader_->get_rtps_mutex();
+}
+
+uint64_t RouterReader::get_unread_count() const
+{
+    return reader_->get_unread_count();
+}
+
+ddspipe::core::types::DdsTopic RouterReader::topic() const
+{
+    return reader_->topic();
+}
+
+ddspipe::core::types::ParticipantId RouterReader::participant_id() const noexcept
+{
+    return reader_->participant_id();
+}
+
+int64_t RouterReader::account_reception_(
+        const ddspipe::core::IRoutingData& data) noexcept
+{
+    counters_->samples_received.add();
+
+    const auto* rtps_data = dynamic_cast<const ddspipe::core::types::RtpsPayloadData*>(&data);
+    if (rtps_data == nullptr)
+    {
+        return 0;
+    }
+
+    counters_->bytes_received.add(rtps_data->payload.length);
+    return rtps_data->source_timestamp.to_ns();
+}
+
+int64_t RouterReader::take_reception_() noexcept
+{
+    std::unique_lock<std::mutex> lock(receptions_mutex_);
+
+    if (receptions_ns_.size() > 1)
+    {
+        // Count the samples still pending without the lock, as the listener stores receptions holding the mutex
+        // of the internal reader, that is also taken to count them.
+        const uint64_t count_before = receptions_count_;
+        lock.unlock();
+        const uint64_t pending = reader_->get_unread_count();
+        lock.lock();
+
+        // The receptions stored meanwhile may belong to samples not counted as pending yet.
+        // Any other reception beyond the sample taken and the pending ones belongs to a sample removed without
+        // being taken. Those are the oldest, so they are discarded from the front.
+        const uint64_t limit = 1 + pending + (receptions_count_ - count_before);
+        while (receptions_ns_.size() > limit)
+        {
+            receptions_ns_.pop_front();
+        }
+    }
+
+    if (receptions_ns_.empty())
+    {
+        // The internal reader did not notify this sample (e.g. several samples notified at once)
+        return steady_now_ns();
+    }
+
+    const int64_t reception_ns = receptions_ns_.front();
+    receptions_ns_.pop_front();
+    return reception_ns;
+}
+
+bool RouterReader::is_expired_(
+        const ddspipe::core::IRoutingData& data,
+        const int64_t reception_ns) const noexcept
+{
+    if (max_age_ns_ == 0)
+    {
+        return false;
+    }
+
+    // Time waited inside the router since the reception of the sample
+    if (steady_now_ns() - reception_ns > max_age_ns_)
+    {
+        return true;
+    }
+
+    // Check the source timestamp if the data has it.
+    // NOTE: this requires the clocks of the source and the router hosts to be synchronized.
+    const auto* rtps_data = dynamic_cast<const ddspipe::core::types::RtpsPayloadData*>(&data);
+    if (rtps_data != nullptr)
+    {
+        const int64_t source_timestamp_ns = rtps_data->source_timestamp.to_ns();
+        if (source_timestamp_ns > 0 && system_now_ns() - source_timestamp_ns > max_age_ns_)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool RouterReader::identify_origin_(
+        ddspipe::core::IRoutingData& data,
+        ddspipe::core::types::Guid& writer_guid,
+        uint64_t& sequence_number,
+        bool& stamped) const noexcept
+{
+    // Only RTPS data can be identified
+    auto* rtps_data = dynamic_cast<ddspipe::core::types::RtpsPayloadData*>(&data);
+    if (rtps_data == nullptr)
+    {
+        return false;
+    }
+
+    if (router_link_ && rtps_data->write_params.is_set())
+    {
+        // The sample comes from another DDS Router, which sent its origin as related sample identity
+        // NOTE: depending on the Fast DDS version, it is received as the related or as the sample identity
+        const auto& write_params = rtps_data->write_params.get_reference();
+        const fastrtps::rtps::SampleIdentity identity =
+                write_params.related_sample_identity() != fastrtps::rtps::SampleIdentity::unknown() ?
+                write_params.related_sample_identity() : write_params.sample_identity();
+
+        if (identity != fastrtps::rtps::SampleIdentity::unknown())
+        {
+            // The origin only travels between DDS Routers, so it is not forwarded as is
+            rtps_data->write_params.unset();
+
+            writer_guid = identity.writer_guid();
+            sequence_number = identity.sequence_number().to64long();
+            stamped = true;
+            return sequence_number != 0;
+        }
+    }
+
+    // Sequence number 0 is not valid in RTPS, so the origin of the sample is unknown
+    sequence_number = rtps_data->origin_sequence_number.to64long();
+    if (sequence_number == 0)
+    {
+        return false;
+    }
+
+    writer_guid = rtps_data->source_guid;
+    return true;
+}
+
+bool RouterReader::is_duplicated_(
+        const ddspipe::core::IRoutingData& data,
+        const ddspipe::core::types::Guid& writer_guid,
+        const uint64_t sequence_number) noexcept
+{
+    if (!duplicate_filter_)
+    {
+        return false;
+    }
+
+    // Only RTPS data have a known origin. The writer it is received from is registered too, so the window of the
+    // origin is erased once every writer delivering it is undiscovered.
+    const auto& rtps_data = static_cast<const ddspipe::core::types::RtpsPayloadData&>(data);
+    return !duplicate_filter_->insert(writer_guid, sequence_number, rtps_data.source_guid);
+}
+
+void RouterReader::account_redundancy_path_(
+        const ddspipe::core::IRoutingData& data,
+        const bool duplicated) noexcept
+{
+    if (!redundancy_path_)
+    {
+        return;
+    }
+
+    if (duplicated)
+    {
+        redundancy_path_->late_arrivals.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        redundancy_path_->first_arrivals.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // NOTE: this requires the clocks of the source and the router hosts to be synchronized.
+    const auto* rtps_data = dynamic_cast<const ddspipe::core::types::RtpsPayloadData*>(&data);
+    if (rtps_data != nullptr)
+    {
+        const int64_t source_timestamp_ns = rtps_data->source_timestamp.to_ns();
+        if (source_timestamp_ns > 0)
+        {
+            const int64_t latency_ns = system_now_ns() - source_timestamp_ns;
+            redundancy_path_->latency.record(latency_ns > 0 ? static_cast<uint64_t>(latency_ns) : 0);
+        }
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
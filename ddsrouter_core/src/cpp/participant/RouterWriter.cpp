@@ -0,0 +1,219 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file RouterWriter.cpp
+ *
+ */
+
+#include <cstdio>
+
+#include <fastdds/rtps/common/WriteParams.h>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddsrouter_core/metrics/IngressStamp.hpp>
+#include <ddsrouter_core/participant/RouterWriter.hpp>
+#include <ddsrouter_core/tracing/FlightRecorder.hpp>
+#include <ddsrouter_core/tracing/Tracer.hpp>
+
+#include "../utils/clock.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Latency as stored in the histograms (negative values due to clock adjustments are stored as 0)
+uint64_t to_latency(
+        const int64_t latency_ns) noexcept
+{
+    return latency_ns > 0 ? static_cast<uint64_t>(latency_ns) : 0;
+}
+
+} /* namespace */
+
+RouterWriter::RouterWriter(
+        const std::shared_ptr<ddspipe::core::IWriter>& writer,
+        const ddspipe::core::types::ParticipantId& participant_id,
+        const std::string& topic_name,
+        const std::shared_ptr<RouterWriterCounters>& counters,
+        const std::shared_ptr<const std::atomic<bool>>& interest_flag,
+        const std::shared_ptr<LinkSelector>& link_selector,
+        const int link_index,
+        const std::shared_ptr<const std::atomic<bool>>& route_latency,
+        const bool router_link,
+        const bool stamp_origin)
+    : writer_(writer)
+    , trace_topic_(Tracer::label(topic_name))
+    , trace_participant_(Tracer::label(participant_id))
+    , flight_subject_("topic=" + topic_name + " participant=" + participant_id)
+    , counters_(counters)
+    , interest_flag_(interest_flag)
+    , link_selector_(link_selector)
+    , link_index_(link_index)
+    , route_latency_(route_latency)
+    , router_link_(router_link)
+    , stamp_origin_(stamp_origin)
+{
+    FlightRecorder::record(FlightEventKind::bridge_created, flight_subject_, "endpoint=writer");
+}
+
+RouterWriter::~RouterWriter()
+{
+    FlightRecorder::record(FlightEventKind::bridge_destroyed, flight_subject_, "endpoint=writer");
+}
+
+void RouterWriter::enable() noexcept
+{
+    writer_->enable();
+}
+
+void RouterWriter::disable() noexcept
+{
+    writer_->disable();
+}
+
+utils::ReturnCode RouterWriter::write(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    if (interest_flag_ && !interest_flag_->load(std::memory_order_relaxed))
+    {
+        // Nobody reads this topic behind the remote DDS Router
+        counters_->uninterested_samples.add();
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    if (link_selector_ && !link_selector_->is_active(link_index_))
+    {
+        // Another link of the group sends this data
+        counters_->inactive_link_samples.add();
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    const utils::ReturnCode ret = router_link_ ? stamped_write_(data) : traced_write_(data);
+
+    if (ret != utils::ReturnCode::RETCODE_OK)
+    {
+        counters_->failed_writes.add();
+        FlightRecorder::record(FlightEventKind::sample_dropped, flight_subject_, "reason=write_error");
+        return ret;
+    }
+
+    counters_->samples_sent.add();
+
+    const auto* rtps_data = dynamic_cast<const ddspipe::core::types::RtpsPayloadData*>(&data);
+    if (rtps_data != nullptr)
+    {
+        counters_->bytes_sent.add(rtps_data->payload.length);
+    }
+
+    account_latency_(data);
+
+    return ret;
+}
+
+utils::ReturnCode RouterWriter::traced_write_(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    const IngressStamp* stamp = IngressStamp::get(data);
+    if (stamp == nullptr || !stamp->trace_sample)
+    {
+        return writer_->write(data);
+    }
+
+    TraceEvent event;
+    event.name = "writer.write";
+    event.topic = trace_topic_;
+    event.participant = trace_participant_;
+    event.sample = stamp->trace_sample;
+    event.start_ns = Tracer::now();
+
+    const utils::ReturnCode ret = writer_->write(data);
+
+    event.duration_ns = Tracer::now() - event.start_ns;
+    DDSROUTER_TRACE_SPAN(event);
+
+    return ret;
+}
+
+utils::ReturnCode RouterWriter::stamped_write_(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    auto* rtps_data = dynamic_cast<ddspipe::core::types::RtpsPayloadData*>(&data);
+    const IngressStamp* stamp = IngressStamp::get(data);
+    if (rtps_data == nullptr || stamp == nullptr || stamp->origin_sequence_number == 0 ||
+            !(stamp_origin_ || stamp->origin_stamped))
+    {
+        // The origin of the sample is unknown or not needed
+        return traced_write_(data);
+    }
+
+    fastrtps::rtps::SampleIdentity identity;
+    identity.writer_guid(stamp->origin_writer_guid);
+    identity.sequence_number(fastrtps::rtps::SequenceNumber_t(stamp->origin_sequence_number));
+
+    // The same sample is written afterwards by the rest of writers, that must not send the origin
+    const utils::Fuzzy<fastrtps::rtps::WriteParams> write_params = rtps_data->write_params;
+
+    fastrtps::rtps::WriteParams stamped_write_params;
+    stamped_write_params.related_sample_identity(identity);
+    rtps_data->write_params.set_value(stamped_write_params);
+
+    const utils::ReturnCode ret = traced_write_(data);
+
+    rtps_data->write_params = write_params;
+
+    return ret;
+}
+
+void RouterWriter::account_latency_(
+        const ddspipe::core::IRoutingData& data) noexcept
+{
+    if (route_latency_ && !route_latency_->load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    const IngressStamp* stamp = IngressStamp::get(data);
+    if (stamp == nullptr)
+    {
+        // Not taken by a RouterReader in this thread
+        return;
+    }
+
+    RouteLatency* latency = counters_->route_latencies.get(*stamp->source, stamp->source_index);
+    const uint64_t router_latency = to_latency(steady_now_ns() - stamp->time_ns);
+    latency->router.record(router_latency);
+
+    const uint64_t outlier_threshold = FlightRecorder::latency_outlier_threshold();
+    if (outlier_threshold > 0 && router_latency > outlier_threshold)
+    {
+        char note[64];
+        std::snprintf(note, sizeof(note), "source=%s latency_ns=%llu",
+                stamp->source->c_str(), static_cast<unsigned long long>(router_latency));
+        FlightRecorder::record(FlightEventKind::latency_outlier, flight_subject_, note);
+    }
+
+    if (latency->source && stamp->source_timestamp_ns > 0)
+    {
+        latency->source->record(to_latency(system_now_ns() - stamp->source_timestamp_ns));
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,71 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ShmParticipant.cpp
+ *
+ */
+
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/participant/ShmParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+ShmParticipant::ShmParticipant(
+        const std::shared_ptr<ShmParticipantConfiguration>& participant_configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database)
+    : ddspipe::participants::rtps::CommonParticipant(
+        participant_configuration,
+        payload_pool,
+        discovery_database,
+        participant_configuration->domain,
+        reckon_participant_attributes_(participant_configuration.get()))
+{
+}
+
+fastrtps::rtps::RTPSParticipantAttributes ShmParticipant::reckon_participant_attributes_(
+        const ShmParticipantConfiguration* participant_configuration)
+{
+    fastrtps::rtps::RTPSParticipantAttributes params =
+            ddspipe::participants::rtps::CommonParticipant::reckon_participant_attributes_(participant_configuration);
+
+    // Replace the builtin transports (UDP and shared memory) with a shared memory one
+    auto shm_transport = std::make_shared<eprosima::fastdds::rtps::SharedMemTransportDescriptor>();
+    shm_transport->segment_size(participant_configuration->segment_size);
+    if (participant_configuration->max_message_size > 0)
+    {
+        shm_transport->maxMessageSize = participant_configuration->max_message_size;
+    }
+
+    params.useBuiltinTransports = false;
+    params.userTransports.clear();
+    params.userTransports.push_back(shm_transport);
+
+    logDebug(DDSROUTER_SHM_PARTICIPANT,
+            "Participant " << participant_configuration->id << " only uses shared memory, with a segment of "
+                           << shm_transport->segment_size() << " bytes and messages up to "
+                           << shm_transport->max_message_size() << " bytes.");
+
+    return params;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
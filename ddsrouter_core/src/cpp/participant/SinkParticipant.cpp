@@ -0,0 +1,93 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file SinkParticipant.cpp
+ *
+ */
+
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_participants/reader/auxiliar/BlankReader.hpp>
+
+#include <ddsrouter_core/participant/SinkParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+SinkParticipant::SinkParticipant(
+        const std::shared_ptr<SinkParticipantConfiguration>& configuration)
+    : configuration_(configuration)
+    , counters_(std::make_shared<SinkCounters>())
+{
+}
+
+SinkParticipant::~SinkParticipant()
+{
+    utils::Formatter summary;
+    summary << "Sink participant " << configuration_->id << " received " << counters_->samples.value()
+            << " samples (" << counters_->bytes.value() << " bytes)";
+
+    if (configuration_->verify_checksum)
+    {
+        summary << ", " << counters_->invalid_samples.value() << " with invalid checksum";
+    }
+    summary << ".";
+
+    logInfo(DDSROUTER_SINK, summary);
+}
+
+ddspipe::core::types::ParticipantId SinkParticipant::id() const noexcept
+{
+    return configuration_->id;
+}
+
+bool SinkParticipant::is_repeater() const noexcept
+{
+    return configuration_->is_repeater;
+}
+
+bool SinkParticipant::is_rtps_kind() const noexcept
+{
+    return false;
+}
+
+ddspipe::core::types::TopicQoS SinkParticipant::topic_qos() const noexcept
+{
+    return ddspipe::core::types::TopicQoS();
+}
+
+std::shared_ptr<ddspipe::core::IWriter> SinkParticipant::create_writer(
+        const ddspipe::core::ITopic& /* topic */)
+{
+    return std::make_shared<SinkWriter>(counters_, configuration_->verify_checksum);
+}
+
+std::shared_ptr<ddspipe::core::IReader> SinkParticipant::create_reader(
+        const ddspipe::core::ITopic& /* topic */)
+{
+    return std::make_shared<ddspipe::participants::BlankReader>();
+}
+
+const SinkCounters& SinkParticipant::counters() const noexcept
+{
+    return *counters_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
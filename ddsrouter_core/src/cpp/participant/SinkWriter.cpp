@@ -0,0 +1,80 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file SinkWriter.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddsrouter_core/participant/SinkWriter.hpp>
+#include <ddsrouter_core/types/GeneratedSample.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+SinkWriter::SinkWriter(
+        const std::shared_ptr<SinkCounters>& counters,
+        const bool verify_checksum)
+    : counters_(counters)
+    , verify_checksum_(verify_checksum)
+{
+}
+
+void SinkWriter::enable() noexcept
+{
+    // Nothing to do
+}
+
+void SinkWriter::disable() noexcept
+{
+    // Nothing to do
+}
+
+utils::ReturnCode SinkWriter::write(
+        ddspipe::core::IRoutingData& data) noexcept
+{
+    counters_->samples.add();
+
+    auto* rtps_data = dynamic_cast<ddspipe::core::types::RtpsPayloadData*>(&data);
+    if (!rtps_data)
+    {
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    counters_->bytes.add(rtps_data->payload.length);
+
+    if (verify_checksum_ && !types::GeneratedSample::check(rtps_data->payload.data, rtps_data->payload.length))
+    {
+        counters_->invalid_samples.add();
+
+        if (!invalid_sample_reported_.exchange(true))
+        {
+            logWarning(DDSROUTER_SINK,
+                    "Received a sample with invalid checksum from " << rtps_data->source_guid
+                                                                    << ". Further invalid samples are only counted.");
+        }
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,71 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file UdsParticipant.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/participant/UdsParticipant.hpp>
+#include <ddsrouter_core/transport/UdsTransportDescriptor.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+UdsParticipant::UdsParticipant(
+        const std::shared_ptr<UdsParticipantConfiguration>& participant_configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database)
+    : ddspipe::participants::rtps::CommonParticipant(
+        participant_configuration,
+        payload_pool,
+        discovery_database,
+        participant_configuration->domain,
+        reckon_participant_attributes_(participant_configuration.get()))
+{
+}
+
+fastrtps::rtps::RTPSParticipantAttributes UdsParticipant::reckon_participant_attributes_(
+        const UdsParticipantConfiguration* participant_configuration)
+{
+    fastrtps::rtps::RTPSParticipantAttributes params =
+            ddspipe::participants::rtps::CommonParticipant::reckon_participant_attributes_(participant_configuration);
+
+    // Replace the builtin transports (UDP and shared memory) with a Unix domain socket one
+    auto uds_transport = std::make_shared<UdsTransportDescriptor>();
+    uds_transport->socket_directory = participant_configuration->socket_directory;
+    uds_transport->memfd_threshold = participant_configuration->memfd_threshold;
+    uds_transport->maxMessageSize = participant_configuration->max_message_size;
+
+    params.useBuiltinTransports = false;
+    params.userTransports.clear();
+    params.userTransports.push_back(uds_transport);
+
+    // There is no multicast, so the participants of the domain are discovered through the initial peers
+    params.builtin.initialPeersList.push_back(fastrtps::rtps::Locator_t(LOCATOR_KIND_UDS, 0));
+
+    logDebug(DDSROUTER_UDS_PARTICIPANT,
+            "Participant " << participant_configuration->id << " only uses Unix domain sockets in "
+                           << uds_transport->socket_directory << ", with messages up to "
+                           << uds_transport->maxMessageSize << " bytes.");
+
+    return params;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
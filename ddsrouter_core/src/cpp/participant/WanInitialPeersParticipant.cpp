@@ -0,0 +1,63 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WanInitialPeersParticipant.cpp
+ *
+ */
+
+#include <ddspipe_participants/participant/rtps/InitialPeersParticipant.hpp>
+
+#include <ddsrouter_core/participant/WanInitialPeersParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Gives access to the attributes reckoned by the ddspipe initial peers participant
+struct InitialPeersAttributes : public ddspipe::participants::rtps::InitialPeersParticipant
+{
+    using ddspipe::participants::rtps::InitialPeersParticipant::reckon_participant_attributes_;
+};
+
+} /* namespace */
+
+WanInitialPeersParticipant::WanInitialPeersParticipant(
+        const std::shared_ptr<WanInitialPeersParticipantConfiguration>& participant_configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool,
+        const std::shared_ptr<ddspipe::core::DiscoveryDatabase>& discovery_database)
+    : WanParticipant(
+        participant_configuration,
+        payload_pool,
+        discovery_database,
+        participant_configuration->domain,
+        reckon_participant_attributes_(participant_configuration.get()))
+{
+}
+
+fastrtps::rtps::RTPSParticipantAttributes WanInitialPeersParticipant::reckon_participant_attributes_(
+        const WanInitialPeersParticipantConfiguration* participant_configuration)
+{
+    return configure_transports_(
+        InitialPeersAttributes::reckon_participant_attributes_(participant_configuration),
+        participant_configuration->io,
+        participant_configuration->socket,
+        participant_configuration->id);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,142 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WanParticipant.cpp
+ *
+ */
+
+#include <memory>
+
+#include <fastdds/rtps/transport/TCPTransportDescriptor.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/participant/WanParticipant.hpp>
+#include <ddsrouter_core/transport/UdpTransportDescriptor.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Bits of the type of service below the DSCP (used by ECN)
+constexpr unsigned int DSCP_SHIFT = 2;
+
+} /* namespace */
+
+fastrtps::rtps::RTPSParticipantAttributes WanParticipant::configure_transports_(
+        fastrtps::rtps::RTPSParticipantAttributes params,
+        const UdpIoConfiguration& io,
+        const SocketConfiguration& socket,
+        const ddspipe::core::types::ParticipantId& id)
+{
+    apply_socket_configuration_(params, socket);
+    use_io_backend_(params, io, socket, id);
+    return params;
+}
+
+void WanParticipant::apply_socket_configuration_(
+        fastrtps::rtps::RTPSParticipantAttributes& params,
+        const SocketConfiguration& socket)
+{
+    for (auto& transport : params.userTransports)
+    {
+        auto socket_transport = std::dynamic_pointer_cast<fastdds::rtps::SocketTransportDescriptor>(transport);
+        if (!socket_transport)
+        {
+            continue;
+        }
+
+        if (socket.send_buffer_size > 0)
+        {
+            socket_transport->sendBufferSize = socket.send_buffer_size;
+        }
+        if (socket.receive_buffer_size > 0)
+        {
+            socket_transport->receiveBufferSize = socket.receive_buffer_size;
+        }
+
+        auto tcp_transport = std::dynamic_pointer_cast<fastdds::rtps::TCPTransportDescriptor>(transport);
+        if (!tcp_transport)
+        {
+            continue;
+        }
+
+        if (socket.tcp_nodelay)
+        {
+            tcp_transport->enable_tcp_nodelay = true;
+        }
+        if (socket.rtps_keep_alive_period > 0)
+        {
+            tcp_transport->keep_alive_frequency_ms = socket.rtps_keep_alive_period;
+        }
+        if (socket.rtps_keep_alive_timeout > 0)
+        {
+            tcp_transport->keep_alive_timeout_ms = socket.rtps_keep_alive_timeout;
+        }
+    }
+}
+
+void WanParticipant::use_io_backend_(
+        fastrtps::rtps::RTPSParticipantAttributes& params,
+        const UdpIoConfiguration& io,
+        const SocketConfiguration& socket,
+        const ddspipe::core::types::ParticipantId& id)
+{
+    if (io.backend == UdpIoBackend::fastdds)
+    {
+        return;
+    }
+
+    unsigned int replaced = 0;
+    for (auto& transport : params.userTransports)
+    {
+        auto udp_transport = std::dynamic_pointer_cast<fastdds::rtps::UDPv4TransportDescriptor>(transport);
+        if (!udp_transport || std::dynamic_pointer_cast<UdpTransportDescriptor>(transport))
+        {
+            continue;
+        }
+
+        auto descriptor = std::make_shared<UdpTransportDescriptor>(*udp_transport);
+        descriptor->backend = io.backend;
+        descriptor->ring_entries = io.ring_entries;
+        descriptor->sqpoll = io.sqpoll;
+        descriptor->batch_size = io.batch_size;
+        descriptor->offload = io.offload;
+        descriptor->busy_poll = socket.busy_poll;
+        descriptor->type_of_service = static_cast<uint8_t>(socket.dscp << DSCP_SHIFT);
+
+        transport = descriptor;
+        ++replaced;
+    }
+
+    if (replaced == 0)
+    {
+        logWarning(DDSROUTER_WAN_PARTICIPANT,
+                "Participant " << id << " has no UDPv4 transport, so its I/O backend is not used.");
+    }
+    else
+    {
+        logDebug(DDSROUTER_WAN_PARTICIPANT,
+                "Participant " << id << " uses an I/O backend other than Fast DDS in " << replaced
+                               << " UDPv4 transports.");
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,439 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file Lz4Frame.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <ddsrouter_core/recorder/Lz4Frame.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+constexpr uint32_t FRAME_MAGIC = 0x184D2204;
+
+//! Version 01 and independent blocks, without block or content checksums, content size or dictionary
+constexpr uint8_t FRAME_FLAGS = 0x60;
+
+//! Blocks of up to 64 KiB
+constexpr uint8_t FRAME_BLOCK_DESCRIPTOR = 0x40;
+constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+//! Bit of the size of a block that tells it is stored uncompressed
+constexpr uint32_t UNCOMPRESSED_BLOCK = 0x80000000;
+
+constexpr unsigned int MIN_MATCH = 4;
+
+//! The last match must start at least this number of bytes before the end of the block
+constexpr size_t MATCH_START_MARGIN = 12;
+
+//! The last bytes of the block are always literals
+constexpr size_t LAST_LITERALS = 5;
+
+constexpr size_t MAX_OFFSET = 65535;
+
+constexpr unsigned int HASH_LOG = 12;
+
+constexpr uint32_t PRIME32_1 = 2654435761U;
+constexpr uint32_t PRIME32_2 = 2246822519U;
+constexpr uint32_t PRIME32_3 = 3266489917U;
+constexpr uint32_t PRIME32_4 = 668265263U;
+constexpr uint32_t PRIME32_5 = 374761393U;
+
+uint32_t read_le32(
+        const uint8_t* data) noexcept
+{
+    return static_cast<uint32_t>(data[0])
+           | (static_cast<uint32_t>(data[1]) << 8)
+           | (static_cast<uint32_t>(data[2]) << 16)
+           | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+void write_le32(
+        const uint32_t value,
+        std::vector<uint8_t>& output)
+{
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        output.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+uint32_t rotl32(
+        const uint32_t value,
+        const unsigned int bits) noexcept
+{
+    return (value << bits) | (value >> (32 - bits));
+}
+
+//! Write the extra bytes of a literal or match length that does not fit in its 4 bits of the token
+void write_length(
+        size_t length,
+        std::vector<uint8_t>& output)
+{
+    while (length >= 255)
+    {
+        output.push_back(255);
+        length -= 255;
+    }
+    output.push_back(static_cast<uint8_t>(length));
+}
+
+//! Read the extra bytes of a length, returning false if the block ends before
+bool read_length(
+        const uint8_t*& input,
+        const uint8_t* end,
+        size_t& length) noexcept
+{
+    uint8_t byte;
+    do
+    {
+        if (input >= end)
+        {
+            return false;
+        }
+        byte = *input++;
+        length += byte;
+    } while (byte == 255);
+
+    return true;
+}
+
+//! Append a sequence: the literals from \c literals to \c match_start , and then a match (if \c match_length > 0)
+void write_sequence(
+        const uint8_t* literals,
+        const uint8_t* match_start,
+        const size_t offset,
+        const size_t match_length,
+        std::vector<uint8_t>& output)
+{
+    const size_t literal_length = static_cast<size_t>(match_start - literals);
+    const size_t match_code = match_length > 0 ? match_length - MIN_MATCH : 0;
+
+    output.push_back(static_cast<uint8_t>((std::min<size_t>(literal_length, 15) << 4) | std::min<size_t>(match_code, 15)));
+    if (literal_length >= 15)
+    {
+        write_length(literal_length - 15, output);
+    }
+    output.insert(output.end(), literals, match_start);
+
+    if (match_length == 0)
+    {
+        return;
+    }
+
+    output.push_back(static_cast<uint8_t>(offset));
+    output.push_back(static_cast<uint8_t>(offset >> 8));
+    if (match_code >= 15)
+    {
+        write_length(match_code - 15, output);
+    }
+}
+
+//! Append the compressed block of \c data to \c output
+void compress_block(
+        const uint8_t* data,
+        const size_t size,
+        std::vector<uint8_t>& output)
+{
+    const uint8_t* anchor = data;
+
+    if (size > MATCH_START_MARGIN)
+    {
+        // Position + 1 of the last occurrence of each hash of 4 bytes (0 if none)
+        std::vector<uint32_t> table(1u << HASH_LOG, 0);
+
+        const uint8_t* input = data;
+        const uint8_t* match_start_limit = data + size - MATCH_START_MARGIN;
+        const uint8_t* match_end_limit = data + size - LAST_LITERALS;
+
+        while (input <= match_start_limit)
+        {
+            const uint32_t sequence = read_le32(input);
+            const uint32_t hash = (sequence * PRIME32_1) >> (32 - HASH_LOG);
+            const uint32_t candidate_position = table[hash];
+            table[hash] = static_cast<uint32_t>(input - data) + 1;
+
+            if (candidate_position == 0)
+            {
+                ++input;
+                continue;
+            }
+
+            const uint8_t* candidate = data + candidate_position - 1;
+            if (static_cast<size_t>(input - candidate) > MAX_OFFSET || read_le32(candidate) != sequence)
+            {
+                ++input;
+                continue;
+            }
+
+            size_t match_length = MIN_MATCH;
+            while (input + match_length < match_end_limit && candidate[match_length] == input[match_length])
+            {
+                ++match_length;
+            }
+
+            write_sequence(anchor, input, static_cast<size_t>(input - candidate), match_length, output);
+            input += match_length;
+            anchor = input;
+        }
+    }
+
+    write_sequence(anchor, data + size, 0, 0, output);
+}
+
+//! Append the decompressed block to \c output , whose bytes from \c frame_start can be referenced by matches
+bool decompress_block(
+        const uint8_t* input,
+        const size_t size,
+        const size_t frame_start,
+        std::vector<uint8_t>& output)
+{
+    const uint8_t* end = input + size;
+
+    while (input < end)
+    {
+        const uint8_t token = *input++;
+
+        size_t literal_length = token >> 4;
+        if (literal_length == 15 && !read_length(input, end, literal_length))
+        {
+            return false;
+        }
+        if (literal_length > static_cast<size_t>(end - input))
+        {
+            return false;
+        }
+        output.insert(output.end(), input, input + literal_length);
+        input += literal_length;
+
+        if (input == end)
+        {
+            // Last sequence, without match
+            break;
+        }
+
+        if (end - input < 2)
+        {
+            return false;
+        }
+        const size_t offset = static_cast<size_t>(input[0]) | (static_cast<size_t>(input[1]) << 8);
+        input += 2;
+        if (offset == 0 || offset > output.size() - frame_start)
+        {
+            return false;
+        }
+
+        size_t match_length = token & 0x0F;
+        if (match_length == 15 && !read_length(input, end, match_length))
+        {
+            return false;
+        }
+        match_length += MIN_MATCH;
+
+        // The match may overlap the bytes it produces, so it is copied in pieces of at most offset bytes
+        size_t position = output.size() - offset;
+        output.resize(output.size() + match_length);
+        uint8_t* target = output.data() + position + offset;
+        while (match_length > 0)
+        {
+            const size_t piece = std::min(match_length, offset);
+            std::memcpy(target, output.data() + position, piece);
+            target += piece;
+            position += piece;
+            match_length -= piece;
+        }
+    }
+
+    return true;
+}
+
+} /* namespace */
+
+void Lz4Frame::compress(
+        const uint8_t* data,
+        const size_t size,
+        std::vector<uint8_t>& output)
+{
+    output.reserve(output.size() + size + size / 255 + 32);
+
+    write_le32(FRAME_MAGIC, output);
+    const size_t descriptor_start = output.size();
+    output.push_back(FRAME_FLAGS);
+    output.push_back(FRAME_BLOCK_DESCRIPTOR);
+    output.push_back(static_cast<uint8_t>(xxhash32(output.data() + descriptor_start, 2) >> 8));
+
+    for (size_t block_start = 0; block_start < size; block_start += BLOCK_SIZE)
+    {
+        const size_t block_size = std::min(BLOCK_SIZE, size - block_start);
+
+        // Reserve the size of the block, and write it once compressed
+        const size_t size_position = output.size();
+        write_le32(0, output);
+        compress_block(data + block_start, block_size, output);
+
+        uint32_t compressed_size = static_cast<uint32_t>(output.size() - size_position - 4);
+        if (compressed_size >= block_size)
+        {
+            // Incompressible block: store it as is
+            output.resize(size_position + 4);
+            output.insert(output.end(), data + block_start, data + block_start + block_size);
+            compressed_size = static_cast<uint32_t>(block_size) | UNCOMPRESSED_BLOCK;
+        }
+
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            output[size_position + i] = static_cast<uint8_t>(compressed_size >> (8 * i));
+        }
+    }
+
+    // End mark
+    write_le32(0, output);
+}
+
+bool Lz4Frame::decompress(
+        const uint8_t* data,
+        const size_t size,
+        std::vector<uint8_t>& output) noexcept
+{
+    try
+    {
+        const uint8_t* input = data;
+        const uint8_t* end = data + size;
+
+        // Magic, flags, block descriptor and header checksum
+        if (size < 7 || read_le32(input) != FRAME_MAGIC)
+        {
+            return false;
+        }
+        input += 4;
+
+        const uint8_t flags = *input;
+        if ((flags >> 6) != 0x01)
+        {
+            return false;
+        }
+        const bool block_checksum = (flags & 0x10) != 0;
+        const bool content_size = (flags & 0x08) != 0;
+        const bool content_checksum = (flags & 0x04) != 0;
+        const bool dictionary_id = (flags & 0x01) != 0;
+
+        const size_t header_size = 3 + (content_size ? 8 : 0) + (dictionary_id ? 4 : 0);
+        if (static_cast<size_t>(end - input) < header_size)
+        {
+            return false;
+        }
+        input += header_size;
+
+        const size_t frame_start = output.size();
+        while (true)
+        {
+            if (end - input < 4)
+            {
+                return false;
+            }
+            const uint32_t block_header = read_le32(input);
+            input += 4;
+
+            if (block_header == 0)
+            {
+                // End mark
+                break;
+            }
+
+            const size_t block_size = block_header & ~UNCOMPRESSED_BLOCK;
+            if (static_cast<size_t>(end - input) < block_size + (block_checksum ? 4 : 0))
+            {
+                return false;
+            }
+
+            if (block_header & UNCOMPRESSED_BLOCK)
+            {
+                output.insert(output.end(), input, input + block_size);
+            }
+            else if (!decompress_block(input, block_size, frame_start, output))
+            {
+                return false;
+            }
+
+            input += block_size + (block_checksum ? 4 : 0);
+        }
+
+        return !content_checksum || end - input >= 4;
+    }
+    catch (const std::bad_alloc&)
+    {
+        return false;
+    }
+}
+
+uint32_t Lz4Frame::xxhash32(
+        const uint8_t* data,
+        const size_t size,
+        const uint32_t seed) noexcept
+{
+    const uint8_t* input = data;
+    const uint8_t* end = data + size;
+    uint32_t hash;
+
+    if (size >= 16)
+    {
+        uint32_t lanes[4] = {seed + PRIME32_1 + PRIME32_2, seed + PRIME32_2, seed, seed - PRIME32_1};
+        while (end - input >= 16)
+        {
+            for (auto& lane : lanes)
+            {
+                lane = rotl32(lane + read_le32(input) * PRIME32_2, 13) * PRIME32_1;
+                input += 4;
+            }
+        }
+        hash = rotl32(lanes[0], 1) + rotl32(lanes[1], 7) + rotl32(lanes[2], 12) + rotl32(lanes[3], 18);
+    }
+    else
+    {
+        hash = seed + PRIME32_5;
+    }
+
+    hash += static_cast<uint32_t>(size);
+
+    while (end - input >= 4)
+    {
+        hash = rotl32(hash + read_le32(input) * PRIME32_3, 17) * PRIME32_4;
+        input += 4;
+    }
+    while (input < end)
+    {
+        hash = rotl32(hash + (*input++) * PRIME32_5, 11) * PRIME32_1;
+    }
+
+    hash ^= hash >> 15;
+    hash *= PRIME32_2;
+    hash ^= hash >> 13;
+    hash *= PRIME32_3;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
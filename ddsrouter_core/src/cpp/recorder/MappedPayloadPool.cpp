@@ -0,0 +1,80 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file MappedPayloadPool.cpp
+ *
+ */
+
+#include <ddsrouter_core/recorder/MappedPayloadPool.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool MappedPayloadPool::map_payload(
+        const uint8_t* data,
+        const uint32_t size,
+        ddspipe::core::types::Payload& payload) noexcept
+{
+    if (size == 0)
+    {
+        // An empty payload must not point anywhere, as it is not released
+        return false;
+    }
+
+    // The mapping is read only, but payloads are never modified once filled
+    payload.data = const_cast<fastrtps::rtps::octet*>(data);
+    payload.length = size;
+    payload.max_size = size;
+    return true;
+}
+
+bool MappedPayloadPool::get_payload(
+        uint32_t /* size */,
+        ddspipe::core::types::Payload& /* target_payload */)
+{
+    return false;
+}
+
+bool MappedPayloadPool::get_payload(
+        const ddspipe::core::types::Payload& src_payload,
+        ddspipe::core::PayloadPool*& data_owner,
+        ddspipe::core::types::Payload& target_payload)
+{
+    if (data_owner != this)
+    {
+        return false;
+    }
+
+    target_payload.data = src_payload.data;
+    target_payload.length = src_payload.length;
+    target_payload.max_size = src_payload.max_size;
+    target_payload.encapsulation = src_payload.encapsulation;
+    return true;
+}
+
+bool MappedPayloadPool::release_payload(
+        ddspipe::core::types::Payload& target_payload)
+{
+    target_payload.data = nullptr;
+    target_payload.length = 0;
+    target_payload.max_size = 0;
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
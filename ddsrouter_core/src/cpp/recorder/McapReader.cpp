@@ -0,0 +1,468 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file McapReader.cpp
+ *
+ */
+
+#include <cstring>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // if defined(_WIN32)
+
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/recorder/Lz4Frame.hpp>
+#include <ddsrouter_core/recorder/McapReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Bytes of the fields of a message record before its data
+constexpr uint64_t MESSAGE_HEADER_SIZE = 2 + 4 + 8 + 8;
+
+/**
+ * Reads the fields of a record without exceeding its content.
+ *
+ * Any read beyond the content fails, and every read after it fails too.
+ */
+class Cursor
+{
+public:
+
+    Cursor(
+            const uint8_t* data,
+            const uint64_t size)
+        : it_(data)
+        , end_(data + size)
+    {
+    }
+
+    template <typename T>
+    bool read(
+            T& value) noexcept
+    {
+        if (!valid_ || static_cast<uint64_t>(end_ - it_) < sizeof(T))
+        {
+            valid_ = false;
+            return false;
+        }
+
+        uint64_t read_value = 0;
+        for (unsigned int i = 0; i < sizeof(T); ++i)
+        {
+            read_value |= static_cast<uint64_t>(*it_++) << (8 * i);
+        }
+        value = static_cast<T>(read_value);
+        return true;
+    }
+
+    //! Read a byte array prefixed by its length of type \c SizeT
+    template <typename SizeT>
+    bool read_bytes(
+            const uint8_t*& bytes,
+            uint64_t& size) noexcept
+    {
+        SizeT length;
+        if (!read(length) || static_cast<uint64_t>(end_ - it_) < length)
+        {
+            valid_ = false;
+            return false;
+        }
+
+        bytes = it_;
+        size = length;
+        it_ += length;
+        return true;
+    }
+
+    bool read_string(
+            std::string& value) noexcept
+    {
+        const uint8_t* bytes;
+        uint64_t size;
+        if (!read_bytes<uint32_t>(bytes, size))
+        {
+            return false;
+        }
+
+        value.assign(reinterpret_cast<const char*>(bytes), size);
+        return true;
+    }
+
+    bool valid() const noexcept
+    {
+        return valid_;
+    }
+
+private:
+
+    const uint8_t* it_;
+    const uint8_t* end_;
+    bool valid_ = true;
+};
+
+} /* namespace */
+
+McapReader::McapReader(
+        const std::string& file_name)
+    : file_name_(file_name)
+{
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                    FILE_ATTRIBUTE_NORMAL, nullptr);
+    LARGE_INTEGER file_size;
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &file_size))
+    {
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(file);
+        }
+        throw utils::InitializationException(
+                  utils::Formatter() << "Cannot open MCAP file " << file_name << ".");
+    }
+    file_handle_ = file;
+    size_ = static_cast<uint64_t>(file_size.QuadPart);
+
+    if (size_ > 0)
+    {
+        mapping_handle_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_handle_ != nullptr)
+        {
+            data_ = static_cast<const uint8_t*>(MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+        }
+    }
+#else
+    const int file = ::open(file_name.c_str(), O_RDONLY);
+    struct stat file_stat;
+    if (file < 0 || fstat(file, &file_stat) != 0)
+    {
+        if (file >= 0)
+        {
+            ::close(file);
+        }
+        throw utils::InitializationException(
+                  utils::Formatter() << "Cannot open MCAP file " << file_name << ".");
+    }
+    size_ = static_cast<uint64_t>(file_stat.st_size);
+
+    if (size_ > 0)
+    {
+        void* mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0);
+        if (mapping != MAP_FAILED)
+        {
+            data_ = static_cast<const uint8_t*>(mapping);
+
+            // The file is read from beginning to end
+            madvise(mapping, size_, MADV_SEQUENTIAL);
+        }
+    }
+
+    // The mapping remains valid once the file is closed
+    ::close(file);
+#endif // if defined(_WIN32)
+
+    if (data_ == nullptr || size_ < sizeof(MCAP_MAGIC) || std::memcmp(data_, MCAP_MAGIC, sizeof(MCAP_MAGIC)) != 0)
+    {
+        unmap_();
+        throw utils::InitializationException(
+                  utils::Formatter() << "File " << file_name << " is not a MCAP file.");
+    }
+
+    read_channels_(data_ + sizeof(MCAP_MAGIC), size_ - sizeof(MCAP_MAGIC));
+    rewind();
+}
+
+McapReader::~McapReader()
+{
+    unmap_();
+}
+
+bool McapReader::next(
+        McapMessage& message)
+{
+    while (true)
+    {
+        Record record;
+
+        if (chunk_ != nullptr)
+        {
+            if (read_record_(chunk_, chunk_size_, chunk_position_, record))
+            {
+                if (record.opcode == McapOpcode::message)
+                {
+                    if (read_message_(record, message))
+                    {
+                        message.mapped = chunk_mapped_;
+                        return true;
+                    }
+                }
+                else
+                {
+                    register_record_(record);
+                }
+                continue;
+            }
+
+            chunk_ = nullptr;
+        }
+
+        if (!read_record_(data_, size_, position_, record) ||
+                record.opcode == McapOpcode::data_end ||
+                record.opcode == McapOpcode::footer)
+        {
+            position_ = size_;
+            return false;
+        }
+
+        switch (record.opcode)
+        {
+            case McapOpcode::message:
+                if (read_message_(record, message))
+                {
+                    message.mapped = true;
+                    return true;
+                }
+                break;
+
+            case McapOpcode::chunk:
+            {
+                Cursor cursor(record.content, record.length);
+                uint64_t start_time, end_time, uncompressed_size;
+                uint32_t uncompressed_crc;
+                std::string compression;
+                const uint8_t* records;
+                uint64_t records_size;
+
+                cursor.read(start_time);
+                cursor.read(end_time);
+                cursor.read(uncompressed_size);
+                cursor.read(uncompressed_crc);
+                cursor.read_string(compression);
+                if (!cursor.read_bytes<uint64_t>(records, records_size))
+                {
+                    throw utils::InconsistencyException(
+                              utils::Formatter() << "Malformed chunk in MCAP file " << file_name_ << ".");
+                }
+
+                if (compression == MCAP_COMPRESSION_NONE)
+                {
+                    chunk_ = records;
+                    chunk_size_ = records_size;
+                    chunk_mapped_ = true;
+                }
+                else if (compression == MCAP_COMPRESSION_LZ4)
+                {
+                    decompressed_.clear();
+                    decompressed_.reserve(uncompressed_size);
+                    if (!Lz4Frame::decompress(records, records_size, decompressed_))
+                    {
+                        throw utils::InconsistencyException(
+                                  utils::Formatter() << "Corrupted LZ4 chunk in MCAP file " << file_name_ << ".");
+                    }
+                    chunk_ = decompressed_.data();
+                    chunk_size_ = decompressed_.size();
+                    chunk_mapped_ = false;
+                }
+                else
+                {
+                    throw utils::InconsistencyException(
+                              utils::Formatter() << "Unsupported compression " << compression << " in MCAP file "
+                                                 << file_name_ << ".");
+                }
+                chunk_position_ = 0;
+                break;
+            }
+
+            default:
+                register_record_(record);
+                break;
+        }
+    }
+}
+
+void McapReader::rewind() noexcept
+{
+    position_ = sizeof(MCAP_MAGIC);
+    chunk_ = nullptr;
+}
+
+const std::map<uint16_t, McapChannel>& McapReader::channels() const noexcept
+{
+    return channels_;
+}
+
+const std::string& McapReader::file_name() const noexcept
+{
+    return file_name_;
+}
+
+bool McapReader::read_record_(
+        const uint8_t* buffer,
+        const uint64_t size,
+        uint64_t& position,
+        Record& record) noexcept
+{
+    if (size - position < MCAP_RECORD_PREFIX_SIZE)
+    {
+        return false;
+    }
+
+    Cursor cursor(buffer + position, MCAP_RECORD_PREFIX_SIZE);
+    uint8_t opcode;
+    uint64_t length;
+    cursor.read(opcode);
+    cursor.read(length);
+
+    if (size - position - MCAP_RECORD_PREFIX_SIZE < length)
+    {
+        // Truncated record
+        return false;
+    }
+
+    record.opcode = static_cast<McapOpcode>(opcode);
+    record.content = buffer + position + MCAP_RECORD_PREFIX_SIZE;
+    record.length = length;
+    position += MCAP_RECORD_PREFIX_SIZE + length;
+    return true;
+}
+
+void McapReader::unmap_() noexcept
+{
+#if defined(_WIN32)
+    if (data_ != nullptr)
+    {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_ != nullptr)
+    {
+        CloseHandle(mapping_handle_);
+    }
+    if (file_handle_ != nullptr)
+    {
+        CloseHandle(file_handle_);
+    }
+    mapping_handle_ = nullptr;
+    file_handle_ = nullptr;
+#else
+    if (data_ != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(data_), size_);
+    }
+#endif // if defined(_WIN32)
+    data_ = nullptr;
+}
+
+void McapReader::read_channels_(
+        const uint8_t* buffer,
+        const uint64_t size) noexcept
+{
+    uint64_t position = 0;
+    Record record;
+
+    while (read_record_(buffer, size, position, record) && record.opcode != McapOpcode::footer)
+    {
+        register_record_(record);
+    }
+}
+
+void McapReader::register_record_(
+        const Record& record) noexcept
+{
+    Cursor cursor(record.content, record.length);
+
+    if (record.opcode == McapOpcode::schema)
+    {
+        uint16_t id;
+        std::string name;
+        if (cursor.read(id) && cursor.read_string(name))
+        {
+            schemas_[id] = name;
+        }
+    }
+    else if (record.opcode == McapOpcode::channel)
+    {
+        uint16_t id;
+        uint16_t schema_id;
+        McapChannel channel;
+        std::string message_encoding;
+        const uint8_t* metadata;
+        uint64_t metadata_size;
+
+        cursor.read(id);
+        cursor.read(schema_id);
+        cursor.read_string(channel.topic_name);
+        cursor.read_string(message_encoding);
+        if (!cursor.read_bytes<uint32_t>(metadata, metadata_size))
+        {
+            return;
+        }
+
+        auto schema = schemas_.find(schema_id);
+        if (schema != schemas_.end())
+        {
+            channel.type_name = schema->second;
+        }
+
+        Cursor metadata_cursor(metadata, metadata_size);
+        std::string key;
+        std::string value;
+        while (metadata_cursor.read_string(key) && metadata_cursor.read_string(value))
+        {
+            if (key == MCAP_KEYED_METADATA)
+            {
+                channel.keyed = value == "true";
+            }
+        }
+
+        channels_[id] = channel;
+    }
+}
+
+bool McapReader::read_message_(
+        const Record& record,
+        McapMessage& message) noexcept
+{
+    if (record.length < MESSAGE_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    Cursor cursor(record.content, MESSAGE_HEADER_SIZE);
+    cursor.read(message.channel_id);
+    cursor.read(message.sequence);
+    cursor.read(message.log_time);
+    cursor.read(message.publish_time);
+
+    message.data = record.content + MESSAGE_HEADER_SIZE;
+    message.size = static_cast<uint32_t>(record.length - MESSAGE_HEADER_SIZE);
+    return true;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,369 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file McapRecorder.cpp
+ *
+ */
+
+#include <chrono>
+#include <limits>
+
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddsrouter_core/recorder/McapRecorder.hpp>
+
+#include "../utils/clock.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Maximum time the samples received wait in the current chunk before it is written
+constexpr std::chrono::seconds FLUSH_PERIOD(1);
+
+} /* namespace */
+
+McapRecorder::McapRecorder(
+        const std::shared_ptr<RecorderParticipantConfiguration>& configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool)
+    : configuration_(configuration)
+    , payload_pool_(payload_pool)
+    , start_time_(utils::timestamp_to_string(utils::now()))
+    , slots_(new Slot[QUEUE_SIZE])
+    , writer_(configuration->chunk_size, configuration->compress)
+{
+    for (uint64_t i = 0; i < QUEUE_SIZE; ++i)
+    {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    // Create the first file now, so a wrong path is reported at start up
+    open_next_file_();
+
+    thread_ = std::thread(&McapRecorder::run_, this);
+}
+
+McapRecorder::~McapRecorder()
+{
+    {
+        // Set under the lock, so the I/O thread does not miss the notification
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_.store(true);
+    }
+    condition_.notify_one();
+    thread_.join();
+
+    logInfo(DDSROUTER_RECORDER,
+            "Recorder " << configuration_->id << " wrote " << recorded_samples() << " samples in " << files()
+                        << " files, and dropped " << dropped_samples() << " samples.");
+}
+
+uint16_t McapRecorder::add_channel(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // A topic keeps its channel if its writer is created again
+    for (std::size_t i = 0; i < channels_.size(); ++i)
+    {
+        if (channels_[i].topic_unique_name() == topic.topic_unique_name())
+        {
+            return static_cast<uint16_t>(i + 1);
+        }
+    }
+
+    if (channels_.size() >= std::numeric_limits<uint16_t>::max())
+    {
+        logWarning(DDSROUTER_RECORDER,
+                "Recorder " << configuration_->id << " has no channel left for topic " << topic.topic_name()
+                            << ": its samples will not be recorded.");
+        return 0;
+    }
+
+    channels_.push_back(topic);
+    return static_cast<uint16_t>(channels_.size());
+}
+
+bool McapRecorder::record(
+        const uint16_t channel_id,
+        const ddspipe::core::types::RtpsPayloadData& data) noexcept
+{
+    if (channel_id == 0 || failed_ || stop_.load(std::memory_order_relaxed))
+    {
+        dropped_samples_.add();
+        return false;
+    }
+
+    // Reserve the size of the payload, so the samples queued never exceed the maximum
+    const uint64_t size = data.payload.length;
+    if (pending_size_.fetch_add(size, std::memory_order_relaxed) + size > configuration_->max_pending_size)
+    {
+        // The I/O thread is behind: drop the sample
+        pending_size_.fetch_sub(size, std::memory_order_relaxed);
+        dropped_samples_.add();
+        return false;
+    }
+
+    PendingSample sample;
+    try
+    {
+        sample.channel_id = channel_id;
+        sample.log_time = static_cast<uint64_t>(system_now_ns());
+        sample.data = std::make_unique<ddspipe::core::types::RtpsPayloadData>();
+        sample.data->source_timestamp = data.source_timestamp;
+
+        // Reference the payload in the shared pool (it is only copied if it belongs to another pool)
+        ddspipe::core::PayloadPool* payload_owner = data.payload_owner;
+        if (payload_pool_->get_payload(data.payload, payload_owner, sample.data->payload))
+        {
+            sample.data->payload_owner = payload_pool_.get();
+
+            const uint64_t position = push_position_.load(std::memory_order_relaxed);
+            if (push_(std::move(sample)))
+            {
+                // Wake up the I/O thread if the queue was empty
+                if (position == pop_position_.load(std::memory_order_relaxed))
+                {
+                    condition_.notify_one();
+                }
+                return true;
+            }
+        }
+    }
+    catch (const std::bad_alloc&)
+    {
+    }
+
+    // The payload of the sample (if any) is released when it is destroyed
+    pending_size_.fetch_sub(size, std::memory_order_relaxed);
+    dropped_samples_.add();
+    return false;
+}
+
+uint64_t McapRecorder::recorded_samples() const noexcept
+{
+    return recorded_samples_.value();
+}
+
+uint64_t McapRecorder::dropped_samples() const noexcept
+{
+    return dropped_samples_.value();
+}
+
+uint64_t McapRecorder::files() const noexcept
+{
+    return next_file_index_;
+}
+
+bool McapRecorder::push_(
+        PendingSample&& sample) noexcept
+{
+    uint64_t position = push_position_.load(std::memory_order_relaxed);
+    Slot* slot;
+
+    while (true)
+    {
+        slot = &slots_[position % QUEUE_SIZE];
+        const uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+
+        if (sequence == position)
+        {
+            // The slot is free for this position: claim it
+            if (push_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (sequence < position)
+        {
+            // The slot still holds the sample pushed QUEUE_SIZE positions before: the queue is full
+            return false;
+        }
+        else
+        {
+            // Another thread claimed this position
+            position = push_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->sample = std::move(sample);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool McapRecorder::pop_(
+        PendingSample& sample) noexcept
+{
+    if (!ready_())
+    {
+        return false;
+    }
+
+    const uint64_t position = pop_position_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[position % QUEUE_SIZE];
+
+    sample = std::move(slot.sample);
+    slot.sequence.store(position + QUEUE_SIZE, std::memory_order_release);
+    pop_position_.store(position + 1, std::memory_order_relaxed);
+    return true;
+}
+
+bool McapRecorder::ready_() const noexcept
+{
+    const uint64_t position = pop_position_.load(std::memory_order_relaxed);
+    return slots_[position % QUEUE_SIZE].sequence.load(std::memory_order_acquire) == position + 1;
+}
+
+void McapRecorder::run_() noexcept
+{
+    std::vector<PendingSample> batch;
+    PendingSample sample;
+    auto last_flush = std::chrono::steady_clock::now();
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait_for(lock, FLUSH_PERIOD, [this]()
+                    {
+                        return stop_.load() || ready_();
+                    });
+        }
+
+        // Stop once the samples queued before stopping are taken
+        const bool stop = stop_.load();
+        while (pop_(sample))
+        {
+            batch.push_back(std::move(sample));
+        }
+
+        {
+            // The channels are registered after taking the samples, so the channel of every sample taken is
+            // registered (it is added before its samples are pushed)
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (; writer_channels_ < channels_.size(); ++writer_channels_)
+            {
+                const auto& topic = channels_[writer_channels_];
+                writer_.add_channel(
+                    static_cast<uint16_t>(writer_channels_ + 1),
+                    topic.topic_name(),
+                    topic.type_name,
+                    topic.topic_qos.keyed);
+                sequences_.push_back(0);
+            }
+        }
+
+        uint64_t batch_size = 0;
+        for (const auto& sample : batch)
+        {
+            batch_size += sample.data->payload.length;
+
+            if (failed_)
+            {
+                dropped_samples_.add();
+                continue;
+            }
+
+            try
+            {
+                write_(sample);
+                recorded_samples_.add();
+            }
+            catch (const std::exception& e)
+            {
+                // Stop recording, as the disk is probably full or gone
+                logError(DDSROUTER_RECORDER,
+                        "Recorder " << configuration_->id << " stops recording: " << e.what());
+                failed_ = true;
+                dropped_samples_.add();
+            }
+        }
+
+        // Release the payloads of the samples written
+        batch.clear();
+        pending_size_.fetch_sub(batch_size, std::memory_order_relaxed);
+
+        const auto now = std::chrono::steady_clock::now();
+        if (!failed_ && (stop || now - last_flush >= FLUSH_PERIOD))
+        {
+            try
+            {
+                if (stop)
+                {
+                    writer_.close();
+                }
+                else
+                {
+                    writer_.flush();
+                }
+            }
+            catch (const std::exception& e)
+            {
+                logError(DDSROUTER_RECORDER,
+                        "Recorder " << configuration_->id << " stops recording: " << e.what());
+                failed_ = true;
+            }
+            last_flush = now;
+        }
+
+        if (stop)
+        {
+            break;
+        }
+    }
+}
+
+void McapRecorder::write_(
+        const PendingSample& sample)
+{
+    if (!writer_.is_open())
+    {
+        open_next_file_();
+    }
+
+    const auto& data = *sample.data;
+    writer_.write(
+        sample.channel_id,
+        sequences_[sample.channel_id - 1]++,
+        sample.log_time,
+        static_cast<uint64_t>(data.source_timestamp.to_ns()),
+        data.payload.data,
+        data.payload.length);
+
+    if (configuration_->max_file_size > 0 && writer_.size() >= configuration_->max_file_size)
+    {
+        // The next file is created with the next sample, so no empty file is left at the end
+        writer_.close();
+    }
+}
+
+void McapRecorder::open_next_file_()
+{
+    const std::string file_name =
+            configuration_->file_prefix + "_" + start_time_ + "_" + std::to_string(next_file_index_) + ".mcap";
+
+    writer_.open(file_name);
+    ++next_file_index_;
+
+    logInfo(DDSROUTER_RECORDER, "Recorder " << configuration_->id << " writing file " << file_name << ".");
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
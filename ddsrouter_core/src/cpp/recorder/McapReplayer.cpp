@@ -0,0 +1,305 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file McapReplayer.cpp
+ *
+ */
+
+#include <chrono>
+#include <cstring>
+
+#include <fastdds/rtps/common/Time_t.h>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/participant/ReplayerReader.hpp>
+#include <ddsrouter_core/recorder/McapReplayer.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+//! Time the replay thread waits for a full reader before trying again
+constexpr std::chrono::milliseconds FULL_READER_PERIOD(1);
+
+ddspipe::core::types::DdsTopic channel_topic(
+        const McapChannel& channel)
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = channel.topic_name;
+    topic.type_name = channel.type_name;
+    topic.topic_qos.keyed = channel.keyed;
+    return topic;
+}
+
+//! Add the topics of the channels of \c file that are not in \c topics yet
+void add_topics(
+        const McapReader& file,
+        std::vector<ddspipe::core::types::DdsTopic>& topics)
+{
+    for (const auto& channel : file.channels())
+    {
+        ddspipe::core::types::DdsTopic topic = channel_topic(channel.second);
+
+        bool known = false;
+        for (const auto& known_topic : topics)
+        {
+            known = known || known_topic.topic_unique_name() == topic.topic_unique_name();
+        }
+
+        if (!known)
+        {
+            topics.push_back(topic);
+        }
+    }
+}
+
+} /* namespace */
+
+McapReplayer::McapReplayer(
+        const std::shared_ptr<ReplayerParticipantConfiguration>& configuration,
+        const std::shared_ptr<ddspipe::core::PayloadPool>& payload_pool)
+    : configuration_(configuration)
+    , payload_pool_(payload_pool)
+    , mapped_payload_pool_(std::make_shared<MappedPayloadPool>())
+{
+    for (const auto& file_name : configuration_->files)
+    {
+        files_.emplace_back(new McapReader(file_name));
+        add_topics(*files_.back(), topics_);
+    }
+}
+
+McapReplayer::~McapReplayer()
+{
+    stop();
+}
+
+std::vector<ddspipe::core::types::DdsTopic> McapReplayer::read_topics(
+        const std::vector<std::string>& files)
+{
+    std::vector<ddspipe::core::types::DdsTopic> topics;
+    for (const auto& file_name : files)
+    {
+        McapReader file(file_name);
+        add_topics(file, topics);
+    }
+    return topics;
+}
+
+const std::vector<ddspipe::core::types::DdsTopic>& McapReplayer::topics() const noexcept
+{
+    return topics_;
+}
+
+void McapReplayer::add_reader(
+        const std::shared_ptr<ReplayerReader>& reader)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    readers_[reader->topic().topic_unique_name()] = reader;
+}
+
+void McapReplayer::reader_enabled() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    ++enabled_readers_;
+    if (started_ || stop_ || enabled_readers_ < readers_.size())
+    {
+        return;
+    }
+
+    logInfo(DDSROUTER_REPLAYER,
+            "Replaying " << files_.size() << " files in participant " << configuration_->id << " at playback rate "
+                         << configuration_->playback_rate << ".");
+
+    started_ = true;
+    thread_ = std::thread(&McapReplayer::run_, this);
+}
+
+void McapReplayer::stop() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+uint64_t McapReplayer::replayed_samples() const noexcept
+{
+    return replayed_samples_.load(std::memory_order_relaxed);
+}
+
+bool McapReplayer::finished() const noexcept
+{
+    return finished_;
+}
+
+void McapReplayer::run_() noexcept
+{
+    const Clock::time_point start = Clock::now();
+    const double playback_rate = configuration_->playback_rate;
+
+    // Log time of the first message replayed, origin of the time of the rest
+    bool first_message = true;
+    uint64_t first_log_time = 0;
+
+    for (auto& file : files_)
+    {
+        try
+        {
+            file->rewind();
+
+            McapMessage message;
+            while (file->next(message))
+            {
+                auto channel = file->channels().find(message.channel_id);
+                if (channel == file->channels().end())
+                {
+                    continue;
+                }
+
+                std::shared_ptr<ReplayerReader> reader;
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (stop_)
+                    {
+                        return;
+                    }
+
+                    auto it = readers_.find(channel_topic(channel->second).topic_unique_name());
+                    if (it != readers_.end())
+                    {
+                        reader = it->second.lock();
+                    }
+                }
+
+                if (!reader)
+                {
+                    // Topic not forwarded
+                    continue;
+                }
+
+                if (first_message)
+                {
+                    first_log_time = message.log_time;
+                    first_message = false;
+                }
+
+                if (playback_rate > 0)
+                {
+                    const double offset_s =
+                            static_cast<double>(static_cast<int64_t>(message.log_time - first_log_time)) / 1e9;
+                    const Clock::time_point due = start + std::chrono::duration_cast<Clock::duration>(
+                        std::chrono::duration<double>(offset_s / playback_rate));
+
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    if (condition_.wait_until(lock, due, [this]()
+                            {
+                                return stop_;
+                            }))
+                    {
+                        return;
+                    }
+                }
+
+                std::unique_ptr<ddspipe::core::types::RtpsPayloadData> sample = make_sample_(message, *reader);
+                if (!sample)
+                {
+                    logWarning(DDSROUTER_REPLAYER,
+                            "Failed to allocate a sample of topic " << channel->second.topic_name
+                                                                    << " in participant " << configuration_->id << ".");
+                    continue;
+                }
+
+                // Wait for the reader to take its samples pending
+                while (!reader->push(sample))
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    if (condition_.wait_for(lock, FULL_READER_PERIOD, [this]()
+                            {
+                                return stop_;
+                            }))
+                    {
+                        return;
+                    }
+                }
+
+                replayed_samples_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            logError(DDSROUTER_REPLAYER,
+                    "Error replaying file " << file->file_name() << " in participant " << configuration_->id
+                                            << ": " << e.what() << ". Skipping the rest of the file.");
+        }
+    }
+
+    finished_ = true;
+
+    logInfo(DDSROUTER_REPLAYER,
+            "Replayer " << configuration_->id << " finished after replaying " << replayed_samples() << " samples.");
+}
+
+std::unique_ptr<ddspipe::core::types::RtpsPayloadData> McapReplayer::make_sample_(
+        const McapMessage& message,
+        const ReplayerReader& reader)
+{
+    std::unique_ptr<ddspipe::core::types::RtpsPayloadData> data(new ddspipe::core::types::RtpsPayloadData());
+
+    if (message.mapped && mapped_payload_pool_->map_payload(message.data, message.size, data->payload))
+    {
+        data->payload_owner = mapped_payload_pool_.get();
+    }
+    else if (message.size > 0)
+    {
+        // The message is in a decompressed chunk, that will be overwritten by the next one
+        if (!payload_pool_->get_payload(message.size, data->payload))
+        {
+            return nullptr;
+        }
+        data->payload_owner = payload_pool_.get();
+        std::memcpy(data->payload.data, message.data, message.size);
+        data->payload.length = message.size;
+    }
+
+    // The second byte of the encapsulation tells the endianness
+    data->payload.encapsulation = (message.size >= 2 && (message.data[1] & 0x01)) ? CDR_LE : CDR_BE;
+
+    const std::string topic_unique_name = reader.topic().topic_unique_name();
+    data->kind = fastrtps::rtps::ALIVE;
+    data->source_guid = reader.guid();
+    data->participant_receiver = configuration_->id;
+    data->origin_sequence_number = fastrtps::rtps::SequenceNumber_t(++sequences_[topic_unique_name]);
+    fastrtps::rtps::Time_t::now(data->source_timestamp);
+
+    return data;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,320 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file McapWriter.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <cpp_utils/exception/InconsistencyException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/recorder/Lz4Frame.hpp>
+#include <ddsrouter_core/recorder/McapWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Library written in the header of the files
+constexpr const char* LIBRARY = "ddsrouter";
+
+template <typename T>
+void append_integer(
+        const T value,
+        std::vector<uint8_t>& buffer)
+{
+    for (unsigned int i = 0; i < sizeof(T); ++i)
+    {
+        buffer.push_back(static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8 * i)));
+    }
+}
+
+void append_string(
+        const std::string& value,
+        std::vector<uint8_t>& buffer)
+{
+    append_integer(static_cast<uint32_t>(value.size()), buffer);
+    buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+} /* namespace */
+
+McapWriter::McapWriter(
+        const uint64_t chunk_size,
+        const bool compress)
+    : chunk_size_(chunk_size)
+    , compress_(compress)
+{
+}
+
+McapWriter::~McapWriter()
+{
+    if (!is_open())
+    {
+        return;
+    }
+
+    try
+    {
+        close();
+    }
+    catch (const utils::InconsistencyException& e)
+    {
+        logWarning(DDSROUTER_RECORDER, "Error closing MCAP file " << file_name_ << ": " << e.what());
+    }
+}
+
+void McapWriter::open(
+        const std::string& file_name)
+{
+    if (is_open())
+    {
+        close();
+    }
+
+    file_.open(file_name, std::ios::binary | std::ios::trunc);
+    if (!file_)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Cannot create MCAP file " << file_name << ".");
+    }
+
+    file_name_ = file_name;
+    file_.write(reinterpret_cast<const char*>(MCAP_MAGIC), sizeof(MCAP_MAGIC));
+    file_size_ = sizeof(MCAP_MAGIC);
+
+    // Header: profile (none, as the messages are plain CDR) and library
+    record_.clear();
+    append_string("", record_);
+    append_string(LIBRARY, record_);
+    write_record_(McapOpcode::header);
+}
+
+void McapWriter::close()
+{
+    if (!is_open())
+    {
+        return;
+    }
+
+    write_chunk_();
+
+    // Data end, without CRC of the data section
+    record_.clear();
+    append_integer<uint32_t>(0, record_);
+    write_record_(McapOpcode::data_end);
+
+    // Footer, without summary section
+    record_.clear();
+    append_integer<uint64_t>(0, record_);
+    append_integer<uint64_t>(0, record_);
+    append_integer<uint32_t>(0, record_);
+    write_record_(McapOpcode::footer);
+
+    file_.write(reinterpret_cast<const char*>(MCAP_MAGIC), sizeof(MCAP_MAGIC));
+    file_.close();
+
+    const bool failed = file_.fail();
+    channels_written_.clear();
+    file_size_ = 0;
+
+    if (failed)
+    {
+        throw utils::InconsistencyException(
+                  utils::Formatter() << "Error writing MCAP file " << file_name_ << ".");
+    }
+}
+
+bool McapWriter::is_open() const noexcept
+{
+    return file_.is_open();
+}
+
+void McapWriter::add_channel(
+        const uint16_t channel_id,
+        const std::string& topic_name,
+        const std::string& type_name,
+        const bool keyed)
+{
+    channels_[channel_id] = {topic_name, type_name, keyed};
+}
+
+void McapWriter::write(
+        const uint16_t channel_id,
+        const uint32_t sequence,
+        const uint64_t log_time,
+        const uint64_t publish_time,
+        const uint8_t* data,
+        const uint32_t size)
+{
+    if (!is_open())
+    {
+        throw utils::InconsistencyException("No MCAP file open to write.");
+    }
+
+    auto channel = channels_.find(channel_id);
+    if (channel == channels_.end())
+    {
+        throw utils::InconsistencyException(
+                  utils::Formatter() << "MCAP channel " << channel_id << " not registered.");
+    }
+
+    if (channels_written_.insert(channel_id).second)
+    {
+        // Schema (one per channel, with the same id) with no definition
+        record_.clear();
+        append_integer(channel_id, record_);
+        append_string(channel->second.type_name, record_);
+        append_string("", record_);
+        append_integer<uint32_t>(0, record_);
+        write_record_(McapOpcode::schema);
+
+        // Channel, with whether it is keyed as metadata
+        std::vector<uint8_t> metadata;
+        append_string(MCAP_KEYED_METADATA, metadata);
+        append_string(channel->second.keyed ? "true" : "false", metadata);
+
+        record_.clear();
+        append_integer(channel_id, record_);
+        append_integer(channel_id, record_);
+        append_string(channel->second.topic_name, record_);
+        append_string(MCAP_MESSAGE_ENCODING, record_);
+        append_integer(static_cast<uint32_t>(metadata.size()), record_);
+        record_.insert(record_.end(), metadata.begin(), metadata.end());
+        write_record_(McapOpcode::channel);
+    }
+
+    if (chunk_.empty())
+    {
+        chunk_start_time_ = log_time;
+        chunk_end_time_ = log_time;
+    }
+    else
+    {
+        chunk_start_time_ = std::min(chunk_start_time_, log_time);
+        chunk_end_time_ = std::max(chunk_end_time_, log_time);
+    }
+
+    // Message, serialized directly in the chunk
+    chunk_.push_back(static_cast<uint8_t>(McapOpcode::message));
+    append_integer<uint64_t>(sizeof(channel_id) + sizeof(sequence) + sizeof(log_time) + sizeof(publish_time) + size,
+            chunk_);
+    append_integer(channel_id, chunk_);
+    append_integer(sequence, chunk_);
+    append_integer(log_time, chunk_);
+    append_integer(publish_time, chunk_);
+    chunk_.insert(chunk_.end(), data, data + size);
+
+    if (chunk_.size() >= chunk_size_)
+    {
+        write_chunk_();
+    }
+}
+
+void McapWriter::flush()
+{
+    if (!is_open())
+    {
+        return;
+    }
+
+    write_chunk_();
+    file_.flush();
+
+    if (file_.fail())
+    {
+        throw utils::InconsistencyException(
+                  utils::Formatter() << "Error writing MCAP file " << file_name_ << ".");
+    }
+}
+
+uint64_t McapWriter::size() const noexcept
+{
+    return file_size_ + chunk_.size();
+}
+
+void McapWriter::write_record_(
+        const McapOpcode opcode,
+        const uint8_t* tail /* = nullptr */,
+        const uint64_t tail_size /* = 0 */)
+{
+    std::vector<uint8_t> prefix;
+    prefix.push_back(static_cast<uint8_t>(opcode));
+    append_integer<uint64_t>(record_.size() + tail_size, prefix);
+
+    file_.write(reinterpret_cast<const char*>(prefix.data()), prefix.size());
+    file_.write(reinterpret_cast<const char*>(record_.data()), record_.size());
+    if (tail_size > 0)
+    {
+        file_.write(reinterpret_cast<const char*>(tail), tail_size);
+    }
+
+    if (file_.fail())
+    {
+        throw utils::InconsistencyException(
+                  utils::Formatter() << "Error writing MCAP file " << file_name_ << ".");
+    }
+
+    file_size_ += MCAP_RECORD_PREFIX_SIZE + record_.size() + tail_size;
+}
+
+void McapWriter::write_chunk_()
+{
+    if (chunk_.empty())
+    {
+        return;
+    }
+
+    const uint8_t* records = chunk_.data();
+    uint64_t records_size = chunk_.size();
+    const char* compression = MCAP_COMPRESSION_NONE;
+
+    if (compress_)
+    {
+        compressed_.clear();
+        Lz4Frame::compress(chunk_.data(), chunk_.size(), compressed_);
+
+        // Keep incompressible chunks as they are
+        if (compressed_.size() < chunk_.size())
+        {
+            records = compressed_.data();
+            records_size = compressed_.size();
+            compression = MCAP_COMPRESSION_LZ4;
+        }
+    }
+
+    // Chunk, without CRC of the uncompressed records, followed by its records
+    record_.clear();
+    append_integer(chunk_start_time_, record_);
+    append_integer(chunk_end_time_, record_);
+    append_integer<uint64_t>(chunk_.size(), record_);
+    append_integer<uint32_t>(0, record_);
+    append_string(compression, record_);
+    append_integer(records_size, record_);
+    write_record_(McapOpcode::chunk, records, records_size);
+
+    chunk_.clear();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
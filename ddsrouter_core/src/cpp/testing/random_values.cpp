@@ -24,6 +24,13 @@
 #include <ddspipe_participants/configuration/SimpleParticipantConfiguration.hpp>
 #include <ddspipe_participants/configuration/XmlParticipantConfiguration.hpp>
 
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ShmParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/UdsParticipantConfiguration.hpp>
+#include <ddsrouter_core/recorder/McapWriter.hpp>
 #include <ddsrouter_core/testing/random_values.hpp>
 #include <ddsrouter_core/types/ParticipantKind.hpp>
 
@@ -89,6 +96,62 @@ std::shared_ptr<ParticipantConfiguration> random_participant_configuration(
             return c;
         }
 
+        case ParticipantKind::generator:
+        {
+            auto c = std::make_shared<GeneratorParticipantConfiguration>();
+            c->id = id;
+            GeneratedTopicConfiguration topic;
+            topic.topic_name = "topic_" + std::to_string(seed);
+            c->topics.push_back(topic);
+            return c;
+        }
+
+        case ParticipantKind::sink:
+        {
+            auto c = std::make_shared<SinkParticipantConfiguration>();
+            c->id = id;
+            return c;
+        }
+
+        case ParticipantKind::recorder:
+        {
+            auto c = std::make_shared<RecorderParticipantConfiguration>();
+            c->id = id;
+            c->file_prefix = "recorder_" + std::to_string(seed);
+            return c;
+        }
+
+        case ParticipantKind::replayer:
+        {
+            auto c = std::make_shared<ReplayerParticipantConfiguration>();
+            c->id = id;
+
+            // The file replayed must exist, so write an empty one
+            const std::string file_name = "replayer_" + std::to_string(seed) + ".mcap";
+            McapWriter writer(0, false);
+            writer.open(file_name);
+            writer.close();
+
+            c->files.push_back(file_name);
+            return c;
+        }
+
+        case ParticipantKind::shm:
+        {
+            auto c = std::make_shared<ShmParticipantConfiguration>();
+            c->id = id;
+            c->domain = random_domain(seed);
+            return c;
+        }
+
+        case ParticipantKind::uds:
+        {
+            auto c = std::make_shared<UdsParticipantConfiguration>();
+            c->id = id;
+            c->domain = random_domain(seed);
+            return c;
+        }
+
         default:
             throw eprosima::utils::InconsistencyException("No valid kind");
     }
@@ -0,0 +1,334 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FlightRecorder.cpp
+ *
+ */
+
+#include <array>
+#include <atomic>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif // if defined(_WIN32)
+
+#include <ddsrouter_core/tracing/FlightRecorder.hpp>
+
+#include "../utils/clock.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Words used to store the text of an event
+constexpr std::size_t TEXT_WORDS = (FlightRecorder::TEXT_SIZE + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+//! Maximum length of a dumped line (time, kind, text and line break)
+constexpr std::size_t LINE_SIZE = 64 + FlightRecorder::TEXT_SIZE;
+
+//! Names of the kinds of events, as dumped
+constexpr const char* KIND_NAMES[] = {
+    "discovery",
+    "bridge_created",
+    "bridge_destroyed",
+    "sample_dropped",
+    "reload",
+    "latency_outlier",
+};
+
+/**
+ * Position of the ring.
+ *
+ * Every field is atomic, so the slot can be read while it is being written (sequence lock).
+ * The sequence is 0 while the slot is empty, 2i+1 while the i-th event is being written in it,
+ * and 2i+2 once it holds the i-th event.
+ *
+ * NOTE: every field is trivially constructible and zero initialized, so the ring can be used
+ * before static initialization (e.g. by another static object) and is never destroyed.
+ */
+struct Slot
+{
+    std::atomic<uint64_t> sequence;
+    std::atomic<int64_t> time_ns;
+    std::atomic<uint8_t> kind;
+    std::atomic<uint8_t> length;
+    std::array<std::atomic<uint64_t>, TEXT_WORDS> text;
+};
+
+//! Event read from a slot
+struct Event
+{
+    int64_t time_ns;
+    uint8_t kind;
+    std::size_t length;
+    char text[TEXT_WORDS * sizeof(uint64_t)];
+};
+
+Slot slots[FlightRecorder::RING_SIZE];
+
+//! Index of the next event recorded
+std::atomic<uint64_t> next_event;
+
+//! Minimum latency of a sample to be recorded as an outlier (ns)
+std::atomic<uint64_t> outlier_threshold {FlightRecorder::DEFAULT_LATENCY_OUTLIER_THRESHOLD};
+
+//! Copy \c text into \c it without exceeding \c end
+char* append(
+        char* it,
+        const char* end,
+        const char* text) noexcept
+{
+    while (it < end && *text != '\0')
+    {
+        *it++ = *text++;
+    }
+    return it;
+}
+
+//! Write the decimal representation of \c value with at least \c min_digits into \c it without exceeding \c end
+char* append(
+        char* it,
+        const char* end,
+        uint64_t value,
+        const std::size_t min_digits = 1) noexcept
+{
+    char digits[20];
+    std::size_t size = 0;
+    do
+    {
+        digits[size++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while ((value != 0 || size < min_digits) && size < sizeof(digits));
+
+    while (it < end && size > 0)
+    {
+        *it++ = digits[--size];
+    }
+    return it;
+}
+
+//! Read the \c index -th event, if it is still kept and no thread is overwriting it
+bool read_event(
+        const uint64_t index,
+        Event& event) noexcept
+{
+    const Slot& slot = slots[index % FlightRecorder::RING_SIZE];
+    const uint64_t sequence = 2 * index + 2;
+
+    if (slot.sequence.load(std::memory_order_acquire) != sequence)
+    {
+        return false;
+    }
+
+    event.time_ns = slot.time_ns.load(std::memory_order_relaxed);
+    event.kind = slot.kind.load(std::memory_order_relaxed);
+    event.length = slot.length.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < TEXT_WORDS; ++i)
+    {
+        const uint64_t word = slot.text[i].load(std::memory_order_relaxed);
+        std::memcpy(event.text + i * sizeof(uint64_t), &word, sizeof(uint64_t));
+    }
+
+    // Discard the event if the slot has been overwritten while reading it
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+//! Write \c event as a line in \c line , and return its size
+std::size_t format_event(
+        const Event& event,
+        char (&line)[LINE_SIZE]) noexcept
+{
+    char* it = line;
+    // Leave room for the line break
+    const char* end = line + LINE_SIZE - 1;
+
+    // Seconds since epoch with nanoseconds
+    const uint64_t time_ns = event.time_ns > 0 ? static_cast<uint64_t>(event.time_ns) : 0;
+    it = append(it, end, time_ns / 1000000000);
+    it = append(it, end, ".");
+    it = append(it, end, time_ns % 1000000000, 9);
+    it = append(it, end, " ");
+
+    constexpr std::size_t kinds = sizeof(KIND_NAMES) / sizeof(KIND_NAMES[0]);
+    it = append(it, end, event.kind < kinds ? KIND_NAMES[event.kind] : "unknown");
+
+    if (event.length > 0)
+    {
+        it = append(it, end, " ");
+        for (std::size_t i = 0; i < event.length && it < end; ++i)
+        {
+            *it++ = event.text[i];
+        }
+    }
+
+    *it++ = '\n';
+    return static_cast<std::size_t>(it - line);
+}
+
+//! Call \c callback with every event kept, from the oldest to the newest, formatted as a line
+template <typename Callback>
+bool for_each_line(
+        Callback callback) noexcept
+{
+    const uint64_t end = next_event.load(std::memory_order_acquire);
+    const uint64_t begin = end > FlightRecorder::RING_SIZE ? end - FlightRecorder::RING_SIZE : 0;
+
+    Event event;
+    char line[LINE_SIZE];
+    for (uint64_t index = begin; index < end; ++index)
+    {
+        if (read_event(index, event) && !callback(line, format_event(event, line)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} /* namespace */
+
+void FlightRecorder::record(
+        const FlightEventKind kind,
+        const std::string& subject,
+        const char* note) noexcept
+{
+    // Compose the text before claiming the slot, so it is claimed for as short as possible
+    char text[TEXT_WORDS * sizeof(uint64_t)] = {};
+    const char* end = text + TEXT_SIZE;
+    char* it = append(text, end, subject.c_str());
+    if (!subject.empty() && note[0] != '\0')
+    {
+        it = append(it, end, " ");
+    }
+    it = append(it, end, note);
+
+    const int64_t time_ns = system_now_ns();
+
+    const uint64_t index = next_event.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = slots[index % RING_SIZE];
+
+    // Claim the slot, unless another thread is writing it or it already holds a newer event
+    uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    do
+    {
+        if ((sequence & 1) != 0 || sequence > 2 * index)
+        {
+            return;
+        }
+    } while (!slot.sequence.compare_exchange_weak(
+                sequence, 2 * index + 1, std::memory_order_relaxed, std::memory_order_relaxed));
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.time_ns.store(time_ns, std::memory_order_relaxed);
+    slot.kind.store(static_cast<uint8_t>(kind), std::memory_order_relaxed);
+    slot.length.store(static_cast<uint8_t>(it - text), std::memory_order_relaxed);
+    for (std::size_t i = 0; i < TEXT_WORDS; ++i)
+    {
+        uint64_t word;
+        std::memcpy(&word, text + i * sizeof(uint64_t), sizeof(uint64_t));
+        slot.text[i].store(word, std::memory_order_relaxed);
+    }
+
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+}
+
+uint64_t FlightRecorder::latency_outlier_threshold() noexcept
+{
+    return outlier_threshold.load(std::memory_order_relaxed);
+}
+
+void FlightRecorder::latency_outlier_threshold(
+        const uint64_t threshold_ns) noexcept
+{
+    outlier_threshold.store(threshold_ns, std::memory_order_relaxed);
+}
+
+std::string FlightRecorder::to_string()
+{
+    std::string result;
+
+    for_each_line(
+        [&result](const char* line, const std::size_t size)
+        {
+            result.append(line, size);
+            return true;
+        });
+
+    return result;
+}
+
+bool FlightRecorder::dump(
+        const char* file_name) noexcept
+{
+    // Only async-signal-safe functions are used, so it can be dumped from a signal handler
+#if defined(_WIN32)
+    const int file = ::_open(file_name, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    const int file = ::open(file_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif // if defined(_WIN32)
+
+    if (file < 0)
+    {
+        return false;
+    }
+
+    const bool written = for_each_line(
+        [file](const char* line, const std::size_t size)
+        {
+            std::size_t done = 0;
+            while (done < size)
+            {
+#if defined(_WIN32)
+                const int ret = ::_write(file, line + done, static_cast<unsigned int>(size - done));
+#else
+                const ssize_t ret = ::write(file, line + done, size - done);
+#endif // if defined(_WIN32)
+                if (ret <= 0)
+                {
+                    return false;
+                }
+                done += static_cast<std::size_t>(ret);
+            }
+            return true;
+        });
+
+#if defined(_WIN32)
+    return ::_close(file) == 0 && written;
+#else
+    return ::close(file) == 0 && written;
+#endif // if defined(_WIN32)
+}
+
+void FlightRecorder::clear() noexcept
+{
+    for (Slot& slot : slots)
+    {
+        slot.sequence.store(0, std::memory_order_relaxed);
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
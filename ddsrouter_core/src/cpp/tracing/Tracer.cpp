@@ -0,0 +1,361 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file Tracer.cpp
+ *
+ */
+
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/tracing/Tracer.hpp>
+
+#include "../utils/clock.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Events recorded by a thread
+struct Ring
+{
+    //! Mutex to protect the ring (only contended while exporting)
+    std::mutex mutex;
+
+    //! Events (\c Tracer::RING_SIZE )
+    std::vector<TraceEvent> events;
+
+    //! Position where the next event is recorded
+    std::size_t next {0};
+
+    //! Whether the ring has been filled (so every position holds an event)
+    bool full {false};
+
+    //! Id of the thread in the exported trace
+    uint32_t thread_id {0};
+};
+
+//! Rings and labels of every thread (never destroyed, so threads may record while the process exits)
+struct TracerState
+{
+    std::mutex rings_mutex;
+    std::vector<std::shared_ptr<Ring>> rings;
+
+    std::mutex labels_mutex;
+    std::vector<std::string> labels {""};
+    std::map<std::string, uint32_t> label_ids {{"", 0}};
+};
+
+TracerState& state()
+{
+    static TracerState* state = new TracerState();
+    return *state;
+}
+
+//! One of each \c sampling samples is traced (0 = disabled)
+std::atomic<uint32_t> sampling {0};
+
+//! Id of the next traced sample
+std::atomic<uint64_t> next_sample {1};
+
+//! Ring of the current thread (created when it records its first event)
+thread_local std::shared_ptr<Ring> thread_ring;
+
+//! Samples seen by the current thread since the last traced one
+thread_local uint32_t thread_samples {0};
+
+//! Escape a string to be written in JSON
+std::string escape(
+        const std::string& value)
+{
+    std::string result;
+    result.reserve(value.size());
+
+    for (const char c : value)
+    {
+        switch (c)
+        {
+            case '\\':
+                result += "\\\\";
+                break;
+
+            case '"':
+                result += "\\\"";
+                break;
+
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    std::ostringstream code;
+                    code << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
+                    result += code.str();
+                }
+                else
+                {
+                    result += c;
+                }
+                break;
+        }
+    }
+
+    return result;
+}
+
+//! Write a Chrome trace event (without the trailing comma)
+void write_event(
+        std::ostream& output,
+        const TraceEvent& event,
+        const char phase,
+        const int64_t timestamp_ns,
+        const uint32_t thread_id,
+        const std::vector<std::string>& labels)
+{
+    output << "{\"name\":\"" << escape(event.name ? event.name : "") << "\",\"cat\":\"ddsrouter\",\"ph\":\"" << phase
+           << "\",\"pid\":1,\"tid\":" << thread_id << ",\"ts\":" << static_cast<double>(timestamp_ns) / 1000.0;
+
+    if (phase == 'X')
+    {
+        output << ",\"dur\":" << static_cast<double>(event.duration_ns) / 1000.0;
+    }
+    else
+    {
+        output << ",\"id\":" << event.sample;
+    }
+
+    const std::string& topic = event.topic < labels.size() ? labels[event.topic] : labels[0];
+    const std::string& participant = event.participant < labels.size() ? labels[event.participant] : labels[0];
+
+    output << ",\"args\":{\"topic\":\"" << escape(topic) << "\",\"participant\":\"" << escape(participant)
+           << "\",\"sample\":" << event.sample << "}}";
+}
+
+} /* namespace */
+
+bool Tracer::trace_points_compiled() noexcept
+{
+#if defined(DDSROUTER_TRACING_ENABLED)
+    return true;
+#else
+    return false;
+#endif // if defined(DDSROUTER_TRACING_ENABLED)
+}
+
+void Tracer::enable(
+        const uint32_t new_sampling) noexcept
+{
+    sampling.store(new_sampling < 1 ? 1 : new_sampling, std::memory_order_relaxed);
+
+    if (!trace_points_compiled())
+    {
+        logWarning(DDSROUTER_TRACING,
+                "Tracing enabled, but the trace points have not been compiled (see CMake option DDSROUTER_TRACING).");
+    }
+}
+
+void Tracer::disable() noexcept
+{
+    sampling.store(0, std::memory_order_relaxed);
+}
+
+bool Tracer::enabled() noexcept
+{
+    return sampling.load(std::memory_order_relaxed) != 0;
+}
+
+uint32_t Tracer::label(
+        const std::string& text)
+{
+    TracerState& tracer_state = state();
+    std::lock_guard<std::mutex> lock(tracer_state.labels_mutex);
+
+    auto it = tracer_state.label_ids.find(text);
+    if (it != tracer_state.label_ids.end())
+    {
+        return it->second;
+    }
+
+    const uint32_t id = static_cast<uint32_t>(tracer_state.labels.size());
+    tracer_state.labels.push_back(text);
+    tracer_state.label_ids[text] = id;
+    return id;
+}
+
+uint64_t Tracer::sample() noexcept
+{
+    const uint32_t current_sampling = sampling.load(std::memory_order_relaxed);
+    if (current_sampling == 0)
+    {
+        return 0;
+    }
+
+    if (++thread_samples < current_sampling)
+    {
+        return 0;
+    }
+
+    thread_samples = 0;
+    return next_sample.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Tracer::record(
+        const TraceEvent& event) noexcept
+{
+    if (!thread_ring)
+    {
+        try
+        {
+            auto ring = std::make_shared<Ring>();
+            ring->events.resize(RING_SIZE);
+
+            TracerState& tracer_state = state();
+            std::lock_guard<std::mutex> lock(tracer_state.rings_mutex);
+            ring->thread_id = static_cast<uint32_t>(tracer_state.rings.size() + 1);
+            tracer_state.rings.push_back(ring);
+
+            thread_ring = ring;
+        }
+        catch (const std::exception&)
+        {
+            // Tracing must never break the forwarding
+            return;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(thread_ring->mutex);
+
+    thread_ring->events[thread_ring->next] = event;
+    thread_ring->next = (thread_ring->next + 1) % RING_SIZE;
+    if (thread_ring->next == 0)
+    {
+        thread_ring->full = true;
+    }
+}
+
+std::string Tracer::to_chrome_trace()
+{
+    TracerState& tracer_state = state();
+
+    std::vector<std::string> labels;
+    {
+        std::lock_guard<std::mutex> lock(tracer_state.labels_mutex);
+        labels = tracer_state.labels;
+    }
+
+    std::vector<std::shared_ptr<Ring>> rings;
+    {
+        std::lock_guard<std::mutex> lock(tracer_state.rings_mutex);
+        rings = tracer_state.rings;
+    }
+
+    std::ostringstream output;
+    output << std::fixed << std::setprecision(3);
+    output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    bool first = true;
+    for (const auto& ring : rings)
+    {
+        // Copy the events, so the thread is not blocked while they are serialized
+        std::vector<TraceEvent> events;
+        {
+            std::lock_guard<std::mutex> lock(ring->mutex);
+            if (ring->full)
+            {
+                events.insert(events.end(), ring->events.begin() + ring->next, ring->events.end());
+            }
+            events.insert(events.end(), ring->events.begin(), ring->events.begin() + ring->next);
+        }
+
+        for (const auto& event : events)
+        {
+            if (!first)
+            {
+                output << ",";
+            }
+            first = false;
+
+            if (event.async)
+            {
+                write_event(output, event, 'b', event.start_ns, ring->thread_id, labels);
+                output << ",";
+                write_event(output, event, 'e', event.start_ns + event.duration_ns, ring->thread_id, labels);
+            }
+            else
+            {
+                write_event(output, event, 'X', event.start_ns, ring->thread_id, labels);
+            }
+        }
+    }
+
+    output << "]}\n";
+    return output.str();
+}
+
+bool Tracer::export_chrome_trace(
+        const std::string& file_name) noexcept
+{
+    try
+    {
+        std::ofstream file(file_name);
+        file << to_chrome_trace();
+        file.close();
+
+        if (!file)
+        {
+            logWarning(DDSROUTER_TRACING, "Failed to write trace in file " << file_name << ".");
+            return false;
+        }
+
+        logInfo(DDSROUTER_TRACING, "Trace written in file " << file_name << ".");
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        logWarning(DDSROUTER_TRACING, "Failed to write trace in file " << file_name << ": " << e.what());
+        return false;
+    }
+}
+
+void Tracer::clear() noexcept
+{
+    TracerState& tracer_state = state();
+    std::lock_guard<std::mutex> rings_lock(tracer_state.rings_mutex);
+
+    for (const auto& ring : tracer_state.rings)
+    {
+        std::lock_guard<std::mutex> lock(ring->mutex);
+        ring->next = 0;
+        ring->full = false;
+    }
+}
+
+int64_t Tracer::now() noexcept
+{
+    return steady_now_ns();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,871 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IoUringUdp.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <linux/io_uring.h>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddsrouter_core/transport/IoUringUdp.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Maximum time the internal thread waits before checking whether it must stop
+constexpr utils::Duration_ms POLL_PERIOD = 100;
+
+//! Times the sender waits \c POLL_PERIOD for its sends to complete before giving up
+constexpr uint32_t MAX_SEND_WAITS = 10;
+
+} /* namespace */
+
+#if defined(__linux__)
+
+namespace {
+
+//! Milliseconds the kernel polling thread spins without work before sleeping
+constexpr uint32_t SQPOLL_IDLE = 100;
+
+//! Identifier of the group of buffers provided to the kernel
+constexpr uint16_t BUFFER_GROUP = 0;
+
+//! User data of the multishot receive operation
+constexpr uint64_t RECEIVE_USER_DATA = 1;
+
+//! User data of the operation that cancels the multishot receive
+constexpr uint64_t CANCEL_USER_DATA = 2;
+
+//! Smallest power of two not lower than \c value
+uint32_t next_power_of_two(
+        const uint32_t value) noexcept
+{
+    uint32_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+//! Endpoint of an IPv4 socket address
+UdpEndpoint to_endpoint(
+        const sockaddr_in& address) noexcept
+{
+    UdpEndpoint endpoint;
+    std::memcpy(endpoint.address.data(), &address.sin_addr.s_addr, endpoint.address.size());
+    endpoint.port = ntohs(address.sin_port);
+    return endpoint;
+}
+
+//! IPv4 socket address of an endpoint
+sockaddr_in to_address(
+        const UdpEndpoint& endpoint) noexcept
+{
+    sockaddr_in address {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(endpoint.port);
+    std::memcpy(&address.sin_addr.s_addr, endpoint.address.data(), endpoint.address.size());
+    return address;
+}
+
+} /* namespace */
+
+/**
+ * Submission and completion queues of an io_uring, mapped from the kernel.
+ *
+ * It uses the system calls directly, so it does not depend on liburing.
+ * It is not thread safe: each ring is used by a single thread at a time.
+ */
+class IoUring
+{
+public:
+
+    //! Create the ring and map its queues
+    IoUring(
+            const uint32_t entries,
+            const bool sqpoll)
+        : sqpoll_(sqpoll)
+    {
+        io_uring_params params {};
+        if (sqpoll)
+        {
+            params.flags |= IORING_SETUP_SQPOLL;
+            params.sq_thread_idle = SQPOLL_IDLE;
+        }
+
+        fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd_ < 0)
+        {
+            throw utils::InitializationException(
+                      utils::Formatter() << "Failed to create io_uring: " << std::strerror(errno) << ".");
+        }
+
+        if (!(params.features & IORING_FEAT_EXT_ARG))
+        {
+            release_();
+            throw utils::InitializationException("io_uring transport requires Linux 5.11 or higher.");
+        }
+
+        sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap)
+        {
+            sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+        }
+
+        sq_ring_ = map_(sq_ring_size_, IORING_OFF_SQ_RING);
+        cq_ring_ = single_mmap ? sq_ring_ : map_(cq_ring_size_, IORING_OFF_CQ_RING);
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(map_(sqes_size_, IORING_OFF_SQES));
+
+        uint8_t* sq = static_cast<uint8_t*>(sq_ring_);
+        sq_head_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+        sq_flags_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.flags);
+        sq_mask_ = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+        sq_entries_ = params.sq_entries;
+
+        uint8_t* cq = static_cast<uint8_t*>(cq_ring_);
+        cq_head_ = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        // Each entry of the queue is always the submission entry with its same index
+        uint32_t* sq_array = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+        for (uint32_t i = 0; i < sq_entries_; ++i)
+        {
+            sq_array[i] = i;
+        }
+
+        sqe_tail_ = *sq_tail_;
+    }
+
+    //! Unmap the queues and close the ring, which cancels any operation left
+    ~IoUring()
+    {
+        release_();
+    }
+
+    //! Number of entries of the submission queue
+    uint32_t entries() const noexcept
+    {
+        return sq_entries_;
+    }
+
+    //! Next free submission entry, cleared, or nullptr if the queue is full
+    io_uring_sqe* get_sqe() noexcept
+    {
+        const uint32_t head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+        if (sqe_tail_ - head >= sq_entries_)
+        {
+            return nullptr;
+        }
+
+        io_uring_sqe* sqe = &sqes_[sqe_tail_ & sq_mask_];
+        ++sqe_tail_;
+        std::memset(sqe, 0, sizeof(*sqe));
+        return sqe;
+    }
+
+    /**
+     * Submit the entries queued and, if \c wait_nr is not 0, wait for that many completions or \c timeout .
+     *
+     * Return the result of the system call (negative with errno set on error or timeout), or 0 if it is not needed.
+     */
+    int submit(
+            const uint32_t wait_nr = 0,
+            const utils::Duration_ms timeout = POLL_PERIOD) noexcept
+    {
+        const uint32_t to_submit = sqe_tail_ - *sq_tail_;
+        __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+
+        uint32_t flags = 0;
+        if (sqpoll_)
+        {
+            // The kernel thread submits the entries by itself, unless it has gone to sleep
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (__atomic_load_n(sq_flags_, __ATOMIC_RELAXED) & IORING_SQ_NEED_WAKEUP)
+            {
+                flags |= IORING_ENTER_SQ_WAKEUP;
+            }
+            else if (wait_nr == 0)
+            {
+                return 0;
+            }
+        }
+        else if (to_submit == 0 && wait_nr == 0)
+        {
+            return 0;
+        }
+
+        __kernel_timespec timespec {};
+        io_uring_getevents_arg arg {};
+        void* argp = nullptr;
+        std::size_t argsz = 0;
+        if (wait_nr > 0)
+        {
+            flags |= IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+            timespec.tv_sec = timeout / 1000;
+            timespec.tv_nsec = (timeout % 1000) * 1000000;
+            arg.ts = reinterpret_cast<uint64_t>(&timespec);
+            argp = &arg;
+            argsz = sizeof(arg);
+        }
+
+        return static_cast<int>(::syscall(__NR_io_uring_enter, fd_, to_submit, wait_nr, flags, argp, argsz));
+    }
+
+    //! Call \c handler with each completion available, and free them. Return the number of completions
+    template <typename Handler>
+    uint32_t consume_completions(
+            Handler handler) noexcept
+    {
+        uint32_t head = *cq_head_;
+        const uint32_t tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        uint32_t consumed = 0;
+
+        while (head != tail)
+        {
+            handler(cqes_[head & cq_mask_]);
+            ++head;
+            ++consumed;
+        }
+
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+        return consumed;
+    }
+
+    /**
+     * Queue a multishot receive of datagrams from \c socket in the provided buffers.
+     *
+     * Return false if the queue is full.
+     */
+    bool prepare_multishot_receive(
+            const int socket,
+            const uint64_t user_data) noexcept
+    {
+        io_uring_sqe* sqe = get_sqe();
+        if (sqe == nullptr)
+        {
+            return false;
+        }
+
+        // Only the sizes of the header are used, to lay out the source address in each buffer
+        receive_header_ = {};
+        receive_header_.msg_namelen = sizeof(sockaddr_in);
+
+        sqe->opcode = IORING_OP_RECVMSG;
+        sqe->fd = socket;
+        sqe->addr = reinterpret_cast<uint64_t>(&receive_header_);
+        sqe->len = 1;
+        sqe->ioprio = IORING_RECV_MULTISHOT;
+        sqe->flags = IOSQE_BUFFER_SELECT;
+        sqe->buf_group = BUFFER_GROUP;
+        sqe->user_data = user_data;
+        return true;
+    }
+
+    //! Queue the cancellation of the operations with \c user_data . Return false if the queue is full
+    bool prepare_cancel(
+            const uint64_t user_data,
+            const uint64_t cancel_user_data) noexcept
+    {
+        io_uring_sqe* sqe = get_sqe();
+        if (sqe == nullptr)
+        {
+            return false;
+        }
+
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = user_data;
+        sqe->user_data = cancel_user_data;
+        return true;
+    }
+
+    //! Header of the datagrams received with \c prepare_multishot_receive
+    const msghdr& receive_header() const noexcept
+    {
+        return receive_header_;
+    }
+
+    /**
+     * Provide the kernel with \c count buffers of \c size bytes, selected by the operations with buffer selection.
+     *
+     * Return false if the kernel does not support provided buffer rings.
+     */
+    bool provide_buffers(
+            const uint32_t count,
+            const uint32_t size)
+    {
+        buffer_count_ = next_power_of_two(std::min<uint32_t>(count, 1 << 15));
+        // Aligned so the header of the completion at the start of each buffer is too
+        buffer_size_ = (size + 7) & ~7u;
+        buffer_ring_size_ = buffer_count_ * sizeof(io_uring_buf);
+
+        void* ring = ::mmap(nullptr, buffer_ring_size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ring == MAP_FAILED)
+        {
+            return false;
+        }
+        buffer_ring_ = static_cast<io_uring_buf*>(ring);
+
+        io_uring_buf_reg registration {};
+        registration.ring_addr = reinterpret_cast<uint64_t>(buffer_ring_);
+        registration.ring_entries = buffer_count_;
+        registration.bgid = BUFFER_GROUP;
+        if (::syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PBUF_RING, &registration, 1) != 0)
+        {
+            ::munmap(buffer_ring_, buffer_ring_size_);
+            buffer_ring_ = nullptr;
+            return false;
+        }
+
+        buffers_.resize(static_cast<std::size_t>(buffer_count_) * buffer_size_);
+        for (uint32_t id = 0; id < buffer_count_; ++id)
+        {
+            recycle_buffer(static_cast<uint16_t>(id));
+        }
+        return true;
+    }
+
+    //! Provided buffer \c id
+    uint8_t* buffer(
+            const uint16_t id) noexcept
+    {
+        return buffers_.data() + static_cast<std::size_t>(id) * buffer_size_;
+    }
+
+    //! Give the provided buffer \c id back to the kernel
+    void recycle_buffer(
+            const uint16_t id) noexcept
+    {
+        // The tail overlays the reserved field of the first entry, so the entry is written field by field
+        io_uring_buf* entry = &buffer_ring_[buffer_tail_ & (buffer_count_ - 1)];
+        entry->addr = reinterpret_cast<uint64_t>(buffer(id));
+        entry->len = buffer_size_;
+        entry->bid = id;
+        ++buffer_tail_;
+        __atomic_store_n(&buffer_ring_[0].resv, buffer_tail_, __ATOMIC_RELEASE);
+    }
+
+protected:
+
+    //! Map a region of the ring
+    void* map_(
+            const std::size_t size,
+            const uint64_t offset)
+    {
+        void* region = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, offset);
+        if (region == MAP_FAILED)
+        {
+            const int error = errno;
+            release_();
+            throw utils::InitializationException(
+                      utils::Formatter() << "Failed to map io_uring: " << std::strerror(error) << ".");
+        }
+        return region;
+    }
+
+    //! Unmap every region and close the ring
+    void release_() noexcept
+    {
+        if (sqes_ != nullptr)
+        {
+            ::munmap(sqes_, sqes_size_);
+            sqes_ = nullptr;
+        }
+        if (cq_ring_ != nullptr && cq_ring_ != sq_ring_)
+        {
+            ::munmap(cq_ring_, cq_ring_size_);
+        }
+        cq_ring_ = nullptr;
+        if (sq_ring_ != nullptr)
+        {
+            ::munmap(sq_ring_, sq_ring_size_);
+            sq_ring_ = nullptr;
+        }
+        if (fd_ >= 0)
+        {
+            ::close(fd_);
+            fd_ = -1;
+        }
+        if (buffer_ring_ != nullptr)
+        {
+            ::munmap(buffer_ring_, buffer_ring_size_);
+            buffer_ring_ = nullptr;
+        }
+    }
+
+    //! Ring file descriptor
+    int fd_ {-1};
+
+    //! Whether a kernel thread polls the submission queue
+    bool sqpoll_;
+
+    void* sq_ring_ {nullptr};
+    std::size_t sq_ring_size_ {0};
+    void* cq_ring_ {nullptr};
+    std::size_t cq_ring_size_ {0};
+    io_uring_sqe* sqes_ {nullptr};
+    std::size_t sqes_size_ {0};
+
+    uint32_t* sq_head_ {nullptr};
+    uint32_t* sq_tail_ {nullptr};
+    uint32_t* sq_flags_ {nullptr};
+    uint32_t sq_mask_ {0};
+    uint32_t sq_entries_ {0};
+
+    //! Tail including the entries got but not submitted yet
+    uint32_t sqe_tail_ {0};
+
+    uint32_t* cq_head_ {nullptr};
+    uint32_t* cq_tail_ {nullptr};
+    uint32_t cq_mask_ {0};
+    io_uring_cqe* cqes_ {nullptr};
+
+    //! Ring of provided buffers, as an array because the flexible array of io_uring_buf_ring has another layout in C++
+    io_uring_buf* buffer_ring_ {nullptr};
+    std::size_t buffer_ring_size_ {0};
+    uint32_t buffer_count_ {0};
+    uint32_t buffer_size_ {0};
+    uint16_t buffer_tail_ {0};
+
+    //! Memory of the provided buffers
+    std::vector<uint8_t> buffers_;
+
+    //! Header of the multishot receive
+    msghdr receive_header_ {};
+};
+
+struct IoUringUdpSender::SendOperation
+{
+    msghdr message;
+    iovec data;
+    sockaddr_in destination;
+    uint32_t buffer;
+};
+
+IoUringUdpSender::IoUringUdpSender(
+        const UdpSocketOptions& options,
+        const uint32_t ring_entries /* = IO_URING_DEFAULT_RING_ENTRIES */,
+        const bool sqpoll /* = false */)
+{
+    socket_ = open_udp_sender_socket(options);
+
+    try
+    {
+        ring_ = std::make_unique<IoUring>(ring_entries, sqpoll);
+    }
+    catch (...)
+    {
+        ::close(socket_);
+        throw;
+    }
+
+    const uint32_t entries = ring_->entries();
+    operations_.reset(new SendOperation[entries]);
+    buffers_.resize(entries);
+    buffer_references_.resize(entries, 0);
+    for (uint32_t i = entries; i > 0; --i)
+    {
+        free_operations_.push_back(i - 1);
+        free_buffers_.push_back(i - 1);
+    }
+}
+
+IoUringUdpSender::~IoUringUdpSender()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // The kernel may still read the buffers of the sends in flight
+        for (uint32_t waits = 0; free_operations_.size() < ring_->entries() && waits < MAX_SEND_WAITS; ++waits)
+        {
+            ring_->submit(1);
+            reap_completions_();
+        }
+    }
+
+    ring_.reset();
+    ::close(socket_);
+}
+
+bool IoUringUdpSender::send_to(
+        const void* data,
+        const uint32_t size,
+        const std::vector<UdpEndpoint>& destinations) noexcept
+{
+    if (destinations.empty())
+    {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    reap_completions_();
+    if (free_buffers_.empty() && !wait_free_operation_())
+    {
+        return false;
+    }
+
+    const uint32_t buffer = free_buffers_.back();
+    free_buffers_.pop_back();
+    buffers_[buffer].assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+
+    bool queued_all = true;
+    for (const auto& destination : destinations)
+    {
+        if (free_operations_.empty() && !wait_free_operation_())
+        {
+            queued_all = false;
+            break;
+        }
+
+        io_uring_sqe* sqe = ring_->get_sqe();
+        if (sqe == nullptr)
+        {
+            // Entries not consumed yet by the kernel polling thread
+            ring_->submit();
+            queued_all = false;
+            break;
+        }
+
+        const uint32_t index = free_operations_.back();
+        free_operations_.pop_back();
+
+        SendOperation& operation = operations_[index];
+        operation.buffer = buffer;
+        operation.destination = to_address(destination);
+        operation.data.iov_base = buffers_[buffer].data();
+        operation.data.iov_len = size;
+        operation.message = {};
+        operation.message.msg_name = &operation.destination;
+        operation.message.msg_namelen = sizeof(operation.destination);
+        operation.message.msg_iov = &operation.data;
+        operation.message.msg_iovlen = 1;
+
+        sqe->opcode = IORING_OP_SENDMSG;
+        sqe->fd = socket_;
+        sqe->addr = reinterpret_cast<uint64_t>(&operation.message);
+        sqe->len = 1;
+        sqe->msg_flags = MSG_NOSIGNAL;
+        sqe->user_data = index;
+
+        ++buffer_references_[buffer];
+    }
+
+    if (buffer_references_[buffer] == 0)
+    {
+        free_buffers_.push_back(buffer);
+        return false;
+    }
+
+    // Every destination in a single system call (none if the kernel polling thread is awake)
+    ring_->submit();
+    return queued_all;
+}
+
+void IoUringUdpSender::reap_completions_() noexcept
+{
+    ring_->consume_completions(
+        [this](const io_uring_cqe& cqe)
+        {
+            const uint32_t index = static_cast<uint32_t>(cqe.user_data);
+            if (cqe.res < 0)
+            {
+                logDebug(DDSROUTER_IO_URING_TRANSPORT, "io_uring send failed: " << std::strerror(-cqe.res) << ".");
+            }
+
+            const uint32_t buffer = operations_[index].buffer;
+            free_operations_.push_back(index);
+            if (--buffer_references_[buffer] == 0)
+            {
+                free_buffers_.push_back(buffer);
+            }
+        });
+}
+
+bool IoUringUdpSender::wait_free_operation_() noexcept
+{
+    for (uint32_t waits = 0; waits < MAX_SEND_WAITS; ++waits)
+    {
+        ring_->submit(1);
+        reap_completions_();
+        if (!free_operations_.empty() && !free_buffers_.empty())
+        {
+            return true;
+        }
+    }
+
+    logWarning(DDSROUTER_IO_URING_TRANSPORT, "io_uring sends are not completing, discarding datagram.");
+    return false;
+}
+
+IoUringUdpReceiver::IoUringUdpReceiver(
+        const UdpEndpoint& endpoint,
+        const std::vector<UdpEndpoint>& interfaces,
+        const uint32_t max_datagram_size,
+        const UdpSocketOptions& options,
+        const uint32_t ring_entries,
+        const DatagramCallback& callback)
+    : callback_(callback)
+{
+    socket_ = open_udp_receiver_socket(endpoint, interfaces, options);
+
+    sockaddr_in address {};
+    socklen_t address_size = sizeof(address);
+    ::getsockname(socket_, reinterpret_cast<sockaddr*>(&address), &address_size);
+    port_ = ntohs(address.sin_port);
+
+    try
+    {
+        ring_ = std::make_unique<IoUring>(ring_entries, false);
+
+        // Each buffer holds the header of the completion, the source address and the datagram
+        const uint32_t buffer_size = sizeof(io_uring_recvmsg_out) + sizeof(sockaddr_in) + max_datagram_size;
+        if (!ring_->provide_buffers(ring_entries, buffer_size))
+        {
+            throw utils::InitializationException("io_uring transport requires Linux 5.19 or higher.");
+        }
+
+        // Multishot receive fails on submission in kernels that do not support it
+        if (!arm_() || ring_->submit() < 0 || !process_completions_())
+        {
+            throw utils::InitializationException("io_uring transport requires Linux 6.0 or higher.");
+        }
+    }
+    catch (...)
+    {
+        ring_.reset();
+        ::close(socket_);
+        throw;
+    }
+
+    thread_ = std::thread(&IoUringUdpReceiver::run_, this);
+}
+
+IoUringUdpReceiver::~IoUringUdpReceiver()
+{
+    stop_.store(true);
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    // The kernel must stop writing in the provided buffers before they are released
+    if (!rearm_ && ring_->prepare_cancel(RECEIVE_USER_DATA, CANCEL_USER_DATA))
+    {
+        for (uint32_t waits = 0; !rearm_ && waits < MAX_SEND_WAITS; ++waits)
+        {
+            ring_->submit(1);
+            process_completions_();
+        }
+    }
+
+    ring_.reset();
+    ::close(socket_);
+}
+
+void IoUringUdpReceiver::run_() noexcept
+{
+    while (!stop_.load())
+    {
+        if (rearm_ && !arm_())
+        {
+            logError(DDSROUTER_IO_URING_TRANSPORT, "Failed to queue io_uring receive in port " << port_ << ".");
+            return;
+        }
+
+        // Times out every POLL_PERIOD to check whether it must stop
+        ring_->submit(1);
+
+        if (!process_completions_())
+        {
+            logError(DDSROUTER_IO_URING_TRANSPORT, "io_uring receive in port " << port_ << " failed.");
+            return;
+        }
+    }
+}
+
+bool IoUringUdpReceiver::arm_() noexcept
+{
+    if (!ring_->prepare_multishot_receive(socket_, RECEIVE_USER_DATA))
+    {
+        return false;
+    }
+
+    rearm_ = false;
+    return true;
+}
+
+bool IoUringUdpReceiver::process_completions_() noexcept
+{
+    bool failed = false;
+
+    ring_->consume_completions(
+        [this, &failed](const io_uring_cqe& cqe)
+        {
+            if (cqe.user_data != RECEIVE_USER_DATA)
+            {
+                return;
+            }
+
+            if (!(cqe.flags & IORING_CQE_F_MORE))
+            {
+                // The operation has finished (e.g. no buffers were left) and must be submitted again
+                rearm_ = true;
+            }
+
+            if (cqe.res < 0)
+            {
+                failed = failed || (cqe.res != -ENOBUFS && cqe.res != -ECANCELED);
+                return;
+            }
+
+            if (!(cqe.flags & IORING_CQE_F_BUFFER))
+            {
+                return;
+            }
+
+            const uint16_t id = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+            const uint8_t* buffer = ring_->buffer(id);
+            const msghdr& header = ring_->receive_header();
+
+            io_uring_recvmsg_out out;
+            std::memcpy(&out, buffer, sizeof(out));
+
+            if (out.flags & MSG_TRUNC)
+            {
+                logWarning(DDSROUTER_IO_URING_TRANSPORT,
+                        "Discarding datagram of port " << port_ << " larger than its receive buffer.");
+            }
+            else if (!stop_.load())
+            {
+                sockaddr_in source {};
+                const uint8_t* name = buffer + sizeof(io_uring_recvmsg_out);
+                std::memcpy(&source, name, std::min<std::size_t>(sizeof(source), out.namelen));
+
+                const uint8_t* payload = name + header.msg_namelen + header.msg_controllen;
+                callback_(payload, out.payloadlen, to_endpoint(source));
+            }
+
+            ring_->recycle_buffer(id);
+        });
+
+    return !failed;
+}
+
+#else
+
+class IoUring
+{
+};
+
+struct IoUringUdpSender::SendOperation
+{
+};
+
+IoUringUdpSender::IoUringUdpSender(
+        const UdpSocketOptions&,
+        const uint32_t /* = IO_URING_DEFAULT_RING_ENTRIES */,
+        const bool /* = false */)
+{
+    throw utils::InitializationException("io_uring transport is only available in Linux.");
+}
+
+IoUringUdpSender::~IoUringUdpSender()
+{
+}
+
+bool IoUringUdpSender::send_to(
+        const void*,
+        const uint32_t,
+        const std::vector<UdpEndpoint>&) noexcept
+{
+    return false;
+}
+
+void IoUringUdpSender::reap_completions_() noexcept
+{
+}
+
+bool IoUringUdpSender::wait_free_operation_() noexcept
+{
+    return false;
+}
+
+IoUringUdpReceiver::IoUringUdpReceiver(
+        const UdpEndpoint&,
+        const std::vector<UdpEndpoint>&,
+        const uint32_t,
+        const UdpSocketOptions&,
+        const uint32_t,
+        const DatagramCallback& callback)
+    : callback_(callback)
+{
+    throw utils::InitializationException("io_uring transport is only available in Linux.");
+}
+
+IoUringUdpReceiver::~IoUringUdpReceiver()
+{
+}
+
+void IoUringUdpReceiver::run_() noexcept
+{
+}
+
+bool IoUringUdpReceiver::arm_() noexcept
+{
+    return false;
+}
+
+bool IoUringUdpReceiver::process_completions_() noexcept
+{
+    return false;
+}
+
+#endif // if defined(__linux__)
+
+uint16_t IoUringUdpReceiver::port() const noexcept
+{
+    return port_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
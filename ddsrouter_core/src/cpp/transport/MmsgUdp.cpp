@@ -0,0 +1,630 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+/**
+ * @file MmsgUdp.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddsrouter_core/transport/MmsgUdp.hpp>
+
+// Options of UDP offload, not defined by old C libraries
+#if defined(__linux__) && !defined(UDP_SEGMENT)
+#define UDP_SEGMENT 103
+#endif // if defined(__linux__) && !defined(UDP_SEGMENT)
+#if defined(__linux__) && !defined(UDP_GRO)
+#define UDP_GRO 104
+#endif // if defined(__linux__) && !defined(UDP_GRO)
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+#if defined(__linux__)
+
+namespace {
+
+//! Maximum time the internal thread waits before checking whether it must stop
+constexpr utils::Duration_ms POLL_PERIOD = 100;
+
+//! Datagrams queued while a thread is sending above which the other threads wait
+constexpr std::size_t MAX_PENDING_DATAGRAMS = 1024;
+
+//! Largest datagram coalesced: segments cannot exceed the MTU, so the payload of an Ethernet frame
+constexpr uint32_t MAX_SEGMENT_SIZE = 1472;
+
+//! Maximum segments of a coalesced message (UDP_MAX_SEGMENTS of the kernel)
+constexpr uint32_t MAX_SEGMENTS = 64;
+
+//! Maximum payload of a UDP datagram over IPv4, and so of a coalesced message
+constexpr uint32_t MAX_UDP_PAYLOAD = 65507;
+
+//! Size of the receive buffers with receive offload, enough for the largest message coalesced by the kernel
+constexpr uint32_t OFFLOAD_BUFFER_SIZE = 65535;
+
+//! Ancillary data with the size of the segments of a coalesced message
+union SegmentControl
+{
+    char buffer[CMSG_SPACE(sizeof(uint16_t))];
+    cmsghdr alignment;
+};
+
+//! Ancillary data with the size of the segments of a message coalesced by the kernel
+union ReceiveOffloadControl
+{
+    char buffer[CMSG_SPACE(sizeof(int))];
+    cmsghdr alignment;
+};
+
+//! Endpoint of an IPv4 socket address
+UdpEndpoint to_endpoint(
+        const sockaddr_in& address) noexcept
+{
+    UdpEndpoint endpoint;
+    std::memcpy(endpoint.address.data(), &address.sin_addr.s_addr, endpoint.address.size());
+    endpoint.port = ntohs(address.sin_port);
+    return endpoint;
+}
+
+//! IPv4 socket address of an endpoint
+sockaddr_in to_address(
+        const UdpEndpoint& endpoint) noexcept
+{
+    sockaddr_in address {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(endpoint.port);
+    std::memcpy(&address.sin_addr.s_addr, endpoint.address.data(), endpoint.address.size());
+    return address;
+}
+
+//! Send each segment of a coalesced \c message in a datagram of its own. Return false if any send fails
+bool send_each_segment(
+        const int socket,
+        const msghdr& message) noexcept
+{
+    bool sent_all = true;
+    for (std::size_t i = 0; i < message.msg_iovlen; ++i)
+    {
+        msghdr segment {};
+        segment.msg_name = message.msg_name;
+        segment.msg_namelen = message.msg_namelen;
+        segment.msg_iov = &message.msg_iov[i];
+        segment.msg_iovlen = 1;
+
+        if (::sendmsg(socket, &segment, MSG_NOSIGNAL) < 0)
+        {
+            sent_all = false;
+        }
+    }
+    return sent_all;
+}
+
+} /* namespace */
+
+struct MmsgUdpReceiver::Batch
+{
+    //! Prepare the headers of every message for the next system call, which overwrites their lengths
+    void reset() noexcept
+    {
+        for (auto& message : messages)
+        {
+            message.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            message.msg_hdr.msg_controllen = sizeof(ReceiveOffloadControl);
+            message.msg_hdr.msg_flags = 0;
+            message.msg_len = 0;
+        }
+    }
+
+    std::vector<mmsghdr> messages;
+    std::vector<iovec> data;
+    std::vector<sockaddr_in> sources;
+    std::vector<ReceiveOffloadControl> controls;
+    std::vector<uint8_t> buffers;
+    uint32_t buffer_size {0};
+};
+
+MmsgUdpSender::MmsgUdpSender(
+        const UdpSocketOptions& options,
+        const uint32_t batch_size /* = MMSG_DEFAULT_BATCH_SIZE */,
+        const bool offload /* = true */)
+    : batch_size_(std::max<uint32_t>(batch_size, 1))
+{
+    socket_ = open_udp_sender_socket(options);
+
+    if (offload)
+    {
+        // Kernels without segmentation offload do not know the option
+        const int segment_size = 0;
+        if (::setsockopt(socket_, SOL_UDP, UDP_SEGMENT, &segment_size, sizeof(segment_size)) == 0)
+        {
+            offload_.store(true);
+        }
+        else
+        {
+            logDebug(DDSROUTER_MMSG_TRANSPORT,
+                    "UDP segmentation offload not supported: " << std::strerror(errno) << ".");
+        }
+    }
+}
+
+MmsgUdpSender::~MmsgUdpSender()
+{
+    ::close(socket_);
+}
+
+bool MmsgUdpSender::send_to(
+        const void* data,
+        const uint32_t size,
+        const std::vector<UdpEndpoint>& destinations) noexcept
+{
+    if (destinations.empty())
+    {
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    pending_taken_.wait(lock, [this]()
+            {
+                return !sending_ || pending_.size() < MAX_PENDING_DATAGRAMS;
+            });
+
+    Datagram datagram;
+    if (!free_datagrams_.empty())
+    {
+        datagram = std::move(free_datagrams_.back());
+        free_datagrams_.pop_back();
+    }
+    datagram.data.assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+    datagram.destinations = destinations;
+    pending_.push_back(std::move(datagram));
+
+    if (sending_)
+    {
+        // The sending thread sends it along with its own datagrams
+        return true;
+    }
+
+    sending_ = true;
+
+    bool sent_all = true;
+    std::vector<Datagram> datagrams;
+    while (!pending_.empty())
+    {
+        datagrams.swap(pending_);
+        pending_taken_.notify_all();
+
+        lock.unlock();
+        sent_all = send_datagrams_(datagrams) && sent_all;
+        lock.lock();
+
+        for (auto& sent : datagrams)
+        {
+            if (free_datagrams_.size() < MAX_PENDING_DATAGRAMS)
+            {
+                free_datagrams_.push_back(std::move(sent));
+            }
+        }
+        datagrams.clear();
+    }
+
+    sending_ = false;
+    pending_taken_.notify_all();
+
+    return sent_all;
+}
+
+bool MmsgUdpSender::offload() const noexcept
+{
+    return offload_.load();
+}
+
+bool MmsgUdpSender::send_datagrams_(
+        const std::vector<Datagram>& datagrams) noexcept
+{
+    // Datagrams to each destination, in the order they were sent
+    std::vector<std::pair<UdpEndpoint, std::vector<const Datagram*>>> flows;
+    std::size_t total_sends = 0;
+    for (const auto& datagram : datagrams)
+    {
+        for (const auto& destination : datagram.destinations)
+        {
+            auto flow = std::find_if(flows.begin(), flows.end(),
+                            [&destination](const std::pair<UdpEndpoint, std::vector<const Datagram*>>& flow)
+                            {
+                                return flow.first == destination;
+                            });
+            if (flow == flows.end())
+            {
+                flows.emplace_back(destination, std::vector<const Datagram*>());
+                flow = std::prev(flows.end());
+            }
+            flow->second.push_back(&datagram);
+            ++total_sends;
+        }
+    }
+
+    // Reserved so the headers can point to them
+    std::vector<sockaddr_in> addresses;
+    addresses.reserve(flows.size());
+    std::vector<iovec> data;
+    data.reserve(total_sends);
+    std::vector<SegmentControl> controls;
+    controls.reserve(total_sends);
+    std::vector<mmsghdr> messages;
+    messages.reserve(total_sends);
+
+    const bool offload = offload_.load();
+
+    for (const auto& flow : flows)
+    {
+        addresses.push_back(to_address(flow.first));
+
+        std::size_t next = 0;
+        while (next < flow.second.size())
+        {
+            const std::size_t first = data.size();
+            const uint32_t segment_size = static_cast<uint32_t>(flow.second[next]->data.size());
+            uint32_t message_size = segment_size;
+            data.push_back({const_cast<uint8_t*>(flow.second[next]->data.data()), segment_size});
+            ++next;
+
+            // Every segment but the last must have the size of the first
+            if (offload && segment_size > 0 && segment_size <= MAX_SEGMENT_SIZE)
+            {
+                while (next < flow.second.size() && data.size() - first < MAX_SEGMENTS)
+                {
+                    const uint32_t size = static_cast<uint32_t>(flow.second[next]->data.size());
+                    if (size == 0 || size > segment_size || message_size + size > MAX_UDP_PAYLOAD)
+                    {
+                        break;
+                    }
+
+                    data.push_back({const_cast<uint8_t*>(flow.second[next]->data.data()), size});
+                    message_size += size;
+                    ++next;
+
+                    if (size < segment_size)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            mmsghdr message {};
+            message.msg_hdr.msg_name = &addresses.back();
+            message.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+            message.msg_hdr.msg_iov = &data[first];
+            message.msg_hdr.msg_iovlen = data.size() - first;
+
+            if (message.msg_hdr.msg_iovlen > 1)
+            {
+                controls.emplace_back();
+                std::memset(&controls.back(), 0, sizeof(SegmentControl));
+                message.msg_hdr.msg_control = controls.back().buffer;
+                message.msg_hdr.msg_controllen = sizeof(SegmentControl);
+
+                cmsghdr* control = CMSG_FIRSTHDR(&message.msg_hdr);
+                control->cmsg_level = SOL_UDP;
+                control->cmsg_type = UDP_SEGMENT;
+                control->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+                const uint16_t segment = static_cast<uint16_t>(segment_size);
+                std::memcpy(CMSG_DATA(control), &segment, sizeof(segment));
+            }
+
+            messages.push_back(message);
+        }
+    }
+
+    bool sent_all = true;
+    std::size_t next = 0;
+    while (next < messages.size())
+    {
+        const unsigned int count = static_cast<unsigned int>(
+            std::min<std::size_t>(batch_size_, messages.size() - next));
+        const int sent = ::sendmmsg(socket_, &messages[next], count, MSG_NOSIGNAL);
+        if (sent > 0)
+        {
+            next += static_cast<std::size_t>(sent);
+            continue;
+        }
+
+        const int error = errno;
+        if (error == EINTR)
+        {
+            continue;
+        }
+
+        // The first message of the call has failed
+        const msghdr& failed = messages[next].msg_hdr;
+        if (failed.msg_iovlen > 1 && (error == EIO || error == EINVAL))
+        {
+            // The device cannot segment (EIO) or the segments exceed the MTU of the route (EINVAL)
+            if (error == EIO && offload_.exchange(false))
+            {
+                logWarning(DDSROUTER_MMSG_TRANSPORT,
+                        "UDP segmentation offload not supported by the network device, disabling it.");
+            }
+            sent_all = send_each_segment(socket_, failed) && sent_all;
+        }
+        else
+        {
+            logDebug(DDSROUTER_MMSG_TRANSPORT, "sendmmsg failed: " << std::strerror(error) << ".");
+            sent_all = false;
+        }
+        ++next;
+    }
+
+    return sent_all;
+}
+
+MmsgUdpReceiver::MmsgUdpReceiver(
+        const UdpEndpoint& endpoint,
+        const std::vector<UdpEndpoint>& interfaces,
+        const uint32_t max_datagram_size,
+        const UdpSocketOptions& options,
+        const uint32_t batch_size,
+        const bool offload,
+        const DatagramCallback& callback)
+    : max_datagram_size_(max_datagram_size)
+    , callback_(callback)
+{
+    socket_ = open_udp_receiver_socket(endpoint, interfaces, options);
+
+    sockaddr_in address {};
+    socklen_t address_size = sizeof(address);
+    ::getsockname(socket_, reinterpret_cast<sockaddr*>(&address), &address_size);
+    port_ = ntohs(address.sin_port);
+
+    if (offload)
+    {
+        const int enable = 1;
+        if (::setsockopt(socket_, SOL_UDP, UDP_GRO, &enable, sizeof(enable)) == 0)
+        {
+            offload_ = true;
+        }
+        else
+        {
+            logDebug(DDSROUTER_MMSG_TRANSPORT,
+                    "UDP receive offload not supported: " << std::strerror(errno) << ".");
+        }
+    }
+
+    const uint32_t count = std::max<uint32_t>(batch_size, 1);
+
+    batch_ = std::make_unique<Batch>();
+    batch_->buffer_size = offload_ ? std::max(max_datagram_size, OFFLOAD_BUFFER_SIZE) : max_datagram_size;
+    batch_->buffers.resize(static_cast<std::size_t>(count) * batch_->buffer_size);
+    batch_->data.resize(count);
+    batch_->sources.resize(count);
+    batch_->controls.resize(count);
+    batch_->messages.resize(count);
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        batch_->data[i].iov_base = batch_->buffers.data() + static_cast<std::size_t>(i) * batch_->buffer_size;
+        batch_->data[i].iov_len = batch_->buffer_size;
+
+        msghdr& header = batch_->messages[i].msg_hdr;
+        header.msg_name = &batch_->sources[i];
+        header.msg_iov = &batch_->data[i];
+        header.msg_iovlen = 1;
+        header.msg_control = batch_->controls[i].buffer;
+    }
+
+    thread_ = std::thread(&MmsgUdpReceiver::run_, this);
+}
+
+MmsgUdpReceiver::~MmsgUdpReceiver()
+{
+    stop_.store(true);
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    ::close(socket_);
+}
+
+void MmsgUdpReceiver::run_() noexcept
+{
+    const unsigned int count = static_cast<unsigned int>(batch_->messages.size());
+    pollfd descriptor {socket_, POLLIN, 0};
+
+    while (!stop_.load())
+    {
+        // Times out every POLL_PERIOD to check whether it must stop
+        const int ready = ::poll(&descriptor, 1, static_cast<int>(POLL_PERIOD));
+        if (ready < 0 && errno != EINTR)
+        {
+            logError(DDSROUTER_MMSG_TRANSPORT,
+                    "Failed to wait for datagrams in port " << port_ << ": " << std::strerror(errno) << ".");
+            return;
+        }
+        if (ready <= 0)
+        {
+            continue;
+        }
+
+        // A full batch means that more datagrams may be waiting
+        int received = 0;
+        do
+        {
+            batch_->reset();
+            received = ::recvmmsg(socket_, batch_->messages.data(), count, MSG_DONTWAIT, nullptr);
+            if (received > 0)
+            {
+                process_batch_(static_cast<uint32_t>(received));
+            }
+        } while (received == static_cast<int>(count) && !stop_.load());
+
+        if (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        {
+            logError(DDSROUTER_MMSG_TRANSPORT,
+                    "Failed to receive datagrams in port " << port_ << ": " << std::strerror(errno) << ".");
+            return;
+        }
+    }
+}
+
+void MmsgUdpReceiver::process_batch_(
+        const uint32_t received) noexcept
+{
+    for (uint32_t i = 0; i < received && !stop_.load(); ++i)
+    {
+        msghdr& header = batch_->messages[i].msg_hdr;
+        const uint32_t size = batch_->messages[i].msg_len;
+
+        if (header.msg_flags & MSG_TRUNC)
+        {
+            logWarning(DDSROUTER_MMSG_TRANSPORT,
+                    "Discarding datagram of port " << port_ << " larger than its receive buffer.");
+            continue;
+        }
+
+        // Datagrams coalesced by the kernel have the size of each of them (but the last) in the ancillary data
+        uint32_t segment_size = size;
+        for (cmsghdr* control = CMSG_FIRSTHDR(&header); control != nullptr; control = CMSG_NXTHDR(&header, control))
+        {
+            if (control->cmsg_level == SOL_UDP && control->cmsg_type == UDP_GRO)
+            {
+                int gro_size = 0;
+                std::memcpy(&gro_size, CMSG_DATA(control), sizeof(gro_size));
+                if (gro_size > 0)
+                {
+                    segment_size = static_cast<uint32_t>(gro_size);
+                }
+            }
+        }
+
+        if (segment_size > max_datagram_size_)
+        {
+            logWarning(DDSROUTER_MMSG_TRANSPORT,
+                    "Discarding datagram of port " << port_ << " larger than its receive buffer.");
+            continue;
+        }
+
+        const UdpEndpoint source = to_endpoint(batch_->sources[i]);
+        const uint8_t* data = static_cast<const uint8_t*>(batch_->data[i].iov_base);
+
+        uint32_t offset = 0;
+        do
+        {
+            const uint32_t datagram_size = std::min(segment_size, size - offset);
+            callback_(data + offset, datagram_size, source);
+            offset += datagram_size;
+        } while (offset < size);
+    }
+}
+
+#else
+
+struct MmsgUdpReceiver::Batch
+{
+};
+
+MmsgUdpSender::MmsgUdpSender(
+        const UdpSocketOptions&,
+        const uint32_t batch_size /* = MMSG_DEFAULT_BATCH_SIZE */,
+        const bool /* = true */)
+    : batch_size_(batch_size)
+{
+    throw utils::InitializationException("mmsg transport is only available in Linux.");
+}
+
+MmsgUdpSender::~MmsgUdpSender()
+{
+}
+
+bool MmsgUdpSender::send_to(
+        const void*,
+        const uint32_t,
+        const std::vector<UdpEndpoint>&) noexcept
+{
+    return false;
+}
+
+bool MmsgUdpSender::offload() const noexcept
+{
+    return false;
+}
+
+bool MmsgUdpSender::send_datagrams_(
+        const std::vector<Datagram>&) noexcept
+{
+    return false;
+}
+
+MmsgUdpReceiver::MmsgUdpReceiver(
+        const UdpEndpoint&,
+        const std::vector<UdpEndpoint>&,
+        const uint32_t max_datagram_size,
+        const UdpSocketOptions&,
+        const uint32_t,
+        const bool,
+        const DatagramCallback& callback)
+    : max_datagram_size_(max_datagram_size)
+    , callback_(callback)
+{
+    throw utils::InitializationException("mmsg transport is only available in Linux.");
+}
+
+MmsgUdpReceiver::~MmsgUdpReceiver()
+{
+}
+
+void MmsgUdpReceiver::run_() noexcept
+{
+}
+
+void MmsgUdpReceiver::process_batch_(
+        const uint32_t) noexcept
+{
+}
+
+#endif // if defined(__linux__)
+
+uint16_t MmsgUdpReceiver::port() const noexcept
+{
+    return port_;
+}
+
+bool MmsgUdpReceiver::offload() const noexcept
+{
+    return offload_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,219 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file UdpBackend.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
+#include <cerrno>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/transport/UdpBackend.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+bool UdpEndpoint::is_multicast() const noexcept
+{
+    return address[0] >= 224 && address[0] <= 239;
+}
+
+bool UdpEndpoint::is_any() const noexcept
+{
+    return address == std::array<uint8_t, 4>{};
+}
+
+bool UdpEndpoint::operator ==(
+        const UdpEndpoint& other) const noexcept
+{
+    return address == other.address && port == other.port;
+}
+
+#if defined(__linux__)
+
+namespace {
+
+//! Set an option of \c socket , throwing if it fails
+void set_socket_option(
+        const int socket,
+        const int level,
+        const int name,
+        const void* value,
+        const socklen_t size,
+        const char* description)
+{
+    if (::setsockopt(socket, level, name, value, size) != 0)
+    {
+        const int error = errno;
+        ::close(socket);
+        throw utils::InitializationException(
+                  utils::Formatter() << "Failed to set " << description << " of UDP socket: "
+                                     << std::strerror(error) << ".");
+    }
+}
+
+//! Set the buffer sizes of \c options in \c socket
+void set_buffer_sizes(
+        const int socket,
+        const UdpSocketOptions& options)
+{
+    if (options.send_buffer_size > 0)
+    {
+        const int size = static_cast<int>(options.send_buffer_size);
+        set_socket_option(socket, SOL_SOCKET, SO_SNDBUF, &size, sizeof(size), "send buffer size");
+    }
+
+    if (options.receive_buffer_size > 0)
+    {
+        const int size = static_cast<int>(options.receive_buffer_size);
+        set_socket_option(socket, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size), "receive buffer size");
+    }
+}
+
+//! Set the busy poll and type of service of \c options in \c socket
+void set_quality_of_service(
+        const int socket,
+        const UdpSocketOptions& options)
+{
+    if (options.busy_poll > 0)
+    {
+        // It requires privileges, so the socket is still usable without it
+        const int busy_poll = static_cast<int>(options.busy_poll);
+        if (::setsockopt(socket, SOL_SOCKET, SO_BUSY_POLL, &busy_poll, sizeof(busy_poll)) != 0)
+        {
+            logWarning(DDSROUTER_UDP_TRANSPORT,
+                    "Failed to set busy poll of UDP socket: " << std::strerror(errno) << ".");
+        }
+    }
+
+    if (options.type_of_service > 0)
+    {
+        const int type_of_service = options.type_of_service;
+        set_socket_option(socket, IPPROTO_IP, IP_TOS, &type_of_service, sizeof(type_of_service), "type of service");
+    }
+}
+
+} /* namespace */
+
+int open_udp_sender_socket(
+        const UdpSocketOptions& options)
+{
+    const int new_socket = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, IPPROTO_UDP);
+    if (new_socket < 0)
+    {
+        throw utils::InitializationException("Failed to create UDP socket.");
+    }
+
+    set_buffer_sizes(new_socket, options);
+    set_quality_of_service(new_socket, options);
+
+    const unsigned char ttl = options.multicast_ttl;
+    set_socket_option(new_socket, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl), "multicast time to live");
+
+    return new_socket;
+}
+
+int open_udp_receiver_socket(
+        const UdpEndpoint& endpoint,
+        const std::vector<UdpEndpoint>& interfaces,
+        const UdpSocketOptions& options)
+{
+    const int new_socket = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, IPPROTO_UDP);
+    if (new_socket < 0)
+    {
+        throw utils::InitializationException("Failed to create UDP socket.");
+    }
+
+    set_buffer_sizes(new_socket, options);
+    set_quality_of_service(new_socket, options);
+
+    sockaddr_in address {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(endpoint.port);
+
+    if (endpoint.is_multicast())
+    {
+        // Every participant of the host listens in the multicast port
+        const int reuse = 1;
+        set_socket_option(new_socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse), "address reuse");
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+    }
+    else
+    {
+        std::memcpy(&address.sin_addr.s_addr, endpoint.address.data(), endpoint.address.size());
+    }
+
+    if (::bind(new_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        const int error = errno;
+        ::close(new_socket);
+        throw utils::InitializationException(
+                  utils::Formatter() << "Failed to bind UDP socket to port " << endpoint.port << ": "
+                                     << std::strerror(error) << ".");
+    }
+
+    if (endpoint.is_multicast())
+    {
+        std::vector<UdpEndpoint> join_interfaces = interfaces;
+        if (join_interfaces.empty())
+        {
+            join_interfaces.push_back(UdpEndpoint());
+        }
+
+        for (const auto& interface : join_interfaces)
+        {
+            ip_mreq membership {};
+            std::memcpy(&membership.imr_multiaddr.s_addr, endpoint.address.data(), endpoint.address.size());
+            std::memcpy(&membership.imr_interface.s_addr, interface.address.data(), interface.address.size());
+            set_socket_option(new_socket, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership),
+                    "multicast membership");
+        }
+    }
+
+    return new_socket;
+}
+
+#else
+
+int open_udp_sender_socket(
+        const UdpSocketOptions&)
+{
+    throw utils::InitializationException("UDP I/O backends are only available in Linux.");
+}
+
+int open_udp_receiver_socket(
+        const UdpEndpoint&,
+        const std::vector<UdpEndpoint>&,
+        const UdpSocketOptions&)
+{
+    throw utils::InitializationException("UDP I/O backends are only available in Linux.");
+}
+
+#endif // if defined(__linux__)
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,597 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file UdpTransport.cpp
+ *
+ */
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#endif // if !defined(_WIN32)
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/transport/IoUringUdp.hpp>
+#include <ddsrouter_core/transport/MmsgUdp.hpp>
+#include <ddsrouter_core/transport/UdpTransport.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Multicast group of the default metatraffic locators, as in the Fast DDS UDPv4 transport
+const UdpEndpoint DEFAULT_MULTICAST_GROUP {{239, 255, 0, 1}, 0};
+
+//! Loopback address
+const UdpEndpoint LOCALHOST {{127, 0, 0, 1}, 0};
+
+//! Offset of the IPv4 address in the address of a locator
+constexpr std::size_t IPV4_ADDRESS_OFFSET = 12;
+
+//! Output channel of a \c UdpTransport , that sends through the socket of the transport
+class UdpSenderResource : public fastrtps::rtps::SenderResource
+{
+public:
+
+    UdpSenderResource(
+            UdpTransport& transport)
+        : fastrtps::rtps::SenderResource(transport.kind())
+    {
+        // The socket belongs to the transport, so there is nothing to clean
+        clean_up = []()
+                {
+                };
+
+        send_lambda_ = [&transport](
+            const fastrtps::rtps::octet* data,
+            uint32_t size,
+            fastrtps::rtps::LocatorsIterator* begin,
+            fastrtps::rtps::LocatorsIterator* end,
+            const std::chrono::steady_clock::time_point&) -> bool
+                {
+                    return transport.send(data, size, begin, end);
+                };
+    }
+
+};
+
+//! Endpoint of a UDPv4 locator
+UdpEndpoint to_endpoint(
+        const fastrtps::rtps::Locator_t& locator) noexcept
+{
+    UdpEndpoint endpoint;
+    std::copy_n(locator.address + IPV4_ADDRESS_OFFSET, endpoint.address.size(), endpoint.address.begin());
+    endpoint.port = static_cast<uint16_t>(locator.port);
+    return endpoint;
+}
+
+//! UDPv4 locator of an endpoint
+fastrtps::rtps::Locator_t to_locator(
+        const UdpEndpoint& endpoint) noexcept
+{
+    fastrtps::rtps::Locator_t locator(LOCATOR_KIND_UDPv4, endpoint.port);
+    std::copy(endpoint.address.begin(), endpoint.address.end(), locator.address + IPV4_ADDRESS_OFFSET);
+    return locator;
+}
+
+//! Addresses of the IPv4 interfaces up in the host whose name or address is in \c whitelist (all if it is empty)
+std::vector<UdpEndpoint> local_interfaces(
+        const std::vector<std::string>& whitelist)
+{
+    std::vector<UdpEndpoint> interfaces;
+
+#if !defined(_WIN32)
+    ifaddrs* addresses = nullptr;
+    if (::getifaddrs(&addresses) != 0)
+    {
+        return interfaces;
+    }
+
+    for (ifaddrs* it = addresses; it != nullptr; it = it->ifa_next)
+    {
+        if (it->ifa_addr == nullptr || it->ifa_addr->sa_family != AF_INET || !(it->ifa_flags & IFF_UP))
+        {
+            continue;
+        }
+
+        const sockaddr_in* address = reinterpret_cast<const sockaddr_in*>(it->ifa_addr);
+        char address_string[INET_ADDRSTRLEN] = {};
+        ::inet_ntop(AF_INET, &address->sin_addr, address_string, sizeof(address_string));
+
+        if (!whitelist.empty() &&
+                std::find(whitelist.begin(), whitelist.end(), it->ifa_name) == whitelist.end() &&
+                std::find(whitelist.begin(), whitelist.end(), address_string) == whitelist.end())
+        {
+            continue;
+        }
+
+        UdpEndpoint endpoint;
+        std::memcpy(endpoint.address.data(), &address->sin_addr.s_addr, endpoint.address.size());
+        if (std::find(interfaces.begin(), interfaces.end(), endpoint) == interfaces.end())
+        {
+            interfaces.push_back(endpoint);
+        }
+    }
+
+    ::freeifaddrs(addresses);
+#endif // if !defined(_WIN32)
+
+    return interfaces;
+}
+
+//! Whether \c endpoint is in the loopback network
+bool is_loopback(
+        const UdpEndpoint& endpoint) noexcept
+{
+    return endpoint.address[0] == 127;
+}
+
+} /* namespace */
+
+UdpTransport::UdpTransport(
+        const UdpTransportDescriptor& descriptor)
+    : fastdds::rtps::TransportInterface(LOCATOR_KIND_UDPv4)
+    , configuration_(descriptor)
+{
+}
+
+UdpTransport::~UdpTransport()
+{
+    // Stop the receivers before the sender is closed
+    std::lock_guard<std::mutex> lock(input_channels_mutex_);
+    input_channels_.clear();
+}
+
+bool UdpTransport::init(
+        const fastrtps::rtps::PropertyPolicy* /* properties */)
+{
+    interfaces_ = local_interfaces(configuration_.interfaceWhiteList);
+
+    try
+    {
+        switch (configuration_.backend)
+        {
+            case UdpIoBackend::io_uring:
+                sender_.reset(new IoUringUdpSender(socket_options_(), configuration_.ring_entries,
+                        configuration_.sqpoll));
+                break;
+
+            case UdpIoBackend::mmsg:
+                sender_.reset(new MmsgUdpSender(socket_options_(), configuration_.batch_size,
+                        configuration_.offload));
+                break;
+
+            default:
+                logError(DDSROUTER_UDP_TRANSPORT, "UDP transport created for the Fast DDS I/O backend.");
+                return false;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        logError(DDSROUTER_UDP_TRANSPORT, "Error initializing UDP transport: " << e.what());
+        return false;
+    }
+
+    return true;
+}
+
+bool UdpTransport::IsInputChannelOpen(
+        const fastrtps::rtps::Locator_t& locator) const
+{
+    std::lock_guard<std::mutex> lock(input_channels_mutex_);
+    return IsLocatorSupported(locator) && input_channels_.count(input_channel_key_(locator)) > 0;
+}
+
+bool UdpTransport::IsLocatorSupported(
+        const fastrtps::rtps::Locator_t& locator) const
+{
+    return locator.kind == kind();
+}
+
+bool UdpTransport::is_locator_allowed(
+        const fastrtps::rtps::Locator_t& locator) const
+{
+    return IsLocatorSupported(locator) && (to_endpoint(locator).is_multicast() || is_interface_allowed_(locator));
+}
+
+fastrtps::rtps::Locator_t UdpTransport::RemoteToMainLocal(
+        const fastrtps::rtps::Locator_t& remote) const
+{
+    return fastrtps::rtps::Locator_t(kind(), remote.port);
+}
+
+bool UdpTransport::OpenOutputChannel(
+        fastdds::rtps::SendResourceList& sender_resource_list,
+        const fastrtps::rtps::Locator_t& locator)
+{
+    if (!IsLocatorSupported(locator))
+    {
+        return false;
+    }
+
+    // Every locator is reached through the same socket
+    for (const auto& sender_resource : sender_resource_list)
+    {
+        if (sender_resource->kind() == kind())
+        {
+            return true;
+        }
+    }
+
+    sender_resource_list.emplace_back(new UdpSenderResource(*this));
+    return true;
+}
+
+bool UdpTransport::OpenInputChannel(
+        const fastrtps::rtps::Locator_t& locator,
+        fastdds::rtps::TransportReceiverInterface* receiver,
+        uint32_t max_message_size)
+{
+    if (!is_locator_allowed(locator))
+    {
+        return false;
+    }
+
+    const auto key = input_channel_key_(locator);
+
+    std::lock_guard<std::mutex> lock(input_channels_mutex_);
+    if (input_channels_.count(key) > 0)
+    {
+        return true;
+    }
+
+    UdpEndpoint endpoint;
+    endpoint.address = key.second;
+    endpoint.port = static_cast<uint16_t>(key.first);
+
+    // Multicast is joined in the interfaces of the whitelist, or in the default one
+    const std::vector<UdpEndpoint> join_interfaces =
+            configuration_.interfaceWhiteList.empty() ? std::vector<UdpEndpoint>() : interfaces_;
+
+    auto callback = [receiver, locator](const uint8_t* data, uint32_t size, const UdpEndpoint& source)
+            {
+                receiver->OnDataReceived(data, size, locator, to_locator(source));
+            };
+
+    try
+    {
+        switch (configuration_.backend)
+        {
+            case UdpIoBackend::io_uring:
+                input_channels_[key].reset(new IoUringUdpReceiver(
+                            endpoint, join_interfaces, max_message_size, socket_options_(),
+                            configuration_.ring_entries, callback));
+                break;
+
+            case UdpIoBackend::mmsg:
+                input_channels_[key].reset(new MmsgUdpReceiver(
+                            endpoint, join_interfaces, max_message_size, socket_options_(),
+                            configuration_.batch_size, configuration_.offload, callback));
+                break;
+
+            default:
+                return false;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        // The port may be used by another participant, so Fast DDS tries the next one
+        logDebug(DDSROUTER_UDP_TRANSPORT, "Cannot open input channel in port " << locator.port << ": " << e.what());
+        input_channels_.erase(key);
+        return false;
+    }
+
+    return true;
+}
+
+bool UdpTransport::CloseInputChannel(
+        const fastrtps::rtps::Locator_t& locator)
+{
+    std::unique_ptr<IUdpReceiver> input_channel;
+    {
+        std::lock_guard<std::mutex> lock(input_channels_mutex_);
+        auto it = input_channels_.find(input_channel_key_(locator));
+        if (!IsLocatorSupported(locator) || it == input_channels_.end())
+        {
+            return false;
+        }
+        input_channel = std::move(it->second);
+        input_channels_.erase(it);
+    }
+
+    // The receiver thread is stopped out of the lock, as it may be delivering a message
+    input_channel.reset();
+    return true;
+}
+
+bool UdpTransport::DoInputLocatorsMatch(
+        const fastrtps::rtps::Locator_t& left,
+        const fastrtps::rtps::Locator_t& right) const
+{
+    return IsLocatorSupported(left) && IsLocatorSupported(right) && left.port == right.port;
+}
+
+fastrtps::rtps::LocatorList_t UdpTransport::NormalizeLocator(
+        const fastrtps::rtps::Locator_t& locator)
+{
+    fastrtps::rtps::LocatorList_t list;
+
+    if (!to_endpoint(locator).is_any())
+    {
+        list.push_back(locator);
+        return list;
+    }
+
+    // A locator in every interface is announced as one per interface, but loopback
+    for (const auto& interface : interfaces_)
+    {
+        if (!is_loopback(interface))
+        {
+            UdpEndpoint endpoint = interface;
+            endpoint.port = static_cast<uint16_t>(locator.port);
+            list.push_back(to_locator(endpoint));
+        }
+    }
+
+    if (list.empty())
+    {
+        UdpEndpoint endpoint = LOCALHOST;
+        endpoint.port = static_cast<uint16_t>(locator.port);
+        list.push_back(to_locator(endpoint));
+    }
+
+    return list;
+}
+
+bool UdpTransport::is_local_locator(
+        const fastrtps::rtps::Locator_t& locator) const
+{
+    const UdpEndpoint endpoint = to_endpoint(locator);
+    if (is_loopback(endpoint))
+    {
+        return true;
+    }
+
+    return std::any_of(interfaces_.begin(), interfaces_.end(), [&endpoint](const UdpEndpoint& interface)
+                   {
+                       return interface.address == endpoint.address;
+                   });
+}
+
+fastdds::rtps::TransportDescriptorInterface* UdpTransport::get_configuration()
+{
+    return &configuration_;
+}
+
+void UdpTransport::AddDefaultOutputLocator(
+        fastrtps::rtps::LocatorList_t& default_list)
+{
+    UdpEndpoint endpoint = DEFAULT_MULTICAST_GROUP;
+    endpoint.port = configuration_.m_output_udp_socket;
+    default_list.push_back(to_locator(endpoint));
+}
+
+bool UdpTransport::getDefaultMetatrafficMulticastLocators(
+        fastrtps::rtps::LocatorList_t& locators,
+        uint32_t metatraffic_multicast_port) const
+{
+    UdpEndpoint endpoint = DEFAULT_MULTICAST_GROUP;
+    endpoint.port = static_cast<uint16_t>(metatraffic_multicast_port);
+    locators.push_back(to_locator(endpoint));
+    return true;
+}
+
+bool UdpTransport::getDefaultMetatrafficUnicastLocators(
+        fastrtps::rtps::LocatorList_t& locators,
+        uint32_t metatraffic_unicast_port) const
+{
+    return getDefaultUnicastLocators(locators, metatraffic_unicast_port);
+}
+
+bool UdpTransport::getDefaultUnicastLocators(
+        fastrtps::rtps::LocatorList_t& locators,
+        uint32_t unicast_port) const
+{
+    if (configuration_.interfaceWhiteList.empty())
+    {
+        locators.push_back(fastrtps::rtps::Locator_t(kind(), unicast_port));
+        return true;
+    }
+
+    for (const auto& interface : interfaces_)
+    {
+        UdpEndpoint endpoint = interface;
+        endpoint.port = static_cast<uint16_t>(unicast_port);
+        locators.push_back(to_locator(endpoint));
+    }
+    return true;
+}
+
+bool UdpTransport::fillMetatrafficMulticastLocator(
+        fastrtps::rtps::Locator_t& locator,
+        uint32_t metatraffic_multicast_port) const
+{
+    if (locator.port == 0)
+    {
+        locator.port = metatraffic_multicast_port;
+    }
+    return true;
+}
+
+bool UdpTransport::fillMetatrafficUnicastLocator(
+        fastrtps::rtps::Locator_t& locator,
+        uint32_t metatraffic_unicast_port) const
+{
+    if (locator.port == 0)
+    {
+        locator.port = metatraffic_unicast_port;
+    }
+    return true;
+}
+
+bool UdpTransport::configureInitialPeerLocator(
+        fastrtps::rtps::Locator_t& locator,
+        const fastrtps::rtps::PortParameters& port_params,
+        uint32_t domain_id,
+        fastrtps::rtps::LocatorList_t& list) const
+{
+    if (locator.port != 0)
+    {
+        list.push_back(locator);
+        return true;
+    }
+
+    // Without port, reach the first participants of the domain in that address
+    for (uint32_t participant_id = 0; participant_id < configuration_.max_initial_peers_range(); ++participant_id)
+    {
+        fastrtps::rtps::Locator_t peer = locator;
+        peer.port = port_params.getUnicastPort(domain_id, participant_id);
+        list.push_back(peer);
+    }
+    return true;
+}
+
+bool UdpTransport::fillUnicastLocator(
+        fastrtps::rtps::Locator_t& locator,
+        uint32_t well_known_port) const
+{
+    if (locator.port == 0)
+    {
+        locator.port = well_known_port;
+    }
+    return true;
+}
+
+uint32_t UdpTransport::max_recv_buffer_size() const
+{
+    return configuration_.max_message_size();
+}
+
+void UdpTransport::select_locators(
+        fastrtps::rtps::LocatorSelector& selector) const
+{
+    auto& entries = selector.transport_starts();
+
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        auto* entry = entries[i];
+        if (!entry->transport_should_process)
+        {
+            continue;
+        }
+
+        bool selected = false;
+        for (size_t j = 0; j < entry->unicast.size(); ++j)
+        {
+            if (IsLocatorSupported(entry->unicast[j]) && !selector.is_selected(entry->unicast[j]))
+            {
+                entry->state.unicast.push_back(j);
+                selected = true;
+            }
+        }
+
+        // Multicast only reaches the entries without unicast locators
+        for (size_t j = 0; !selected && j < entry->multicast.size(); ++j)
+        {
+            if (IsLocatorSupported(entry->multicast[j]))
+            {
+                if (!selector.is_selected(entry->multicast[j]))
+                {
+                    entry->state.multicast.push_back(j);
+                }
+                selected = true;
+            }
+        }
+
+        if (selected)
+        {
+            selector.select(i);
+        }
+    }
+}
+
+bool UdpTransport::send(
+        const fastrtps::rtps::octet* data,
+        uint32_t size,
+        fastrtps::rtps::LocatorsIterator* begin,
+        fastrtps::rtps::LocatorsIterator* end) noexcept
+{
+    if (!sender_)
+    {
+        return false;
+    }
+
+    std::vector<UdpEndpoint> destinations;
+    fastrtps::rtps::LocatorsIterator& it = *begin;
+    while (it != *end)
+    {
+        if (IsLocatorSupported(*it) && !to_endpoint(*it).is_any())
+        {
+            destinations.push_back(to_endpoint(*it));
+        }
+        ++it;
+    }
+
+    // Every destination at once, that the backend may send in a single system call
+    sender_->send_to(data, size, destinations);
+    return true;
+}
+
+UdpSocketOptions UdpTransport::socket_options_() const
+{
+    UdpSocketOptions options;
+    options.send_buffer_size = configuration_.sendBufferSize;
+    options.receive_buffer_size = configuration_.receiveBufferSize;
+    options.multicast_ttl = configuration_.TTL;
+    options.busy_poll = configuration_.busy_poll;
+    options.type_of_service = configuration_.type_of_service;
+    return options;
+}
+
+std::pair<uint32_t, std::array<uint8_t, 4>> UdpTransport::input_channel_key_(
+        const fastrtps::rtps::Locator_t& locator)
+{
+    const UdpEndpoint endpoint = to_endpoint(locator);
+    return {locator.port, endpoint.is_multicast() ? endpoint.address : std::array<uint8_t, 4>{}};
+}
+
+bool UdpTransport::is_interface_allowed_(
+        const fastrtps::rtps::Locator_t& locator) const
+{
+    if (configuration_.interfaceWhiteList.empty())
+    {
+        return true;
+    }
+
+    const UdpEndpoint endpoint = to_endpoint(locator);
+    return std::any_of(interfaces_.begin(), interfaces_.end(), [&endpoint](const UdpEndpoint& interface)
+                   {
+                       return interface.address == endpoint.address;
+                   });
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
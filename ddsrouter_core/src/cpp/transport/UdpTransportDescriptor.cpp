@@ -0,0 +1,45 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file UdpTransportDescriptor.cpp
+ *
+ */
+
+#include <ddsrouter_core/transport/UdpTransport.hpp>
+#include <ddsrouter_core/transport/UdpTransportDescriptor.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+UdpTransportDescriptor::UdpTransportDescriptor(
+        const fastdds::rtps::UDPv4TransportDescriptor& descriptor)
+    : fastdds::rtps::UDPv4TransportDescriptor(descriptor)
+{
+}
+
+fastdds::rtps::TransportInterface* UdpTransportDescriptor::create_transport() const
+{
+    if (backend == UdpIoBackend::fastdds)
+    {
+        return fastdds::rtps::UDPv4TransportDescriptor::create_transport();
+    }
+
+    return new UdpTransport(*this);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
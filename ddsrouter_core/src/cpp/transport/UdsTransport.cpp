@@ -0,0 +1,376 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file UdsTransport.cpp
+ *
+ */
+
+#include <chrono>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/transport/UdsTransport.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Output channel of a \c UdsTransport , that sends through the socket of the transport
+class UdsSenderResource : public fastrtps::rtps::SenderResource
+{
+public:
+
+    UdsSenderResource(
+            UdsTransport& transport)
+        : fastrtps::rtps::SenderResource(transport.kind())
+    {
+        // The socket belongs to the transport, so there is nothing to clean
+        clean_up = []()
+                {
+                };
+
+        send_lambda_ = [&transport](
+            const fastrtps::rtps::octet* data,
+            uint32_t size,
+            fastrtps::rtps::LocatorsIterator* begin,
+            fastrtps::rtps::LocatorsIterator* end,
+            const std::chrono::steady_clock::time_point&) -> bool
+                {
+                    return transport.send(data, size, begin, end);
+                };
+    }
+
+};
+
+} /* namespace */
+
+UdsTransport::UdsTransport(
+        const UdsTransportDescriptor& descriptor)
+    : fastdds::rtps::TransportInterface(LOCATOR_KIND_UDS)
+    , configuration_(descriptor)
+{
+}
+
+UdsTransport::~UdsTransport()
+{
+    // Stop the receivers before the sender is closed
+    std::lock_guard<std::mutex> lock(input_channels_mutex_);
+    input_channels_.clear();
+}
+
+bool UdsTransport::init(
+        const fastrtps::rtps::PropertyPolicy* /* properties */)
+{
+    try
+    {
+        sender_.reset(new UnixSocketSender(configuration_.memfd_threshold));
+    }
+    catch (const std::exception& e)
+    {
+        logError(DDSROUTER_UDS_TRANSPORT, "Error initializing Unix domain socket transport: " << e.what());
+        return false;
+    }
+
+    return true;
+}
+
+bool UdsTransport::IsInputChannelOpen(
+        const fastrtps::rtps::Locator_t& locator) const
+{
+    std::lock_guard<std::mutex> lock(input_channels_mutex_);
+    return IsLocatorSupported(locator) && input_channels_.count(locator.port) > 0;
+}
+
+bool UdsTransport::IsLocatorSupported(
+        const fastrtps::rtps::Locator_t& locator) const
+{
+    return locator.kind == kind();
+}
+
+bool UdsTransport::is_locator_allowed(
+        const fastrtps::rtps::Locator_t& locator) const
+{
+    return IsLocatorSupported(locator);
+}
+
+fastrtps::rtps::Locator_t UdsTransport::RemoteToMainLocal(
+        const fastrtps::rtps::Locator_t& remote) const
+{
+    return fastrtps::rtps::Locator_t(kind(), remote.port);
+}
+
+bool UdsTransport::OpenOutputChannel(
+        fastdds::rtps::SendResourceList& sender_resource_list,
+        const fastrtps::rtps::Locator_t& locator)
+{
+    if (!IsLocatorSupported(locator))
+    {
+        return false;
+    }
+
+    // Every locator is reached through the same socket
+    for (const auto& sender_resource : sender_resource_list)
+    {
+        if (sender_resource->kind() == kind())
+        {
+            return true;
+        }
+    }
+
+    sender_resource_list.emplace_back(new UdsSenderResource(*this));
+    return true;
+}
+
+bool UdsTransport::OpenInputChannel(
+        const fastrtps::rtps::Locator_t& locator,
+        fastdds::rtps::TransportReceiverInterface* receiver,
+        uint32_t max_message_size)
+{
+    if (!IsLocatorSupported(locator))
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(input_channels_mutex_);
+    if (input_channels_.count(locator.port) > 0)
+    {
+        return true;
+    }
+
+    // The sender socket is not bound, so the remote locator only tells the kind
+    const fastrtps::rtps::Locator_t remote_locator(kind(), 0);
+
+    try
+    {
+        input_channels_[locator.port].reset(new UnixSocketReceiver(
+                    socket_path(locator.port),
+                    max_message_size,
+                    [receiver, locator, remote_locator](const uint8_t* data, uint32_t size)
+                    {
+                        receiver->OnDataReceived(data, size, locator, remote_locator);
+                    }));
+    }
+    catch (const std::exception& e)
+    {
+        // The port may be used by another participant, so Fast DDS tries the next one
+        logDebug(DDSROUTER_UDS_TRANSPORT, "Cannot open input channel in port " << locator.port << ": " << e.what());
+        input_channels_.erase(locator.port);
+        return false;
+    }
+
+    return true;
+}
+
+bool UdsTransport::CloseInputChannel(
+        const fastrtps::rtps::Locator_t& locator)
+{
+    std::unique_ptr<UnixSocketReceiver> input_channel;
+    {
+        std::lock_guard<std::mutex> lock(input_channels_mutex_);
+        auto it = input_channels_.find(locator.port);
+        if (!IsLocatorSupported(locator) || it == input_channels_.end())
+        {
+            return false;
+        }
+        input_channel = std::move(it->second);
+        input_channels_.erase(it);
+    }
+
+    // The receiver thread is stopped out of the lock, as it may be delivering a message
+    input_channel.reset();
+    return true;
+}
+
+bool UdsTransport::DoInputLocatorsMatch(
+        const fastrtps::rtps::Locator_t& left,
+        const fastrtps::rtps::Locator_t& right) const
+{
+    return IsLocatorSupported(left) && IsLocatorSupported(right) && left.port == right.port;
+}
+
+fastrtps::rtps::LocatorList_t UdsTransport::NormalizeLocator(
+        const fastrtps::rtps::Locator_t& locator)
+{
+    fastrtps::rtps::LocatorList_t list;
+    list.push_back(locator);
+    return list;
+}
+
+bool UdsTransport::is_local_locator(
+        const fastrtps::rtps::Locator_t& /* locator */) const
+{
+    // Every socket file is in this host
+    return true;
+}
+
+fastdds::rtps::TransportDescriptorInterface* UdsTransport::get_configuration()
+{
+    return &configuration_;
+}
+
+void UdsTransport::AddDefaultOutputLocator(
+        fastrtps::rtps::LocatorList_t& /* default_list */)
+{
+    // There is no multicast, so there is no default output locator
+}
+
+bool UdsTransport::getDefaultMetatrafficMulticastLocators(
+        fastrtps::rtps::LocatorList_t& /* locators */,
+        uint32_t /* metatraffic_multicast_port */) const
+{
+    // There is no multicast, the participants are discovered through the initial peers
+    return true;
+}
+
+bool UdsTransport::getDefaultMetatrafficUnicastLocators(
+        fastrtps::rtps::LocatorList_t& locators,
+        uint32_t metatraffic_unicast_port) const
+{
+    locators.push_back(fastrtps::rtps::Locator_t(kind(), metatraffic_unicast_port));
+    return true;
+}
+
+bool UdsTransport::getDefaultUnicastLocators(
+        fastrtps::rtps::LocatorList_t& locators,
+        uint32_t unicast_port) const
+{
+    locators.push_back(fastrtps::rtps::Locator_t(kind(), unicast_port));
+    return true;
+}
+
+bool UdsTransport::fillMetatrafficMulticastLocator(
+        fastrtps::rtps::Locator_t& locator,
+        uint32_t metatraffic_multicast_port) const
+{
+    if (locator.port == 0)
+    {
+        locator.port = metatraffic_multicast_port;
+    }
+    return true;
+}
+
+bool UdsTransport::fillMetatrafficUnicastLocator(
+        fastrtps::rtps::Locator_t& locator,
+        uint32_t metatraffic_unicast_port) const
+{
+    if (locator.port == 0)
+    {
+        locator.port = metatraffic_unicast_port;
+    }
+    return true;
+}
+
+bool UdsTransport::configureInitialPeerLocator(
+        fastrtps::rtps::Locator_t& locator,
+        const fastrtps::rtps::PortParameters& port_params,
+        uint32_t domain_id,
+        fastrtps::rtps::LocatorList_t& list) const
+{
+    if (locator.port != 0)
+    {
+        list.push_back(locator);
+        return true;
+    }
+
+    // Without port, reach the first participants of the domain
+    for (uint32_t participant_id = 0; participant_id < configuration_.max_initial_peers_range(); ++participant_id)
+    {
+        list.push_back(fastrtps::rtps::Locator_t(kind(), port_params.getUnicastPort(domain_id, participant_id)));
+    }
+    return true;
+}
+
+bool UdsTransport::fillUnicastLocator(
+        fastrtps::rtps::Locator_t& locator,
+        uint32_t well_known_port) const
+{
+    if (locator.port == 0)
+    {
+        locator.port = well_known_port;
+    }
+    return true;
+}
+
+uint32_t UdsTransport::max_recv_buffer_size() const
+{
+    return configuration_.max_message_size();
+}
+
+void UdsTransport::select_locators(
+        fastrtps::rtps::LocatorSelector& selector) const
+{
+    auto& entries = selector.transport_starts();
+
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        auto* entry = entries[i];
+        if (!entry->transport_should_process)
+        {
+            continue;
+        }
+
+        // There is no multicast, so every unicast locator is selected
+        bool selected = false;
+        for (size_t j = 0; j < entry->unicast.size(); ++j)
+        {
+            if (IsLocatorSupported(entry->unicast[j]) && !selector.is_selected(entry->unicast[j]))
+            {
+                entry->state.unicast.push_back(j);
+                selected = true;
+            }
+        }
+
+        if (selected)
+        {
+            selector.select(i);
+        }
+    }
+}
+
+bool UdsTransport::send(
+        const fastrtps::rtps::octet* data,
+        uint32_t size,
+        fastrtps::rtps::LocatorsIterator* begin,
+        fastrtps::rtps::LocatorsIterator* end) noexcept
+{
+    if (!sender_)
+    {
+        return false;
+    }
+
+    fastrtps::rtps::LocatorsIterator& it = *begin;
+    while (it != *end)
+    {
+        if (IsLocatorSupported(*it))
+        {
+            sender_->send_to(data, size, socket_path((*it).port));
+        }
+        ++it;
+    }
+
+    return true;
+}
+
+std::string UdsTransport::socket_path(
+        const uint32_t port) const
+{
+    return unix_socket_path(configuration_.socket_directory, port);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,45 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file UdsTransportDescriptor.cpp
+ *
+ */
+
+#include <ddsrouter_core/transport/UdsTransport.hpp>
+#include <ddsrouter_core/transport/UdsTransportDescriptor.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+UdsTransportDescriptor::UdsTransportDescriptor()
+    : fastdds::rtps::TransportDescriptorInterface(DEFAULT_MAX_MESSAGE_SIZE, DEFAULT_MAX_INITIAL_PEERS_RANGE)
+{
+}
+
+fastdds::rtps::TransportInterface* UdsTransportDescriptor::create_transport() const
+{
+    return new UdsTransport(*this);
+}
+
+uint32_t UdsTransportDescriptor::min_send_buffer_size() const
+{
+    // Messages are never buffered by the transport
+    return 0;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,402 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file UnixSocket.cpp
+ *
+ */
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/time/time_utils.hpp>
+
+#include <ddsrouter_core/transport/UnixSocket.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+namespace {
+
+//! Maximum time the internal thread waits before checking whether it must stop
+constexpr utils::Duration_ms POLL_PERIOD = 100;
+
+#if defined(__linux__)
+
+//! Fill \c address with \c path , if it fits
+bool fill_address(
+        const std::string& path,
+        sockaddr_un& address) noexcept
+{
+    if (path.empty() || path.size() > UNIX_SOCKET_MAX_PATH_SIZE || path.size() >= sizeof(address.sun_path))
+    {
+        return false;
+    }
+
+    address = {};
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size());
+    return true;
+}
+
+//! Write the whole buffer in \c fd
+bool write_all(
+        const int fd,
+        const uint8_t* data,
+        uint32_t size) noexcept
+{
+    while (size > 0)
+    {
+        const ssize_t written = ::write(fd, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<uint32_t>(written);
+    }
+    return true;
+}
+
+//! Whether the socket bound to \c address belongs to a process that has finished
+bool is_stale_socket(
+        const sockaddr_un& address) noexcept
+{
+    const int probe = ::socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (probe < 0)
+    {
+        return false;
+    }
+
+    const bool stale = ::connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 &&
+            errno == ECONNREFUSED;
+    ::close(probe);
+    return stale;
+}
+
+#endif // if defined(__linux__)
+
+} /* namespace */
+
+std::string unix_socket_path(
+        const std::string& directory,
+        const uint32_t port)
+{
+    return directory + "/ddsrouter_uds_" + std::to_string(port);
+}
+
+#if defined(__linux__)
+
+UnixSocketSender::UnixSocketSender(
+        const uint32_t memfd_threshold /* = UNIX_SOCKET_MAX_INLINE_SIZE */)
+    : memfd_threshold_(std::min(memfd_threshold, UNIX_SOCKET_MAX_INLINE_SIZE))
+{
+    socket_ = ::socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (socket_ < 0)
+    {
+        throw utils::InitializationException("Failed to create Unix domain socket.");
+    }
+}
+
+UnixSocketSender::~UnixSocketSender()
+{
+    ::close(socket_);
+}
+
+bool UnixSocketSender::send_to(
+        const void* data,
+        const uint32_t size,
+        const std::string& path) noexcept
+{
+    sockaddr_un address;
+    if (!fill_address(path, address))
+    {
+        return false;
+    }
+
+    if (size <= memfd_threshold_)
+    {
+        const ssize_t sent = ::sendto(
+            socket_,
+            data,
+            size,
+            MSG_DONTWAIT | MSG_NOSIGNAL,
+            reinterpret_cast<sockaddr*>(&address),
+            sizeof(address));
+
+        return sent >= 0 && static_cast<uint32_t>(sent) == size;
+    }
+
+    // Sealed so the receiver can map it without the size changing under its feet
+    const int fd = ::memfd_create("ddsrouter_uds", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    bool sent = false;
+    if (write_all(fd, static_cast<const uint8_t*>(data), size) &&
+            ::fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) == 0)
+    {
+        // The datagram carries the size of the message, and the file in its ancillary data
+        uint32_t header = size;
+        iovec iov {&header, sizeof(header)};
+
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+        msghdr message {};
+        message.msg_name = &address;
+        message.msg_namelen = sizeof(address);
+        message.msg_iov = &iov;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&message);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+        std::memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+
+        sent = ::sendmsg(socket_, &message, MSG_DONTWAIT | MSG_NOSIGNAL) == static_cast<ssize_t>(sizeof(header));
+    }
+
+    // The receiver keeps its own descriptor of the file
+    ::close(fd);
+    return sent;
+}
+
+UnixSocketReceiver::UnixSocketReceiver(
+        const std::string& path,
+        const uint32_t max_message_size,
+        const MessageCallback& callback)
+    : path_(path)
+    , max_message_size_(max_message_size)
+    , callback_(callback)
+    , buffer_(UNIX_SOCKET_MAX_INLINE_SIZE)
+{
+    sockaddr_un address;
+    if (!fill_address(path, address))
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Invalid Unix domain socket path " << path << ".");
+    }
+
+    socket_ = ::socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (socket_ < 0)
+    {
+        throw utils::InitializationException("Failed to create Unix domain socket.");
+    }
+
+    bool bound = ::bind(socket_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    if (!bound && errno == EADDRINUSE && is_stale_socket(address))
+    {
+        ::unlink(path.c_str());
+        bound = ::bind(socket_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    }
+
+    if (!bound)
+    {
+        const int error = errno;
+        ::close(socket_);
+        throw utils::InitializationException(
+                  utils::Formatter() << "Failed to bind Unix domain socket to " << path << ": "
+                                     << std::strerror(error) << ".");
+    }
+
+    thread_ = std::thread(&UnixSocketReceiver::run_, this);
+
+    logDebug(DDSROUTER_UDS_TRANSPORT, "Receiving messages in Unix domain socket " << path << ".");
+}
+
+UnixSocketReceiver::~UnixSocketReceiver()
+{
+    stop_.store(true);
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    ::close(socket_);
+    ::unlink(path_.c_str());
+}
+
+void UnixSocketReceiver::run_() noexcept
+{
+    pollfd fd {};
+    fd.fd = socket_;
+    fd.events = POLLIN;
+
+    while (!stop_.load())
+    {
+        if (::poll(&fd, 1, static_cast<int>(POLL_PERIOD)) > 0)
+        {
+            // Drain the queue before polling again
+            while (!stop_.load() && receive_())
+            {
+            }
+        }
+    }
+}
+
+bool UnixSocketReceiver::receive_() noexcept
+{
+    iovec iov {buffer_.data(), buffer_.size()};
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr message {};
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    const ssize_t received = ::recvmsg(socket_, &message, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+    if (received < 0)
+    {
+        return false;
+    }
+
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&message); cmsg != nullptr; cmsg = CMSG_NXTHDR(&message, cmsg))
+    {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS)
+        {
+            int fd;
+            std::memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+            receive_memfd_(fd);
+            return true;
+        }
+    }
+
+    if ((message.msg_flags & MSG_TRUNC) || static_cast<uint32_t>(received) > max_message_size_)
+    {
+        logWarning(DDSROUTER_UDS_TRANSPORT,
+                "Discarding message of Unix domain socket " << path_ << " larger than "
+                                                            << std::min(max_message_size_, UNIX_SOCKET_MAX_INLINE_SIZE)
+                                                            << " bytes.");
+        return true;
+    }
+
+    callback_(buffer_.data(), static_cast<uint32_t>(received));
+    return true;
+}
+
+void UnixSocketReceiver::receive_memfd_(
+        const int fd) noexcept
+{
+    struct stat file_stat;
+    const int seals = ::fcntl(fd, F_GET_SEALS);
+
+    // A file that could shrink while mapped would crash the reader
+    if (::fstat(fd, &file_stat) != 0 || seals < 0 || !(seals & F_SEAL_SHRINK) || file_stat.st_size <= 0 ||
+            static_cast<uint64_t>(file_stat.st_size) > max_message_size_)
+    {
+        logWarning(DDSROUTER_UDS_TRANSPORT,
+                "Discarding memory file of Unix domain socket " << path_ << " not sealed or larger than "
+                                                                << max_message_size_ << " bytes.");
+        ::close(fd);
+        return;
+    }
+
+    const std::size_t size = static_cast<std::size_t>(file_stat.st_size);
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping remains valid once the file is closed
+    ::close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        return;
+    }
+
+    callback_(static_cast<const uint8_t*>(mapping), static_cast<uint32_t>(size));
+    ::munmap(mapping, size);
+}
+
+#else
+
+UnixSocketSender::UnixSocketSender(
+        const uint32_t memfd_threshold /* = UNIX_SOCKET_MAX_INLINE_SIZE */)
+    : memfd_threshold_(memfd_threshold)
+{
+    throw utils::InitializationException("Unix domain socket transport is only available in Linux.");
+}
+
+UnixSocketSender::~UnixSocketSender()
+{
+}
+
+bool UnixSocketSender::send_to(
+        const void*,
+        const uint32_t,
+        const std::string&) noexcept
+{
+    return false;
+}
+
+UnixSocketReceiver::UnixSocketReceiver(
+        const std::string& path,
+        const uint32_t max_message_size,
+        const MessageCallback& callback)
+    : path_(path)
+    , max_message_size_(max_message_size)
+    , callback_(callback)
+{
+    throw utils::InitializationException("Unix domain socket transport is only available in Linux.");
+}
+
+UnixSocketReceiver::~UnixSocketReceiver()
+{
+}
+
+void UnixSocketReceiver::run_() noexcept
+{
+}
+
+bool UnixSocketReceiver::receive_() noexcept
+{
+    return false;
+}
+
+void UnixSocketReceiver::receive_memfd_(
+        const int) noexcept
+{
+}
+
+#endif // if defined(__linux__)
+
+const std::string& UnixSocketReceiver::path() const noexcept
+{
+    return path_;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,78 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file DdsRouterStatistics.cpp
+ *
+ */
+
+#include <ddsrouter_core/types/DdsRouterStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+TrafficStatistics& TrafficStatistics::operator +=(
+        const TrafficStatistics& other) noexcept
+{
+    samples_received += other.samples_received;
+    bytes_received += other.bytes_received;
+    samples_sent += other.samples_sent;
+    bytes_sent += other.bytes_sent;
+    for (std::size_t i = 0; i < dropped_samples.size(); ++i)
+    {
+        dropped_samples[i] += other.dropped_samples[i];
+    }
+    unread_samples += other.unread_samples;
+
+    return *this;
+}
+
+std::map<std::string, TrafficStatistics> DdsRouterStatistics::topics() const
+{
+    std::map<std::string, TrafficStatistics> result;
+
+    for (const auto& topic_it : traffic)
+    {
+        TrafficStatistics& topic_traffic = result[topic_it.first];
+        for (const auto& participant_it : topic_it.second)
+        {
+            topic_traffic += participant_it.second;
+        }
+    }
+
+    return result;
+}
+
+std::map<ddspipe::core::types::ParticipantId, TrafficStatistics> DdsRouterStatistics::participants() const
+{
+    std::map<ddspipe::core::types::ParticipantId, TrafficStatistics> result;
+
+    for (const auto& topic_it : traffic)
+    {
+        for (const auto& participant_it : topic_it.second)
+        {
+            result[participant_it.first] += participant_it.second;
+        }
+    }
+
+    return result;
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,155 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/**
+ * @file GeneratedSample.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+
+#include <ddsrouter_core/types/GeneratedSample.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+namespace {
+
+//! CDR little endian encapsulation
+constexpr unsigned char ENCAPSULATION[4] = {0x00, 0x01, 0x00, 0x00};
+
+// Offsets of the fields in the serialized sample
+constexpr uint32_t KEY_OFFSET = 4;
+constexpr uint32_t SEQUENCE_OFFSET = 12;
+constexpr uint32_t CHECKSUM_OFFSET = 20;
+constexpr uint32_t LENGTH_OFFSET = 24;
+
+void write_little_endian(
+        unsigned char* buffer,
+        uint64_t value,
+        const unsigned int bytes) noexcept
+{
+    for (unsigned int i = 0; i < bytes; ++i)
+    {
+        buffer[i] = static_cast<unsigned char>(value & 0xff);
+        value >>= 8;
+    }
+}
+
+uint64_t read_little_endian(
+        const unsigned char* buffer,
+        const unsigned int bytes) noexcept
+{
+    uint64_t value = 0;
+    for (unsigned int i = bytes; i > 0; --i)
+    {
+        value = (value << 8) | buffer[i - 1];
+    }
+    return value;
+}
+
+//! SplitMix64 generator, used to fill the data from the seed
+uint64_t split_mix(
+        uint64_t& state) noexcept
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+} /* namespace */
+
+const char* GeneratedSample::TYPE_NAME = "ddsrouter::GeneratedSample";
+
+GeneratedSample::GeneratedSample(
+        const std::string& seed,
+        const uint32_t size)
+{
+    if (size < HEADER_SIZE)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Generated samples cannot have less than " << HEADER_SIZE << " bytes.");
+    }
+
+    sample_.resize(size, 0);
+    std::memcpy(sample_.data(), ENCAPSULATION, sizeof(ENCAPSULATION));
+
+    // Fill the data from the seed
+    uint64_t state = checksum(reinterpret_cast<const unsigned char*>(seed.data()), static_cast<uint32_t>(seed.size()));
+    for (uint32_t i = HEADER_SIZE; i < size; i += 8)
+    {
+        write_little_endian(&sample_[i], split_mix(state), std::min<uint32_t>(8, size - i));
+    }
+
+    const uint32_t data_size = size - HEADER_SIZE;
+    write_little_endian(&sample_[CHECKSUM_OFFSET], checksum(&sample_[HEADER_SIZE], data_size), 4);
+    write_little_endian(&sample_[LENGTH_OFFSET], data_size, 4);
+}
+
+uint32_t GeneratedSample::size() const noexcept
+{
+    return static_cast<uint32_t>(sample_.size());
+}
+
+void GeneratedSample::serialize(
+        const uint32_t key,
+        const uint64_t sequence,
+        unsigned char* buffer) const noexcept
+{
+    std::memcpy(buffer, sample_.data(), sample_.size());
+    write_little_endian(&buffer[KEY_OFFSET], key, 4);
+    write_little_endian(&buffer[SEQUENCE_OFFSET], sequence, 8);
+}
+
+bool GeneratedSample::check(
+        const unsigned char* buffer,
+        const uint32_t size) noexcept
+{
+    if (size < HEADER_SIZE || std::memcmp(buffer, ENCAPSULATION, 2) != 0)
+    {
+        return false;
+    }
+
+    const uint32_t data_size = static_cast<uint32_t>(read_little_endian(&buffer[LENGTH_OFFSET], 4));
+    if (data_size > size - HEADER_SIZE)
+    {
+        return false;
+    }
+
+    return read_little_endian(&buffer[CHECKSUM_OFFSET], 4) == checksum(&buffer[HEADER_SIZE], data_size);
+}
+
+uint32_t GeneratedSample::checksum(
+        const unsigned char* data,
+        const uint32_t size) noexcept
+{
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,161 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyHistogram.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <ddsrouter_core/types/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+namespace {
+
+//! Position of the most significant bit set in \c value (value must not be 0)
+unsigned int most_significant_bit(
+        uint64_t value) noexcept
+{
+    unsigned int position = 0;
+    while (value >>= 1)
+    {
+        ++position;
+    }
+    return position;
+}
+
+} /* namespace */
+
+LatencyHistogram::LatencyHistogram()
+{
+    for (auto& bucket : buckets_)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::record(
+        const uint64_t value) noexcept
+{
+    buckets_[bucket_index_(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+
+    uint64_t current_max = max_.load(std::memory_order_relaxed);
+    while (value > current_max &&
+            !max_.compare_exchange_weak(current_max, value, std::memory_order_relaxed))
+    {
+        // current_max is updated by compare_exchange_weak
+    }
+}
+
+uint64_t LatencyHistogram::percentile(
+        const double percentile) const noexcept
+{
+    const uint64_t total = count();
+    if (total == 0)
+    {
+        return 0;
+    }
+
+    // Number of values that must be under the result (at least one)
+    const double clamped_percentile = std::min(1.0, std::max(0.0, percentile));
+    const uint64_t target =
+            std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped_percentile * static_cast<double>(total))));
+
+    uint64_t accumulated = 0;
+    for (unsigned int i = 0; i < BUCKETS; ++i)
+    {
+        accumulated += buckets_[i].load(std::memory_order_relaxed);
+        if (accumulated >= target)
+        {
+            // The highest bucket also holds the values over MAX_VALUE, bounded only by the max
+            return i + 1 == BUCKETS ? max() : std::min(bucket_upper_bound_(i), max());
+        }
+    }
+
+    // Values recorded while iterating
+    return max();
+}
+
+uint64_t LatencyHistogram::count() const noexcept
+{
+    return count_.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::max() const noexcept
+{
+    return max_.load(std::memory_order_relaxed);
+}
+
+LatencySummary LatencyHistogram::summary() const noexcept
+{
+    LatencySummary result;
+    result.count = count();
+    result.p50 = percentile(0.5);
+    result.p99 = percentile(0.99);
+    result.p999 = percentile(0.999);
+    result.max = max();
+    return result;
+}
+
+void LatencyHistogram::reset() noexcept
+{
+    for (auto& bucket : buckets_)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+unsigned int LatencyHistogram::bucket_index_(
+        const uint64_t value) noexcept
+{
+    // Values lower than SUB_BUCKETS are stored in their own bucket
+    if (value < SUB_BUCKETS)
+    {
+        return static_cast<unsigned int>(value);
+    }
+
+    // Otherwise, the power of two selects the group of buckets and the next bits the bucket inside it
+    const uint64_t capped_value = std::min(value, MAX_VALUE);
+    const unsigned int magnitude = most_significant_bit(capped_value) - SUB_BUCKET_BITS;
+    const unsigned int sub_bucket = static_cast<unsigned int>(capped_value >> magnitude) - SUB_BUCKETS;
+    return SUB_BUCKETS + magnitude * SUB_BUCKETS + sub_bucket;
+}
+
+uint64_t LatencyHistogram::bucket_upper_bound_(
+        const unsigned int index) noexcept
+{
+    if (index < SUB_BUCKETS)
+    {
+        return index;
+    }
+
+    const unsigned int magnitude = (index - SUB_BUCKETS) / SUB_BUCKETS;
+    const uint64_t sub_bucket = (index - SUB_BUCKETS) % SUB_BUCKETS + SUB_BUCKETS;
+
+    return ((sub_bucket + 1) << magnitude) - 1;
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
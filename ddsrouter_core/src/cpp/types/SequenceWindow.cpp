@@ -0,0 +1,112 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SequenceWindow.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <ddsrouter_core/types/SequenceWindow.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+namespace {
+
+constexpr unsigned int BITS_PER_WORD = 64;
+
+} /* namespace */
+
+SequenceWindow::SequenceWindow(
+        const unsigned int size)
+    : bitmap_(std::max(1u, (size + BITS_PER_WORD - 1) / BITS_PER_WORD), 0)
+{
+}
+
+bool SequenceWindow::insert(
+        const uint64_t sequence_number) noexcept
+{
+    const uint64_t window_size = size();
+
+    if (empty_)
+    {
+        empty_ = false;
+        highest_ = sequence_number;
+        set_(sequence_number);
+        return true;
+    }
+
+    if (sequence_number > highest_)
+    {
+        // Move the window forward, forgetting the sequence numbers that get out of it
+        if (sequence_number - highest_ >= window_size)
+        {
+            std::fill(bitmap_.begin(), bitmap_.end(), 0);
+        }
+        else
+        {
+            for (uint64_t i = highest_ + 1; i < sequence_number; ++i)
+            {
+                clear_(i);
+            }
+        }
+
+        highest_ = sequence_number;
+        set_(sequence_number);
+        return true;
+    }
+
+    if (highest_ - sequence_number >= window_size || is_set_(sequence_number))
+    {
+        return false;
+    }
+
+    set_(sequence_number);
+    return true;
+}
+
+unsigned int SequenceWindow::size() const noexcept
+{
+    return static_cast<unsigned int>(bitmap_.size()) * BITS_PER_WORD;
+}
+
+bool SequenceWindow::is_set_(
+        const uint64_t sequence_number) const noexcept
+{
+    const uint64_t index = sequence_number % size();
+    return (bitmap_[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1u;
+}
+
+void SequenceWindow::set_(
+        const uint64_t sequence_number) noexcept
+{
+    const uint64_t index = sequence_number % size();
+    bitmap_[index / BITS_PER_WORD] |= (uint64_t(1) << (index % BITS_PER_WORD));
+}
+
+void SequenceWindow::clear_(
+        const uint64_t sequence_number) noexcept
+{
+    const uint64_t index = sequence_number % size();
+    bitmap_[index / BITS_PER_WORD] &= ~(uint64_t(1) << (index % BITS_PER_WORD));
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
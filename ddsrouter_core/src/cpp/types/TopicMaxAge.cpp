@@ -0,0 +1,45 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TopicMaxAge.cpp
+ *
+ */
+
+#include <cpp_utils/utils.hpp>
+
+#include <ddsrouter_core/types/TopicMaxAge.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+bool TopicMaxAge::matches(
+        const std::string& topic_name,
+        const std::string& type_name,
+        const ddspipe::core::types::ParticipantId& participant_id) const noexcept
+{
+    if (!participants.empty() && participants.find(participant_id) == participants.end())
+    {
+        return false;
+    }
+
+    return utils::match_pattern(this->topic_name, topic_name) && utils::match_pattern(this->type_name, type_name);
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,53 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file clock.hpp
+ *
+ * Clock readings shared by the sources of the library. Not installed.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Steady clock time in nanoseconds, to measure intervals inside the DDS Router
+inline int64_t steady_now_ns() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//! Steady clock time in milliseconds, to measure intervals inside the DDS Router
+inline int64_t steady_now_ms() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//! System clock time in nanoseconds since epoch, comparable with the source timestamps of the samples
+inline int64_t system_now_ns() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
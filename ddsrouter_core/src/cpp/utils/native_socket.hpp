@@ -0,0 +1,111 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file native_socket.hpp
+ *
+ * Helpers that hide the differences between POSIX and Windows sockets. Not installed.
+ */
+
+#pragma once
+
+#if defined(_WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // if defined(_WIN32)
+
+#include <cstdint>
+#include <mutex>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+#if defined(_WIN32)
+using native_socket_t = SOCKET;
+const native_socket_t INVALID_NATIVE_SOCKET = INVALID_SOCKET;
+
+inline void close_native_socket(
+        native_socket_t socket)
+{
+    closesocket(socket);
+}
+
+//! Wait until \c socket is readable or \c timeout (ms) expires. Return a positive value if readable.
+inline int poll_native_socket(
+        native_socket_t socket,
+        int timeout)
+{
+    WSAPOLLFD fd {};
+    fd.fd = socket;
+    fd.events = POLLIN;
+    return WSAPoll(&fd, 1, timeout);
+}
+
+//! Initialize the socket library once per process
+inline void initialize_sockets()
+{
+    static std::once_flag once;
+    std::call_once(once, []()
+            {
+                WSADATA data;
+                WSAStartup(MAKEWORD(2, 2), &data);
+            });
+}
+
+#else
+using native_socket_t = int;
+const native_socket_t INVALID_NATIVE_SOCKET = -1;
+
+inline void close_native_socket(
+        native_socket_t socket)
+{
+    close(socket);
+}
+
+//! Wait until \c socket is readable or \c timeout (ms) expires. Return a positive value if readable.
+inline int poll_native_socket(
+        native_socket_t socket,
+        int timeout)
+{
+    pollfd fd {};
+    fd.fd = socket;
+    fd.events = POLLIN;
+    return poll(&fd, 1, timeout);
+}
+
+//! Initialize the socket library once per process
+inline void initialize_sockets()
+{
+    // Nothing to do
+}
+
+#endif // if defined(_WIN32)
+
+//! Native handle of a socket stored as an integer in a public header
+inline native_socket_t native(
+        intptr_t socket)
+{
+    return static_cast<native_socket_t>(socket);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
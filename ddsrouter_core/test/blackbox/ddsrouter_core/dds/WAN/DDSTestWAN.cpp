@@ -15,6 +15,7 @@
 #include <atomic>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
@@ -27,6 +28,7 @@
 #include <ddspipe_participants/types/security/tls/TlsConfiguration.hpp>
 
 #include <ddsrouter_core/core/DdsRouter.hpp>
+#include <ddsrouter_core/interest/InterestSubscriber.hpp>
 
 #include <test_participants.hpp>
 
@@ -419,6 +421,201 @@ void test_WAN_communication_all(
     }
 }
 
+/**
+ * @brief Create a DDS Router configuration with two parallel initial peers paths to another DDS Router
+ *
+ * Path N listens (in the server) or connects (in the client) in port 11666 + N.
+ * The paths form a redundancy group in both DDS Routers, so they exchange the origin of the samples.
+ * The paths of the server (the receiving side) only forward to the simple participant.
+ *
+ * @return DdsRouterConfiguration
+ */
+DdsRouterConfiguration redundant_router_configuration(
+        bool server,
+        core::types::DomainIdType domain)
+{
+    std::vector<std::shared_ptr<participants::InitialPeersParticipantConfiguration>> paths;
+    for (uint16_t path = 0; path < 2; ++path)
+    {
+        auto part = std::make_shared<participants::InitialPeersParticipantConfiguration>();
+        part->id = core::types::ParticipantId("Path_" + std::to_string(path));
+
+        const participants::types::Address address(
+            "127.0.0.1",
+            11666 + path,
+            11666 + path,
+            participants::types::IpVersion::v4,
+            participants::types::TransportProtocol::udp);
+        if (server)
+        {
+            part->listening_addresses.insert(address);
+        }
+        else
+        {
+            part->connection_addresses.insert(address);
+        }
+
+        paths.push_back(part);
+    }
+
+    DdsRouterConfiguration conf = router_configuration({types::ParticipantKind::initial_peers, paths[0]}, domain);
+    conf.participants_configurations.insert({types::ParticipantKind::initial_peers, paths[1]});
+
+    RedundancyGroupConfiguration redundancy_group;
+    redundancy_group.name = "paths";
+
+    const core::types::ParticipantId simple_id("simple_participant_" + std::to_string(domain));
+    for (const auto& path : paths)
+    {
+        redundancy_group.participants.insert(path->id);
+
+        if (server)
+        {
+            conf.ddspipe_configuration.routes.routes[path->id] = {simple_id};
+        }
+    }
+
+    conf.redundancy_groups.push_back(redundancy_group);
+
+    return conf;
+}
+
+/**
+ * Test that every sample sent through two parallel WAN paths is delivered exactly once.
+ *
+ * Both DDS Routers group the paths in a redundancy group, so the sending one stamps the origin of each sample and
+ * the copy arriving through the slower path is discarded, although each copy comes from a different writer.
+ */
+void test_WAN_redundancy(
+        uint32_t samples_to_receive = DEFAULT_SAMPLES_TO_RECEIVE,
+        uint32_t time_between_samples = DEFAULT_MILLISECONDS_PUBLISH_LOOP)
+{
+    uint32_t samples_sent = 0;
+    std::atomic<uint32_t> samples_received(0);
+
+    HelloWorld msg;
+    msg.message("Testing DdsRouter Blackbox Redundant WAN Communication ...");
+
+    // Create DDS Publisher in domain 0
+    TestPublisher<HelloWorld> publisher;
+    ASSERT_TRUE(publisher.init(0));
+
+    // Create DDS Subscriber in domain 1
+    TestSubscriber<HelloWorld> subscriber;
+    ASSERT_TRUE(subscriber.init(1, &msg, &samples_received));
+
+    // Create DdsRouter entity that receives through both paths
+    DdsRouter server_router(redundant_router_configuration(true, 1));
+    server_router.start();
+
+    // Create DdsRouter entity that sends through both paths
+    DdsRouter client_router(redundant_router_configuration(false, 0));
+    client_router.start();
+
+    // Start publishing
+    while (subscriber.received_indexes().size() < samples_to_receive)
+    {
+        msg.index(++samples_sent);
+        publisher.publish(msg);
+
+        if (time_between_samples > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(time_between_samples));
+        }
+    }
+
+    // Give time to the copies through the slower path to arrive
+    std::this_thread::sleep_for(std::chrono::milliseconds(10 * time_between_samples));
+
+    for (const auto& it : subscriber.received_indexes())
+    {
+        ASSERT_EQ(1u, it.second) << "Sample " << it.first << " received " << it.second << " times.";
+    }
+
+    // Both paths deliver every sample, so the copies of one of them are discarded
+    uint64_t late_arrivals = 0;
+    for (const auto& it : server_router.redundancy_statistics())
+    {
+        late_arrivals += it.second.late_arrivals;
+    }
+    ASSERT_GT(late_arrivals, 0u);
+
+    client_router.stop();
+    server_router.stop();
+}
+
+/**
+ * Test that the readers of another DDS Router are not announced as local interest, while local readers are.
+ *
+ * The server DDS Router announces its interest, and the client DDS Router creates a reader in its WAN participant
+ * as soon as it discovers the publisher. This reader is discovered by the WAN participant of the server, which is a
+ * router link, so the topic must only be of interest once a local subscriber appears.
+ */
+void test_WAN_router_link_interest(
+        uint16_t interest_port = 11700)
+{
+    uint32_t samples_sent = 0;
+    std::atomic<uint32_t> samples_received(0);
+
+    HelloWorld msg;
+    msg.message("Testing DdsRouter Blackbox Router Link Interest ...");
+
+    // Create DDS Publisher in domain 0
+    TestPublisher<HelloWorld> publisher;
+    ASSERT_TRUE(publisher.init(0));
+
+    DdsRouterConfiguration server_configuration = router_configuration(
+        wan_participant_configuration(
+            WanParticipantKind::discovery_server,
+            true, // is server 1
+            WanKind::server,
+            participants::types::TransportProtocol::udp,
+            participants::types::IpVersion::v4),
+        1);
+    server_configuration.advanced_options.interest_port = interest_port;
+    DdsRouter server_router(server_configuration);
+    server_router.start();
+
+    DdsRouter client_router(
+        router_configuration(
+            wan_participant_configuration(
+                WanParticipantKind::discovery_server,
+                false, // is server 1
+                WanKind::client,
+                participants::types::TransportProtocol::udp,
+                participants::types::IpVersion::v4),
+            0));
+    client_router.start();
+
+    InterestConfiguration interest_configuration;
+    interest_configuration.ip = "127.0.0.1";
+    interest_configuration.port = interest_port;
+    InterestSubscriber interest(interest_configuration);
+
+    // Request on behalf of the client router, so the reader of its WAN participant is not announced back
+    interest.add_participant(core::types::GuidPrefix(0u));
+
+    // Give time to the routers to discover each other and the reader of the client router to be discovered
+    std::this_thread::sleep_for(std::chrono::milliseconds(2 * InterestSubscriber::LEASE_DURATION));
+    ASSERT_TRUE(interest.is_known());
+    ASSERT_EQ(0u, interest.topics().count(TOPIC_NAME));
+
+    // Create DDS Subscriber in domain 1, which is local interest of the server router
+    TestSubscriber<HelloWorld> subscriber;
+    ASSERT_TRUE(subscriber.init(1, &msg, &samples_received));
+
+    while (samples_received.load() < DEFAULT_SAMPLES_TO_RECEIVE)
+    {
+        msg.index(++samples_sent);
+        publisher.publish(msg);
+        std::this_thread::sleep_for(std::chrono::milliseconds(DEFAULT_MILLISECONDS_PUBLISH_LOOP));
+    }
+    ASSERT_EQ(1u, interest.topics().count(TOPIC_NAME));
+
+    client_router.stop();
+    server_router.stop();
+}
+
 } /* namespace test */
 
 /**
@@ -663,6 +860,23 @@ TEST(DDSTestWAN, end_to_end_initial_peers_WAN_communication_high_throughput)
         1000); // 50K message size
 }
 
+/**
+ * Test that every sample sent through two parallel initial peers paths between two routers is delivered exactly once,
+ * when the paths form a redundancy group.
+ */
+TEST(DDSTestWAN, end_to_end_redundancy_group_exactly_once)
+{
+    test::test_WAN_redundancy();
+}
+
+/**
+ * Test that the readers discovered by a WAN participant are not local interest of a DDS Router.
+ */
+TEST(DDSTestWAN, end_to_end_router_link_interest)
+{
+    test::test_WAN_router_link_interest();
+}
+
 int main(
         int argc,
         char** argv)
@@ -13,7 +13,9 @@
 // limitations under the License.
 
 #include <atomic>
+#include <filesystem>
 #include <thread>
+#include <vector>
 
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
@@ -23,7 +25,9 @@
 
 #include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
 
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
 #include <ddsrouter_core/core/DdsRouter.hpp>
+#include <ddsrouter_core/recorder/McapWriter.hpp>
 
 #include <test_participants.hpp>
 
@@ -199,6 +203,127 @@ void test_local_communication(
     router.stop();
 }
 
+/**
+ * Test that the payloads given by the payload pool of a DDS Router are counted once, by replaying an uncompressed
+ * MCAP file in a Simple Participant. The replayer references the samples in the mapped file, so the writer copies
+ * them from a payload pool other than the one of the DDS Router.
+ */
+void test_replay_payloads_in_use(
+        uint32_t samples_to_replay = DEFAULT_SAMPLES_TO_RECEIVE)
+{
+    const std::filesystem::path file = std::filesystem::temp_directory_path() / "DDSTestLocal_payloads_in_use.mcap";
+    {
+        McapWriter writer(1024, false);
+        writer.add_channel(1, TOPIC_NAME, "HelloWorld", false);
+        writer.open(file.string());
+
+        for (uint32_t i = 0; i < samples_to_replay; ++i)
+        {
+            std::vector<uint8_t> payload(64, static_cast<uint8_t>(i));
+            payload[0] = 0x00;
+            payload[1] = 0x01;  // Little endian encapsulation
+            writer.write(1, i, 1000 + i, 1000 + i, payload.data(), static_cast<uint32_t>(payload.size()));
+        }
+        writer.close();
+    }
+
+    DdsRouterConfiguration conf;
+    {
+        auto part = std::make_shared<ReplayerParticipantConfiguration>();
+        part->id = core::types::ParticipantId("replayer");
+        part->files.push_back(file.string());
+        part->playback_rate = 0;
+        conf.participants_configurations.insert({types::ParticipantKind::replayer, part});
+    }
+    {
+        auto part = std::make_shared<participants::SimpleParticipantConfiguration>();
+        part->id = core::types::ParticipantId("participant_1");
+        part->domain.domain_id = 1u;
+        conf.participants_configurations.insert({types::ParticipantKind::simple, part});
+    }
+
+    DdsRouter router(conf);
+    router.start();
+
+    // Wait for every sample to be written in domain 1
+    uint64_t samples_sent = 0;
+    for (unsigned int i = 0; i < 100 && samples_sent < samples_to_replay; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        samples_sent = router.get_statistics().participants()["participant_1"].samples_sent;
+    }
+    ASSERT_EQ(samples_to_replay, samples_sent);
+
+    // The samples are only held by the history of the writer
+    ASSERT_LE(router.get_statistics().payloads_in_use, samples_to_replay);
+
+    router.stop();
+    std::filesystem::remove(file);
+}
+
+//! Number of latencies accounted in the route from participant_0 to participant_1
+uint64_t route_latency_count(
+        const DdsRouter& router)
+{
+    auto latencies = router.get_statistics().latencies[TOPIC_NAME];
+    return latencies[{"participant_0", "participant_1"}].router.count;
+}
+
+/**
+ * Test that the latency of every sample forwarded from one domain to the other is accounted in its route, and that
+ * the accounting stops when the route latency is disabled by reloading the configuration.
+ */
+void test_route_latency_switch(
+        uint32_t samples_to_receive = DEFAULT_SAMPLES_TO_RECEIVE,
+        uint32_t time_between_samples = DEFAULT_MILLISECONDS_PUBLISH_LOOP)
+{
+    uint32_t samples_sent = 0;
+    std::atomic<uint32_t> samples_received(0);
+
+    HelloWorld msg;
+    msg.message("Testing DdsRouter Blackbox Route Latency ...");
+
+    // Create DDS Publisher in domain 0
+    TestPublisher<HelloWorld> publisher;
+    ASSERT_TRUE(publisher.init(0));
+
+    // Create DDS Subscriber in domain 1
+    TestSubscriber<HelloWorld> subscriber;
+    ASSERT_TRUE(subscriber.init(1, &msg, &samples_received));
+
+    DdsRouterConfiguration configuration = dds_test_simple_configuration();
+    DdsRouter router(configuration);
+    router.start();
+
+    while (samples_received.load() < samples_to_receive)
+    {
+        msg.index(++samples_sent);
+        publisher.publish(msg);
+        std::this_thread::sleep_for(std::chrono::milliseconds(time_between_samples));
+    }
+
+    // Every sample received by the subscriber has been accounted
+    const uint64_t accounted = route_latency_count(router);
+    ASSERT_GE(accounted, samples_received.load());
+
+    // Disable the accounting while running
+    configuration.advanced_options.route_latency = false;
+    router.reload_configuration(configuration);
+
+    samples_received.store(0);
+    while (samples_received.load() < samples_to_receive)
+    {
+        msg.index(++samples_sent);
+        publisher.publish(msg);
+        std::this_thread::sleep_for(std::chrono::milliseconds(time_between_samples));
+    }
+
+    // The samples sent before reloading and received after are accounted at most
+    ASSERT_LE(route_latency_count(router), accounted + 1);
+
+    router.stop();
+}
+
 } /* namespace test */
 
 /**
@@ -315,6 +440,22 @@ TEST(DDSTestLocal, end_to_end_local_communication_transient_local_disable_dynami
         true);
 }
 
+/**
+ * Test that the payloads copied from the payload pool of a replayer are counted once in the payloads in use.
+ */
+TEST(DDSTestLocal, end_to_end_replay_payloads_in_use)
+{
+    test::test_replay_payloads_in_use();
+}
+
+/**
+ * Test that the route latency is accounted in every sample forwarded, and that it can be disabled at runtime.
+ */
+TEST(DDSTestLocal, end_to_end_route_latency_switch)
+{
+    test::test_route_latency_switch();
+}
+
 int main(
         int argc,
         char** argv)
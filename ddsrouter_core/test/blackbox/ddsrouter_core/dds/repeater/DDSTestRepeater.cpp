@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <set>
 #include <thread>
 
 #include <cpp_utils/testing/gtest_aux.hpp>
@@ -215,6 +216,131 @@ void test_WAN_communication(
     repeater.stop();
 }
 
+/**
+ * @brief Create an initial peers participant that connects to the repeaters listening in \c ports
+ */
+std::pair<
+    types::ParticipantKind,
+    std::shared_ptr<participants::ParticipantConfiguration>>
+repeaters_client_configuration(
+        const std::string& id,
+        const std::set<uint16_t>& ports)
+{
+    auto conf = std::make_shared<participants::InitialPeersParticipantConfiguration>();
+
+    conf->id = core::types::ParticipantId(id);
+    for (const auto port : ports)
+    {
+        conf->connection_addresses.insert(
+            participants::types::Address(
+                "127.0.0.1",
+                port,
+                port,
+                participants::types::IpVersion::v4,
+                participants::types::TransportProtocol::udp)
+            );
+    }
+
+    return {types::ParticipantKind::initial_peers, conf};
+}
+
+/**
+ * @brief Create a repeater initial peers participant listening in \c port
+ */
+std::pair<
+    types::ParticipantKind,
+    std::shared_ptr<participants::ParticipantConfiguration>>
+repeater_configuration(
+        const uint16_t port)
+{
+    auto conf = std::make_shared<participants::InitialPeersParticipantConfiguration>();
+
+    conf->id = core::types::ParticipantId("Repeater_" + std::to_string(port));
+    conf->listening_addresses.insert(
+        participants::types::Address(
+            "127.0.0.1",
+            port,
+            port,
+            participants::types::IpVersion::v4,
+            participants::types::TransportProtocol::udp)
+        );
+    conf->is_repeater = true;
+
+    return {types::ParticipantKind::initial_peers, conf};
+}
+
+/**
+ * Test that a sample reaching a DDS Router through two repeaters is only forwarded once.
+ *
+ * The participant of each client router connects to both repeaters, so every sample reaches the receiving router
+ * twice, from a different writer of each repeater. The participants of the client routers have duplicate
+ * suppression, so the sending router stamps the origin of each sample, the repeaters forward it, and the receiving
+ * router identifies both copies by it.
+ */
+void test_repeaters_deduplication(
+        uint32_t samples_to_receive = DEFAULT_SAMPLES_TO_RECEIVE,
+        uint32_t time_between_samples = DEFAULT_MILLISECONDS_PUBLISH_LOOP)
+{
+    uint32_t samples_sent = 0;
+    std::atomic<uint32_t> samples_received(0);
+
+    HelloWorld msg;
+    msg.message("Testing DdsRouter Blackbox Repeaters Deduplication ...");
+
+    // Create DDS Publisher in domain 0
+    TestPublisher<HelloWorld> publisher;
+    ASSERT_TRUE(publisher.init(0));
+
+    // Create DDS Subscriber in domain 1
+    TestSubscriber<HelloWorld> subscriber;
+    ASSERT_TRUE(subscriber.init(1, &msg, &samples_received));
+
+    // Create the two repeaters
+    DdsRouter repeater_1(router_configuration(repeater_configuration(11666), 66, false));
+    repeater_1.start();
+    DdsRouter repeater_2(router_configuration(repeater_configuration(11667), 66, false));
+    repeater_2.start();
+
+    // Create the sending router, which stamps the origin of each sample
+    DdsRouterConfiguration client_configuration_0 =
+            router_configuration(repeaters_client_configuration("Client_0", {11666, 11667}), 0);
+    client_configuration_0.deduplication_configurations["Client_0"] = DeduplicationConfiguration();
+    DdsRouter client_router_0(client_configuration_0);
+    client_router_0.start();
+
+    // Create the receiving router, which discards the second copy of each sample
+    DdsRouterConfiguration client_configuration_1 =
+            router_configuration(repeaters_client_configuration("Client_1", {11666, 11667}), 1);
+    client_configuration_1.deduplication_configurations["Client_1"] = DeduplicationConfiguration();
+    DdsRouter client_router_1(client_configuration_1);
+    client_router_1.start();
+
+    // Start publishing
+    while (subscriber.received_indexes().size() < samples_to_receive)
+    {
+        msg.index(++samples_sent);
+        publisher.publish(msg);
+
+        if (time_between_samples > 0)
+        {
+            eprosima::utils::sleep_for(time_between_samples);
+        }
+    }
+
+    // Give time to the copies through the slower repeater to arrive
+    eprosima::utils::sleep_for(10 * time_between_samples);
+
+    for (const auto& it : subscriber.received_indexes())
+    {
+        ASSERT_EQ(1u, it.second) << "Sample " << it.first << " received " << it.second << " times.";
+    }
+
+    client_router_0.stop();
+    client_router_1.stop();
+    repeater_1.stop();
+    repeater_2.stop();
+}
+
 } /* namespace test */
 
 /**
@@ -259,6 +385,15 @@ TEST(DDSTestRepeater, repeater_initial_peers_communication_UDPv4)
         );
 }
 
+/**
+ * Test that samples reaching a DDS Router through two repeaters are forwarded only once,
+ * with duplicate suppression in the receiving participant.
+ */
+TEST(DDSTestRepeater, repeaters_deduplication_UDPv4)
+{
+    test::test_repeaters_deduplication();
+}
+
 int main(
         int argc,
         char** argv)
@@ -17,6 +17,8 @@
 #include <atomic>
 #include <iostream>
 #include <condition_variable>
+#include <map>
+#include <mutex>
 
 #include <gtest/gtest.h>
 
@@ -95,7 +97,8 @@ public:
 
     //! Initialize the publisher
     bool init(
-            uint32_t domain)
+            uint32_t domain,
+            const std::string& topic_name = TOPIC_NAME)
     {
         // CREATE THE PARTICIPANT
         eprosima::fastdds::dds::DomainParticipantQos pqos;
@@ -131,7 +134,7 @@ public:
 
         // CREATE THE TOPIC
         std::string type_name = keyed_ ? "HelloWorldKeyed" : "HelloWorld";
-        topic_ = participant_->create_topic(TOPIC_NAME, type_name, eprosima::fastdds::dds::TOPIC_QOS_DEFAULT);
+        topic_ = participant_->create_topic(topic_name, type_name, eprosima::fastdds::dds::TOPIC_QOS_DEFAULT);
 
         if (topic_ == nullptr)
         {
@@ -239,7 +242,7 @@ private:
 };
 
 template <>
-bool TestPublisher<HelloWorldKeyed>::publish(
+inline bool TestPublisher<HelloWorldKeyed>::publish(
         HelloWorldKeyed msg)
 {
     hello_.index(msg.index());
@@ -249,7 +252,7 @@ bool TestPublisher<HelloWorldKeyed>::publish(
 }
 
 template <>
-eprosima::fastrtps::types::ReturnCode_t TestPublisher<HelloWorldKeyed>::dispose_key(
+inline eprosima::fastrtps::types::ReturnCode_t TestPublisher<HelloWorldKeyed>::dispose_key(
         HelloWorldKeyed msg)
 {
     hello_.id(msg.id());
@@ -301,7 +304,8 @@ public:
     bool init(
             uint32_t domain,
             MsgStruct* msg_should_receive,
-            std::atomic<uint32_t>* samples_received)
+            std::atomic<uint32_t>* samples_received,
+            const std::string& topic_name = TOPIC_NAME)
     {
         // INITIALIZE THE LISTENER
         listener_.init(msg_should_receive, samples_received);
@@ -339,7 +343,7 @@ public:
 
         // CREATE THE TOPIC
         std::string type_name = keyed_ ? "HelloWorldKeyed" : "HelloWorld";
-        topic_ = participant_->create_topic(TOPIC_NAME, type_name, eprosima::fastdds::dds::TOPIC_QOS_DEFAULT);
+        topic_ = participant_->create_topic(topic_name, type_name, eprosima::fastdds::dds::TOPIC_QOS_DEFAULT);
 
         if (topic_ == nullptr)
         {
@@ -379,6 +383,13 @@ public:
         return listener_.n_key_disposed;
     }
 
+    //! Number of times each index has been received (only of the samples with the expected message)
+    std::map<uint32_t, uint32_t> received_indexes()
+    {
+        std::lock_guard<std::mutex> lock(listener_.received_indexes_mtx);
+        return listener_.received_indexes;
+    }
+
 private:
 
     eprosima::fastdds::dds::DomainParticipant* participant_;
@@ -439,6 +450,10 @@ private:
                 {
                     if (msg_received.message() == msg_should_receive->message())
                     {
+                        {
+                            std::lock_guard<std::mutex> lock(received_indexes_mtx);
+                            received_indexes[msg_received.index()]++;
+                        }
                         (*samples_received)++;
                     }
                 }
@@ -475,6 +490,12 @@ private:
         //! Reference to received messages counter
         std::atomic<uint32_t>* samples_received;
 
+        //! Number of times each index has been received
+        std::map<uint32_t, uint32_t> received_indexes;
+
+        //! Protects received_indexes
+        std::mutex received_indexes_mtx;
+
         //! Number of DataWriters discovered
         std::atomic<std::uint32_t> discovered;
 
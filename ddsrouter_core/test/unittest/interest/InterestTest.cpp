@@ -0,0 +1,350 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/types/dds/Endpoint.hpp>
+
+#include <ddsrouter_core/interest/InterestMessage.hpp>
+#include <ddsrouter_core/interest/InterestPublisher.hpp>
+#include <ddsrouter_core/interest/InterestSubscriber.hpp>
+#include <ddsrouter_core/interest/LocalInterest.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddspipe::core::types;
+
+namespace test {
+
+//! GUID prefix of the participant \c id
+GuidPrefix prefix(
+        const uint8_t id)
+{
+    GuidPrefix prefix;
+    prefix.value[0] = id;
+    return prefix;
+}
+
+//! Endpoint of the participant \c prefix_id discovered by \c participant_id in \c topic_name
+Endpoint endpoint(
+        const uint8_t id,
+        const std::string& topic_name,
+        const ParticipantId& participant_id,
+        const EndpointKind kind = EndpointKind::reader,
+        const uint8_t prefix_id = 0)
+{
+    Endpoint endpoint;
+    endpoint.kind = kind;
+    endpoint.guid.guidPrefix = prefix(prefix_id);
+    endpoint.guid.entityId.value[3] = id;
+    endpoint.topic.m_topic_name = topic_name;
+    endpoint.discoverer_participant_id = participant_id;
+    endpoint.active = true;
+    return endpoint;
+}
+
+//! Wait for a condition to be true, up to 2 lease durations
+template <typename Condition>
+bool wait_for(
+        Condition condition)
+{
+    for (unsigned int i = 0; i < 2 * InterestSubscriber::LEASE_DURATION / 10; ++i)
+    {
+        if (condition())
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return condition();
+}
+
+} /* namespace test */
+
+/**
+ * Test that the messages are deserialized as they were serialized, and that invalid data is rejected
+ */
+TEST(InterestTest, message_serialization)
+{
+    // Interest with topics
+    {
+        InterestMessage message;
+        message.kind = InterestMessage::Kind::interest;
+        message.topics = {"rt/chatter", "rt/cmd_vel", ""};
+
+        const std::vector<uint8_t> data = message.serialize();
+
+        InterestMessage result;
+        ASSERT_TRUE(InterestMessage::deserialize(data.data(), data.size(), result));
+        ASSERT_EQ(InterestMessage::Kind::interest, result.kind);
+        ASSERT_FALSE(result.all_topics);
+        ASSERT_EQ(message.topics, result.topics);
+
+        // Truncated message
+        ASSERT_FALSE(InterestMessage::deserialize(data.data(), data.size() - 1, result));
+    }
+
+    // Request
+    {
+        const std::vector<uint8_t> data = InterestMessage().serialize();
+
+        InterestMessage result;
+        ASSERT_TRUE(InterestMessage::deserialize(data.data(), data.size(), result));
+        ASSERT_EQ(InterestMessage::Kind::request, result.kind);
+        ASSERT_TRUE(result.topics.empty());
+        ASSERT_TRUE(result.participants.empty());
+    }
+
+    // Request with the participants of the requester
+    {
+        InterestMessage message;
+        message.participants = {test::prefix(1), test::prefix(2)};
+
+        const std::vector<uint8_t> data = message.serialize();
+
+        InterestMessage result;
+        ASSERT_TRUE(InterestMessage::deserialize(data.data(), data.size(), result));
+        ASSERT_EQ(InterestMessage::Kind::request, result.kind);
+        ASSERT_EQ(message.participants, result.participants);
+
+        // Truncated participants
+        ASSERT_FALSE(InterestMessage::deserialize(data.data(), data.size() - 1, result));
+    }
+
+    // Too many topics to fit in a datagram
+    {
+        InterestMessage message;
+        message.kind = InterestMessage::Kind::interest;
+        for (unsigned int i = 0; i < 1000; ++i)
+        {
+            message.topics.insert(std::string(100, 'a') + std::to_string(i));
+        }
+
+        const std::vector<uint8_t> data = message.serialize();
+        ASSERT_LE(data.size(), InterestMessage::MAX_SIZE);
+
+        InterestMessage result;
+        ASSERT_TRUE(InterestMessage::deserialize(data.data(), data.size(), result));
+        ASSERT_TRUE(result.all_topics);
+        ASSERT_TRUE(result.topics.empty());
+    }
+
+    // Data of another protocol
+    {
+        const std::vector<uint8_t> data(64, 0x42);
+
+        InterestMessage result;
+        ASSERT_FALSE(InterestMessage::deserialize(data.data(), data.size(), result));
+    }
+}
+
+/**
+ * Test that the live readers are tracked, and that the readers of the requester are not announced to it
+ */
+TEST(InterestTest, local_readers)
+{
+    LocalInterest local_interest({"wan"});
+    ASSERT_TRUE(local_interest.topics().empty());
+
+    uint64_t version = local_interest.version();
+
+    // Readers of local participants
+    local_interest.update_endpoint(test::endpoint(1, "topic_a", "local"));
+    local_interest.update_endpoint(test::endpoint(2, "topic_a", "local"));
+    ASSERT_EQ(std::set<std::string>({"topic_a"}), local_interest.topics());
+    ASSERT_GT(local_interest.version(), version);
+
+    // Writers are ignored
+    version = local_interest.version();
+    local_interest.update_endpoint(test::endpoint(3, "topic_c", "local", EndpointKind::writer));
+    ASSERT_EQ(std::set<std::string>({"topic_a"}), local_interest.topics());
+    ASSERT_EQ(version, local_interest.version());
+
+    // Readers of remote DDS Routers are interest for the others, but not for themselves
+    local_interest.update_endpoint(test::endpoint(4, "topic_b", "wan", EndpointKind::reader, 7));
+    ASSERT_EQ(std::set<std::string>({"topic_a", "topic_b"}), local_interest.topics());
+    ASSERT_EQ(std::set<std::string>({"topic_a"}), local_interest.topics({test::prefix(7)}));
+    ASSERT_EQ(std::set<std::string>({"topic_a", "topic_b"}), local_interest.topics({test::prefix(8)}));
+    ASSERT_GT(local_interest.version(), version);
+
+    // The topic is of interest while any of its readers is alive
+    version = local_interest.version();
+    Endpoint inactive_reader = test::endpoint(1, "topic_a", "local");
+    inactive_reader.active = false;
+    local_interest.update_endpoint(inactive_reader);
+    ASSERT_EQ(std::set<std::string>({"topic_a", "topic_b"}), local_interest.topics());
+
+    local_interest.erase_endpoint(test::endpoint(2, "topic_a", "local"));
+    ASSERT_EQ(std::set<std::string>({"topic_b"}), local_interest.topics());
+    ASSERT_GT(local_interest.version(), version);
+}
+
+/**
+ * Test that the interest announced by a publisher reaches a subscriber, and that the subscriber considers every
+ * topic of interest while it does not know the remote interest
+ */
+TEST(InterestTest, remote_interest)
+{
+    auto local_interest = std::make_shared<LocalInterest>(std::set<ParticipantId>());
+    local_interest->update_endpoint(test::endpoint(1, "topic_a", "local"));
+
+    std::unique_ptr<InterestPublisher> publisher(new InterestPublisher(0, local_interest));
+
+    InterestConfiguration configuration;
+    configuration.ip = "127.0.0.1";
+    configuration.port = publisher->port();
+    InterestSubscriber subscriber(configuration);
+
+    auto flag_a = subscriber.interest_flag("topic_a");
+    auto flag_b = subscriber.interest_flag("topic_b");
+
+    // Initial interest
+    ASSERT_TRUE(test::wait_for([&subscriber]()
+            {
+                return subscriber.is_known();
+            }));
+    ASSERT_TRUE(flag_a->load());
+    ASSERT_FALSE(flag_b->load());
+    ASSERT_FALSE(subscriber.interest_flag("topic_c")->load());
+
+    // Changes are received as they happen
+    local_interest->update_endpoint(test::endpoint(2, "topic_b", "local"));
+    local_interest->erase_endpoint(test::endpoint(1, "topic_a", "local"));
+    ASSERT_TRUE(test::wait_for([&flag_a, &flag_b]()
+            {
+                return !flag_a->load() && flag_b->load();
+            }));
+    ASSERT_EQ(std::set<std::string>({"topic_b"}), subscriber.topics());
+
+    // Every topic is of interest when the remote interest is lost
+    publisher.reset();
+    ASSERT_TRUE(test::wait_for([&subscriber]()
+            {
+                return !subscriber.is_known();
+            }));
+    ASSERT_TRUE(flag_a->load());
+    ASSERT_TRUE(flag_b->load());
+}
+
+/**
+ * Test that a publisher restricted to a set of peers only answers the subscribers of those peers
+ */
+TEST(InterestTest, restricted_peers)
+{
+    auto local_interest = std::make_shared<LocalInterest>(std::set<ParticipantId>());
+    local_interest->update_endpoint(test::endpoint(1, "topic_a", "local"));
+
+    InterestConfiguration configuration;
+    configuration.ip = "127.0.0.1";
+
+    // Requests from a host that is not a peer are ignored
+    {
+        InterestPublisher publisher(0, local_interest, {"10.0.0.1"});
+        configuration.port = publisher.port();
+        InterestSubscriber subscriber(configuration);
+
+        ASSERT_FALSE(test::wait_for([&subscriber]()
+                {
+                    return subscriber.is_known();
+                }));
+        ASSERT_TRUE(subscriber.interest_flag("topic_b")->load());
+    }
+
+    // Requests from a peer are answered
+    {
+        InterestPublisher publisher(0, local_interest, {"10.0.0.1", "127.0.0.1"});
+        configuration.port = publisher.port();
+        InterestSubscriber subscriber(configuration);
+
+        ASSERT_TRUE(test::wait_for([&subscriber]()
+                {
+                    return subscriber.is_known();
+                }));
+        ASSERT_EQ(std::set<std::string>({"topic_a"}), subscriber.topics());
+    }
+}
+
+/**
+ * Test that the interest of a DDS Router reaches the next hops, and that it never comes back through the router
+ * link that announced it
+ */
+TEST(InterestTest, multi_hop)
+{
+    // DDS Router C, with a local reader
+    auto interest_c = std::make_shared<LocalInterest>(std::set<ParticipantId>({"wan_b"}));
+    interest_c->update_endpoint(test::endpoint(1, "topic_c", "local"));
+    InterestPublisher publisher_c(0, interest_c);
+
+    // DDS Router B, connected to A and C, subscribed to the interest of C
+    InterestConfiguration configuration;
+    configuration.ip = "127.0.0.1";
+    configuration.port = publisher_c.port();
+    auto subscriber_c = std::make_shared<InterestSubscriber>(configuration);
+
+    auto interest_b = std::make_shared<LocalInterest>(
+        std::set<ParticipantId>({"wan_a", "wan_c"}),
+        std::map<ParticipantId, std::shared_ptr<InterestSubscriber>>({{"wan_c", subscriber_c}}));
+
+    // Readers of the router links of A (prefix 1) and C (prefix 3)
+    interest_b->update_endpoint(test::endpoint(1, "topic_a", "wan_a", EndpointKind::reader, 1));
+    interest_b->update_endpoint(test::endpoint(2, "topic_x", "wan_c", EndpointKind::reader, 3));
+
+    // The readers of C are used while its interest is unknown
+    ASSERT_EQ(std::set<std::string>({"topic_a", "topic_x"}), interest_b->topics());
+
+    // Then its interest is used instead, and it is never announced back to C
+    ASSERT_TRUE(test::wait_for([&subscriber_c]()
+            {
+                return subscriber_c->is_known();
+            }));
+    ASSERT_EQ(std::set<std::string>({"topic_a", "topic_c"}), interest_b->topics());
+    ASSERT_EQ(std::set<std::string>({"topic_c"}), interest_b->topics({test::prefix(1)}));
+    ASSERT_EQ(std::set<std::string>({"topic_a"}), interest_b->topics({test::prefix(3)}));
+
+    // The changes of the interest of C change the interest of B
+    const uint64_t version = interest_b->version();
+    interest_c->update_endpoint(test::endpoint(2, "topic_d", "local"));
+    ASSERT_TRUE(test::wait_for([&interest_b, version]()
+            {
+                return interest_b->version() != version;
+            }));
+    ASSERT_EQ(std::set<std::string>({"topic_c", "topic_d"}), interest_b->topics({test::prefix(1)}));
+
+    // C sends the participants of its subscriber to B, so B does not announce the readers of C back
+    auto publisher_b = std::unique_ptr<InterestPublisher>(new InterestPublisher(0, interest_b));
+    configuration.port = publisher_b->port();
+    InterestSubscriber subscriber_b(configuration);
+    subscriber_b.add_participant(test::prefix(3));
+
+    ASSERT_TRUE(test::wait_for([&subscriber_b]()
+            {
+                return subscriber_b.is_known() && subscriber_b.topics() == std::set<std::string>({"topic_a"});
+            }));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
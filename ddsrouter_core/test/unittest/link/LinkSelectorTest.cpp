@@ -0,0 +1,228 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/configuration/LinkGroupConfiguration.hpp>
+#include <ddsrouter_core/link/LinkProbe.hpp>
+#include <ddsrouter_core/link/LinkProbeResponder.hpp>
+#include <ddsrouter_core/link/LinkSelector.hpp>
+#include <ddsrouter_core/link/UdpSocket.hpp>
+
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+constexpr eprosima::utils::Duration_ms PROBE_PERIOD = 20;
+constexpr eprosima::utils::Duration_ms DETECTION_TIME = 100;
+
+//! Port where nobody answers the probes
+constexpr uint16_t DEAD_PORT = 9;
+
+//! Link group with a link for each port in localhost
+LinkGroupConfiguration link_group(
+        const uint16_t port_0,
+        const uint16_t port_1)
+{
+    LinkGroupConfiguration configuration;
+    configuration.name = "test";
+    configuration.probe_period = PROBE_PERIOD;
+    configuration.detection_time = DETECTION_TIME;
+    configuration.hysteresis = 5;
+
+    configuration.links.push_back({"link_0", "127.0.0.1", port_0});
+    configuration.links.push_back({"link_1", "127.0.0.1", port_1});
+
+    return configuration;
+}
+
+//! Wait for a condition to be true, up to 20 detection times
+template <typename Condition>
+bool wait_for(
+        Condition condition)
+{
+    for (unsigned int i = 0; i < 20 * DETECTION_TIME / PROBE_PERIOD; ++i)
+    {
+        if (condition())
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(PROBE_PERIOD));
+    }
+    return condition();
+}
+
+//! Send \c size bytes of \c data to \c port in localhost and return the size of the answer (-1 if none)
+int probe(
+        const uint16_t port,
+        const void* data,
+        const std::size_t size)
+{
+    UdpSocket socket;
+    socket.send_to(data, size, "127.0.0.1", port);
+
+    char answer[64];
+    if (!socket.wait_readable(DETECTION_TIME))
+    {
+        return -1;
+    }
+    return socket.receive(answer, sizeof(answer));
+}
+
+} /* namespace test */
+
+/**
+ * Test that every link is active while no link answers the probes
+ */
+TEST(LinkSelectorTest, all_links_active_without_answers)
+{
+    LinkSelector selector(test::link_group(test::DEAD_PORT, test::DEAD_PORT));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2 * test::DETECTION_TIME));
+
+    ASSERT_TRUE(selector.is_active(0));
+    ASSERT_TRUE(selector.is_active(1));
+    ASSERT_EQ(0, selector.link_index("link_0"));
+    ASSERT_EQ(1, selector.link_index("link_1"));
+    ASSERT_EQ(-1, selector.link_index("link_2"));
+}
+
+/**
+ * Test that the only link that answers the probes becomes the only active one
+ */
+TEST(LinkSelectorTest, select_alive_link)
+{
+    LinkProbeResponder responder(0);
+    LinkSelector selector(test::link_group(test::DEAD_PORT, responder.port()));
+
+    ASSERT_TRUE(test::wait_for([&selector]()
+            {
+                return !selector.is_active(0) && selector.is_active(1);
+            }));
+}
+
+/**
+ * Test that the data is sent through another link when the active one goes down
+ */
+TEST(LinkSelectorTest, failover)
+{
+    std::unique_ptr<LinkProbeResponder> responder_0(new LinkProbeResponder(0));
+    std::unique_ptr<LinkProbeResponder> responder_1(new LinkProbeResponder(0));
+    LinkSelector selector(test::link_group(responder_0->port(), responder_1->port()));
+
+    // Wait until a single link is active
+    ASSERT_TRUE(test::wait_for([&selector]()
+            {
+                return selector.is_active(0) != selector.is_active(1);
+            }));
+
+    // Make the active link go down
+    const int active_link = selector.is_active(0) ? 0 : 1;
+    if (active_link == 0)
+    {
+        responder_0.reset();
+    }
+    else
+    {
+        responder_1.reset();
+    }
+
+    ASSERT_TRUE(test::wait_for([&selector, active_link]()
+            {
+                return !selector.is_active(active_link) && selector.is_active(1 - active_link);
+            }));
+}
+
+/**
+ * Test that the responder only answers valid probes, and only from its peers if they are configured
+ */
+TEST(LinkSelectorTest, responder_only_answers_probes)
+{
+    const LinkProbe probe;
+    char datagram[2 * sizeof(LinkProbe)] = {};
+    std::memcpy(datagram, &probe, sizeof(probe));
+
+    {
+        LinkProbeResponder responder(0);
+
+        ASSERT_EQ(static_cast<int>(sizeof(probe)), test::probe(responder.port(), &probe, sizeof(probe)));
+
+        // Datagrams bigger or smaller than a probe
+        ASSERT_EQ(-1, test::probe(responder.port(), datagram, sizeof(datagram)));
+        ASSERT_EQ(-1, test::probe(responder.port(), datagram, sizeof(probe) - 1));
+
+        // Datagram of the size of a probe without its magic
+        LinkProbe invalid_probe;
+        invalid_probe.magic = 0;
+        ASSERT_EQ(-1, test::probe(responder.port(), &invalid_probe, sizeof(invalid_probe)));
+    }
+
+    {
+        LinkProbeResponder responder(0, {"127.0.0.1"});
+        ASSERT_EQ(static_cast<int>(sizeof(probe)), test::probe(responder.port(), &probe, sizeof(probe)));
+    }
+
+    {
+        LinkProbeResponder responder(0, {"10.0.0.2"});
+        ASSERT_EQ(-1, test::probe(responder.port(), &probe, sizeof(probe)));
+    }
+}
+
+/**
+ * Test the statistics of the links
+ */
+TEST(LinkSelectorTest, statistics)
+{
+    LinkProbeResponder responder(0);
+    LinkSelector selector(test::link_group(responder.port(), test::DEAD_PORT));
+
+    ASSERT_TRUE(test::wait_for([&selector]()
+            {
+                // Every link is active until one of them answers
+                return !selector.statistics().at("link_1").active;
+            }));
+
+    auto statistics = selector.statistics();
+    ASSERT_EQ(2u, statistics.size());
+
+    const auto& link_0 = statistics.at("link_0");
+    ASSERT_TRUE(link_0.alive);
+    ASSERT_TRUE(link_0.active);
+    ASSERT_GT(link_0.round_trip_time, 0u);
+    ASSERT_GT(link_0.probes_sent, 0u);
+    ASSERT_GT(link_0.probes_received, 0u);
+    ASSERT_EQ(1u, link_0.activations);
+
+    const auto& link_1 = statistics.at("link_1");
+    ASSERT_FALSE(link_1.alive);
+    ASSERT_FALSE(link_1.active);
+    ASSERT_EQ(0u, link_1.round_trip_time);
+    ASSERT_GT(link_1.probes_sent, 0u);
+    ASSERT_EQ(0u, link_1.probes_received);
+    ASSERT_EQ(0u, link_1.activations);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
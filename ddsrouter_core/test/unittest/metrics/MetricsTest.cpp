@@ -0,0 +1,457 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif // if !defined(_WIN32)
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <ddsrouter_core/metrics/CountingPayloadPool.hpp>
+#include <ddsrouter_core/metrics/IngressStamp.hpp>
+#include <ddsrouter_core/metrics/MetricsHttpServer.hpp>
+#include <ddsrouter_core/metrics/MetricsRegistry.hpp>
+#include <ddsrouter_core/metrics/PrometheusSerializer.hpp>
+#include <ddsrouter_core/metrics/ShardedCounter.hpp>
+#include <ddsrouter_core/metrics/StatisticsPubSubType.hpp>
+#include <ddsrouter_core/types/DdsRouterStatistics.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Position of a drop reason in \c TrafficStatistics::dropped_samples
+std::size_t index(
+        const types::DropReason reason)
+{
+    return static_cast<std::size_t>(reason);
+}
+
+#if !defined(_WIN32)
+//! Send \c request to a local TCP port and return the whole response
+std::string http_request(
+        const uint16_t port,
+        const std::string& request)
+{
+    int client = ::socket(AF_INET, SOCK_STREAM, 0);
+
+    sockaddr_in address {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+
+    std::string response;
+    if (::connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0)
+    {
+        ::send(client, request.data(), request.size(), 0);
+
+        char buffer[1024];
+        ssize_t received;
+        while ((received = ::recv(client, buffer, sizeof(buffer), 0)) > 0)
+        {
+            response.append(buffer, static_cast<std::size_t>(received));
+        }
+    }
+
+    ::close(client);
+    return response;
+}
+
+#endif // if !defined(_WIN32)
+
+} /* namespace test */
+
+/**
+ * Test that a counter accumulates the values added from a single thread
+ */
+TEST(MetricsTest, sharded_counter)
+{
+    ShardedCounter counter;
+    ASSERT_EQ(0u, counter.value());
+
+    counter.add();
+    counter.add(41);
+    ASSERT_EQ(42u, counter.value());
+
+    counter.reset();
+    ASSERT_EQ(0u, counter.value());
+}
+
+/**
+ * Test that a counter does not lose any value added concurrently from more threads than shards
+ */
+TEST(MetricsTest, sharded_counter_concurrent)
+{
+    constexpr unsigned int THREADS = ShardedCounter::SHARDS + 4;
+    constexpr unsigned int ADDS = 10000;
+
+    ShardedCounter counter;
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < THREADS; ++i)
+    {
+        threads.emplace_back([&counter]()
+                {
+                    for (unsigned int j = 0; j < ADDS; ++j)
+                    {
+                        counter.add();
+                    }
+                });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(THREADS * ADDS, counter.value());
+}
+
+/**
+ * Test that the registry shares the counters of the same topic and participant and reports their traffic
+ */
+TEST(MetricsTest, registry_traffic)
+{
+    MetricsRegistry registry;
+    ASSERT_TRUE(registry.traffic().empty());
+
+    auto reader_counters = registry.reader_counters("participant_1", "topic");
+    ASSERT_EQ(reader_counters, registry.reader_counters("participant_1", "topic"));
+    ASSERT_NE(reader_counters, registry.reader_counters("participant_2", "topic"));
+
+    auto writer_counters = registry.writer_counters("participant_2", "topic");
+
+    reader_counters->samples_received.add(3);
+    reader_counters->bytes_received.add(300);
+    reader_counters->expired_samples.add();
+    writer_counters->samples_sent.add(2);
+    writer_counters->bytes_sent.add(200);
+    writer_counters->uninterested_samples.add(4);
+
+    auto traffic = registry.traffic();
+    ASSERT_EQ(1u, traffic.size());
+    ASSERT_EQ(2u, traffic["topic"].size());
+
+    const types::TrafficStatistics& participant_1 = traffic["topic"]["participant_1"];
+    ASSERT_EQ(3u, participant_1.samples_received);
+    ASSERT_EQ(300u, participant_1.bytes_received);
+    ASSERT_EQ(0u, participant_1.samples_sent);
+    ASSERT_EQ(1u, participant_1.dropped_samples[test::index(types::DropReason::expired)]);
+
+    const types::TrafficStatistics& participant_2 = traffic["topic"]["participant_2"];
+    ASSERT_EQ(0u, participant_2.samples_received);
+    ASSERT_EQ(2u, participant_2.samples_sent);
+    ASSERT_EQ(200u, participant_2.bytes_sent);
+    ASSERT_EQ(4u, participant_2.dropped_samples[test::index(types::DropReason::uninterested)]);
+}
+
+/**
+ * Test the aggregation of the traffic by topic and by participant
+ */
+TEST(MetricsTest, statistics_aggregation)
+{
+    types::DdsRouterStatistics statistics;
+    statistics.traffic["topic_a"]["participant_1"].samples_received = 1;
+    statistics.traffic["topic_a"]["participant_2"].samples_received = 2;
+    statistics.traffic["topic_b"]["participant_1"].samples_received = 4;
+    statistics.traffic["topic_b"]["participant_1"].dropped_samples[test::index(types::DropReason::duplicated)] = 8;
+
+    auto topics = statistics.topics();
+    ASSERT_EQ(2u, topics.size());
+    ASSERT_EQ(3u, topics["topic_a"].samples_received);
+    ASSERT_EQ(4u, topics["topic_b"].samples_received);
+    ASSERT_EQ(8u, topics["topic_b"].dropped_samples[test::index(types::DropReason::duplicated)]);
+
+    auto participants = statistics.participants();
+    ASSERT_EQ(2u, participants.size());
+    ASSERT_EQ(5u, participants["participant_1"].samples_received);
+    ASSERT_EQ(2u, participants["participant_2"].samples_received);
+    ASSERT_EQ(8u, participants["participant_1"].dropped_samples[test::index(types::DropReason::duplicated)]);
+}
+
+/**
+ * Test that the ingress stamp is only returned for the sample it was set for, and in the same thread, until reset
+ */
+TEST(MetricsTest, ingress_stamp)
+{
+    ddspipe::core::types::RtpsPayloadData data;
+    ddspipe::core::types::RtpsPayloadData other_data;
+    const ddspipe::core::types::ParticipantId source("participant_1");
+
+    IngressStamp stamp;
+    stamp.data = &data;
+    stamp.source = &source;
+    stamp.time_ns = 42;
+    IngressStamp::set(stamp);
+
+    const IngressStamp* result = IngressStamp::get(data);
+    ASSERT_NE(nullptr, result);
+    ASSERT_EQ(&source, result->source);
+    ASSERT_EQ(42, result->time_ns);
+
+    ASSERT_EQ(nullptr, IngressStamp::get(other_data));
+    ASSERT_EQ(result, IngressStamp::current());
+
+    std::thread([&data]()
+            {
+                ASSERT_EQ(nullptr, IngressStamp::get(data));
+                ASSERT_EQ(nullptr, IngressStamp::current());
+            }).join();
+
+    // The stamp is forgotten before taking the next sample
+    IngressStamp::reset();
+    ASSERT_EQ(nullptr, IngressStamp::get(data));
+    ASSERT_EQ(nullptr, IngressStamp::current());
+}
+
+/**
+ * Test that the registry reports the latencies of every route of every topic
+ */
+TEST(MetricsTest, registry_latencies)
+{
+    MetricsRegistry registry(true);
+    ASSERT_TRUE(registry.source_latency());
+    ASSERT_FALSE(MetricsRegistry().source_latency());
+    ASSERT_TRUE(registry.latencies().empty());
+
+    auto writer_counters = registry.writer_counters("participant_2", "topic");
+    ASSERT_EQ(writer_counters->route_latencies.get("participant_1"), writer_counters->route_latencies.get("participant_1"));
+
+    for (uint64_t latency = 1; latency <= 100; ++latency)
+    {
+        writer_counters->route_latencies.get("participant_1")->router.record(latency * 1000);
+    }
+    writer_counters->route_latencies.get("participant_3")->source->record(5000);
+
+    auto latencies = registry.latencies();
+    ASSERT_EQ(1u, latencies.size());
+    ASSERT_EQ(2u, latencies["topic"].size());
+
+    const types::RouteLatencyStatistics& route_1 = latencies["topic"][{"participant_1", "participant_2"}];
+    ASSERT_EQ(100u, route_1.router.count);
+    ASSERT_EQ(100000u, route_1.router.max);
+    ASSERT_NEAR(50000.0, static_cast<double>(route_1.router.p50), 50000.0 / types::LatencyHistogram::SUB_BUCKETS);
+    ASSERT_EQ(0u, route_1.source.count);
+
+    const types::RouteLatencyStatistics& route_3 = latencies["topic"][{"participant_3", "participant_2"}];
+    ASSERT_EQ(0u, route_3.router.count);
+    ASSERT_EQ(1u, route_3.source.count);
+}
+
+/**
+ * Test that the latencies of a route are got by the index of the source participant, and that the accounting of the
+ * route latencies is switched in every writer at once
+ *
+ * CASES:
+ * - participant indexes
+ * - source index cached
+ * - source index not cached
+ * - route latency switch
+ */
+TEST(MetricsTest, route_latency_cache)
+{
+    MetricsRegistry registry;
+
+    // Participant indexes
+    ASSERT_EQ(0u, registry.participant_index("participant_1"));
+    ASSERT_EQ(1u, registry.participant_index("participant_2"));
+    ASSERT_EQ(0u, registry.participant_index("participant_1"));
+
+    auto writer_counters = registry.writer_counters("participant_2", "topic");
+
+    // Source index cached
+    RouteLatency* cached = writer_counters->route_latencies.get("participant_1", 0);
+    ASSERT_EQ(writer_counters->route_latencies.get("participant_1").get(), cached);
+    ASSERT_EQ(nullptr, cached->source);
+    ASSERT_EQ(cached, writer_counters->route_latencies.get("participant_1", 0));
+
+    // Source index not cached
+    RouteLatency* not_cached = writer_counters->route_latencies.get("participant_3", RouteLatencies::CACHED_SOURCES);
+    ASSERT_EQ(writer_counters->route_latencies.get("participant_3").get(), not_cached);
+    ASSERT_EQ(not_cached,
+            writer_counters->route_latencies.get("participant_3", IngressStamp::UNKNOWN_SOURCE_INDEX));
+
+    // Route latency switch
+    auto route_latency = registry.route_latency();
+    ASSERT_TRUE(route_latency->load());
+    registry.set_route_latency(false);
+    ASSERT_FALSE(route_latency->load());
+    ASSERT_FALSE(MetricsRegistry(false, false).route_latency()->load());
+}
+
+/**
+ * Test the Prometheus text format of the statistics
+ */
+TEST(MetricsTest, prometheus_text)
+{
+    types::DdsRouterStatistics statistics;
+    statistics.traffic["topic\"a"]["participant_1"].samples_received = 3;
+    statistics.traffic["topic\"a"]["participant_1"].bytes_sent = 100;
+    statistics.traffic["topic\"a"]["participant_1"].dropped_samples[test::index(types::DropReason::expired)] = 2;
+    statistics.payloads_in_use = 7;
+    statistics.latencies["topic"][{"participant_1", "participant_2"}].router.count = 1;
+    statistics.latencies["topic"][{"participant_1", "participant_2"}].router.max = 2000000;
+
+    const std::string text = to_prometheus_text(statistics);
+
+    ASSERT_NE(std::string::npos, text.find("# TYPE ddsrouter_samples_received_total counter\n"));
+    ASSERT_NE(std::string::npos,
+            text.find("ddsrouter_samples_received_total{topic=\"topic\\\"a\",participant=\"participant_1\"} 3\n"));
+    ASSERT_NE(std::string::npos,
+            text.find("ddsrouter_bytes_sent_total{topic=\"topic\\\"a\",participant=\"participant_1\"} 100\n"));
+    ASSERT_NE(std::string::npos,
+            text.find("ddsrouter_dropped_samples_total{topic=\"topic\\\"a\",participant=\"participant_1\","
+            "reason=\"expired\"} 2\n"));
+    ASSERT_NE(std::string::npos, text.find("# TYPE ddsrouter_payloads_in_use gauge\n"));
+    ASSERT_NE(std::string::npos, text.find("ddsrouter_payloads_in_use 7\n"));
+    ASSERT_NE(std::string::npos, text.find("# TYPE ddsrouter_router_latency_seconds summary\n"));
+    ASSERT_NE(std::string::npos,
+            text.find("ddsrouter_router_latency_seconds{topic=\"topic\",source=\"participant_1\","
+            "destination=\"participant_2\",quantile=\"1\"} 0.002\n"));
+    ASSERT_NE(std::string::npos,
+            text.find("ddsrouter_router_latency_seconds_count{topic=\"topic\",source=\"participant_1\","
+            "destination=\"participant_2\"} 1\n"));
+
+    // Metrics of features not in use are not reported
+    ASSERT_EQ(std::string::npos, text.find("ddsrouter_source_latency_seconds"));
+    ASSERT_EQ(std::string::npos, text.find("ddsrouter_link_"));
+    ASSERT_EQ(std::string::npos, text.find("ddsrouter_redundancy_"));
+}
+
+/**
+ * Test that the metrics are served in /metrics and other requests are rejected
+ */
+TEST(MetricsTest, http_server)
+{
+#if defined(_WIN32)
+    GTEST_SKIP();
+#else
+    MetricsHttpServer server(0, []()
+            {
+                return std::string("ddsrouter_payloads_in_use 7\n");
+            });
+    ASSERT_NE(0u, server.port());
+
+    const std::string metrics = test::http_request(server.port(), "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    ASSERT_EQ(0u, metrics.find("HTTP/1.1 200 OK\r\n"));
+    ASSERT_NE(std::string::npos, metrics.find("Content-Type: text/plain; version=0.0.4"));
+    ASSERT_NE(std::string::npos, metrics.find("\r\n\r\nddsrouter_payloads_in_use 7\n"));
+
+    const std::string not_found = test::http_request(server.port(), "GET /other HTTP/1.1\r\n\r\n");
+    ASSERT_EQ(0u, not_found.find("HTTP/1.1 404 Not Found\r\n"));
+
+    const std::string not_allowed = test::http_request(server.port(), "POST /metrics HTTP/1.1\r\n\r\n");
+    ASSERT_EQ(0u, not_allowed.find("HTTP/1.1 405 Method Not Allowed\r\n"));
+#endif // if defined(_WIN32)
+}
+
+/**
+ * Test that every payload given by the pool is counted once, whether it is copied from another pool or referenced
+ *
+ * CASES:
+ * - copy of a payload owned by another pool
+ * - copy of a payload without owner
+ * - reference to a payload owned by the pool
+ */
+TEST(MetricsTest, counting_payload_pool)
+{
+    CountingPayloadPool pool;
+    ddspipe::core::FastPayloadPool other_pool;
+
+    ddspipe::core::types::Payload src_payload;
+    ASSERT_TRUE(other_pool.get_payload(16, src_payload));
+    src_payload.length = 16;
+
+    // Copy of a payload owned by another pool
+    {
+        ddspipe::core::PayloadPool* data_owner = &other_pool;
+        ddspipe::core::types::Payload payload;
+        ASSERT_TRUE(pool.get_payload(src_payload, data_owner, payload));
+        ASSERT_EQ(1u, pool.payloads_in_use());
+
+        ASSERT_TRUE(pool.release_payload(payload));
+        ASSERT_EQ(0u, pool.payloads_in_use());
+    }
+
+    // Copy of a payload without owner
+    ddspipe::core::PayloadPool* data_owner = nullptr;
+    ddspipe::core::types::Payload payload;
+    ASSERT_TRUE(pool.get_payload(src_payload, data_owner, payload));
+    ASSERT_EQ(&pool, data_owner);
+    ASSERT_EQ(1u, pool.payloads_in_use());
+
+    // Reference to a payload owned by the pool
+    {
+        ddspipe::core::types::Payload reference;
+        ASSERT_TRUE(pool.get_payload(payload, data_owner, reference));
+        ASSERT_EQ(2u, pool.payloads_in_use());
+
+        ASSERT_TRUE(pool.release_payload(reference));
+        ASSERT_EQ(1u, pool.payloads_in_use());
+    }
+
+    ASSERT_TRUE(pool.release_payload(payload));
+    ASSERT_EQ(0u, pool.payloads_in_use());
+
+    ASSERT_TRUE(other_pool.release_payload(src_payload));
+}
+
+/**
+ * Test that the statistics published in the DDS topic are serialized and deserialized back
+ */
+TEST(MetricsTest, statistics_type)
+{
+    StatisticsPubSubType type;
+    ASSERT_EQ(std::string(StatisticsPubSubType::TYPE_NAME), type.getName());
+
+    StatisticsSample sample;
+    sample.timestamp = 1697712345123456789ull;
+    sample.metrics = "ddsrouter_payloads_in_use 7\n";
+
+    const uint32_t size = type.getSerializedSizeProvider(&sample)();
+    ASSERT_EQ(StatisticsPubSubType::serialized_size(sample), size);
+
+    fastrtps::rtps::SerializedPayload_t payload(size);
+    ASSERT_TRUE(type.serialize(&sample, &payload));
+    ASSERT_EQ(size, payload.length);
+
+    StatisticsSample result;
+    ASSERT_TRUE(type.deserialize(&payload, &result));
+    ASSERT_EQ(sample.timestamp, result.timestamp);
+    ASSERT_EQ(sample.metrics, result.metrics);
+
+    // A payload too small for the sample is not serialized
+    fastrtps::rtps::SerializedPayload_t small_payload(size - 1);
+    ASSERT_FALSE(type.serialize(&sample, &small_payload));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
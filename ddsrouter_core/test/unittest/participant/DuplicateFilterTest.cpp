@@ -0,0 +1,153 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/types/dds/Guid.hpp>
+
+#include <ddsrouter_core/participant/DuplicateFilter.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Lease of the filters whose windows expire in the tests (ms)
+constexpr utils::Duration_ms LEASE = 100;
+
+//! GUID of a different writer for each \c index
+ddspipe::core::types::Guid writer_guid(
+        const uint8_t index)
+{
+    ddspipe::core::types::Guid guid;
+    guid.guidPrefix.value[0] = index;
+    guid.entityId.value[3] = 0x03;
+    return guid;
+}
+
+} /* namespace test */
+
+/**
+ * Test that a sample is only inserted the first time, for each writer independently
+ */
+TEST(DuplicateFilterTest, duplicates)
+{
+    DuplicateFilter filter(64, 60000);
+
+    ASSERT_TRUE(filter.insert(test::writer_guid(1), 1));
+    ASSERT_TRUE(filter.insert(test::writer_guid(1), 2));
+    ASSERT_FALSE(filter.insert(test::writer_guid(1), 1));
+    ASSERT_FALSE(filter.insert(test::writer_guid(1), 2));
+
+    // Same sequence number from another writer
+    ASSERT_TRUE(filter.insert(test::writer_guid(2), 1));
+    ASSERT_FALSE(filter.insert(test::writer_guid(2), 1));
+
+    ASSERT_EQ(2u, filter.size());
+}
+
+/**
+ * Test that the window of a writer is forgotten when it is erased, and only that one
+ */
+TEST(DuplicateFilterTest, erase)
+{
+    DuplicateFilter filter(64, 60000);
+
+    ASSERT_TRUE(filter.insert(test::writer_guid(1), 1));
+    ASSERT_TRUE(filter.insert(test::writer_guid(2), 1));
+
+    filter.erase(test::writer_guid(1));
+    ASSERT_EQ(1u, filter.size());
+
+    ASSERT_TRUE(filter.insert(test::writer_guid(1), 1));
+    ASSERT_FALSE(filter.insert(test::writer_guid(2), 1));
+
+    // Erasing an unknown writer does nothing
+    filter.erase(test::writer_guid(3));
+    ASSERT_EQ(2u, filter.size());
+}
+
+/**
+ * Test that the window of an origin forwarded by other routers is erased when every writer that delivered it
+ * has been undiscovered, and not before
+ */
+TEST(DuplicateFilterTest, erase_senders)
+{
+    DuplicateFilter filter(64, 60000);
+
+    // The same origin received through two paths
+    ASSERT_TRUE(filter.insert(test::writer_guid(1), 1, test::writer_guid(10)));
+    ASSERT_FALSE(filter.insert(test::writer_guid(1), 1, test::writer_guid(11)));
+    ASSERT_TRUE(filter.insert(test::writer_guid(2), 1, test::writer_guid(10)));
+
+    // Erasing the origin itself does nothing, as it is not a sender
+    filter.erase(test::writer_guid(1));
+    ASSERT_EQ(2u, filter.size());
+
+    // The copies of the origin still arriving through the other path are detected
+    filter.erase(test::writer_guid(10));
+    ASSERT_EQ(1u, filter.size());
+    ASSERT_FALSE(filter.insert(test::writer_guid(1), 1, test::writer_guid(11)));
+
+    filter.erase(test::writer_guid(11));
+    ASSERT_EQ(0u, filter.size());
+    ASSERT_TRUE(filter.insert(test::writer_guid(1), 1, test::writer_guid(11)));
+}
+
+/**
+ * Test that the windows of the writers without samples for longer than the lease are erased,
+ * while the windows of the writers still publishing are kept
+ */
+TEST(DuplicateFilterTest, lease)
+{
+    DuplicateFilter filter(64, test::LEASE);
+
+    // Writers in every shard
+    constexpr uint8_t WRITERS = 64;
+    for (uint8_t i = 0; i < WRITERS; ++i)
+    {
+        ASSERT_TRUE(filter.insert(test::writer_guid(i), 1));
+    }
+    ASSERT_EQ(WRITERS, filter.size());
+
+    // Keep only the first writer publishing, until the lease of the rest expires twice
+    for (int i = 0; i < 4; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(test::LEASE / 2 + 10));
+        ASSERT_TRUE(filter.insert(test::writer_guid(0), 2 + i));
+    }
+
+    // The windows of the rest have been erased, so their samples are new again
+    for (uint8_t i = 1; i < WRITERS; ++i)
+    {
+        ASSERT_TRUE(filter.insert(test::writer_guid(i), 1));
+    }
+
+    ASSERT_EQ(WRITERS, filter.size());
+    ASSERT_FALSE(filter.insert(test::writer_guid(0), 1));
+    ASSERT_FALSE(filter.insert(test::writer_guid(0), 5));
+    ASSERT_FALSE(filter.insert(test::writer_guid(1), 1));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
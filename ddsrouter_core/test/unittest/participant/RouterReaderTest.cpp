@@ -0,0 +1,285 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <chrono>
+#include <deque>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/participant/DuplicateFilter.hpp>
+#include <ddsrouter_core/participant/RouterReader.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Latency budget of the readers tested (ms)
+constexpr utils::Duration_ms MAX_AGE = 50;
+
+//! Time a sample waits to exceed \c MAX_AGE
+constexpr std::chrono::milliseconds EXPIRATION_WAIT(MAX_AGE * 2);
+
+/**
+ * Reader that notifies each sample as it is received, as the readers of the DDS Pipe do.
+ */
+class MockReader : public ddspipe::core::IReader
+{
+public:
+
+    //! Receive a sample identified by \c sequence and notify it
+    void receive(
+            const uint64_t sequence,
+            const uint64_t related_sequence = 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            samples_.push_back({sequence, related_sequence});
+        }
+        on_data_available_();
+    }
+
+    //! Remove the oldest sample without notifying it, as a KEEP_LAST history replacing it
+    void evict_oldest()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        samples_.pop_front();
+    }
+
+    void enable() noexcept override
+    {
+    }
+
+    void disable() noexcept override
+    {
+    }
+
+    void set_on_data_available_callback(
+            std::function<void()> on_data_available_lambda) noexcept override
+    {
+        on_data_available_ = on_data_available_lambda;
+    }
+
+    void unset_on_data_available_callback() noexcept override
+    {
+        on_data_available_ = []()
+                {
+                };
+    }
+
+    utils::ReturnCode take(
+            std::unique_ptr<ddspipe::core::IRoutingData>& data) noexcept override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (samples_.empty())
+        {
+            return utils::ReturnCode::RETCODE_NO_DATA;
+        }
+
+        std::unique_ptr<ddspipe::core::types::RtpsPayloadData> sample(new ddspipe::core::types::RtpsPayloadData());
+        sample->origin_sequence_number = fastrtps::rtps::SequenceNumber_t(samples_.front().sequence);
+        if (samples_.front().related_sequence != 0)
+        {
+            fastrtps::rtps::SampleIdentity identity;
+            identity.writer_guid(related_writer_guid());
+            identity.sequence_number(fastrtps::rtps::SequenceNumber_t(samples_.front().related_sequence));
+
+            fastrtps::rtps::WriteParams write_params;
+            write_params.related_sample_identity(identity);
+            sample->write_params.set_value(write_params);
+        }
+        samples_.pop_front();
+        data.reset(sample.release());
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    //! Writer of the related sample identity of the samples received with one
+    static ddspipe::core::types::Guid related_writer_guid()
+    {
+        ddspipe::core::types::Guid guid;
+        guid.guidPrefix.value[0] = 1;
+        guid.entityId.value[3] = 0x03;
+        return guid;
+    }
+
+    ddspipe::core::types::Guid guid() const override
+    {
+        return ddspipe::core::types::Guid();
+    }
+
+    fastrtps::RecursiveTimedMutex& get_rtps_mutex() const override
+    {
+        return rtps_mutex_;
+    }
+
+    uint64_t get_unread_count() const override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return samples_.size();
+    }
+
+    ddspipe::core::types::DdsTopic topic() const override
+    {
+        ddspipe::core::types::DdsTopic topic;
+        topic.m_topic_name = "topic";
+        topic.type_name = "type";
+        return topic;
+    }
+
+    ddspipe::core::types::ParticipantId participant_id() const override
+    {
+        return "participant";
+    }
+
+protected:
+
+    //! Sample received, with the sequence number of its related sample identity (0 if it has none)
+    struct Sample
+    {
+        uint64_t sequence;
+        uint64_t related_sequence;
+    };
+
+    mutable std::mutex mutex_;
+
+    mutable fastrtps::RecursiveTimedMutex rtps_mutex_;
+
+    std::deque<Sample> samples_;
+
+    std::function<void()> on_data_available_ = []()
+            {
+            };
+};
+
+//! Sequence number of the sample taken from \c reader , or 0 if none
+uint64_t take_sequence(
+        RouterReader& reader,
+        bool* write_params_set = nullptr)
+{
+    std::unique_ptr<ddspipe::core::IRoutingData> data;
+    if (reader.take(data) != utils::ReturnCode::RETCODE_OK)
+    {
+        return 0;
+    }
+
+    const auto& rtps_data = dynamic_cast<ddspipe::core::types::RtpsPayloadData&>(*data);
+    if (write_params_set != nullptr)
+    {
+        *write_params_set = rtps_data.write_params.is_set();
+    }
+    return rtps_data.origin_sequence_number.to64long();
+}
+
+} /* namespace test */
+
+/**
+ * Test that a sample that waited longer than the max age expires, even if other samples keep arriving after it
+ */
+TEST(RouterReaderTest, max_age_under_steady_traffic)
+{
+    auto mock = std::make_shared<test::MockReader>();
+    auto counters = std::make_shared<RouterReaderCounters>();
+    RouterReader reader(mock, "topic", test::MAX_AGE, nullptr, counters);
+    reader.set_on_data_available_callback([]()
+            {
+            });
+
+    mock->receive(1);
+    std::this_thread::sleep_for(test::EXPIRATION_WAIT);
+    mock->receive(2);
+
+    // The first sample is discarded, even if the last notification is recent
+    ASSERT_EQ(2u, test::take_sequence(reader));
+    ASSERT_EQ(0u, test::take_sequence(reader));
+    ASSERT_EQ(2u, counters->samples_received.value());
+    ASSERT_EQ(1u, counters->expired_samples.value());
+}
+
+/**
+ * Test that the reception of a sample removed without being taken is not applied to the next sample
+ */
+TEST(RouterReaderTest, max_age_after_eviction)
+{
+    auto mock = std::make_shared<test::MockReader>();
+    auto counters = std::make_shared<RouterReaderCounters>();
+    RouterReader reader(mock, "topic", test::MAX_AGE, nullptr, counters);
+    reader.set_on_data_available_callback([]()
+            {
+            });
+
+    mock->receive(1);
+    std::this_thread::sleep_for(test::EXPIRATION_WAIT);
+    mock->evict_oldest();
+    mock->receive(2);
+    mock->receive(3);
+
+    // The second and third samples have just been received
+    ASSERT_EQ(2u, test::take_sequence(reader));
+    ASSERT_EQ(3u, test::take_sequence(reader));
+    ASSERT_EQ(0u, counters->expired_samples.value());
+}
+
+/**
+ * Test that the related sample identity of the samples is not taken as their origin, unless the reader receives
+ * the samples stamped by other DDS Routers, in which case it is removed from the samples forwarded
+ */
+TEST(RouterReaderTest, origin_stamp)
+{
+    auto counters = std::make_shared<RouterReaderCounters>();
+    bool write_params_set = false;
+
+    // The related sample identity of an application is kept as is, and each sample is a different one
+    {
+        auto mock = std::make_shared<test::MockReader>();
+        RouterReader reader(mock, "topic", 0, std::make_shared<DuplicateFilter>(64, 60000), counters);
+
+        mock->receive(1, 7);
+        mock->receive(2, 7);
+
+        ASSERT_EQ(1u, test::take_sequence(reader, &write_params_set));
+        ASSERT_TRUE(write_params_set);
+        ASSERT_EQ(2u, test::take_sequence(reader, &write_params_set));
+        ASSERT_TRUE(write_params_set);
+        ASSERT_EQ(0u, counters->duplicated_samples.value());
+    }
+
+    // The origin stamped by another DDS Router identifies the sample, and it is not forwarded
+    {
+        auto mock = std::make_shared<test::MockReader>();
+        RouterReader reader(mock, "topic", 0, std::make_shared<DuplicateFilter>(64, 60000), counters,
+                nullptr, IngressStamp::UNKNOWN_SOURCE_INDEX, true);
+
+        mock->receive(1, 7);
+        mock->receive(2, 7);
+
+        ASSERT_EQ(1u, test::take_sequence(reader, &write_params_set));
+        ASSERT_FALSE(write_params_set);
+        ASSERT_EQ(0u, test::take_sequence(reader));
+        ASSERT_EQ(1u, counters->duplicated_samples.value());
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,133 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
+#include <ddsrouter_core/participant/SinkParticipant.hpp>
+#include <ddsrouter_core/types/GeneratedSample.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Sink participant with checksum verification \c verify_checksum
+SinkParticipant sink_participant(
+        const bool verify_checksum)
+{
+    auto configuration = std::make_shared<SinkParticipantConfiguration>();
+    configuration->id = "sink";
+    configuration->verify_checksum = verify_checksum;
+    return SinkParticipant(configuration);
+}
+
+//! Sample with a generated payload of \c size bytes
+std::unique_ptr<ddspipe::core::types::RtpsPayloadData> generated_data(
+        const uint32_t size,
+        const uint64_t sequence)
+{
+    types::GeneratedSample sample("topic", size);
+
+    std::unique_ptr<ddspipe::core::types::RtpsPayloadData> data(new ddspipe::core::types::RtpsPayloadData());
+    data->payload.reserve(size);
+    sample.serialize(0, sequence, data->payload.data);
+    data->payload.length = size;
+    return data;
+}
+
+//! Topic of the samples
+ddspipe::core::types::DdsTopic topic()
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic";
+    topic.type_name = types::GeneratedSample::TYPE_NAME;
+    return topic;
+}
+
+} /* namespace test */
+
+/**
+ * Test that the samples written in every writer are accounted in the counters of the participant
+ */
+TEST(SinkParticipantTest, count_samples)
+{
+    SinkParticipant participant = test::sink_participant(false);
+    ASSERT_EQ("sink", participant.id());
+    ASSERT_FALSE(participant.is_rtps_kind());
+
+    auto writer = participant.create_writer(test::topic());
+    auto other_writer = participant.create_writer(test::topic());
+
+    for (uint64_t i = 0; i < 10; ++i)
+    {
+        auto data = test::generated_data(100, i);
+        ASSERT_TRUE(writer->write(*data) == utils::ReturnCode::RETCODE_OK);
+        ASSERT_TRUE(other_writer->write(*data) == utils::ReturnCode::RETCODE_OK);
+    }
+
+    ASSERT_EQ(20u, participant.counters().samples.value());
+    ASSERT_EQ(2000u, participant.counters().bytes.value());
+    ASSERT_EQ(0u, participant.counters().invalid_samples.value());
+
+    // The sink does not produce samples
+    auto reader = participant.create_reader(test::topic());
+    std::unique_ptr<ddspipe::core::IRoutingData> data;
+    ASSERT_TRUE(reader->take(data) == utils::ReturnCode::RETCODE_NO_DATA);
+}
+
+/**
+ * Test that samples with an invalid checksum are accounted if the checksum is verified
+ */
+TEST(SinkParticipantTest, verify_checksum)
+{
+    auto corrupted_data = test::generated_data(100, 1);
+    corrupted_data->payload.data[50] ^= 0x01;
+
+    // Not verified
+    {
+        SinkParticipant participant = test::sink_participant(false);
+        auto writer = participant.create_writer(test::topic());
+
+        ASSERT_TRUE(writer->write(*corrupted_data) == utils::ReturnCode::RETCODE_OK);
+        ASSERT_EQ(1u, participant.counters().samples.value());
+        ASSERT_EQ(0u, participant.counters().invalid_samples.value());
+    }
+
+    // Verified
+    {
+        SinkParticipant participant = test::sink_participant(true);
+        auto writer = participant.create_writer(test::topic());
+
+        ASSERT_TRUE(writer->write(*test::generated_data(100, 0)) == utils::ReturnCode::RETCODE_OK);
+        ASSERT_TRUE(writer->write(*corrupted_data) == utils::ReturnCode::RETCODE_OK);
+        ASSERT_TRUE(writer->write(*corrupted_data) == utils::ReturnCode::RETCODE_OK);
+
+        ASSERT_EQ(3u, participant.counters().samples.value());
+        ASSERT_EQ(2u, participant.counters().invalid_samples.value());
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,467 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/recorder/Lz4Frame.hpp>
+#include <ddsrouter_core/recorder/McapFormat.hpp>
+#include <ddsrouter_core/recorder/McapRecorder.hpp>
+#include <ddsrouter_core/recorder/McapWriter.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Message read from a MCAP file
+struct Message
+{
+    uint16_t channel_id;
+    uint32_t sequence;
+    uint64_t log_time;
+    std::vector<uint8_t> data;
+};
+
+template <typename T>
+T read_integer(
+        const uint8_t*& input)
+{
+    uint64_t value = 0;
+    for (unsigned int i = 0; i < sizeof(T); ++i)
+    {
+        value |= static_cast<uint64_t>(*input++) << (8 * i);
+    }
+    return static_cast<T>(value);
+}
+
+std::string read_string(
+        const uint8_t*& input)
+{
+    const uint32_t size = read_integer<uint32_t>(input);
+    std::string value(reinterpret_cast<const char*>(input), size);
+    input += size;
+    return value;
+}
+
+//! Append the messages of the records in \c data to \c messages , and return the opcodes of the records
+std::vector<McapOpcode> read_records(
+        const uint8_t* data,
+        const uint64_t size,
+        std::vector<Message>& messages)
+{
+    std::vector<McapOpcode> opcodes;
+    const uint8_t* input = data;
+
+    while (input < data + size)
+    {
+        const McapOpcode opcode = static_cast<McapOpcode>(*input++);
+        const uint64_t length = read_integer<uint64_t>(input);
+        const uint8_t* content = input;
+        input += length;
+        opcodes.push_back(opcode);
+
+        if (opcode == McapOpcode::message)
+        {
+            Message message;
+            message.channel_id = read_integer<uint16_t>(content);
+            message.sequence = read_integer<uint32_t>(content);
+            message.log_time = read_integer<uint64_t>(content);
+            read_integer<uint64_t>(content);
+            message.data.assign(content, input);
+            messages.push_back(message);
+        }
+        else if (opcode == McapOpcode::chunk)
+        {
+            read_integer<uint64_t>(content);
+            read_integer<uint64_t>(content);
+            const uint64_t uncompressed_size = read_integer<uint64_t>(content);
+            read_integer<uint32_t>(content);
+            const std::string compression = read_string(content);
+            const uint64_t records_size = read_integer<uint64_t>(content);
+
+            std::vector<uint8_t> records;
+            if (compression == MCAP_COMPRESSION_LZ4)
+            {
+                EXPECT_TRUE(Lz4Frame::decompress(content, records_size, records));
+            }
+            else
+            {
+                EXPECT_EQ(MCAP_COMPRESSION_NONE, compression);
+                records.assign(content, content + records_size);
+            }
+            EXPECT_EQ(uncompressed_size, records.size());
+
+            read_records(records.data(), records.size(), messages);
+        }
+    }
+
+    return opcodes;
+}
+
+//! Read the messages of a MCAP file, checking its structure
+std::vector<Message> read_file(
+        const std::filesystem::path& file_name)
+{
+    std::ifstream file(file_name, std::ios::binary);
+    std::vector<uint8_t> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    const uint64_t magic_size = sizeof(MCAP_MAGIC);
+    EXPECT_GE(content.size(), 2 * magic_size);
+    EXPECT_EQ(0, std::memcmp(content.data(), MCAP_MAGIC, magic_size));
+    EXPECT_EQ(0, std::memcmp(content.data() + content.size() - magic_size, MCAP_MAGIC, magic_size));
+
+    std::vector<Message> messages;
+    std::vector<McapOpcode> opcodes =
+            read_records(content.data() + magic_size, content.size() - 2 * magic_size, messages);
+
+    EXPECT_GE(opcodes.size(), 3u);
+    EXPECT_TRUE(opcodes.front() == McapOpcode::header);
+    EXPECT_TRUE(opcodes[opcodes.size() - 2] == McapOpcode::data_end);
+    EXPECT_TRUE(opcodes.back() == McapOpcode::footer);
+
+    return messages;
+}
+
+//! Empty directory for the files of a test
+std::filesystem::path test_directory(
+        const std::string& name)
+{
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / ("McapRecorderTest_" + name);
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    return directory;
+}
+
+//! Files in \c directory , sorted by name
+std::vector<std::filesystem::path> files_in(
+        const std::filesystem::path& directory)
+{
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        files.push_back(entry.path());
+    }
+    std::sort(files.begin(), files.end(), [](const std::filesystem::path& a, const std::filesystem::path& b)
+            {
+                // Numeric order of the index of the file, the last part of its name
+                auto index = [](const std::filesystem::path& path)
+                        {
+                            const std::string stem = path.stem().string();
+                            return std::stoul(stem.substr(stem.rfind('_') + 1));
+                        };
+                return index(a) < index(b);
+            });
+    return files;
+}
+
+//! Configuration of a recorder writing in \c directory
+std::shared_ptr<RecorderParticipantConfiguration> recorder_configuration(
+        const std::filesystem::path& directory)
+{
+    auto configuration = std::make_shared<RecorderParticipantConfiguration>();
+    configuration->id = "recorder";
+    configuration->file_prefix = (directory / "test").string();
+    configuration->chunk_size = 1024;
+    return configuration;
+}
+
+//! Topic recorded
+ddspipe::core::types::DdsTopic topic(
+        const std::string& name)
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = name;
+    topic.type_name = "type";
+    return topic;
+}
+
+//! Sample with a payload of \c size bytes from \c pool , whose bytes are \c value
+std::unique_ptr<ddspipe::core::types::RtpsPayloadData> data(
+        const std::shared_ptr<ddspipe::core::PayloadPool>& pool,
+        const uint32_t size,
+        const uint8_t value)
+{
+    std::unique_ptr<ddspipe::core::types::RtpsPayloadData> data(new ddspipe::core::types::RtpsPayloadData());
+    pool->get_payload(size, data->payload);
+    data->payload_owner = pool.get();
+    std::memset(data->payload.data, value, size);
+    data->payload.length = size;
+    return data;
+}
+
+} /* namespace test */
+
+/**
+ * Test that data compressed in LZ4 frames is decompressed as it was
+ *
+ * CASES:
+ * - empty
+ * - compressible (repeated text) of several blocks
+ * - incompressible (random)
+ */
+TEST(McapRecorderTest, lz4_round_trip)
+{
+    std::vector<std::vector<uint8_t>> test_cases(3);
+
+    const std::string text = "DDS Router records the traffic it forwards. ";
+    while (test_cases[1].size() < 200000)
+    {
+        test_cases[1].insert(test_cases[1].end(), text.begin(), text.end());
+    }
+
+    std::mt19937 generator(42);
+    for (unsigned int i = 0; i < 100000; ++i)
+    {
+        test_cases[2].push_back(static_cast<uint8_t>(generator()));
+    }
+
+    for (const auto& test_case : test_cases)
+    {
+        std::vector<uint8_t> compressed;
+        Lz4Frame::compress(test_case.data(), test_case.size(), compressed);
+
+        std::vector<uint8_t> decompressed;
+        ASSERT_TRUE(Lz4Frame::decompress(compressed.data(), compressed.size(), decompressed));
+        ASSERT_EQ(test_case, decompressed);
+    }
+
+    // Compressible data is compressed
+    std::vector<uint8_t> compressed;
+    Lz4Frame::compress(test_cases[1].data(), test_cases[1].size(), compressed);
+    ASSERT_LT(compressed.size(), test_cases[1].size() / 10);
+
+    // A corrupted frame is rejected
+    compressed[4] = 0;
+    std::vector<uint8_t> decompressed;
+    ASSERT_FALSE(Lz4Frame::decompress(compressed.data(), compressed.size(), decompressed));
+}
+
+/**
+ * Test that the MCAP files written contain every message written, with and without compression
+ */
+TEST(McapRecorderTest, mcap_file)
+{
+    std::filesystem::path directory = test::test_directory("mcap_file");
+
+    for (bool compress : {false, true})
+    {
+        const std::filesystem::path file_name = directory / (compress ? "compressed.mcap" : "plain.mcap");
+
+        McapWriter writer(1000, compress);
+        writer.add_channel(1, "topic_1", "type", false);
+        writer.add_channel(2, "topic_2", "type", true);
+        writer.open(file_name.string());
+
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            std::vector<uint8_t> payload(50, static_cast<uint8_t>(i));
+            writer.write(static_cast<uint16_t>(1 + i % 2), i, 1000 + i, 500 + i, payload.data(), 50);
+        }
+        writer.close();
+
+        std::vector<test::Message> messages = test::read_file(file_name);
+        ASSERT_EQ(100u, messages.size());
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            ASSERT_EQ(1 + i % 2, messages[i].channel_id);
+            ASSERT_EQ(i, messages[i].sequence);
+            ASSERT_EQ(1000u + i, messages[i].log_time);
+            ASSERT_EQ(std::vector<uint8_t>(50, static_cast<uint8_t>(i)), messages[i].data);
+        }
+    }
+}
+
+/**
+ * Test that the samples recorded are written in their channels, with the sequence of each channel
+ */
+TEST(McapRecorderTest, record)
+{
+    std::filesystem::path directory = test::test_directory("record");
+    auto pool = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    {
+        McapRecorder recorder(test::recorder_configuration(directory), pool);
+        const uint16_t channel_1 = recorder.add_channel(test::topic("topic_1"));
+        const uint16_t channel_2 = recorder.add_channel(test::topic("topic_2"));
+        ASSERT_NE(channel_1, channel_2);
+        ASSERT_EQ(channel_1, recorder.add_channel(test::topic("topic_1")));
+
+        for (uint8_t i = 0; i < 100; ++i)
+        {
+            ASSERT_TRUE(recorder.record(i % 2 ? channel_2 : channel_1, *test::data(pool, 100, i)));
+        }
+    }
+
+    std::vector<std::filesystem::path> files = test::files_in(directory);
+    ASSERT_EQ(1u, files.size());
+
+    std::vector<test::Message> messages = test::read_file(files[0]);
+    ASSERT_EQ(100u, messages.size());
+    for (uint8_t i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(i % 2 ? 2 : 1, messages[i].channel_id);
+        ASSERT_EQ(i / 2u, messages[i].sequence);
+        ASSERT_EQ(std::vector<uint8_t>(100, i), messages[i].data);
+    }
+}
+
+/**
+ * Test that samples are dropped and counted when the samples pending to be written reach their maximum
+ */
+TEST(McapRecorderTest, drop_samples)
+{
+    std::filesystem::path directory = test::test_directory("drop_samples");
+    auto pool = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    auto configuration = test::recorder_configuration(directory);
+    configuration->max_pending_size = 50;
+
+    McapRecorder recorder(configuration, pool);
+    const uint16_t channel = recorder.add_channel(test::topic("topic"));
+
+    for (uint8_t i = 0; i < 10; ++i)
+    {
+        ASSERT_FALSE(recorder.record(channel, *test::data(pool, 100, i)));
+    }
+    ASSERT_TRUE(recorder.record(channel, *test::data(pool, 10, 0)));
+
+    ASSERT_EQ(10u, recorder.dropped_samples());
+}
+
+/**
+ * Test that the file is rotated when it reaches its maximum size, and that every file is complete
+ */
+TEST(McapRecorderTest, rotation)
+{
+    std::filesystem::path directory = test::test_directory("rotation");
+    auto pool = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    auto configuration = test::recorder_configuration(directory);
+    configuration->max_file_size = 10000;
+
+    uint64_t files_created;
+    {
+        McapRecorder recorder(configuration, pool);
+        const uint16_t channel = recorder.add_channel(test::topic("topic"));
+
+        for (uint32_t i = 0; i < 1000; ++i)
+        {
+            ASSERT_TRUE(recorder.record(channel, *test::data(pool, 100, static_cast<uint8_t>(i))));
+        }
+
+        // Wait for the samples to be written
+        while (recorder.recorded_samples() < 1000)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        files_created = recorder.files();
+    }
+
+    std::vector<std::filesystem::path> files = test::files_in(directory);
+    ASSERT_GT(files.size(), 1u);
+    ASSERT_EQ(files_created, files.size());
+
+    uint32_t sequence = 0;
+    for (const auto& file : files)
+    {
+        for (const auto& message : test::read_file(file))
+        {
+            ASSERT_EQ(sequence, message.sequence);
+            ASSERT_EQ(std::vector<uint8_t>(100, static_cast<uint8_t>(sequence)), message.data);
+            ++sequence;
+        }
+    }
+    ASSERT_EQ(1000u, sequence);
+}
+
+/**
+ * Test that the samples recorded from several threads at once are either written or dropped and counted, and that
+ * the samples of each channel are written in the order they are recorded
+ */
+TEST(McapRecorderTest, concurrent_record)
+{
+    constexpr unsigned int N_THREADS = 4;
+    constexpr uint64_t SAMPLES_PER_THREAD = 2 * McapRecorder::QUEUE_SIZE;
+
+    std::filesystem::path directory = test::test_directory("concurrent_record");
+    auto pool = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    uint64_t recorded;
+    uint64_t dropped;
+    {
+        McapRecorder recorder(test::recorder_configuration(directory), pool);
+
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < N_THREADS; ++i)
+        {
+            const uint16_t channel = recorder.add_channel(test::topic("topic_" + std::to_string(i)));
+            threads.emplace_back([&recorder, &pool, channel]()
+                    {
+                        for (uint64_t j = 0; j < SAMPLES_PER_THREAD; ++j)
+                        {
+                            recorder.record(channel, *test::data(pool, 16, static_cast<uint8_t>(channel)));
+                        }
+                    });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Wait for the samples queued to be written
+        while (recorder.recorded_samples() + recorder.dropped_samples() < N_THREADS * SAMPLES_PER_THREAD)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        recorded = recorder.recorded_samples();
+        dropped = recorder.dropped_samples();
+    }
+
+    ASSERT_EQ(N_THREADS * SAMPLES_PER_THREAD, recorded + dropped);
+
+    std::vector<test::Message> messages = test::read_file(test::files_in(directory)[0]);
+    ASSERT_EQ(recorded, messages.size());
+
+    std::vector<uint32_t> sequences(N_THREADS, 0);
+    for (const auto& message : messages)
+    {
+        ASSERT_EQ(sequences[message.channel_id - 1]++, message.sequence);
+        ASSERT_EQ(std::vector<uint8_t>(16, static_cast<uint8_t>(message.channel_id)), message.data);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
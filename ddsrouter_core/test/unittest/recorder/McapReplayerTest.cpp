@@ -0,0 +1,310 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/participant/ReplayerParticipant.hpp>
+#include <ddsrouter_core/recorder/McapReader.hpp>
+#include <ddsrouter_core/recorder/McapReplayer.hpp>
+#include <ddsrouter_core/recorder/McapWriter.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Messages written in the files of the tests
+constexpr uint32_t N_MESSAGES = 100;
+
+//! Empty directory for the files of a test
+std::filesystem::path test_directory(
+        const std::string& name)
+{
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / ("McapReplayerTest_" + name);
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    return directory;
+}
+
+/**
+ * Write \c N_MESSAGES in two channels, the message \c i with 50 bytes of value \c i and logged \c period_ns after
+ * the previous one.
+ */
+std::filesystem::path write_file(
+        const std::filesystem::path& file_name,
+        const bool compress,
+        const uint64_t period_ns = 1000)
+{
+    McapWriter writer(1000, compress);
+    writer.add_channel(1, "topic_1", "type", false);
+    writer.add_channel(2, "topic_2", "type", true);
+    writer.open(file_name.string());
+
+    for (uint32_t i = 0; i < N_MESSAGES; ++i)
+    {
+        std::vector<uint8_t> payload(50, static_cast<uint8_t>(i));
+        payload[1] = 0x01;  // Little endian encapsulation
+        writer.write(static_cast<uint16_t>(1 + i % 2), i, 1000 + i * period_ns, 500 + i, payload.data(), 50);
+    }
+    writer.close();
+
+    return file_name;
+}
+
+//! Configuration of a replayer of \c files
+std::shared_ptr<ReplayerParticipantConfiguration> replayer_configuration(
+        const std::vector<std::filesystem::path>& files,
+        const double playback_rate)
+{
+    auto configuration = std::make_shared<ReplayerParticipantConfiguration>();
+    configuration->id = "replayer";
+    for (const auto& file : files)
+    {
+        configuration->files.push_back(file.string());
+    }
+    configuration->playback_rate = playback_rate;
+    return configuration;
+}
+
+//! Topic replayed
+ddspipe::core::types::DdsTopic topic(
+        const std::string& name,
+        const bool keyed)
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = name;
+    topic.type_name = "type";
+    topic.topic_qos.keyed = keyed;
+    return topic;
+}
+
+//! Take every sample of \c readers until \c n_samples are taken
+std::vector<std::unique_ptr<ddspipe::core::types::RtpsPayloadData>> take_samples(
+        const std::vector<std::shared_ptr<ddspipe::core::IReader>>& readers,
+        const uint32_t n_samples)
+{
+    std::vector<std::unique_ptr<ddspipe::core::types::RtpsPayloadData>> samples;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    while (samples.size() < n_samples && std::chrono::steady_clock::now() < deadline)
+    {
+        for (const auto& reader : readers)
+        {
+            std::unique_ptr<ddspipe::core::IRoutingData> data;
+            while (reader->take(data) == utils::ReturnCode::RETCODE_OK)
+            {
+                samples.emplace_back(dynamic_cast<ddspipe::core::types::RtpsPayloadData*>(data.release()));
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return samples;
+}
+
+} /* namespace test */
+
+/**
+ * Test that the messages of a MCAP file are read as written, pointing to the mapped file if not compressed
+ *
+ * CASES:
+ * - uncompressed chunks
+ * - LZ4 compressed chunks
+ */
+TEST(McapReplayerTest, read_file)
+{
+    std::filesystem::path directory = test::test_directory("read_file");
+
+    for (bool compress : {false, true})
+    {
+        McapReader reader(test::write_file(directory / (compress ? "compressed.mcap" : "plain.mcap"), compress)
+                        .string());
+
+        ASSERT_EQ(2u, reader.channels().size());
+        ASSERT_EQ("topic_1", reader.channels().at(1).topic_name);
+        ASSERT_EQ("type", reader.channels().at(1).type_name);
+        ASSERT_FALSE(reader.channels().at(1).keyed);
+        ASSERT_TRUE(reader.channels().at(2).keyed);
+
+        // Read twice, to check the rewind
+        for (unsigned int pass = 0; pass < 2; ++pass)
+        {
+            McapMessage message;
+            for (uint32_t i = 0; i < test::N_MESSAGES; ++i)
+            {
+                ASSERT_TRUE(reader.next(message));
+                ASSERT_EQ(1 + i % 2, message.channel_id);
+                ASSERT_EQ(i, message.sequence);
+                ASSERT_EQ(1000u + i * 1000, message.log_time);
+                ASSERT_EQ(50u, message.size);
+                ASSERT_EQ(static_cast<uint8_t>(i), message.data[0]);
+                ASSERT_EQ(static_cast<uint8_t>(i), message.data[49]);
+                ASSERT_EQ(!compress, message.mapped);
+            }
+            ASSERT_FALSE(reader.next(message));
+
+            reader.rewind();
+        }
+    }
+}
+
+/**
+ * Test that a truncated file is read up to its last complete record, and that other files are rejected
+ *
+ * CASES:
+ * - truncated file
+ * - file that is not MCAP
+ * - file that does not exist
+ */
+TEST(McapReplayerTest, read_wrong_file)
+{
+    std::filesystem::path directory = test::test_directory("read_wrong_file");
+
+    // truncated file
+    {
+        std::filesystem::path file_name = test::write_file(directory / "truncated.mcap", false);
+        std::filesystem::resize_file(file_name, std::filesystem::file_size(file_name) / 2);
+
+        McapReader reader(file_name.string());
+        McapMessage message;
+        uint32_t messages = 0;
+        while (reader.next(message))
+        {
+            ASSERT_EQ(messages++, message.sequence);
+        }
+        ASSERT_GT(messages, 0u);
+        ASSERT_LT(messages, test::N_MESSAGES);
+    }
+
+    // file that is not MCAP
+    {
+        std::filesystem::path file_name = directory / "text.mcap";
+        std::ofstream(file_name) << "This is not a MCAP file";
+
+        ASSERT_THROW(McapReader reader(file_name.string()), std::exception);
+    }
+
+    // file that does not exist
+    {
+        ASSERT_THROW(McapReader reader((directory / "missing.mcap").string()), std::exception);
+    }
+}
+
+/**
+ * Test that a replayer participant publishes every message of its files as fast as possible, pointing to the
+ * mapped files when not compressed
+ */
+TEST(McapReplayerTest, replay)
+{
+    std::filesystem::path directory = test::test_directory("replay");
+    std::vector<std::filesystem::path> files = {
+        test::write_file(directory / "plain.mcap", false),
+        test::write_file(directory / "compressed.mcap", true),
+    };
+    auto pool = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    {
+        ReplayerParticipant participant(test::replayer_configuration(files, 0), pool);
+
+        std::shared_ptr<McapReplayer> replayer = participant.replayer();
+        ASSERT_EQ(2u, replayer->topics().size());
+        ASSERT_EQ(2u, McapReplayer::read_topics({files[0].string()}).size());
+
+        std::vector<std::shared_ptr<ddspipe::core::IReader>> readers = {
+            participant.create_reader(test::topic("topic_1", false)),
+            participant.create_reader(test::topic("topic_2", true)),
+        };
+        ASSERT_EQ("topic_1", readers[0]->topic().topic_name());
+        ASSERT_NE(readers[0]->guid(), readers[1]->guid());
+
+        // Topics not recorded are not replayed
+        ASSERT_EQ("", participant.create_reader(test::topic("topic_3", false))->topic().topic_name());
+
+        // The replay starts once every reader is enabled
+        readers[0]->enable();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ASSERT_EQ(0u, replayer->replayed_samples());
+        readers[1]->enable();
+
+        auto samples = test::take_samples(readers, 2 * test::N_MESSAGES);
+        ASSERT_EQ(2 * test::N_MESSAGES, samples.size());
+        ASSERT_EQ(2 * test::N_MESSAGES, replayer->replayed_samples());
+
+        uint32_t mapped_samples = 0;
+        for (const auto& sample : samples)
+        {
+            ASSERT_EQ(50u, sample->payload.length);
+            ASSERT_EQ(CDR_LE, sample->payload.encapsulation);
+            ASSERT_EQ("replayer", sample->participant_receiver);
+            mapped_samples += sample->payload_owner != pool.get();
+        }
+        ASSERT_EQ(test::N_MESSAGES, mapped_samples);
+
+        // Release the samples before their pools
+        samples.clear();
+    }
+}
+
+/**
+ * Test that a replayer participant publishes the messages at their original timing multiplied by its rate
+ */
+TEST(McapReplayerTest, playback_rate)
+{
+    std::filesystem::path directory = test::test_directory("playback_rate");
+
+    // 100 messages over 198 ms, replayed in 99 ms
+    std::vector<std::filesystem::path> files = {test::write_file(directory / "plain.mcap", false, 2000000)};
+    auto pool = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    ReplayerParticipant participant(test::replayer_configuration(files, 2), pool);
+
+    std::vector<std::shared_ptr<ddspipe::core::IReader>> readers = {
+        participant.create_reader(test::topic("topic_1", false)),
+        participant.create_reader(test::topic("topic_2", true)),
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& reader : readers)
+    {
+        reader->enable();
+    }
+
+    auto samples = test::take_samples(readers, test::N_MESSAGES);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(test::N_MESSAGES, samples.size());
+    ASSERT_GE(elapsed, std::chrono::milliseconds(99));
+    ASSERT_LT(elapsed, std::chrono::milliseconds(198));
+
+    samples.clear();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,174 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/tracing/FlightRecorder.hpp>
+
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Lines of \c text
+std::vector<std::string> lines(
+        const std::string& text)
+{
+    std::vector<std::string> result;
+    std::istringstream stream(text);
+    for (std::string line; std::getline(stream, line);)
+    {
+        result.push_back(line);
+    }
+    return result;
+}
+
+//! Whether \c line ends with \c suffix
+bool ends_with(
+        const std::string& line,
+        const std::string& suffix)
+{
+    return line.size() >= suffix.size() && line.compare(line.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+} /* namespace test */
+
+/**
+ * Test that the events are dumped from the oldest to the newest with their kind and text
+ */
+TEST(FlightRecorderTest, record)
+{
+    FlightRecorder::clear();
+
+    FlightRecorder::record(FlightEventKind::bridge_created, "topic=rt/chatter participant=local", "endpoint=reader");
+    FlightRecorder::record(FlightEventKind::sample_dropped, "topic=rt/chatter participant=local", "reason=expired");
+    FlightRecorder::record(FlightEventKind::reload, "", "result=updated");
+
+    const std::vector<std::string> lines = test::lines(FlightRecorder::to_string());
+    ASSERT_EQ(3u, lines.size());
+
+    ASSERT_TRUE(test::ends_with(lines[0], " bridge_created topic=rt/chatter participant=local endpoint=reader"));
+    ASSERT_TRUE(test::ends_with(lines[1], " sample_dropped topic=rt/chatter participant=local reason=expired"));
+    ASSERT_TRUE(test::ends_with(lines[2], " reload result=updated"));
+
+    // Lines start with the time in seconds with nanoseconds
+    const std::string time = lines[0].substr(0, lines[0].find(' '));
+    ASSERT_EQ(time.size() - 10, time.find('.'));
+}
+
+/**
+ * Test that only the most recent events are kept and that long texts are truncated
+ */
+TEST(FlightRecorderTest, ring_overflow)
+{
+    FlightRecorder::clear();
+
+    for (std::size_t i = 0; i < FlightRecorder::RING_SIZE + 10; ++i)
+    {
+        FlightRecorder::record(FlightEventKind::discovery, "event=" + std::to_string(i));
+    }
+    FlightRecorder::record(FlightEventKind::discovery, std::string(2 * FlightRecorder::TEXT_SIZE, 'x'));
+
+    const std::vector<std::string> lines = test::lines(FlightRecorder::to_string());
+    ASSERT_EQ(FlightRecorder::RING_SIZE, lines.size());
+
+    // Oldest events are overwritten
+    ASSERT_TRUE(test::ends_with(lines.front(), " discovery event=11"));
+    ASSERT_TRUE(test::ends_with(lines[lines.size() - 2], " discovery event=" +
+            std::to_string(FlightRecorder::RING_SIZE + 9)));
+    ASSERT_TRUE(test::ends_with(lines.back(), " discovery " + std::string(FlightRecorder::TEXT_SIZE, 'x')));
+}
+
+/**
+ * Test that events recorded concurrently by several threads are never corrupted
+ */
+TEST(FlightRecorderTest, concurrent_record)
+{
+    FlightRecorder::clear();
+
+    constexpr unsigned int THREADS = 4;
+    constexpr unsigned int EVENTS = 10000;
+
+    std::vector<std::thread> threads;
+    for (unsigned int thread = 0; thread < THREADS; ++thread)
+    {
+        threads.emplace_back([thread]()
+                {
+                    const std::string subject = "thread=" + std::to_string(thread) + " " + std::string(100, 'a' + thread);
+                    for (unsigned int i = 0; i < EVENTS; ++i)
+                    {
+                        FlightRecorder::record(FlightEventKind::sample_dropped, subject, "reason=write_error");
+                    }
+                });
+    }
+
+    // Dump while recording
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        for (const std::string& line : test::lines(FlightRecorder::to_string()))
+        {
+            const std::size_t thread = line.find("thread=");
+            ASSERT_NE(std::string::npos, thread);
+            const char id = line[thread + 7];
+            ASSERT_TRUE(test::ends_with(line, std::string(100, 'a' + (id - '0')) + " reason=write_error"));
+        }
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Events whose slot was being written by another thread are discarded
+    const std::size_t kept = test::lines(FlightRecorder::to_string()).size();
+    ASSERT_GT(kept, 0u);
+    ASSERT_LE(kept, FlightRecorder::RING_SIZE);
+}
+
+/**
+ * Test dumping the events in a file
+ */
+TEST(FlightRecorderTest, dump_file)
+{
+    FlightRecorder::clear();
+    FlightRecorder::record(FlightEventKind::latency_outlier, "topic=rt/chatter participant=remote", "latency_ns=1");
+
+    const std::string file_name = "FlightRecorderTest_dump_file.log";
+    ASSERT_TRUE(FlightRecorder::dump(file_name.c_str()));
+
+    std::ifstream file(file_name);
+    std::stringstream content;
+    content << file.rdbuf();
+    file.close();
+    std::remove(file_name.c_str());
+
+    ASSERT_EQ(FlightRecorder::to_string(), content.str());
+
+    ASSERT_FALSE(FlightRecorder::dump("non_existing_directory/flight_recorder.log"));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
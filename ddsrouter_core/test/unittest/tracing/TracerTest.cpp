@@ -0,0 +1,192 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/tracing/Tracer.hpp>
+
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Number of occurrences of \c pattern in \c text
+std::size_t count(
+        const std::string& text,
+        const std::string& pattern)
+{
+    std::size_t result = 0;
+    for (auto position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + 1))
+    {
+        ++result;
+    }
+    return result;
+}
+
+//! Event of a write span of \c sample
+TraceEvent write_event(
+        const uint64_t sample)
+{
+    TraceEvent event;
+    event.name = "writer.write";
+    event.sample = sample;
+    event.start_ns = 1000000;
+    event.duration_ns = 2500;
+    return event;
+}
+
+} /* namespace test */
+
+/**
+ * Test that only one of each N samples is traced, and none when the tracer is disabled
+ */
+TEST(TracerTest, sampling)
+{
+    Tracer::disable();
+    ASSERT_FALSE(Tracer::enabled());
+    ASSERT_EQ(0u, Tracer::sample());
+
+    Tracer::enable(4);
+    ASSERT_TRUE(Tracer::enabled());
+
+    unsigned int traced = 0;
+    uint64_t last_sample = 0;
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        const uint64_t sample = Tracer::sample();
+        if (sample != 0)
+        {
+            // Ids are unique and increasing
+            ASSERT_GT(sample, last_sample);
+            last_sample = sample;
+            ++traced;
+        }
+    }
+    ASSERT_EQ(25u, traced);
+
+    // Sampling lower than 1 traces every sample
+    Tracer::enable(0);
+    ASSERT_NE(0u, Tracer::sample());
+    ASSERT_NE(0u, Tracer::sample());
+
+    Tracer::disable();
+    ASSERT_EQ(0u, Tracer::sample());
+}
+
+/**
+ * Test the Chrome trace event format of complete and asynchronous spans
+ */
+TEST(TracerTest, chrome_trace)
+{
+    Tracer::clear();
+
+    const uint32_t topic = Tracer::label("topic\"1");
+    const uint32_t participant = Tracer::label("participant_1");
+    ASSERT_EQ(topic, Tracer::label("topic\"1"));
+    ASSERT_NE(topic, participant);
+
+    TraceEvent event = test::write_event(7);
+    event.topic = topic;
+    event.participant = participant;
+    Tracer::record(event);
+
+    TraceEvent queue_event;
+    queue_event.name = "reader.queue";
+    queue_event.async = true;
+    queue_event.sample = 7;
+    queue_event.start_ns = 500000;
+    queue_event.duration_ns = 500000;
+    Tracer::record(queue_event);
+
+    const std::string trace = Tracer::to_chrome_trace();
+
+    ASSERT_EQ(0u, trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    ASSERT_NE(std::string::npos,
+            trace.find("{\"name\":\"writer.write\",\"cat\":\"ddsrouter\",\"ph\":\"X\",\"pid\":1,\"tid\":"));
+    ASSERT_NE(std::string::npos, trace.find("\"ts\":1000.000,\"dur\":2.500,"));
+    ASSERT_NE(std::string::npos,
+            trace.find("\"args\":{\"topic\":\"topic\\\"1\",\"participant\":\"participant_1\",\"sample\":7}"));
+    ASSERT_NE(std::string::npos, trace.find("\"ph\":\"b\",\"pid\":1,\"tid\":"));
+    ASSERT_NE(std::string::npos, trace.find("\"ts\":500.000,\"id\":7,"));
+    ASSERT_NE(std::string::npos, trace.find("\"ts\":1000.000,\"id\":7,"));
+
+    Tracer::clear();
+    ASSERT_EQ(0u, test::count(Tracer::to_chrome_trace(), "\"name\""));
+}
+
+/**
+ * Test that each thread keeps its own events and only the most recent ones when its ring is full
+ */
+TEST(TracerTest, ring_overflow)
+{
+    Tracer::clear();
+
+    std::thread([]()
+            {
+                for (uint64_t sample = 1; sample <= Tracer::RING_SIZE + 10; ++sample)
+                {
+                    Tracer::record(test::write_event(sample));
+                }
+            }).join();
+
+    std::thread([]()
+            {
+                Tracer::record(test::write_event(Tracer::RING_SIZE + 11));
+            }).join();
+
+    const std::string trace = Tracer::to_chrome_trace();
+    ASSERT_EQ(Tracer::RING_SIZE + 1, test::count(trace, "\"name\":\"writer.write\""));
+
+    // Oldest events are overwritten
+    ASSERT_EQ(std::string::npos, trace.find("\"sample\":10}"));
+    ASSERT_NE(std::string::npos, trace.find("\"sample\":11}"));
+    ASSERT_NE(std::string::npos, trace.find("\"sample\":" + std::to_string(Tracer::RING_SIZE + 11) + "}"));
+}
+
+/**
+ * Test writing the trace in a file
+ */
+TEST(TracerTest, export_file)
+{
+    Tracer::clear();
+    Tracer::record(test::write_event(1));
+
+    const std::string file_name = "TracerTest_export_file.json";
+    ASSERT_TRUE(Tracer::export_chrome_trace(file_name));
+
+    std::ifstream file(file_name);
+    std::stringstream content;
+    content << file.rdbuf();
+    file.close();
+    std::remove(file_name.c_str());
+
+    ASSERT_EQ(Tracer::to_chrome_trace(), content.str());
+
+    ASSERT_FALSE(Tracer::export_chrome_trace("non_existing_directory/trace.json"));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
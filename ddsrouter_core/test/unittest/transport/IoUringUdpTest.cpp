@@ -0,0 +1,272 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/transport/IoUringUdp.hpp>
+
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Loopback address
+const UdpEndpoint LOCALHOST {{127, 0, 0, 1}, 0};
+
+//! Maximum size of the datagrams received
+constexpr uint32_t MAX_DATAGRAM_SIZE = 65500;
+
+//! Datagram of \c size bytes with a recognizable pattern
+std::vector<uint8_t> datagram(
+        const uint32_t size,
+        const uint8_t seed = 0)
+{
+    std::vector<uint8_t> data(size);
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 7 + seed);
+    }
+    return data;
+}
+
+//! Endpoint of \c receiver in the loopback interface
+UdpEndpoint endpoint_of(
+        const IUdpReceiver& receiver)
+{
+    UdpEndpoint endpoint = LOCALHOST;
+    endpoint.port = receiver.port();
+    return endpoint;
+}
+
+//! Datagrams received by an \c IoUringUdpReceiver
+class DatagramsReceived
+{
+public:
+
+    IUdpReceiver::DatagramCallback callback()
+    {
+        return [this](const uint8_t* data, uint32_t size, const UdpEndpoint& source)
+               {
+                   std::lock_guard<std::mutex> lock(mutex_);
+                   datagrams_.emplace_back(data, data + size);
+                   sources_.push_back(source);
+               };
+    }
+
+    //! Wait until \c count datagrams are received, up to 2 seconds
+    std::vector<std::vector<uint8_t>> wait_for(
+            const std::size_t count)
+    {
+        for (unsigned int i = 0; i < 200; ++i)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (datagrams_.size() >= count)
+                {
+                    return datagrams_;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        return datagrams_;
+    }
+
+    std::vector<UdpEndpoint> sources()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return sources_;
+    }
+
+protected:
+
+    std::mutex mutex_;
+    std::vector<std::vector<uint8_t>> datagrams_;
+    std::vector<UdpEndpoint> sources_;
+};
+
+//! Whether the kernel supports the io_uring backend (it may be disabled, e.g. in containers)
+bool io_uring_supported()
+{
+    try
+    {
+        IoUringUdpReceiver receiver(LOCALHOST, {}, MAX_DATAGRAM_SIZE, {}, 8, [](const uint8_t*, uint32_t,
+                const UdpEndpoint&)
+                {
+                });
+        return true;
+    }
+    catch (const eprosima::utils::InitializationException&)
+    {
+        return false;
+    }
+}
+
+} /* namespace test */
+
+#define SKIP_IF_IO_URING_UNSUPPORTED()                          \
+    if (!test::io_uring_supported())                            \
+    {                                                           \
+        GTEST_SKIP() << "io_uring not supported by the kernel"; \
+    }
+
+/**
+ * Send datagrams of different sizes through the loopback interface.
+ */
+TEST(IoUringUdpTest, send_receive)
+{
+    SKIP_IF_IO_URING_UNSUPPORTED();
+
+    test::DatagramsReceived received;
+    IoUringUdpReceiver receiver(test::LOCALHOST, {}, test::MAX_DATAGRAM_SIZE, {}, 8, received.callback());
+    IoUringUdpSender sender({});
+
+    const auto small = test::datagram(100);
+    const auto largest = test::datagram(test::MAX_DATAGRAM_SIZE);
+    ASSERT_TRUE(sender.send_to(small.data(), small.size(), {test::endpoint_of(receiver)}));
+    ASSERT_TRUE(sender.send_to(largest.data(), largest.size(), {test::endpoint_of(receiver)}));
+
+    const auto datagrams = received.wait_for(2);
+    ASSERT_EQ(2u, datagrams.size());
+    ASSERT_EQ(small, datagrams[0]);
+    ASSERT_EQ(largest, datagrams[1]);
+
+    const auto sources = received.sources();
+    ASSERT_EQ(test::LOCALHOST.address, sources[0].address);
+    ASSERT_NE(0u, sources[0].port);
+}
+
+/**
+ * A single call sends the datagram to every destination.
+ */
+TEST(IoUringUdpTest, several_destinations)
+{
+    SKIP_IF_IO_URING_UNSUPPORTED();
+
+    test::DatagramsReceived received_1;
+    test::DatagramsReceived received_2;
+    IoUringUdpReceiver receiver_1(test::LOCALHOST, {}, test::MAX_DATAGRAM_SIZE, {}, 8, received_1.callback());
+    IoUringUdpReceiver receiver_2(test::LOCALHOST, {}, test::MAX_DATAGRAM_SIZE, {}, 8, received_2.callback());
+    IoUringUdpSender sender({});
+
+    const auto data = test::datagram(1000);
+    ASSERT_TRUE(sender.send_to(data.data(), data.size(),
+            {test::endpoint_of(receiver_1), test::endpoint_of(receiver_2)}));
+
+    ASSERT_EQ(std::vector<std::vector<uint8_t>>{data}, received_1.wait_for(1));
+    ASSERT_EQ(std::vector<std::vector<uint8_t>>{data}, received_2.wait_for(1));
+}
+
+/**
+ * More datagrams than entries in the rings of the sender and the receiver, so both reuse their buffers and the
+ * receive operation is submitted again whenever the provided buffers run out.
+ */
+TEST(IoUringUdpTest, more_datagrams_than_entries)
+{
+    SKIP_IF_IO_URING_UNSUPPORTED();
+
+    constexpr uint32_t BURSTS = 50;
+    constexpr uint32_t BURST_SIZE = 32;
+
+    test::DatagramsReceived received;
+    IoUringUdpReceiver receiver(test::LOCALHOST, {}, 1000, {}, 4, received.callback());
+    IoUringUdpSender sender({}, 4);
+
+    for (uint32_t burst = 0; burst < BURSTS; ++burst)
+    {
+        for (uint32_t i = 0; i < BURST_SIZE; ++i)
+        {
+            const auto data = test::datagram(100, static_cast<uint8_t>(i));
+            ASSERT_TRUE(sender.send_to(data.data(), data.size(), {test::endpoint_of(receiver)}));
+        }
+        ASSERT_EQ((burst + 1) * BURST_SIZE, received.wait_for((burst + 1) * BURST_SIZE).size());
+    }
+
+    const auto datagrams = received.wait_for(BURSTS * BURST_SIZE);
+    for (uint32_t i = 0; i < BURST_SIZE; ++i)
+    {
+        ASSERT_EQ(test::datagram(100, static_cast<uint8_t>(i)), datagrams[i]);
+    }
+}
+
+/**
+ * Datagrams larger than the maximum size of the receiver are discarded.
+ */
+TEST(IoUringUdpTest, discard_too_large)
+{
+    SKIP_IF_IO_URING_UNSUPPORTED();
+
+    test::DatagramsReceived received;
+    IoUringUdpReceiver receiver(test::LOCALHOST, {}, 1000, {}, 8, received.callback());
+    IoUringUdpSender sender({});
+
+    const auto too_large = test::datagram(1001);
+    const auto valid = test::datagram(1000);
+    ASSERT_TRUE(sender.send_to(too_large.data(), too_large.size(), {test::endpoint_of(receiver)}));
+    ASSERT_TRUE(sender.send_to(valid.data(), valid.size(), {test::endpoint_of(receiver)}));
+
+    const auto datagrams = received.wait_for(1);
+    ASSERT_EQ(1u, datagrams.size());
+    ASSERT_EQ(valid, datagrams[0]);
+}
+
+/**
+ * A port can only be bound by one receiver.
+ */
+TEST(IoUringUdpTest, port_in_use)
+{
+    SKIP_IF_IO_URING_UNSUPPORTED();
+
+    test::DatagramsReceived received;
+    IoUringUdpReceiver receiver(test::LOCALHOST, {}, 1000, {}, 8, received.callback());
+
+    ASSERT_THROW(
+        IoUringUdpReceiver(test::endpoint_of(receiver), {}, 1000, {}, 8, received.callback()),
+        eprosima::utils::InitializationException);
+}
+
+/**
+ * A kernel thread polls the submission queue of the sender.
+ */
+TEST(IoUringUdpTest, sqpoll)
+{
+    SKIP_IF_IO_URING_UNSUPPORTED();
+
+    test::DatagramsReceived received;
+    IoUringUdpReceiver receiver(test::LOCALHOST, {}, 1000, {}, 8, received.callback());
+    IoUringUdpSender sender({}, 8, true);
+
+    for (uint8_t i = 0; i < 20; ++i)
+    {
+        const auto data = test::datagram(100, i);
+        ASSERT_TRUE(sender.send_to(data.data(), data.size(), {test::endpoint_of(receiver)}));
+    }
+
+    ASSERT_EQ(20u, received.wait_for(20).size());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,296 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/transport/MmsgUdp.hpp>
+
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Loopback address
+const UdpEndpoint LOCALHOST {{127, 0, 0, 1}, 0};
+
+//! Maximum size of the datagrams received
+constexpr uint32_t MAX_DATAGRAM_SIZE = 65500;
+
+//! Whether the sender and receiver use UDP offload, in every combination
+const std::vector<bool> OFFLOAD = {false, true};
+
+//! Datagram of \c size bytes with a recognizable pattern
+std::vector<uint8_t> datagram(
+        const uint32_t size,
+        const uint8_t seed = 0)
+{
+    std::vector<uint8_t> data(size);
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 7 + seed);
+    }
+    return data;
+}
+
+//! Endpoint of \c receiver in the loopback interface
+UdpEndpoint endpoint_of(
+        const IUdpReceiver& receiver)
+{
+    UdpEndpoint endpoint = LOCALHOST;
+    endpoint.port = receiver.port();
+    return endpoint;
+}
+
+//! Datagrams received by an \c MmsgUdpReceiver
+class DatagramsReceived
+{
+public:
+
+    IUdpReceiver::DatagramCallback callback()
+    {
+        return [this](const uint8_t* data, uint32_t size, const UdpEndpoint& source)
+               {
+                   std::lock_guard<std::mutex> lock(mutex_);
+                   datagrams_.emplace_back(data, data + size);
+                   sources_.push_back(source);
+               };
+    }
+
+    //! Wait until \c count datagrams are received, up to 2 seconds
+    std::vector<std::vector<uint8_t>> wait_for(
+            const std::size_t count)
+    {
+        for (unsigned int i = 0; i < 200; ++i)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (datagrams_.size() >= count)
+                {
+                    return datagrams_;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        return datagrams_;
+    }
+
+    std::vector<UdpEndpoint> sources()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return sources_;
+    }
+
+protected:
+
+    std::mutex mutex_;
+    std::vector<std::vector<uint8_t>> datagrams_;
+    std::vector<UdpEndpoint> sources_;
+};
+
+//! Sender that sends a batch of datagrams at once, as when other threads queue them while it is sending
+class BatchSender : public MmsgUdpSender
+{
+public:
+
+    using MmsgUdpSender::MmsgUdpSender;
+
+    bool send_batch(
+            const std::vector<std::vector<uint8_t>>& data,
+            const UdpEndpoint& destination)
+    {
+        std::vector<Datagram> datagrams(data.size());
+        for (std::size_t i = 0; i < data.size(); ++i)
+        {
+            datagrams[i].data = data[i];
+            datagrams[i].destinations = {destination};
+        }
+        return send_datagrams_(datagrams);
+    }
+};
+
+} /* namespace test */
+
+/**
+ * Send datagrams of different sizes through the loopback interface.
+ */
+TEST(MmsgUdpTest, send_receive)
+{
+    for (const bool offload : test::OFFLOAD)
+    {
+        test::DatagramsReceived received;
+        MmsgUdpReceiver receiver(test::LOCALHOST, {}, test::MAX_DATAGRAM_SIZE, {}, 8, offload, received.callback());
+        MmsgUdpSender sender({}, 8, offload);
+
+        const auto small = test::datagram(100);
+        const auto largest = test::datagram(test::MAX_DATAGRAM_SIZE);
+        ASSERT_TRUE(sender.send_to(small.data(), small.size(), {test::endpoint_of(receiver)}));
+        ASSERT_TRUE(sender.send_to(largest.data(), largest.size(), {test::endpoint_of(receiver)}));
+
+        const auto datagrams = received.wait_for(2);
+        ASSERT_EQ(2u, datagrams.size());
+        ASSERT_EQ(small, datagrams[0]);
+        ASSERT_EQ(largest, datagrams[1]);
+
+        const auto sources = received.sources();
+        ASSERT_EQ(test::LOCALHOST.address, sources[0].address);
+        ASSERT_NE(0u, sources[0].port);
+    }
+}
+
+/**
+ * A single call sends the datagram to every destination.
+ */
+TEST(MmsgUdpTest, several_destinations)
+{
+    test::DatagramsReceived received_1;
+    test::DatagramsReceived received_2;
+    MmsgUdpReceiver receiver_1(test::LOCALHOST, {}, test::MAX_DATAGRAM_SIZE, {}, 8, true, received_1.callback());
+    MmsgUdpReceiver receiver_2(test::LOCALHOST, {}, test::MAX_DATAGRAM_SIZE, {}, 8, true, received_2.callback());
+    MmsgUdpSender sender({});
+
+    const auto data = test::datagram(1000);
+    ASSERT_TRUE(sender.send_to(data.data(), data.size(),
+            {test::endpoint_of(receiver_1), test::endpoint_of(receiver_2)}));
+
+    ASSERT_EQ(std::vector<std::vector<uint8_t>>{data}, received_1.wait_for(1));
+    ASSERT_EQ(std::vector<std::vector<uint8_t>>{data}, received_2.wait_for(1));
+}
+
+/**
+ * A batch of datagrams to the same destination is coalesced with segmentation offload when supported, and every
+ * datagram is received on its own and in order, whether the receiver uses receive offload or not.
+ */
+TEST(MmsgUdpTest, coalesced_batch)
+{
+    for (const bool offload : test::OFFLOAD)
+    {
+        test::DatagramsReceived received;
+        MmsgUdpReceiver receiver(test::LOCALHOST, {}, test::MAX_DATAGRAM_SIZE, {}, 4, offload, received.callback());
+        test::BatchSender sender({}, 4, true);
+
+        // Segments of the same size but the last, then a larger one that starts another message
+        std::vector<std::vector<uint8_t>> data;
+        for (uint8_t i = 0; i < 10; ++i)
+        {
+            data.push_back(test::datagram(1000, i));
+        }
+        data.push_back(test::datagram(500, 10));
+        data.push_back(test::datagram(1200, 11));
+        data.push_back(test::datagram(1200, 12));
+
+        ASSERT_TRUE(sender.send_batch(data, test::endpoint_of(receiver)));
+        ASSERT_EQ(data, received.wait_for(data.size()));
+    }
+}
+
+/**
+ * Several threads send at once, so the datagrams queued while a thread is sending are sent in its batches.
+ */
+TEST(MmsgUdpTest, concurrent_senders)
+{
+    constexpr uint32_t THREADS = 4;
+    constexpr uint32_t BURSTS = 20;
+    constexpr uint32_t BURST_SIZE = 25;
+
+    test::DatagramsReceived received;
+    MmsgUdpReceiver receiver(test::LOCALHOST, {}, 1000, {}, 8, true, received.callback());
+    MmsgUdpSender sender({}, 8, true);
+
+    for (uint32_t burst = 0; burst < BURSTS; ++burst)
+    {
+        std::atomic<bool> sent_all {true};
+        std::vector<std::thread> threads;
+        for (uint32_t thread = 0; thread < THREADS; ++thread)
+        {
+            threads.emplace_back([&, thread]()
+                    {
+                        for (uint32_t i = 0; i < BURST_SIZE; ++i)
+                        {
+                            const auto data = test::datagram(100, static_cast<uint8_t>(thread));
+                            if (!sender.send_to(data.data(), data.size(), {test::endpoint_of(receiver)}))
+                            {
+                                sent_all = false;
+                            }
+                        }
+                    });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_TRUE(sent_all.load());
+        ASSERT_EQ((burst + 1) * THREADS * BURST_SIZE, received.wait_for((burst + 1) * THREADS * BURST_SIZE).size());
+    }
+
+    for (const auto& data : received.wait_for(BURSTS * THREADS * BURST_SIZE))
+    {
+        ASSERT_EQ(100u, data.size());
+        ASSERT_LT(data[0], THREADS);
+        ASSERT_EQ(test::datagram(100, data[0]), data);
+    }
+}
+
+/**
+ * Datagrams larger than the maximum size of the receiver are discarded.
+ */
+TEST(MmsgUdpTest, discard_too_large)
+{
+    for (const bool offload : test::OFFLOAD)
+    {
+        test::DatagramsReceived received;
+        MmsgUdpReceiver receiver(test::LOCALHOST, {}, 1000, {}, 8, offload, received.callback());
+        MmsgUdpSender sender({}, 8, offload);
+
+        const auto too_large = test::datagram(1001);
+        const auto valid = test::datagram(1000);
+        ASSERT_TRUE(sender.send_to(too_large.data(), too_large.size(), {test::endpoint_of(receiver)}));
+        ASSERT_TRUE(sender.send_to(valid.data(), valid.size(), {test::endpoint_of(receiver)}));
+
+        const auto datagrams = received.wait_for(1);
+        ASSERT_EQ(1u, datagrams.size());
+        ASSERT_EQ(valid, datagrams[0]);
+    }
+}
+
+/**
+ * A port can only be bound by one receiver.
+ */
+TEST(MmsgUdpTest, port_in_use)
+{
+    test::DatagramsReceived received;
+    MmsgUdpReceiver receiver(test::LOCALHOST, {}, 1000, {}, 8, true, received.callback());
+
+    ASSERT_THROW(
+        MmsgUdpReceiver(test::endpoint_of(receiver), {}, 1000, {}, 8, true, received.callback()),
+        eprosima::utils::InitializationException);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,229 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/transport/UnixSocket.hpp>
+
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Bytes of the messages sent in a memory file
+constexpr uint32_t LARGE_SIZE = 4 * 1024 * 1024;
+
+//! Path of a socket file unique for this process
+std::string socket_path(
+        const std::string& name)
+{
+    return "/tmp/ddsrouter_uds_test_" + std::to_string(getpid()) + "_" + name;
+}
+
+//! Message of \c size bytes with a recognizable pattern
+std::vector<uint8_t> message(
+        const uint32_t size)
+{
+    std::vector<uint8_t> data(size);
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    return data;
+}
+
+//! Messages received by a \c UnixSocketReceiver
+class MessagesReceived
+{
+public:
+
+    UnixSocketReceiver::MessageCallback callback()
+    {
+        return [this](const uint8_t* data, uint32_t size)
+               {
+                   std::lock_guard<std::mutex> lock(mutex_);
+                   messages_.emplace_back(data, data + size);
+               };
+    }
+
+    //! Wait until \c count messages are received, up to 2 seconds
+    std::vector<std::vector<uint8_t>> wait_for(
+            const std::size_t count)
+    {
+        for (unsigned int i = 0; i < 200; ++i)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (messages_.size() >= count)
+                {
+                    return messages_;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        return messages_;
+    }
+
+protected:
+
+    std::mutex mutex_;
+    std::vector<std::vector<uint8_t>> messages_;
+};
+
+} /* namespace test */
+
+/**
+ * Send messages small enough to go inline in the datagram.
+ */
+TEST(UnixSocketTest, send_inline)
+{
+    test::MessagesReceived received;
+    UnixSocketReceiver receiver(test::socket_path("inline"), test::LARGE_SIZE, received.callback());
+    UnixSocketSender sender;
+
+    const auto small = test::message(100);
+    const auto largest_inline = test::message(UNIX_SOCKET_MAX_INLINE_SIZE);
+    ASSERT_TRUE(sender.send_to(small.data(), small.size(), receiver.path()));
+    ASSERT_TRUE(sender.send_to(largest_inline.data(), largest_inline.size(), receiver.path()));
+
+    const auto messages = received.wait_for(2);
+    ASSERT_EQ(2u, messages.size());
+    ASSERT_EQ(small, messages[0]);
+    ASSERT_EQ(largest_inline, messages[1]);
+}
+
+/**
+ * Send messages larger than the threshold, that are passed in a memory file.
+ */
+TEST(UnixSocketTest, send_memfd)
+{
+    test::MessagesReceived received;
+    UnixSocketReceiver receiver(test::socket_path("memfd"), test::LARGE_SIZE, received.callback());
+    UnixSocketSender sender(1024);
+
+    const auto medium = test::message(1025);
+    const auto large = test::message(test::LARGE_SIZE);
+    ASSERT_TRUE(sender.send_to(medium.data(), medium.size(), receiver.path()));
+    ASSERT_TRUE(sender.send_to(large.data(), large.size(), receiver.path()));
+
+    const auto messages = received.wait_for(2);
+    ASSERT_EQ(2u, messages.size());
+    ASSERT_EQ(medium, messages[0]);
+    ASSERT_EQ(large, messages[1]);
+}
+
+/**
+ * Messages larger than the maximum size of the receiver are discarded, whichever the way they are sent.
+ */
+TEST(UnixSocketTest, discard_too_large)
+{
+    test::MessagesReceived received;
+    UnixSocketReceiver receiver(test::socket_path("too_large"), 1000, received.callback());
+    UnixSocketSender sender(100);
+
+    const auto inline_message = test::message(1001);
+    const auto memfd_message = test::message(2000);
+    const auto valid = test::message(1000);
+    UnixSocketSender inline_sender;
+    ASSERT_TRUE(inline_sender.send_to(inline_message.data(), inline_message.size(), receiver.path()));
+    ASSERT_TRUE(sender.send_to(memfd_message.data(), memfd_message.size(), receiver.path()));
+    ASSERT_TRUE(sender.send_to(valid.data(), valid.size(), receiver.path()));
+
+    const auto messages = received.wait_for(1);
+    ASSERT_EQ(1u, messages.size());
+    ASSERT_EQ(valid, messages[0]);
+}
+
+/**
+ * Sending to a path without receiver fails without blocking.
+ */
+TEST(UnixSocketTest, no_receiver)
+{
+    UnixSocketSender sender(1024);
+
+    const auto small = test::message(10);
+    const auto large = test::message(2048);
+    ASSERT_FALSE(sender.send_to(small.data(), small.size(), test::socket_path("nobody")));
+    ASSERT_FALSE(sender.send_to(large.data(), large.size(), test::socket_path("nobody")));
+    ASSERT_FALSE(sender.send_to(small.data(), small.size(), ""));
+}
+
+/**
+ * A path can only be bound by one receiver, but the socket file of a finished one is replaced.
+ *
+ * CASES:
+ * - path in use
+ * - stale socket file
+ * - path too long
+ */
+TEST(UnixSocketTest, bind_path)
+{
+    test::MessagesReceived received;
+
+    // path in use
+    {
+        UnixSocketReceiver receiver(test::socket_path("in_use"), test::LARGE_SIZE, received.callback());
+        ASSERT_THROW(
+            UnixSocketReceiver(test::socket_path("in_use"), test::LARGE_SIZE, received.callback()),
+            eprosima::utils::InitializationException);
+    }
+
+    // stale socket file
+    {
+        const std::string path = test::socket_path("stale");
+        sockaddr_un address {};
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+        // Bind a socket and close it without removing its file, as a process that crashed
+        const int stale = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+        ASSERT_EQ(0, ::bind(stale, reinterpret_cast<sockaddr*>(&address), sizeof(address)));
+        ::close(stale);
+
+        UnixSocketReceiver receiver(path, test::LARGE_SIZE, received.callback());
+        UnixSocketSender sender;
+        const auto small = test::message(10);
+        ASSERT_TRUE(sender.send_to(small.data(), small.size(), path));
+        ASSERT_EQ(1u, received.wait_for(1).size());
+    }
+
+    // path too long
+    {
+        ASSERT_THROW(
+            UnixSocketReceiver("/tmp/" + std::string(200, 'a'), test::LARGE_SIZE, received.callback()),
+            eprosima::utils::InitializationException);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,127 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+
+#include <ddsrouter_core/types/GeneratedSample.hpp>
+
+using namespace eprosima::ddsrouter::core::types;
+
+/**
+ * Test that samples smaller than the header cannot be generated
+ */
+TEST(GeneratedSampleTest, minimum_size)
+{
+    ASSERT_THROW(GeneratedSample("topic", GeneratedSample::HEADER_SIZE - 1), eprosima::utils::InitializationException);
+
+    GeneratedSample sample("topic", GeneratedSample::HEADER_SIZE);
+    ASSERT_EQ(GeneratedSample::HEADER_SIZE, sample.size());
+
+    std::vector<unsigned char> buffer(sample.size());
+    sample.serialize(3, 7, buffer.data());
+    ASSERT_TRUE(GeneratedSample::check(buffer.data(), sample.size()));
+}
+
+/**
+ * Test that the samples only depend on the seed, key and sequence
+ */
+TEST(GeneratedSampleTest, deterministic)
+{
+    GeneratedSample sample("topic", 1000);
+    GeneratedSample same_sample("topic", 1000);
+    GeneratedSample other_sample("other_topic", 1000);
+
+    std::vector<unsigned char> buffer(1000);
+    std::vector<unsigned char> same_buffer(1000);
+    std::vector<unsigned char> other_buffer(1000);
+
+    sample.serialize(1, 42, buffer.data());
+    same_sample.serialize(1, 42, same_buffer.data());
+    other_sample.serialize(1, 42, other_buffer.data());
+    ASSERT_EQ(buffer, same_buffer);
+    ASSERT_NE(buffer, other_buffer);
+
+    same_sample.serialize(2, 42, same_buffer.data());
+    ASSERT_NE(buffer, same_buffer);
+
+    same_sample.serialize(1, 43, same_buffer.data());
+    ASSERT_NE(buffer, same_buffer);
+}
+
+/**
+ * Test that the key and sequence are serialized in little endian CDR
+ */
+TEST(GeneratedSampleTest, serialization)
+{
+    GeneratedSample sample("topic", 100);
+
+    std::vector<unsigned char> buffer(100);
+    sample.serialize(0x01020304, 0x05060708090a0b0cull, buffer.data());
+
+    // Encapsulation
+    ASSERT_EQ(0x00, buffer[0]);
+    ASSERT_EQ(0x01, buffer[1]);
+
+    // Key
+    ASSERT_EQ(0x04, buffer[4]);
+    ASSERT_EQ(0x01, buffer[7]);
+
+    // Sequence, aligned to 8 bytes
+    ASSERT_EQ(0x0c, buffer[12]);
+    ASSERT_EQ(0x05, buffer[19]);
+
+    // Data length
+    ASSERT_EQ(100u - GeneratedSample::HEADER_SIZE, buffer[24]);
+    ASSERT_EQ(0x00, buffer[25]);
+}
+
+/**
+ * Test that corrupted samples are detected
+ */
+TEST(GeneratedSampleTest, check)
+{
+    GeneratedSample sample("topic", 256);
+
+    std::vector<unsigned char> buffer(256);
+    sample.serialize(5, 1, buffer.data());
+    ASSERT_TRUE(GeneratedSample::check(buffer.data(), 256));
+
+    // Truncated
+    ASSERT_FALSE(GeneratedSample::check(buffer.data(), 255));
+    ASSERT_FALSE(GeneratedSample::check(buffer.data(), GeneratedSample::HEADER_SIZE - 1));
+
+    // Corrupted data
+    for (uint32_t i = GeneratedSample::HEADER_SIZE; i < 256; i += 17)
+    {
+        std::vector<unsigned char> corrupted(buffer);
+        corrupted[i] ^= 0x10;
+        ASSERT_FALSE(GeneratedSample::check(corrupted.data(), 256));
+    }
+
+    // Corrupted checksum
+    buffer[20] ^= 0x01;
+    ASSERT_FALSE(GeneratedSample::check(buffer.data(), 256));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,172 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/types/LatencyHistogram.hpp>
+
+using namespace eprosima::ddsrouter::core::types;
+
+namespace test {
+
+//! Maximum relative error of a value stored in the histogram
+constexpr double MAX_RELATIVE_ERROR = 1.0 / LatencyHistogram::SUB_BUCKETS;
+
+} /* namespace test */
+
+/**
+ * Test that an empty histogram returns 0 in every percentile
+ */
+TEST(LatencyHistogramTest, empty)
+{
+    LatencyHistogram histogram;
+
+    ASSERT_EQ(0u, histogram.count());
+    ASSERT_EQ(0u, histogram.max());
+    ASSERT_EQ(0u, histogram.percentile(0.5));
+    ASSERT_EQ(0u, histogram.summary().p999);
+}
+
+/**
+ * Test that values lower than the number of sub buckets are stored exactly
+ */
+TEST(LatencyHistogramTest, exact_small_values)
+{
+    for (uint64_t value = 0; value < LatencyHistogram::SUB_BUCKETS * 2; ++value)
+    {
+        LatencyHistogram histogram;
+        histogram.record(value);
+        ASSERT_EQ(value, histogram.percentile(0.5));
+    }
+}
+
+/**
+ * Test that every value is stored with a bounded relative error
+ */
+TEST(LatencyHistogramTest, relative_error)
+{
+    for (uint64_t value = 1; value <= LatencyHistogram::MAX_VALUE; value = value * 3 + 1)
+    {
+        LatencyHistogram histogram;
+        histogram.record(value);
+
+        // Add a bigger value so the result is not truncated by the max
+        histogram.record(UINT64_MAX);
+
+        const uint64_t result = histogram.percentile(0.5);
+        ASSERT_GE(result, value);
+        ASSERT_LE(static_cast<double>(result - value), static_cast<double>(value) * test::MAX_RELATIVE_ERROR);
+    }
+}
+
+/**
+ * Test the percentiles of a uniform distribution
+ */
+TEST(LatencyHistogramTest, percentiles)
+{
+    LatencyHistogram histogram;
+
+    for (uint64_t value = 1; value <= 100000; ++value)
+    {
+        histogram.record(value * 1000);
+    }
+
+    LatencySummary summary = histogram.summary();
+
+    ASSERT_EQ(100000u, summary.count);
+    ASSERT_EQ(100000000u, summary.max);
+    ASSERT_NEAR(50000000.0, static_cast<double>(summary.p50), 50000000.0 * test::MAX_RELATIVE_ERROR);
+    ASSERT_NEAR(99000000.0, static_cast<double>(summary.p99), 99000000.0 * test::MAX_RELATIVE_ERROR);
+    ASSERT_NEAR(99900000.0, static_cast<double>(summary.p999), 99900000.0 * test::MAX_RELATIVE_ERROR);
+
+    // Reset
+    histogram.reset();
+    ASSERT_EQ(0u, histogram.count());
+    ASSERT_EQ(0u, histogram.percentile(1.0));
+}
+
+/**
+ * Test that the maximum value of the range can be recorded
+ */
+TEST(LatencyHistogramTest, max_value)
+{
+    LatencyHistogram histogram;
+
+    histogram.record(UINT64_MAX);
+
+    ASSERT_EQ(UINT64_MAX, histogram.max());
+    ASSERT_EQ(UINT64_MAX, histogram.percentile(0.5));
+}
+
+/**
+ * Test that the values over the capped range are bounded by the max, without affecting the lower percentiles
+ */
+TEST(LatencyHistogramTest, out_of_range)
+{
+    LatencyHistogram histogram;
+
+    for (uint64_t value = 1; value <= 99; ++value)
+    {
+        histogram.record(value * 1000);
+    }
+    histogram.record(LatencyHistogram::MAX_VALUE * 4);
+
+    ASSERT_NEAR(50000.0, static_cast<double>(histogram.percentile(0.5)), 50000.0 * test::MAX_RELATIVE_ERROR);
+    ASSERT_EQ(LatencyHistogram::MAX_VALUE * 4, histogram.percentile(1.0));
+    ASSERT_EQ(LatencyHistogram::MAX_VALUE * 4, histogram.max());
+}
+
+/**
+ * Test that values recorded from several threads are not lost
+ */
+TEST(LatencyHistogramTest, concurrent_record)
+{
+    constexpr unsigned int THREADS = 4;
+    constexpr uint64_t VALUES_PER_THREAD = 100000;
+
+    LatencyHistogram histogram;
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < THREADS; ++i)
+    {
+        threads.emplace_back(
+            [&histogram, i]()
+            {
+                for (uint64_t value = 0; value < VALUES_PER_THREAD; ++value)
+                {
+                    histogram.record(value + i);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(THREADS * VALUES_PER_THREAD, histogram.count());
+    ASSERT_EQ(VALUES_PER_THREAD - 1 + THREADS - 1, histogram.max());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,125 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/types/SequenceWindow.hpp>
+
+using namespace eprosima::ddsrouter::core::types;
+
+/**
+ * Test that the size of the window is rounded up to a multiple of 64
+ */
+TEST(SequenceWindowTest, window_size)
+{
+    ASSERT_EQ(64u, SequenceWindow(0).size());
+    ASSERT_EQ(64u, SequenceWindow(1).size());
+    ASSERT_EQ(64u, SequenceWindow(64).size());
+    ASSERT_EQ(128u, SequenceWindow(65).size());
+    ASSERT_EQ(1024u, SequenceWindow(1000).size());
+}
+
+/**
+ * Test that every sequence number received in order is new
+ */
+TEST(SequenceWindowTest, in_order)
+{
+    SequenceWindow window(64);
+
+    for (uint64_t i = 1; i < 1000; ++i)
+    {
+        ASSERT_TRUE(window.insert(i));
+    }
+}
+
+/**
+ * Test that sequence numbers received twice are detected
+ */
+TEST(SequenceWindowTest, duplicates)
+{
+    SequenceWindow window(64);
+
+    for (uint64_t i = 1; i < 1000; ++i)
+    {
+        ASSERT_TRUE(window.insert(i));
+        ASSERT_FALSE(window.insert(i));
+
+        // Previous sequence numbers inside the window are still detected
+        if (i > 32)
+        {
+            ASSERT_FALSE(window.insert(i - 32));
+        }
+    }
+}
+
+/**
+ * Test that sequence numbers received out of order inside the window are new only once
+ */
+TEST(SequenceWindowTest, out_of_order)
+{
+    SequenceWindow window(64);
+
+    ASSERT_TRUE(window.insert(10));
+    ASSERT_TRUE(window.insert(50));
+    ASSERT_TRUE(window.insert(20));
+    ASSERT_TRUE(window.insert(11));
+    ASSERT_FALSE(window.insert(20));
+    ASSERT_FALSE(window.insert(11));
+    ASSERT_TRUE(window.insert(49));
+    ASSERT_FALSE(window.insert(50));
+}
+
+/**
+ * Test that sequence numbers older than the window are not considered new
+ */
+TEST(SequenceWindowTest, old_sequence_numbers)
+{
+    SequenceWindow window(64);
+
+    ASSERT_TRUE(window.insert(100));
+    ASSERT_TRUE(window.insert(37));
+    ASSERT_FALSE(window.insert(36));
+    ASSERT_FALSE(window.insert(1));
+}
+
+/**
+ * Test that jumping forward forgets the sequence numbers that get out of the window
+ */
+TEST(SequenceWindowTest, jump_forward)
+{
+    SequenceWindow window(64);
+
+    ASSERT_TRUE(window.insert(1));
+    ASSERT_TRUE(window.insert(2));
+
+    // Small jump: the positions of the skipped sequence numbers are cleared
+    ASSERT_TRUE(window.insert(60));
+    ASSERT_TRUE(window.insert(66));
+    ASSERT_TRUE(window.insert(65));
+    ASSERT_FALSE(window.insert(2));
+
+    // Big jump: the whole window is cleared
+    ASSERT_TRUE(window.insert(1000));
+    ASSERT_TRUE(window.insert(1000 - 63));
+    ASSERT_FALSE(window.insert(66));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
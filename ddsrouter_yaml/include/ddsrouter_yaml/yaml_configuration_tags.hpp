@@ -0,0 +1,125 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file yaml_configuration_tags.hpp
+ *
+ * Yaml tags specific of the DDS Router configuration.
+ * Tags common to every DDS Pipe application are defined in <ddspipe_yaml/yaml_configuration_tags.hpp>.
+ */
+
+#pragma once
+
+namespace eprosima {
+namespace ddsrouter {
+namespace yaml {
+
+// Topic QoS related tags
+constexpr const char* TOPIC_QOS_TAG("qos");                     //! Topic QoS of a manual topic
+constexpr const char* QOS_MAX_AGE_TAG("max-age");               //! Latency budget of a topic in milliseconds
+
+// Participant related tags
+constexpr const char* DEDUPLICATION_TAG("deduplication");       //! Duplicate suppression of a participant
+constexpr const char* DEDUPLICATION_WINDOW_TAG("window");       //! Sequence numbers tracked per writer
+constexpr const char* DEDUPLICATION_LEASE_TAG("lease");         //! Milliseconds a writer without samples is tracked
+constexpr const char* INTEREST_TAG("interest");                 //! Address where a remote DDS Router announces its interest
+constexpr const char* INTEREST_ADDRESS_IP_TAG("ip");            //! IP of an interest address
+constexpr const char* INTEREST_ADDRESS_PORT_TAG("port");        //! Port of an interest address
+constexpr const char* ROUTER_LINK_TAG("router-link");            //! Whether a participant connects to other routers
+
+// Generator participant related tags
+constexpr const char* GENERATOR_TOPICS_TAG("topics");               //! Topics published by a generator participant
+constexpr const char* GENERATOR_RATE_TAG("rate");                   //! Samples per second of a generated topic
+constexpr const char* GENERATOR_PAYLOAD_SIZE_TAG("payload-size");   //! Bytes of each sample of a generated topic
+constexpr const char* GENERATOR_KEYS_TAG("keys");                   //! Instances of a generated topic
+
+// Sink participant related tags
+constexpr const char* SINK_VERIFY_CHECKSUM_TAG("verify-checksum");  //! Verify the checksum of the samples received
+
+// Recorder participant related tags
+constexpr const char* RECORDER_FILE_PREFIX_TAG("file-prefix");              //! Path and prefix of the recorded files
+constexpr const char* RECORDER_MAX_FILE_SIZE_TAG("max-file-size");          //! Bytes after which the file is rotated
+constexpr const char* RECORDER_CHUNK_SIZE_TAG("chunk-size");                //! Uncompressed bytes of each chunk
+constexpr const char* RECORDER_COMPRESSION_TAG("compression");              //! Compression of the chunks
+constexpr const char* RECORDER_COMPRESSION_LZ4_TAG("lz4");                  //! LZ4 compression
+constexpr const char* RECORDER_COMPRESSION_NONE_TAG("none");                //! No compression
+constexpr const char* RECORDER_MAX_PENDING_SIZE_TAG("max-pending-size");    //! Bytes queued after which samples are dropped
+
+// Replayer participant related tags
+constexpr const char* REPLAYER_FILES_TAG("files");                  //! MCAP files replayed
+constexpr const char* REPLAYER_PLAYBACK_RATE_TAG("playback-rate");  //! Speed of the replay relative to the recording
+
+// Shared memory participant related tags
+constexpr const char* SHM_SEGMENT_SIZE_TAG("segment-size");             //! Bytes of the shared memory segment
+constexpr const char* SHM_MAX_MESSAGE_SIZE_TAG("max-message-size");     //! Bytes above which samples are fragmented
+
+// Unix domain socket participant related tags
+constexpr const char* UDS_SOCKET_DIRECTORY_TAG("socket-directory");     //! Directory of the socket files
+constexpr const char* UDS_MEMFD_THRESHOLD_TAG("memfd-threshold");       //! Bytes above which messages go in a memory file
+constexpr const char* UDS_MAX_MESSAGE_SIZE_TAG("max-message-size");     //! Bytes above which samples are fragmented
+
+// WAN participant (initial peers and discovery server) related tags
+constexpr const char* IO_TAG("io");                                 //! I/O of the UDP sockets of a WAN participant
+constexpr const char* IO_BACKEND_TAG("backend");                    //! I/O backend of the UDP sockets
+constexpr const char* IO_BACKEND_FASTDDS_TAG("fastdds");            //! Builtin Fast DDS UDP transport
+constexpr const char* IO_BACKEND_IO_URING_TAG("io-uring");          //! io_uring with multishot receive
+constexpr const char* IO_BACKEND_MMSG_TAG("mmsg");                  //! Batched sendmmsg and recvmmsg
+constexpr const char* IO_RING_ENTRIES_TAG("ring-entries");          //! Entries of the io_uring of each socket
+constexpr const char* IO_SQPOLL_TAG("sqpoll");                      //! Kernel thread polling the submission queue
+constexpr const char* IO_BATCH_SIZE_TAG("batch-size");              //! Datagrams per sendmmsg or recvmmsg
+constexpr const char* IO_OFFLOAD_TAG("offload");                    //! UDP segmentation and receive offload
+constexpr const char* SOCKET_TAG("socket");                         //! Options of the sockets of a WAN participant
+constexpr const char* SOCKET_SEND_BUFFER_SIZE_TAG("send-buffer-size");        //! Bytes of the send buffers
+constexpr const char* SOCKET_RECEIVE_BUFFER_SIZE_TAG("receive-buffer-size");  //! Bytes of the receive buffers
+constexpr const char* SOCKET_TCP_NODELAY_TAG("tcp-nodelay");        //! Disable the Nagle algorithm in TCP
+constexpr const char* SOCKET_RTPS_KEEP_ALIVE_PERIOD_TAG("rtps-keep-alive-period");   //! Ms between RTPS keep alives
+constexpr const char* SOCKET_RTPS_KEEP_ALIVE_TIMEOUT_TAG("rtps-keep-alive-timeout"); //! Ms to drop a TCP connection
+constexpr const char* SOCKET_BUSY_POLL_TAG("busy-poll");            //! Microseconds busy polling for datagrams
+constexpr const char* SOCKET_DSCP_TAG("dscp");                      //! DSCP of the datagrams sent
+
+// Redundancy group related tags
+constexpr const char* REDUNDANCY_GROUPS_TAG("redundancy-groups");   //! Groups of participants that are redundant paths
+constexpr const char* REDUNDANCY_GROUP_NAME_TAG("name");            //! Name of a redundancy group
+
+// Link group related tags
+constexpr const char* LINK_GROUPS_TAG("link-groups");               //! Groups of participants that are alternative links
+constexpr const char* LINK_GROUP_NAME_TAG("name");                  //! Name of a link group
+constexpr const char* LINK_GROUP_LINKS_TAG("links");                //! Links of a link group
+constexpr const char* LINK_PARTICIPANT_TAG("participant");          //! Participant of a link
+constexpr const char* LINK_PROBE_ADDRESS_TAG("probe-address");      //! Address where the probes of a link are sent
+constexpr const char* PROBE_ADDRESS_IP_TAG("ip");                   //! IP of a probe address
+constexpr const char* PROBE_ADDRESS_PORT_TAG("port");               //! Port of a probe address
+constexpr const char* LINK_PROBE_PERIOD_TAG("probe-period");        //! Time between probes in milliseconds
+constexpr const char* LINK_DETECTION_TIME_TAG("detection-time");    //! Time without answers to consider a link down
+constexpr const char* LINK_HYSTERESIS_TAG("hysteresis");            //! Improvement required to change the active link
+constexpr const char* LINK_PROBE_PORT_TAG("link-probe-port");       //! Port where the probes of remote routers are answered
+constexpr const char* LINK_PROBE_PEERS_TAG("link-probe-peers");     //! IPs whose link probes are answered
+
+// Interest related tags
+constexpr const char* INTEREST_PORT_TAG("interest-port");           //! Port where the local interest is announced
+constexpr const char* INTEREST_PEERS_TAG("interest-peers");         //! IPs whose interest requests are answered
+
+// Metrics related tags
+constexpr const char* SOURCE_LATENCY_TAG("source-latency");         //! Measure the latency from the source timestamp
+constexpr const char* ROUTE_LATENCY_TAG("route-latency");           //! Measure the latency added by the router
+
+// Monitor related tags
+constexpr const char* MONITOR_TAG("monitor");                       //! Publication of the statistics in a DDS topic
+constexpr const char* MONITOR_DOMAIN_TAG("domain");                 //! Domain where the statistics are published
+constexpr const char* MONITOR_TOPIC_NAME_TAG("topic-name");         //! Topic where the statistics are published
+constexpr const char* MONITOR_PERIOD_TAG("period");                 //! Time between publications in milliseconds
+
+} /* namespace yaml */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -26,13 +26,45 @@
 
 #include <ddspipe_core/configuration/DdsPipeConfiguration.hpp>
 #include <ddsrouter_core/configuration/DdsRouterConfiguration.hpp>
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ShmParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SocketConfiguration.hpp>
+#include <ddsrouter_core/configuration/UdpIoConfiguration.hpp>
+#include <ddsrouter_core/configuration/UdsParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/WanDiscoveryServerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/WanInitialPeersParticipantConfiguration.hpp>
 
 #include <ddsrouter_yaml/YamlReaderConfiguration.hpp>
+#include <ddsrouter_yaml/yaml_configuration_tags.hpp>
 
 namespace eprosima {
 namespace ddspipe {
 namespace yaml {
 
+namespace {
+
+//! Get a UDP/TCP port from \c tag
+uint16_t get_port(
+        const Yaml& yml,
+        const TagType& tag,
+        const YamlReaderVersion version)
+{
+    const unsigned int port = YamlReader::get<unsigned int>(yml, tag, version);
+
+    if (port > UINT16_MAX)
+    {
+        throw eprosima::utils::ConfigurationException(
+                  utils::Formatter() << "Invalid port " << port << " in tag " << tag << ".");
+    }
+
+    return static_cast<uint16_t>(port);
+}
+
+} /* namespace */
+
 template <>
 void YamlReader::fill(
         ddsrouter::core::SpecsConfiguration& object,
@@ -53,11 +85,566 @@ void YamlReader::fill(
         object.remove_unused_entities = YamlReader::get<bool>(yml, REMOVE_UNUSED_ENTITIES_TAG, version);
     }
 
+    /////
+    // Get optional link probe port
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::LINK_PROBE_PORT_TAG))
+    {
+        object.link_probe_port = get_port(yml, ddsrouter::yaml::LINK_PROBE_PORT_TAG, version);
+    }
+
+    // Optional link probe peers
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::LINK_PROBE_PEERS_TAG))
+    {
+        object.link_probe_peers = YamlReader::get_set<std::string>(yml, ddsrouter::yaml::LINK_PROBE_PEERS_TAG, version);
+    }
+
+    // Optional interest port
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::INTEREST_PORT_TAG))
+    {
+        object.interest_port = get_port(yml, ddsrouter::yaml::INTEREST_PORT_TAG, version);
+    }
+
+    // Optional interest peers
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::INTEREST_PEERS_TAG))
+    {
+        object.interest_peers = YamlReader::get_set<std::string>(yml, ddsrouter::yaml::INTEREST_PEERS_TAG, version);
+    }
+
+    // Optional source latency
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::SOURCE_LATENCY_TAG))
+    {
+        object.source_latency = YamlReader::get<bool>(yml, ddsrouter::yaml::SOURCE_LATENCY_TAG, version);
+    }
+
+    // Optional route latency
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::ROUTE_LATENCY_TAG))
+    {
+        object.route_latency = YamlReader::get<bool>(yml, ddsrouter::yaml::ROUTE_LATENCY_TAG, version);
+    }
+
     // Optional Topic QoS
     if (is_tag_present(yml, SPECS_QOS_TAG))
     {
-        fill<core::types::TopicQoS>(object.topic_qos, get_value_in_tag(yml, SPECS_QOS_TAG), version);
+        Yaml qos_yml = get_value_in_tag(yml, SPECS_QOS_TAG);
+
+        fill<core::types::TopicQoS>(object.topic_qos, qos_yml, version);
         core::types::TopicQoS::default_topic_qos.set_value(object.topic_qos);
+
+        // Optional max age (not part of the DDS Pipe Topic QoS)
+        if (is_tag_present(qos_yml, ddsrouter::yaml::QOS_MAX_AGE_TAG))
+        {
+            object.max_age = get<unsigned int>(qos_yml, ddsrouter::yaml::QOS_MAX_AGE_TAG, version);
+        }
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::types::TopicMaxAge& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Name required
+    object.topic_name = get<std::string>(yml, TOPIC_NAME_TAG, version);
+
+    // Optional type
+    if (is_tag_present(yml, TOPIC_TYPE_NAME_TAG))
+    {
+        object.type_name = get<std::string>(yml, TOPIC_TYPE_NAME_TAG, version);
+    }
+
+    // Optional participants
+    if (is_tag_present(yml, COLLECTION_PARTICIPANTS_TAG))
+    {
+        object.participants = get_set<core::types::ParticipantId>(yml, COLLECTION_PARTICIPANTS_TAG, version);
+    }
+
+    // Max age required
+    object.max_age = get<unsigned int>(
+        get_value_in_tag(yml, ddsrouter::yaml::TOPIC_QOS_TAG),
+        ddsrouter::yaml::QOS_MAX_AGE_TAG,
+        version);
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::DeduplicationConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Optional window
+    if (is_tag_present(yml, ddsrouter::yaml::DEDUPLICATION_WINDOW_TAG))
+    {
+        object.window = get<unsigned int>(yml, ddsrouter::yaml::DEDUPLICATION_WINDOW_TAG, version);
+    }
+
+    // Optional lease
+    if (is_tag_present(yml, ddsrouter::yaml::DEDUPLICATION_LEASE_TAG))
+    {
+        object.lease = get<unsigned int>(yml, ddsrouter::yaml::DEDUPLICATION_LEASE_TAG, version);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::InterestConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // IP required
+    object.ip = get<std::string>(yml, ddsrouter::yaml::INTEREST_ADDRESS_IP_TAG, version);
+
+    // Port required
+    object.port = get_port(yml, ddsrouter::yaml::INTEREST_ADDRESS_PORT_TAG, version);
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::RedundancyGroupConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Name required
+    object.name = get<std::string>(yml, ddsrouter::yaml::REDUNDANCY_GROUP_NAME_TAG, version);
+
+    // Participants required
+    object.participants = get_set<core::types::ParticipantId>(yml, COLLECTION_PARTICIPANTS_TAG, version);
+
+    // Optional deduplication window and lease
+    fill<ddsrouter::core::DeduplicationConfiguration>(object.deduplication, yml, version);
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::LinkConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Participant required
+    object.participant = get<std::string>(yml, ddsrouter::yaml::LINK_PARTICIPANT_TAG, version);
+
+    // Probe address required
+    Yaml address_yml = get_value_in_tag(yml, ddsrouter::yaml::LINK_PROBE_ADDRESS_TAG);
+    object.probe_ip = get<std::string>(address_yml, ddsrouter::yaml::PROBE_ADDRESS_IP_TAG, version);
+    object.probe_port = get_port(address_yml, ddsrouter::yaml::PROBE_ADDRESS_PORT_TAG, version);
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::LinkGroupConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Name required
+    object.name = get<std::string>(yml, ddsrouter::yaml::LINK_GROUP_NAME_TAG, version);
+
+    // Links required
+    for (const auto& link_yml : get_value_in_tag(yml, ddsrouter::yaml::LINK_GROUP_LINKS_TAG))
+    {
+        ddsrouter::core::LinkConfiguration link;
+        fill<ddsrouter::core::LinkConfiguration>(link, link_yml, version);
+        object.links.push_back(link);
+    }
+
+    // Optional probe period
+    if (is_tag_present(yml, ddsrouter::yaml::LINK_PROBE_PERIOD_TAG))
+    {
+        object.probe_period = get<unsigned int>(yml, ddsrouter::yaml::LINK_PROBE_PERIOD_TAG, version);
+    }
+
+    // Optional detection time
+    if (is_tag_present(yml, ddsrouter::yaml::LINK_DETECTION_TIME_TAG))
+    {
+        object.detection_time = get<unsigned int>(yml, ddsrouter::yaml::LINK_DETECTION_TIME_TAG, version);
+    }
+
+    // Optional hysteresis
+    if (is_tag_present(yml, ddsrouter::yaml::LINK_HYSTERESIS_TAG))
+    {
+        object.hysteresis = get<unsigned int>(yml, ddsrouter::yaml::LINK_HYSTERESIS_TAG, version);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::MonitorConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // The statistics are published if the tag is present
+    object.enable = true;
+
+    // Optional domain
+    if (is_tag_present(yml, ddsrouter::yaml::MONITOR_DOMAIN_TAG))
+    {
+        object.domain = get<unsigned int>(yml, ddsrouter::yaml::MONITOR_DOMAIN_TAG, version);
+    }
+
+    // Optional topic name
+    if (is_tag_present(yml, ddsrouter::yaml::MONITOR_TOPIC_NAME_TAG))
+    {
+        object.topic_name = get<std::string>(yml, ddsrouter::yaml::MONITOR_TOPIC_NAME_TAG, version);
+    }
+
+    // Optional period
+    if (is_tag_present(yml, ddsrouter::yaml::MONITOR_PERIOD_TAG))
+    {
+        object.period = get<unsigned int>(yml, ddsrouter::yaml::MONITOR_PERIOD_TAG, version);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::GeneratedTopicConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Name required
+    object.topic_name = get<std::string>(yml, TOPIC_NAME_TAG, version);
+
+    // Optional type
+    if (is_tag_present(yml, TOPIC_TYPE_NAME_TAG))
+    {
+        object.type_name = get<std::string>(yml, TOPIC_TYPE_NAME_TAG, version);
+    }
+
+    // Optional rate
+    if (is_tag_present(yml, ddsrouter::yaml::GENERATOR_RATE_TAG))
+    {
+        object.rate = get<float>(yml, ddsrouter::yaml::GENERATOR_RATE_TAG, version);
+    }
+
+    // Optional payload size
+    if (is_tag_present(yml, ddsrouter::yaml::GENERATOR_PAYLOAD_SIZE_TAG))
+    {
+        object.payload_size = get<unsigned int>(yml, ddsrouter::yaml::GENERATOR_PAYLOAD_SIZE_TAG, version);
+    }
+
+    // Optional number of keys
+    if (is_tag_present(yml, ddsrouter::yaml::GENERATOR_KEYS_TAG))
+    {
+        object.keys = get<unsigned int>(yml, ddsrouter::yaml::GENERATOR_KEYS_TAG, version);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::GeneratorParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::ParticipantConfiguration>(object, yml, version);
+
+    // Topics required
+    for (const auto& topic_yml : get_value_in_tag(yml, ddsrouter::yaml::GENERATOR_TOPICS_TAG))
+    {
+        ddsrouter::core::GeneratedTopicConfiguration topic;
+        fill<ddsrouter::core::GeneratedTopicConfiguration>(topic, topic_yml, version);
+        object.topics.push_back(topic);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::SinkParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::ParticipantConfiguration>(object, yml, version);
+
+    // Optional checksum verification
+    if (is_tag_present(yml, ddsrouter::yaml::SINK_VERIFY_CHECKSUM_TAG))
+    {
+        object.verify_checksum = get<bool>(yml, ddsrouter::yaml::SINK_VERIFY_CHECKSUM_TAG, version);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::RecorderParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::ParticipantConfiguration>(object, yml, version);
+
+    // Optional file prefix
+    if (is_tag_present(yml, ddsrouter::yaml::RECORDER_FILE_PREFIX_TAG))
+    {
+        object.file_prefix = get<std::string>(yml, ddsrouter::yaml::RECORDER_FILE_PREFIX_TAG, version);
+    }
+
+    // Optional maximum file size
+    if (is_tag_present(yml, ddsrouter::yaml::RECORDER_MAX_FILE_SIZE_TAG))
+    {
+        object.max_file_size = get<unsigned int>(yml, ddsrouter::yaml::RECORDER_MAX_FILE_SIZE_TAG, version);
+    }
+
+    // Optional chunk size
+    if (is_tag_present(yml, ddsrouter::yaml::RECORDER_CHUNK_SIZE_TAG))
+    {
+        object.chunk_size = get<unsigned int>(yml, ddsrouter::yaml::RECORDER_CHUNK_SIZE_TAG, version);
+    }
+
+    // Optional compression
+    if (is_tag_present(yml, ddsrouter::yaml::RECORDER_COMPRESSION_TAG))
+    {
+        const std::string compression = get<std::string>(yml, ddsrouter::yaml::RECORDER_COMPRESSION_TAG, version);
+        if (compression == ddsrouter::yaml::RECORDER_COMPRESSION_LZ4_TAG)
+        {
+            object.compress = true;
+        }
+        else if (compression == ddsrouter::yaml::RECORDER_COMPRESSION_NONE_TAG)
+        {
+            object.compress = false;
+        }
+        else
+        {
+            throw eprosima::utils::ConfigurationException(
+                      utils::Formatter() << "Unknown compression " << compression << " of recorder participant, "
+                                         << "expected " << ddsrouter::yaml::RECORDER_COMPRESSION_LZ4_TAG << " or "
+                                         << ddsrouter::yaml::RECORDER_COMPRESSION_NONE_TAG << ".");
+        }
+    }
+
+    // Optional maximum pending size
+    if (is_tag_present(yml, ddsrouter::yaml::RECORDER_MAX_PENDING_SIZE_TAG))
+    {
+        object.max_pending_size = get<unsigned int>(yml, ddsrouter::yaml::RECORDER_MAX_PENDING_SIZE_TAG, version);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::ReplayerParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::ParticipantConfiguration>(object, yml, version);
+
+    // Files required
+    for (const auto& file_yml : get_value_in_tag(yml, ddsrouter::yaml::REPLAYER_FILES_TAG))
+    {
+        object.files.push_back(get<std::string>(file_yml, version));
+    }
+
+    // Optional playback rate
+    if (is_tag_present(yml, ddsrouter::yaml::REPLAYER_PLAYBACK_RATE_TAG))
+    {
+        object.playback_rate = get<float>(yml, ddsrouter::yaml::REPLAYER_PLAYBACK_RATE_TAG, version);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::ShmParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::SimpleParticipantConfiguration>(object, yml, version);
+
+    // Optional segment size
+    if (is_tag_present(yml, ddsrouter::yaml::SHM_SEGMENT_SIZE_TAG))
+    {
+        object.segment_size = get<unsigned int>(yml, ddsrouter::yaml::SHM_SEGMENT_SIZE_TAG, version);
+    }
+
+    // Optional maximum message size
+    if (is_tag_present(yml, ddsrouter::yaml::SHM_MAX_MESSAGE_SIZE_TAG))
+    {
+        object.max_message_size = get<unsigned int>(yml, ddsrouter::yaml::SHM_MAX_MESSAGE_SIZE_TAG, version);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::UdsParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::SimpleParticipantConfiguration>(object, yml, version);
+
+    // Optional socket directory
+    if (is_tag_present(yml, ddsrouter::yaml::UDS_SOCKET_DIRECTORY_TAG))
+    {
+        object.socket_directory = get<std::string>(yml, ddsrouter::yaml::UDS_SOCKET_DIRECTORY_TAG, version);
+    }
+
+    // Optional memory file threshold
+    if (is_tag_present(yml, ddsrouter::yaml::UDS_MEMFD_THRESHOLD_TAG))
+    {
+        object.memfd_threshold = get<unsigned int>(yml, ddsrouter::yaml::UDS_MEMFD_THRESHOLD_TAG, version);
+    }
+
+    // Optional maximum message size
+    if (is_tag_present(yml, ddsrouter::yaml::UDS_MAX_MESSAGE_SIZE_TAG))
+    {
+        object.max_message_size = get<unsigned int>(yml, ddsrouter::yaml::UDS_MAX_MESSAGE_SIZE_TAG, version);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::UdpIoConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Optional backend
+    if (is_tag_present(yml, ddsrouter::yaml::IO_BACKEND_TAG))
+    {
+        const std::string backend = get<std::string>(yml, ddsrouter::yaml::IO_BACKEND_TAG, version);
+        if (backend == ddsrouter::yaml::IO_BACKEND_FASTDDS_TAG)
+        {
+            object.backend = ddsrouter::core::UdpIoBackend::fastdds;
+        }
+        else if (backend == ddsrouter::yaml::IO_BACKEND_IO_URING_TAG)
+        {
+            object.backend = ddsrouter::core::UdpIoBackend::io_uring;
+        }
+        else if (backend == ddsrouter::yaml::IO_BACKEND_MMSG_TAG)
+        {
+            object.backend = ddsrouter::core::UdpIoBackend::mmsg;
+        }
+        else
+        {
+            throw eprosima::utils::ConfigurationException(
+                      utils::Formatter() << "Unknown I/O backend " << backend << ", expected "
+                                         << ddsrouter::yaml::IO_BACKEND_FASTDDS_TAG << ", "
+                                         << ddsrouter::yaml::IO_BACKEND_IO_URING_TAG << " or "
+                                         << ddsrouter::yaml::IO_BACKEND_MMSG_TAG << ".");
+        }
+    }
+
+    // Optional ring entries
+    if (is_tag_present(yml, ddsrouter::yaml::IO_RING_ENTRIES_TAG))
+    {
+        object.ring_entries = get<unsigned int>(yml, ddsrouter::yaml::IO_RING_ENTRIES_TAG, version);
+    }
+
+    // Optional submission queue polling
+    if (is_tag_present(yml, ddsrouter::yaml::IO_SQPOLL_TAG))
+    {
+        object.sqpoll = get<bool>(yml, ddsrouter::yaml::IO_SQPOLL_TAG, version);
+    }
+
+    // Optional batch size
+    if (is_tag_present(yml, ddsrouter::yaml::IO_BATCH_SIZE_TAG))
+    {
+        object.batch_size = get<unsigned int>(yml, ddsrouter::yaml::IO_BATCH_SIZE_TAG, version);
+    }
+
+    // Optional UDP offload
+    if (is_tag_present(yml, ddsrouter::yaml::IO_OFFLOAD_TAG))
+    {
+        object.offload = get<bool>(yml, ddsrouter::yaml::IO_OFFLOAD_TAG, version);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::SocketConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Optional buffer sizes
+    if (is_tag_present(yml, ddsrouter::yaml::SOCKET_SEND_BUFFER_SIZE_TAG))
+    {
+        object.send_buffer_size = get<unsigned int>(yml, ddsrouter::yaml::SOCKET_SEND_BUFFER_SIZE_TAG, version);
+    }
+
+    if (is_tag_present(yml, ddsrouter::yaml::SOCKET_RECEIVE_BUFFER_SIZE_TAG))
+    {
+        object.receive_buffer_size = get<unsigned int>(yml, ddsrouter::yaml::SOCKET_RECEIVE_BUFFER_SIZE_TAG, version);
+    }
+
+    // Optional TCP options
+    if (is_tag_present(yml, ddsrouter::yaml::SOCKET_TCP_NODELAY_TAG))
+    {
+        object.tcp_nodelay = get<bool>(yml, ddsrouter::yaml::SOCKET_TCP_NODELAY_TAG, version);
+    }
+
+    // Optional RTPS keep alive of the TCP transport
+    if (is_tag_present(yml, ddsrouter::yaml::SOCKET_RTPS_KEEP_ALIVE_PERIOD_TAG))
+    {
+        object.rtps_keep_alive_period =
+                get<unsigned int>(yml, ddsrouter::yaml::SOCKET_RTPS_KEEP_ALIVE_PERIOD_TAG, version);
+    }
+
+    if (is_tag_present(yml, ddsrouter::yaml::SOCKET_RTPS_KEEP_ALIVE_TIMEOUT_TAG))
+    {
+        object.rtps_keep_alive_timeout =
+                get<unsigned int>(yml, ddsrouter::yaml::SOCKET_RTPS_KEEP_ALIVE_TIMEOUT_TAG, version);
+    }
+
+    // Optional busy poll
+    if (is_tag_present(yml, ddsrouter::yaml::SOCKET_BUSY_POLL_TAG))
+    {
+        object.busy_poll = get<unsigned int>(yml, ddsrouter::yaml::SOCKET_BUSY_POLL_TAG, version);
+    }
+
+    // Optional DSCP
+    if (is_tag_present(yml, ddsrouter::yaml::SOCKET_DSCP_TAG))
+    {
+        const unsigned int dscp = get<unsigned int>(yml, ddsrouter::yaml::SOCKET_DSCP_TAG, version);
+        const unsigned int max_dscp = ddsrouter::core::SocketConfiguration::MAX_DSCP;
+        if (dscp > max_dscp)
+        {
+            throw eprosima::utils::ConfigurationException(
+                      utils::Formatter() << "DSCP " << dscp << " in tag " << ddsrouter::yaml::SOCKET_DSCP_TAG
+                                         << " out of range, expected a value between 0 and " << max_dscp << ".");
+        }
+        object.dscp = static_cast<uint8_t>(dscp);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::WanInitialPeersParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::InitialPeersParticipantConfiguration>(object, yml, version);
+
+    // Optional I/O
+    if (is_tag_present(yml, ddsrouter::yaml::IO_TAG))
+    {
+        fill<ddsrouter::core::UdpIoConfiguration>(object.io, get_value_in_tag(yml, ddsrouter::yaml::IO_TAG), version);
+    }
+
+    // Optional socket options
+    if (is_tag_present(yml, ddsrouter::yaml::SOCKET_TAG))
+    {
+        fill<ddsrouter::core::SocketConfiguration>(object.socket, get_value_in_tag(yml, ddsrouter::yaml::SOCKET_TAG),
+                version);
+    }
+}
+
+template <>
+void YamlReader::fill(
+        ddsrouter::core::WanDiscoveryServerParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<participants::DiscoveryServerParticipantConfiguration>(object, yml, version);
+
+    // Optional I/O
+    if (is_tag_present(yml, ddsrouter::yaml::IO_TAG))
+    {
+        fill<ddsrouter::core::UdpIoConfiguration>(object.io, get_value_in_tag(yml, ddsrouter::yaml::IO_TAG), version);
+    }
+
+    // Optional socket options
+    if (is_tag_present(yml, ddsrouter::yaml::SOCKET_TAG))
+    {
+        fill<ddsrouter::core::SocketConfiguration>(object.socket, get_value_in_tag(yml, ddsrouter::yaml::SOCKET_TAG),
+                version);
     }
 }
 
@@ -95,17 +682,41 @@ YamlReader::get<std::shared_ptr<participants::ParticipantConfiguration>>(
                 YamlReader::get<participants::SimpleParticipantConfiguration>(yml, version));
 
         case ddsrouter::core::types::ParticipantKind::discovery_server:
-            return std::make_shared<participants::DiscoveryServerParticipantConfiguration>(
-                YamlReader::get<participants::DiscoveryServerParticipantConfiguration>(yml, version));
+            return std::make_shared<ddsrouter::core::WanDiscoveryServerParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::WanDiscoveryServerParticipantConfiguration>(yml, version));
 
         case ddsrouter::core::types::ParticipantKind::initial_peers:
-            return std::make_shared<participants::InitialPeersParticipantConfiguration>(
-                YamlReader::get<participants::InitialPeersParticipantConfiguration>(yml, version));
+            return std::make_shared<ddsrouter::core::WanInitialPeersParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::WanInitialPeersParticipantConfiguration>(yml, version));
 
         case ddsrouter::core::types::ParticipantKind::xml:
             return std::make_shared<participants::XmlParticipantConfiguration>(
                 YamlReader::get<participants::XmlParticipantConfiguration>(yml, version));
 
+        case ddsrouter::core::types::ParticipantKind::generator:
+            return std::make_shared<ddsrouter::core::GeneratorParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::GeneratorParticipantConfiguration>(yml, version));
+
+        case ddsrouter::core::types::ParticipantKind::sink:
+            return std::make_shared<ddsrouter::core::SinkParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::SinkParticipantConfiguration>(yml, version));
+
+        case ddsrouter::core::types::ParticipantKind::recorder:
+            return std::make_shared<ddsrouter::core::RecorderParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::RecorderParticipantConfiguration>(yml, version));
+
+        case ddsrouter::core::types::ParticipantKind::replayer:
+            return std::make_shared<ddsrouter::core::ReplayerParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::ReplayerParticipantConfiguration>(yml, version));
+
+        case ddsrouter::core::types::ParticipantKind::shm:
+            return std::make_shared<ddsrouter::core::ShmParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::ShmParticipantConfiguration>(yml, version));
+
+        case ddsrouter::core::types::ParticipantKind::uds:
+            return std::make_shared<ddsrouter::core::UdsParticipantConfiguration>(
+                YamlReader::get<ddsrouter::core::UdsParticipantConfiguration>(yml, version));
+
         default:
             // Non recheable code
             throw eprosima::utils::ConfigurationException(
@@ -216,12 +827,39 @@ void YamlReader::fill(
     {
         ddsrouter::core::types::ParticipantKind kind =
                 YamlReader::get<ddsrouter::core::types::ParticipantKind>(conf, PARTICIPANT_KIND_TAG, version);
+        auto participant_configuration =
+                YamlReader::get<std::shared_ptr<participants::ParticipantConfiguration>>(conf, version);
         object.participants_configurations.insert(
                     {
                         kind,
-                        YamlReader::get<std::shared_ptr<participants::ParticipantConfiguration>>(conf, version)
+                        participant_configuration
                     }
             );
+
+        // Optional duplicate suppression (not part of the DDS Pipe Participant configuration)
+        if (YamlReader::is_tag_present(conf, ddsrouter::yaml::DEDUPLICATION_TAG))
+        {
+            YamlReader::fill<ddsrouter::core::DeduplicationConfiguration>(
+                object.deduplication_configurations[participant_configuration->id],
+                YamlReader::get_value_in_tag(conf, ddsrouter::yaml::DEDUPLICATION_TAG),
+                version);
+        }
+
+        // Optional interest-based forwarding
+        if (YamlReader::is_tag_present(conf, ddsrouter::yaml::INTEREST_TAG))
+        {
+            YamlReader::fill<ddsrouter::core::InterestConfiguration>(
+                object.interest_configurations[participant_configuration->id],
+                YamlReader::get_value_in_tag(conf, ddsrouter::yaml::INTEREST_TAG),
+                version);
+        }
+
+        // Optional router link flag (the default depends on the kind)
+        if (YamlReader::is_tag_present(conf, ddsrouter::yaml::ROUTER_LINK_TAG))
+        {
+            object.router_links[participant_configuration->id] =
+                    YamlReader::get<bool>(conf, ddsrouter::yaml::ROUTER_LINK_TAG, version);
+        }
     }
 
     /////
@@ -246,6 +884,59 @@ void YamlReader::fill(
      */
     object.ddspipe_configuration.remove_unused_entities = object.advanced_options.remove_unused_entities;
 
+    /////
+    // Get optional max age of manual topics
+    // NOTE: the max age is not part of the DDS Pipe Topic QoS, so it is read here from the manual topics
+    if (YamlReader::is_tag_present(yml, TOPICS_TAG))
+    {
+        for (const auto& topic_yml : YamlReader::get_value_in_tag(yml, TOPICS_TAG))
+        {
+            if (YamlReader::is_tag_present(topic_yml, ddsrouter::yaml::TOPIC_QOS_TAG) &&
+                    YamlReader::is_tag_present(
+                        YamlReader::get_value_in_tag(topic_yml, ddsrouter::yaml::TOPIC_QOS_TAG),
+                        ddsrouter::yaml::QOS_MAX_AGE_TAG))
+            {
+                ddsrouter::core::types::TopicMaxAge topic_max_age;
+                YamlReader::fill<ddsrouter::core::types::TopicMaxAge>(topic_max_age, topic_yml, version);
+                object.topic_max_ages.push_back(topic_max_age);
+            }
+        }
+    }
+
+    /////
+    // Get optional redundancy groups
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::REDUNDANCY_GROUPS_TAG))
+    {
+        for (const auto& group_yml : YamlReader::get_value_in_tag(yml, ddsrouter::yaml::REDUNDANCY_GROUPS_TAG))
+        {
+            ddsrouter::core::RedundancyGroupConfiguration redundancy_group;
+            YamlReader::fill<ddsrouter::core::RedundancyGroupConfiguration>(redundancy_group, group_yml, version);
+            object.redundancy_groups.push_back(redundancy_group);
+        }
+    }
+
+    /////
+    // Get optional link groups
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::LINK_GROUPS_TAG))
+    {
+        for (const auto& group_yml : YamlReader::get_value_in_tag(yml, ddsrouter::yaml::LINK_GROUPS_TAG))
+        {
+            ddsrouter::core::LinkGroupConfiguration link_group;
+            YamlReader::fill<ddsrouter::core::LinkGroupConfiguration>(link_group, group_yml, version);
+            object.link_groups.push_back(link_group);
+        }
+    }
+
+    /////
+    // Get optional monitor configuration
+    if (YamlReader::is_tag_present(yml, ddsrouter::yaml::MONITOR_TAG))
+    {
+        YamlReader::fill<ddsrouter::core::MonitorConfiguration>(
+            object.monitor_configuration,
+            YamlReader::get_value_in_tag(yml, ddsrouter::yaml::MONITOR_TAG),
+            version);
+    }
+
     /////
     // Get optional xml configuration
     if (YamlReader::is_tag_present(yml, XML_TAG))
@@ -20,7 +20,16 @@
 #include <ddspipe_yaml/yaml_configuration_tags.hpp>
 #include <ddspipe_yaml/testing/generate_yaml.hpp>
 
+#include <ddsrouter_core/configuration/GeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/ShmParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/SinkParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/UdsParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/WanInitialPeersParticipantConfiguration.hpp>
+
 #include <ddsrouter_yaml/YamlReaderConfiguration.hpp>
+#include <ddsrouter_yaml/yaml_configuration_tags.hpp>
 
 using namespace eprosima;
 
@@ -491,6 +500,1477 @@ TEST(YamlReaderConfigurationTest, downsampling)
     }
 }
 
+/**
+ * Test load of the default max age in the configuration
+ *
+ * CASES:
+ * - trivial configuration
+ */
+TEST(YamlReaderConfigurationTest, max_age)
+{
+    const char* yml_configuration =
+            // trivial configuration
+            R"(
+        version: v4.0
+        participants:
+          - name: "P1"
+            kind: "echo"
+          - name: "P2"
+            kind: "echo"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    std::vector<unsigned int> test_cases = {0, 10, 100, 1000, 5000, 10000};
+
+    for (unsigned int test_case : test_cases)
+    {
+        Yaml yml_topic_qos;
+        Yaml yml_specs;
+
+        yml_topic_qos[ddsrouter::yaml::QOS_MAX_AGE_TAG] = test_case;
+        yml_specs[ddspipe::yaml::SPECS_QOS_TAG] = yml_topic_qos;
+        yml[ddspipe::yaml::SPECS_TAG] = yml_specs;
+
+        // Load configuration
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        // Check max age is correct
+        ASSERT_EQ(test_case, configuration_result.advanced_options.max_age);
+    }
+}
+
+/**
+ * Test load of the max age of manual topics in the configuration
+ *
+ * CASES:
+ * - manual topic with max age for every participant
+ * - manual topic with max age for a participant
+ * - manual topic without max age
+ * - manual topic with max age for a non existing participant
+ */
+TEST(YamlReaderConfigurationTest, topic_max_age)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "P1"
+            kind: "echo"
+          - name: "P2"
+            kind: "echo"
+        topics:
+          - name: "rt/cmd_vel"
+            qos:
+              max-age: 200
+          - name: "rt/camera/*"
+            type: "sensor_msgs::msg::dds_::Image_"
+            qos:
+              max-age: 50
+            participants:
+              - P2
+          - name: "rt/chatter"
+            qos:
+              downsampling: 2
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    // Load configuration
+    ddsrouter::core::DdsRouterConfiguration configuration_result =
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+    // Only topics with max age are stored
+    ASSERT_EQ(2u, configuration_result.topic_max_ages.size());
+
+    const auto& cmd_vel = configuration_result.topic_max_ages[0];
+    ASSERT_EQ(200u, cmd_vel.max_age);
+    ASSERT_TRUE(cmd_vel.matches("rt/cmd_vel", "geometry_msgs::msg::dds_::Twist_", "P1"));
+    ASSERT_TRUE(cmd_vel.matches("rt/cmd_vel", "geometry_msgs::msg::dds_::Twist_", "P2"));
+    ASSERT_FALSE(cmd_vel.matches("rt/chatter", "std_msgs::msg::dds_::String_", "P1"));
+
+    const auto& camera = configuration_result.topic_max_ages[1];
+    ASSERT_EQ(50u, camera.max_age);
+    ASSERT_TRUE(camera.matches("rt/camera/front", "sensor_msgs::msg::dds_::Image_", "P2"));
+    ASSERT_FALSE(camera.matches("rt/camera/front", "sensor_msgs::msg::dds_::Image_", "P1"));
+    ASSERT_FALSE(camera.matches("rt/camera/front", "std_msgs::msg::dds_::String_", "P2"));
+
+    // Non existing participant
+    yml[ddspipe::yaml::TOPICS_TAG][1][ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0] = "P3";
+    configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+    ASSERT_FALSE(configuration_result.is_valid(error_msg));
+}
+
+/**
+ * Test load of the duplicate suppression of the participants in the configuration
+ *
+ * CASES:
+ * - participant with default window and lease
+ * - participant with specific window and lease
+ * - participant without deduplication
+ * - invalid window
+ * - invalid lease
+ */
+TEST(YamlReaderConfigurationTest, deduplication)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "P1"
+            kind: "echo"
+            deduplication: {}
+          - name: "P2"
+            kind: "echo"
+            deduplication:
+              window: 4096
+              lease: 5000
+          - name: "P3"
+            kind: "echo"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    // Load configuration
+    ddsrouter::core::DdsRouterConfiguration configuration_result =
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+    const auto& deduplication = configuration_result.deduplication_configurations;
+    ASSERT_EQ(2u, deduplication.size());
+    ASSERT_EQ(ddsrouter::core::DeduplicationConfiguration().window, deduplication.at("P1").window);
+    ASSERT_EQ(ddsrouter::core::DeduplicationConfiguration().lease, deduplication.at("P1").lease);
+    ASSERT_EQ(4096u, deduplication.at("P2").window);
+    ASSERT_EQ(5000u, deduplication.at("P2").lease);
+    ASSERT_EQ(deduplication.end(), deduplication.find("P3"));
+
+    // Invalid window
+    yml[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][1][ddsrouter::yaml::DEDUPLICATION_TAG]
+    [ddsrouter::yaml::DEDUPLICATION_WINDOW_TAG] = 0;
+    configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+    ASSERT_FALSE(configuration_result.is_valid(error_msg));
+
+    // Invalid lease
+    yml[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][1][ddsrouter::yaml::DEDUPLICATION_TAG]
+    [ddsrouter::yaml::DEDUPLICATION_WINDOW_TAG] = 4096;
+    yml[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][1][ddsrouter::yaml::DEDUPLICATION_TAG]
+    [ddsrouter::yaml::DEDUPLICATION_LEASE_TAG] = 0;
+    configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+    ASSERT_FALSE(configuration_result.is_valid(error_msg));
+}
+
+/**
+ * Test load of the redundancy groups in the configuration
+ *
+ * CASES:
+ * - group with default window
+ * - group with specific window
+ * - group with a single participant
+ * - participant in two groups
+ * - group with a non existing participant
+ */
+TEST(YamlReaderConfigurationTest, redundancy_groups)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "Wired"
+            kind: "echo"
+          - name: "LTE"
+            kind: "echo"
+          - name: "Satellite"
+            kind: "echo"
+          - name: "Local"
+            kind: "echo"
+        redundancy-groups:
+          - name: "teleop"
+            participants:
+              - Wired
+              - LTE
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    // Load configuration
+    ddsrouter::core::DdsRouterConfiguration configuration_result =
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+    ASSERT_EQ(1u, configuration_result.redundancy_groups.size());
+    const auto& teleop = configuration_result.redundancy_groups[0];
+    ASSERT_EQ("teleop", teleop.name);
+    ASSERT_EQ(2u, teleop.participants.size());
+    ASSERT_EQ(ddsrouter::core::DeduplicationConfiguration().window, teleop.deduplication.window);
+
+    // Specific window
+    yml[ddsrouter::yaml::REDUNDANCY_GROUPS_TAG][0][ddsrouter::yaml::DEDUPLICATION_WINDOW_TAG] = 8192;
+    configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+    ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+    ASSERT_EQ(8192u, configuration_result.redundancy_groups[0].deduplication.window);
+
+    // Single participant
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddsrouter::yaml::REDUNDANCY_GROUPS_TAG][0][ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG] =
+                YAML::Load("[Wired]");
+        configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // Participant in two groups
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddsrouter::yaml::REDUNDANCY_GROUPS_TAG].push_back(
+            YAML::Load("{name: backup, participants: [LTE, Satellite]}"));
+        configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // Non existing participant
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddsrouter::yaml::REDUNDANCY_GROUPS_TAG][0][ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG] =
+                YAML::Load("[Wired, Radio]");
+        configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load of the link groups in the configuration
+ *
+ * CASES:
+ * - group with default timing
+ * - group with specific timing
+ * - link probe port and peers in specs
+ * - invalid link probe peer
+ * - group with a single link
+ * - detection time lower than probe period
+ * - invalid probe address
+ * - group with a non existing participant
+ */
+TEST(YamlReaderConfigurationTest, link_groups)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "Wired"
+            kind: "echo"
+          - name: "LTE"
+            kind: "echo"
+          - name: "Local"
+            kind: "echo"
+        link-groups:
+          - name: "cloud"
+            links:
+              - participant: Wired
+                probe-address:
+                  ip: 10.0.0.2
+                  port: 11700
+              - participant: LTE
+                probe-address:
+                  ip: 100.64.0.2
+                  port: 11700
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    // Load configuration
+    ddsrouter::core::DdsRouterConfiguration configuration_result =
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+    ASSERT_EQ(1u, configuration_result.link_groups.size());
+    const auto& cloud = configuration_result.link_groups[0];
+    const ddsrouter::core::LinkGroupConfiguration default_link_group;
+    ASSERT_EQ("cloud", cloud.name);
+    ASSERT_EQ(2u, cloud.links.size());
+    ASSERT_EQ("Wired", cloud.links[0].participant);
+    ASSERT_EQ("10.0.0.2", cloud.links[0].probe_ip);
+    ASSERT_EQ(11700u, cloud.links[0].probe_port);
+    ASSERT_EQ("LTE", cloud.links[1].participant);
+    ASSERT_EQ(default_link_group.probe_period, cloud.probe_period);
+    ASSERT_EQ(default_link_group.detection_time, cloud.detection_time);
+    ASSERT_EQ(default_link_group.hysteresis, cloud.hysteresis);
+    ASSERT_EQ(0u, configuration_result.advanced_options.link_probe_port);
+
+    ASSERT_TRUE(configuration_result.advanced_options.link_probe_peers.empty());
+
+    // Specific timing, link probe port and peers
+    yml[ddsrouter::yaml::LINK_GROUPS_TAG][0][ddsrouter::yaml::LINK_PROBE_PERIOD_TAG] = 50;
+    yml[ddsrouter::yaml::LINK_GROUPS_TAG][0][ddsrouter::yaml::LINK_DETECTION_TIME_TAG] = 300;
+    yml[ddsrouter::yaml::LINK_GROUPS_TAG][0][ddsrouter::yaml::LINK_HYSTERESIS_TAG] = 10;
+    yml[ddspipe::yaml::SPECS_TAG][ddsrouter::yaml::LINK_PROBE_PORT_TAG] = 11700;
+    yml[ddspipe::yaml::SPECS_TAG][ddsrouter::yaml::LINK_PROBE_PEERS_TAG].push_back("10.0.0.2");
+    yml[ddspipe::yaml::SPECS_TAG][ddsrouter::yaml::LINK_PROBE_PEERS_TAG].push_back("100.64.0.2");
+    configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+    ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+    ASSERT_EQ(50u, configuration_result.link_groups[0].probe_period);
+    ASSERT_EQ(300u, configuration_result.link_groups[0].detection_time);
+    ASSERT_EQ(10u, configuration_result.link_groups[0].hysteresis);
+    ASSERT_EQ(11700u, configuration_result.advanced_options.link_probe_port);
+    ASSERT_EQ((std::set<std::string>{"10.0.0.2", "100.64.0.2"}),
+            configuration_result.advanced_options.link_probe_peers);
+
+    // Invalid link probe peer
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddspipe::yaml::SPECS_TAG][ddsrouter::yaml::LINK_PROBE_PEERS_TAG][1] = "not.an.ip";
+        configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // Single link
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddsrouter::yaml::LINK_GROUPS_TAG][0][ddsrouter::yaml::LINK_GROUP_LINKS_TAG].remove(1);
+        configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // Detection time lower than probe period
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddsrouter::yaml::LINK_GROUPS_TAG][0][ddsrouter::yaml::LINK_DETECTION_TIME_TAG] = 20;
+        configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // Invalid probe address
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddsrouter::yaml::LINK_GROUPS_TAG][0][ddsrouter::yaml::LINK_GROUP_LINKS_TAG][0]
+        [ddsrouter::yaml::LINK_PROBE_ADDRESS_TAG][ddsrouter::yaml::PROBE_ADDRESS_IP_TAG] = "not.an.ip";
+        configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // Non existing participant
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddsrouter::yaml::LINK_GROUPS_TAG][0][ddsrouter::yaml::LINK_GROUP_LINKS_TAG][0]
+        [ddsrouter::yaml::LINK_PARTICIPANT_TAG] = "Satellite";
+        configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load of the interest-based forwarding in the configuration
+ *
+ * CASES:
+ * - participant with interest address, and interest port and peers in specs
+ * - invalid interest address
+ * - interest port out of range
+ * - invalid interest peer
+ */
+TEST(YamlReaderConfigurationTest, interest)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "Wan"
+            kind: "echo"
+            interest:
+              ip: 10.0.0.2
+              port: 11701
+          - name: "Local"
+            kind: "echo"
+        specs:
+          interest-port: 11701
+          interest-peers: ["10.0.0.2", "10.0.0.3"]
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    // Load configuration
+    ddsrouter::core::DdsRouterConfiguration configuration_result =
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+    utils::Formatter error_msg;
+    ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+    ASSERT_EQ(1u, configuration_result.interest_configurations.size());
+    const auto& wan_interest = configuration_result.interest_configurations.at("Wan");
+    ASSERT_EQ("10.0.0.2", wan_interest.ip);
+    ASSERT_EQ(11701u, wan_interest.port);
+    ASSERT_EQ(11701u, configuration_result.advanced_options.interest_port);
+    ASSERT_EQ((std::set<std::string>{"10.0.0.2", "10.0.0.3"}), configuration_result.advanced_options.interest_peers);
+
+    // Invalid interest address
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::INTEREST_TAG]
+        [ddsrouter::yaml::INTEREST_ADDRESS_IP_TAG] = "not.an.ip";
+        configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // Interest port out of range
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddspipe::yaml::SPECS_TAG][ddsrouter::yaml::INTEREST_PORT_TAG] = 70000;
+        ASSERT_THROW(
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative),
+            utils::ConfigurationException);
+    }
+
+    // Invalid interest peer
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddspipe::yaml::SPECS_TAG][ddsrouter::yaml::INTEREST_PEERS_TAG][1] = "not.an.ip";
+        configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test the participants considered connected to other DDS Routers, whose readers are not local interest
+ *
+ * CASES:
+ * - default of each kind (WAN, local discovery server, unix socket, simple)
+ * - participant with interest-based forwarding
+ * - default overridden with router-link
+ */
+TEST(YamlReaderConfigurationTest, router_links)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "Wan"
+            kind: "wan"
+            listening-addresses:
+              - ip: "127.0.0.1"
+                port: 11666
+                transport: "udp"
+          - name: "LocalDs"
+            kind: "local-ds"
+            discovery-server-guid:
+              id: 1
+            listening-addresses:
+              - ip: "127.0.0.1"
+                port: 11667
+                transport: "udp"
+          - name: "Uds"
+            kind: "unix-socket"
+            domain: 3
+          - name: "Shared"
+            kind: "local"
+            domain: 5
+          - name: "Echo"
+            kind: "echo"
+            interest:
+              ip: 10.0.0.2
+              port: 11701
+          - name: "Local"
+            kind: "local"
+            domain: 4
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+    utils::Formatter error_msg;
+
+    // Defaults
+    {
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+        ASSERT_TRUE(configuration_result.router_links.empty());
+        ASSERT_EQ((std::set<ddspipe::core::types::ParticipantId>{"Wan", "LocalDs", "Uds", "Echo"}),
+                configuration_result.router_link_participants());
+    }
+
+    // Overridden defaults
+    {
+        Yaml yml_override = YAML::Clone(yml);
+        yml_override[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][1][ddsrouter::yaml::ROUTER_LINK_TAG] = false;
+        yml_override[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][3][ddsrouter::yaml::ROUTER_LINK_TAG] = true;
+        yml_override[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][4][ddsrouter::yaml::ROUTER_LINK_TAG] = false;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_override);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+        ASSERT_EQ(3u, configuration_result.router_links.size());
+        ASSERT_EQ((std::set<ddspipe::core::types::ParticipantId>{"Wan", "Uds", "Shared"}),
+                configuration_result.router_link_participants());
+    }
+}
+
+/**
+ * Test setting source latency in the configuration.
+ *
+ * CASES:
+ * - not set
+ * - trivial configuration
+ */
+TEST(YamlReaderConfigurationTest, source_latency)
+{
+    const char* yml_configuration =
+            // trivial configuration
+            R"(
+        version: v4.0
+        participants:
+          - name: "P1"
+            kind: "echo"
+          - name: "P2"
+            kind: "echo"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    // Disabled by default
+    {
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_FALSE(configuration_result.advanced_options.source_latency);
+    }
+
+    std::vector<bool> test_cases = {false, true};
+
+    for (bool test_case : test_cases)
+    {
+        Yaml yml_specs;
+        yml_specs[ddsrouter::yaml::SOURCE_LATENCY_TAG] = test_case;
+        yml[ddspipe::yaml::SPECS_TAG] = yml_specs;
+
+        // Load configuration
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        // Check source latency is correct
+        ASSERT_EQ(test_case, configuration_result.advanced_options.source_latency);
+    }
+}
+
+/**
+ * Test setting route latency in the configuration.
+ *
+ * CASES:
+ * - not set
+ * - trivial configuration
+ */
+TEST(YamlReaderConfigurationTest, route_latency)
+{
+    const char* yml_configuration =
+            // trivial configuration
+            R"(
+        version: v4.0
+        participants:
+          - name: "P1"
+            kind: "echo"
+          - name: "P2"
+            kind: "echo"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+
+    // Enabled by default
+    {
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.advanced_options.route_latency);
+    }
+
+    std::vector<bool> test_cases = {false, true};
+
+    for (bool test_case : test_cases)
+    {
+        Yaml yml_specs;
+        yml_specs[ddsrouter::yaml::ROUTE_LATENCY_TAG] = test_case;
+        yml[ddspipe::yaml::SPECS_TAG] = yml_specs;
+
+        // Load configuration
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        // Check route latency is correct
+        ASSERT_EQ(test_case, configuration_result.advanced_options.route_latency);
+    }
+}
+
+/**
+ * Test setting the publication of the statistics in the configuration.
+ *
+ * CASES:
+ * - not set
+ * - default values
+ * - every value set
+ * - invalid period
+ */
+TEST(YamlReaderConfigurationTest, monitor)
+{
+    const char* yml_configuration =
+            // trivial configuration
+            R"(
+        version: v4.0
+        participants:
+          - name: "P1"
+            kind: "echo"
+          - name: "P2"
+            kind: "echo"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+    utils::Formatter error_msg;
+
+    // Disabled by default
+    {
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_FALSE(configuration_result.monitor_configuration.enable);
+    }
+
+    // Default values
+    {
+        Yaml yml_monitor = YAML::Clone(yml);
+        yml_monitor[ddsrouter::yaml::MONITOR_TAG] = YAML::Load("{}");
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_monitor);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+        ASSERT_TRUE(configuration_result.monitor_configuration.enable);
+        ASSERT_EQ(0u, configuration_result.monitor_configuration.domain);
+        ASSERT_EQ("ddsrouter/statistics", configuration_result.monitor_configuration.topic_name);
+        ASSERT_EQ(1000u, configuration_result.monitor_configuration.period);
+    }
+
+    // Every value set
+    {
+        Yaml yml_monitor = YAML::Clone(yml);
+        yml_monitor[ddsrouter::yaml::MONITOR_TAG][ddsrouter::yaml::MONITOR_DOMAIN_TAG] = 42;
+        yml_monitor[ddsrouter::yaml::MONITOR_TAG][ddsrouter::yaml::MONITOR_TOPIC_NAME_TAG] = "fleet/router_1";
+        yml_monitor[ddsrouter::yaml::MONITOR_TAG][ddsrouter::yaml::MONITOR_PERIOD_TAG] = 5000;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_monitor);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+        ASSERT_TRUE(configuration_result.monitor_configuration.enable);
+        ASSERT_EQ(42u, configuration_result.monitor_configuration.domain);
+        ASSERT_EQ("fleet/router_1", configuration_result.monitor_configuration.topic_name);
+        ASSERT_EQ(5000u, configuration_result.monitor_configuration.period);
+    }
+
+    // Invalid period
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddsrouter::yaml::MONITOR_TAG][ddsrouter::yaml::MONITOR_PERIOD_TAG] = 0;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load of a generator participant in the configuration.
+ *
+ * CASES:
+ * - default values
+ * - every value set
+ * - no topics
+ * - payload smaller than the header of the generated samples
+ * - repeated topic
+ */
+TEST(YamlReaderConfigurationTest, generator)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "Load"
+            kind: "generator"
+            topics:
+              - name: "rt/chatter"
+              - name: "rt/lidar"
+                type: "sensor_msgs::msg::dds_::PointCloud2_"
+                rate: 20.5
+                payload-size: 65536
+                keys: 4
+          - name: "P2"
+            kind: "echo"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+    utils::Formatter error_msg;
+
+    // Load configuration
+    ddsrouter::core::DdsRouterConfiguration configuration_result =
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+    ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+    std::shared_ptr<ddsrouter::core::GeneratorParticipantConfiguration> generator;
+    for (const auto& participant : configuration_result.participants_configurations)
+    {
+        if (participant.first == ddsrouter::core::types::ParticipantKind::generator)
+        {
+            generator = std::dynamic_pointer_cast<ddsrouter::core::GeneratorParticipantConfiguration>(
+                participant.second);
+        }
+    }
+    ASSERT_NE(nullptr, generator);
+    ASSERT_EQ("Load", generator->id);
+    ASSERT_EQ(2u, generator->topics.size());
+
+    // Default values
+    const auto& chatter = generator->topics[0];
+    ASSERT_EQ("rt/chatter", chatter.topic_name);
+    ASSERT_EQ(ddsrouter::core::types::GeneratedSample::TYPE_NAME, chatter.type_name);
+    ASSERT_EQ(10, chatter.rate);
+    ASSERT_EQ(64u, chatter.payload_size);
+    ASSERT_EQ(0u, chatter.keys);
+    ASSERT_FALSE(chatter.dds_topic().topic_qos.keyed);
+
+    // Every value set
+    const auto& lidar = generator->topics[1];
+    ASSERT_EQ("rt/lidar", lidar.topic_name);
+    ASSERT_EQ("sensor_msgs::msg::dds_::PointCloud2_", lidar.type_name);
+    ASSERT_EQ(20.5, lidar.rate);
+    ASSERT_EQ(65536u, lidar.payload_size);
+    ASSERT_EQ(4u, lidar.keys);
+    ASSERT_TRUE(lidar.dds_topic().topic_qos.keyed);
+
+    // No topics
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0].remove(ddsrouter::yaml::GENERATOR_TOPICS_TAG);
+        ASSERT_THROW(
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative),
+            utils::ConfigurationException);
+    }
+
+    // Payload smaller than the header of the generated samples
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::GENERATOR_TOPICS_TAG][0]
+        [ddsrouter::yaml::GENERATOR_PAYLOAD_SIZE_TAG] = 8;
+        configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // Repeated topic
+    {
+        Yaml yml_negative = YAML::Clone(yml);
+        yml_negative[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::GENERATOR_TOPICS_TAG][1]
+        [ddspipe::yaml::TOPIC_NAME_TAG] = "rt/chatter";
+        configuration_result = ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_negative);
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load of a sink participant in the configuration.
+ *
+ * CASES:
+ * - default values
+ * - checksum verification
+ */
+TEST(YamlReaderConfigurationTest, sink)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "Load"
+            kind: "generator"
+            topics:
+              - name: "rt/chatter"
+          - name: "Sink"
+            kind: "sink"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+    utils::Formatter error_msg;
+
+    std::vector<bool> test_cases = {false, true};
+
+    for (bool test_case : test_cases)
+    {
+        Yaml yml_sink = YAML::Clone(yml);
+        if (test_case)
+        {
+            yml_sink[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][1][ddsrouter::yaml::SINK_VERIFY_CHECKSUM_TAG] = true;
+        }
+
+        // Load configuration
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_sink);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        std::shared_ptr<ddsrouter::core::SinkParticipantConfiguration> sink;
+        for (const auto& participant : configuration_result.participants_configurations)
+        {
+            if (participant.first == ddsrouter::core::types::ParticipantKind::sink)
+            {
+                sink = std::dynamic_pointer_cast<ddsrouter::core::SinkParticipantConfiguration>(participant.second);
+            }
+        }
+        ASSERT_NE(nullptr, sink);
+        ASSERT_EQ("Sink", sink->id);
+        ASSERT_EQ(test_case, sink->verify_checksum);
+    }
+}
+
+/**
+ * Test load of a recorder participant in the configuration.
+ *
+ * CASES:
+ * - default values
+ * - every value set
+ * - unknown compression
+ */
+TEST(YamlReaderConfigurationTest, recorder)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "Load"
+            kind: "generator"
+            topics:
+              - name: "rt/chatter"
+          - name: "Recorder"
+            kind: "recorder"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+    utils::Formatter error_msg;
+
+    auto get_recorder = [](const ddsrouter::core::DdsRouterConfiguration& configuration)
+            {
+                std::shared_ptr<ddsrouter::core::RecorderParticipantConfiguration> recorder;
+                for (const auto& participant : configuration.participants_configurations)
+                {
+                    if (participant.first == ddsrouter::core::types::ParticipantKind::recorder)
+                    {
+                        recorder = std::dynamic_pointer_cast<ddsrouter::core::RecorderParticipantConfiguration>(
+                            participant.second);
+                    }
+                }
+                return recorder;
+            };
+
+    // default values
+    {
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto recorder = get_recorder(configuration_result);
+        ASSERT_NE(nullptr, recorder);
+        ASSERT_EQ("Recorder", recorder->id);
+
+        ddsrouter::core::RecorderParticipantConfiguration default_configuration;
+        ASSERT_EQ(default_configuration.file_prefix, recorder->file_prefix);
+        ASSERT_EQ(default_configuration.max_file_size, recorder->max_file_size);
+        ASSERT_EQ(default_configuration.chunk_size, recorder->chunk_size);
+        ASSERT_EQ(default_configuration.compress, recorder->compress);
+        ASSERT_EQ(default_configuration.max_pending_size, recorder->max_pending_size);
+    }
+
+    // every value set
+    {
+        Yaml yml_recorder = YAML::Clone(yml);
+        Yaml recorder_yml = yml_recorder[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][1];
+        recorder_yml[ddsrouter::yaml::RECORDER_FILE_PREFIX_TAG] = "/tmp/traffic";
+        recorder_yml[ddsrouter::yaml::RECORDER_MAX_FILE_SIZE_TAG] = 1000000;
+        recorder_yml[ddsrouter::yaml::RECORDER_CHUNK_SIZE_TAG] = 4096;
+        recorder_yml[ddsrouter::yaml::RECORDER_COMPRESSION_TAG] = "none";
+        recorder_yml[ddsrouter::yaml::RECORDER_MAX_PENDING_SIZE_TAG] = 8192;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_recorder);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto recorder = get_recorder(configuration_result);
+        ASSERT_NE(nullptr, recorder);
+        ASSERT_EQ("/tmp/traffic", recorder->file_prefix);
+        ASSERT_EQ(1000000u, recorder->max_file_size);
+        ASSERT_EQ(4096u, recorder->chunk_size);
+        ASSERT_FALSE(recorder->compress);
+        ASSERT_EQ(8192u, recorder->max_pending_size);
+    }
+
+    // unknown compression
+    {
+        Yaml yml_recorder = YAML::Clone(yml);
+        yml_recorder[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][1][ddsrouter::yaml::RECORDER_COMPRESSION_TAG] =
+                "zstd";
+
+        ASSERT_THROW(
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_recorder),
+            utils::ConfigurationException);
+    }
+}
+
+/**
+ * Test load of a replayer participant in the configuration.
+ *
+ * CASES:
+ * - default values
+ * - every value set
+ * - no files
+ * - negative playback rate
+ */
+TEST(YamlReaderConfigurationTest, replayer)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "Replayer"
+            kind: "replayer"
+            files:
+              - "/tmp/traffic_0.mcap"
+              - "/tmp/traffic_1.mcap"
+          - name: "Sink"
+            kind: "sink"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+    utils::Formatter error_msg;
+
+    auto get_replayer = [](const ddsrouter::core::DdsRouterConfiguration& configuration)
+            {
+                std::shared_ptr<ddsrouter::core::ReplayerParticipantConfiguration> replayer;
+                for (const auto& participant : configuration.participants_configurations)
+                {
+                    if (participant.first == ddsrouter::core::types::ParticipantKind::replayer)
+                    {
+                        replayer = std::dynamic_pointer_cast<ddsrouter::core::ReplayerParticipantConfiguration>(
+                            participant.second);
+                    }
+                }
+                return replayer;
+            };
+
+    // default values
+    {
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto replayer = get_replayer(configuration_result);
+        ASSERT_NE(nullptr, replayer);
+        ASSERT_EQ("Replayer", replayer->id);
+        ASSERT_EQ((std::vector<std::string>{"/tmp/traffic_0.mcap", "/tmp/traffic_1.mcap"}), replayer->files);
+
+        ddsrouter::core::ReplayerParticipantConfiguration default_configuration;
+        ASSERT_EQ(default_configuration.playback_rate, replayer->playback_rate);
+    }
+
+    // every value set
+    {
+        Yaml yml_replayer = YAML::Clone(yml);
+        yml_replayer[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::REPLAYER_PLAYBACK_RATE_TAG] = 2.5;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_replayer);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto replayer = get_replayer(configuration_result);
+        ASSERT_NE(nullptr, replayer);
+        ASSERT_EQ(2.5, replayer->playback_rate);
+    }
+
+    // no files
+    {
+        Yaml yml_replayer = YAML::Clone(yml);
+        yml_replayer[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0].remove(ddsrouter::yaml::REPLAYER_FILES_TAG);
+
+        ASSERT_THROW(
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_replayer),
+            utils::ConfigurationException);
+    }
+
+    // negative playback rate
+    {
+        Yaml yml_replayer = YAML::Clone(yml);
+        yml_replayer[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::REPLAYER_PLAYBACK_RATE_TAG] = -1;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_replayer);
+
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load of a shared memory participant in the configuration.
+ *
+ * CASES:
+ * - default values
+ * - every value set
+ * - message larger than the segment
+ */
+TEST(YamlReaderConfigurationTest, shm)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "Local"
+            kind: "shm"
+            domain: 3
+          - name: "Echo"
+            kind: "echo"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+    utils::Formatter error_msg;
+
+    auto get_shm = [](const ddsrouter::core::DdsRouterConfiguration& configuration)
+            {
+                std::shared_ptr<ddsrouter::core::ShmParticipantConfiguration> shm;
+                for (const auto& participant : configuration.participants_configurations)
+                {
+                    if (participant.first == ddsrouter::core::types::ParticipantKind::shm)
+                    {
+                        shm = std::dynamic_pointer_cast<ddsrouter::core::ShmParticipantConfiguration>(
+                            participant.second);
+                    }
+                }
+                return shm;
+            };
+
+    // default values
+    {
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto shm = get_shm(configuration_result);
+        ASSERT_NE(nullptr, shm);
+        ASSERT_EQ("Local", shm->id);
+        ASSERT_EQ(3u, shm->domain.domain_id);
+
+        ddsrouter::core::ShmParticipantConfiguration default_configuration;
+        ASSERT_EQ(default_configuration.segment_size, shm->segment_size);
+        ASSERT_EQ(default_configuration.max_message_size, shm->max_message_size);
+    }
+
+    // every value set
+    {
+        Yaml yml_shm = YAML::Clone(yml);
+        Yaml shm_yml = yml_shm[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0];
+        shm_yml[ddsrouter::yaml::SHM_SEGMENT_SIZE_TAG] = 33554432;
+        shm_yml[ddsrouter::yaml::SHM_MAX_MESSAGE_SIZE_TAG] = 2097152;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_shm);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto shm = get_shm(configuration_result);
+        ASSERT_NE(nullptr, shm);
+        ASSERT_EQ(33554432u, shm->segment_size);
+        ASSERT_EQ(2097152u, shm->max_message_size);
+    }
+
+    // message larger than the segment
+    {
+        Yaml yml_shm = YAML::Clone(yml);
+        Yaml shm_yml = yml_shm[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0];
+        shm_yml[ddsrouter::yaml::SHM_SEGMENT_SIZE_TAG] = 1048576;
+        shm_yml[ddsrouter::yaml::SHM_MAX_MESSAGE_SIZE_TAG] = 2097152;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_shm);
+
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load of a Unix domain socket participant in the configuration.
+ *
+ * CASES:
+ * - default values
+ * - every value set
+ * - memory file threshold larger than a datagram
+ * - socket directory too long
+ */
+TEST(YamlReaderConfigurationTest, uds)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "Link"
+            kind: "unix-socket"
+            domain: 3
+          - name: "Echo"
+            kind: "echo"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+    utils::Formatter error_msg;
+
+    auto get_uds = [](const ddsrouter::core::DdsRouterConfiguration& configuration)
+            {
+                std::shared_ptr<ddsrouter::core::UdsParticipantConfiguration> uds;
+                for (const auto& participant : configuration.participants_configurations)
+                {
+                    if (participant.first == ddsrouter::core::types::ParticipantKind::uds)
+                    {
+                        uds = std::dynamic_pointer_cast<ddsrouter::core::UdsParticipantConfiguration>(
+                            participant.second);
+                    }
+                }
+                return uds;
+            };
+
+    // default values
+    {
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto uds = get_uds(configuration_result);
+        ASSERT_NE(nullptr, uds);
+        ASSERT_EQ("Link", uds->id);
+        ASSERT_EQ(3u, uds->domain.domain_id);
+
+        ddsrouter::core::UdsParticipantConfiguration default_configuration;
+        ASSERT_EQ(default_configuration.socket_directory, uds->socket_directory);
+        ASSERT_EQ(default_configuration.memfd_threshold, uds->memfd_threshold);
+        ASSERT_EQ(default_configuration.max_message_size, uds->max_message_size);
+    }
+
+    // every value set
+    {
+        Yaml yml_uds = YAML::Clone(yml);
+        Yaml uds_yml = yml_uds[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0];
+        uds_yml[ddsrouter::yaml::UDS_SOCKET_DIRECTORY_TAG] = "/var/run/ddsrouter";
+        uds_yml[ddsrouter::yaml::UDS_MEMFD_THRESHOLD_TAG] = 16384;
+        uds_yml[ddsrouter::yaml::UDS_MAX_MESSAGE_SIZE_TAG] = 4194304;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_uds);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto uds = get_uds(configuration_result);
+        ASSERT_NE(nullptr, uds);
+        ASSERT_EQ("/var/run/ddsrouter", uds->socket_directory);
+        ASSERT_EQ(16384u, uds->memfd_threshold);
+        ASSERT_EQ(4194304u, uds->max_message_size);
+    }
+
+    // memory file threshold larger than a datagram
+    {
+        Yaml yml_uds = YAML::Clone(yml);
+        Yaml uds_yml = yml_uds[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0];
+        uds_yml[ddsrouter::yaml::UDS_MEMFD_THRESHOLD_TAG] = 1048576;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_uds);
+
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // socket directory too long
+    {
+        Yaml yml_uds = YAML::Clone(yml);
+        Yaml uds_yml = yml_uds[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0];
+        uds_yml[ddsrouter::yaml::UDS_SOCKET_DIRECTORY_TAG] = "/tmp/" + std::string(100, 'a');
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_uds);
+
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load of the I/O backend of a WAN participant
+ *
+ * CASES:
+ * - default values
+ * - every value set
+ * - unknown backend
+ * - no ring entries
+ */
+TEST(YamlReaderConfigurationTest, wan_io)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "Wan"
+            kind: "wan"
+            listening-addresses:
+              - ip: "127.0.0.1"
+                port: 11666
+                transport: "udp"
+          - name: "Echo"
+            kind: "echo"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+    utils::Formatter error_msg;
+
+    auto get_wan = [](const ddsrouter::core::DdsRouterConfiguration& configuration)
+            {
+                std::shared_ptr<ddsrouter::core::WanInitialPeersParticipantConfiguration> wan;
+                for (const auto& participant : configuration.participants_configurations)
+                {
+                    if (participant.first == ddsrouter::core::types::ParticipantKind::initial_peers)
+                    {
+                        wan = std::dynamic_pointer_cast<ddsrouter::core::WanInitialPeersParticipantConfiguration>(
+                            participant.second);
+                    }
+                }
+                return wan;
+            };
+
+    // default values
+    {
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto wan = get_wan(configuration_result);
+        ASSERT_NE(nullptr, wan);
+        ASSERT_EQ("Wan", wan->id);
+
+        ddsrouter::core::UdpIoConfiguration default_configuration;
+        ASSERT_EQ(ddsrouter::core::UdpIoBackend::fastdds, wan->io.backend);
+        ASSERT_EQ(default_configuration.ring_entries, wan->io.ring_entries);
+        ASSERT_EQ(default_configuration.sqpoll, wan->io.sqpoll);
+        ASSERT_EQ(default_configuration.batch_size, wan->io.batch_size);
+        ASSERT_EQ(default_configuration.offload, wan->io.offload);
+    }
+
+    // every value set
+    {
+        Yaml yml_wan = YAML::Clone(yml);
+        Yaml io_yml = yml_wan[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::IO_TAG];
+        io_yml[ddsrouter::yaml::IO_BACKEND_TAG] = "io-uring";
+        io_yml[ddsrouter::yaml::IO_RING_ENTRIES_TAG] = 256;
+        io_yml[ddsrouter::yaml::IO_SQPOLL_TAG] = true;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_wan);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto wan = get_wan(configuration_result);
+        ASSERT_NE(nullptr, wan);
+        ASSERT_EQ(ddsrouter::core::UdpIoBackend::io_uring, wan->io.backend);
+        ASSERT_EQ(256u, wan->io.ring_entries);
+        ASSERT_TRUE(wan->io.sqpoll);
+    }
+
+    // mmsg backend
+    {
+        Yaml yml_wan = YAML::Clone(yml);
+        Yaml io_yml = yml_wan[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::IO_TAG];
+        io_yml[ddsrouter::yaml::IO_BACKEND_TAG] = "mmsg";
+        io_yml[ddsrouter::yaml::IO_BATCH_SIZE_TAG] = 64;
+        io_yml[ddsrouter::yaml::IO_OFFLOAD_TAG] = false;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_wan);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto wan = get_wan(configuration_result);
+        ASSERT_NE(nullptr, wan);
+        ASSERT_EQ(ddsrouter::core::UdpIoBackend::mmsg, wan->io.backend);
+        ASSERT_EQ(64u, wan->io.batch_size);
+        ASSERT_FALSE(wan->io.offload);
+    }
+
+    // unknown backend
+    {
+        Yaml yml_wan = YAML::Clone(yml);
+        Yaml io_yml = yml_wan[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::IO_TAG];
+        io_yml[ddsrouter::yaml::IO_BACKEND_TAG] = "epoll";
+
+        ASSERT_THROW(
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_wan),
+            utils::ConfigurationException);
+    }
+
+    // no ring entries
+    {
+        Yaml yml_wan = YAML::Clone(yml);
+        Yaml io_yml = yml_wan[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::IO_TAG];
+        io_yml[ddsrouter::yaml::IO_RING_ENTRIES_TAG] = 0;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_wan);
+
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // batch size too large
+    {
+        Yaml yml_wan = YAML::Clone(yml);
+        Yaml io_yml = yml_wan[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::IO_TAG];
+        io_yml[ddsrouter::yaml::IO_BATCH_SIZE_TAG] = 1025;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_wan);
+
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load of the socket options of a WAN participant
+ *
+ * CASES:
+ * - default values
+ * - every value set
+ * - DSCP out of the 6 bits
+ * - DSCP out of range
+ * - RTPS keep alive timeout shorter than its period
+ * - busy poll with the Fast DDS backend
+ */
+TEST(YamlReaderConfigurationTest, wan_socket)
+{
+    const char* yml_configuration =
+            R"(
+        version: v4.0
+        participants:
+          - name: "Wan"
+            kind: "wan"
+            listening-addresses:
+              - ip: "127.0.0.1"
+                port: 11666
+                transport: "udp"
+            io:
+              backend: "mmsg"
+          - name: "Echo"
+            kind: "echo"
+        )";
+    Yaml yml = YAML::Load(yml_configuration);
+    utils::Formatter error_msg;
+
+    auto get_wan = [](const ddsrouter::core::DdsRouterConfiguration& configuration)
+            {
+                std::shared_ptr<ddsrouter::core::WanInitialPeersParticipantConfiguration> wan;
+                for (const auto& participant : configuration.participants_configurations)
+                {
+                    if (participant.first == ddsrouter::core::types::ParticipantKind::initial_peers)
+                    {
+                        wan = std::dynamic_pointer_cast<ddsrouter::core::WanInitialPeersParticipantConfiguration>(
+                            participant.second);
+                    }
+                }
+                return wan;
+            };
+
+    // default values
+    {
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto wan = get_wan(configuration_result);
+        ASSERT_NE(nullptr, wan);
+        ASSERT_EQ(0u, wan->socket.send_buffer_size);
+        ASSERT_EQ(0u, wan->socket.receive_buffer_size);
+        ASSERT_FALSE(wan->socket.tcp_nodelay);
+        ASSERT_EQ(0u, wan->socket.rtps_keep_alive_period);
+        ASSERT_EQ(0u, wan->socket.rtps_keep_alive_timeout);
+        ASSERT_EQ(0u, wan->socket.busy_poll);
+        ASSERT_EQ(0u, wan->socket.dscp);
+    }
+
+    // every value set
+    {
+        Yaml yml_wan = YAML::Clone(yml);
+        Yaml socket_yml = yml_wan[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::SOCKET_TAG];
+        socket_yml[ddsrouter::yaml::SOCKET_SEND_BUFFER_SIZE_TAG] = 4194304;
+        socket_yml[ddsrouter::yaml::SOCKET_RECEIVE_BUFFER_SIZE_TAG] = 8388608;
+        socket_yml[ddsrouter::yaml::SOCKET_TCP_NODELAY_TAG] = true;
+        socket_yml[ddsrouter::yaml::SOCKET_RTPS_KEEP_ALIVE_PERIOD_TAG] = 1000;
+        socket_yml[ddsrouter::yaml::SOCKET_RTPS_KEEP_ALIVE_TIMEOUT_TAG] = 5000;
+        socket_yml[ddsrouter::yaml::SOCKET_BUSY_POLL_TAG] = 50;
+        socket_yml[ddsrouter::yaml::SOCKET_DSCP_TAG] = 46;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_wan);
+
+        ASSERT_TRUE(configuration_result.is_valid(error_msg)) << error_msg;
+
+        auto wan = get_wan(configuration_result);
+        ASSERT_NE(nullptr, wan);
+        ASSERT_EQ(4194304u, wan->socket.send_buffer_size);
+        ASSERT_EQ(8388608u, wan->socket.receive_buffer_size);
+        ASSERT_TRUE(wan->socket.tcp_nodelay);
+        ASSERT_EQ(1000u, wan->socket.rtps_keep_alive_period);
+        ASSERT_EQ(5000u, wan->socket.rtps_keep_alive_timeout);
+        ASSERT_EQ(50u, wan->socket.busy_poll);
+        ASSERT_EQ(46u, wan->socket.dscp);
+    }
+
+    // DSCP out of the 6 bits
+    {
+        Yaml yml_wan = YAML::Clone(yml);
+        Yaml socket_yml = yml_wan[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::SOCKET_TAG];
+        socket_yml[ddsrouter::yaml::SOCKET_DSCP_TAG] = 64;
+
+        ASSERT_THROW(
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_wan),
+            utils::ConfigurationException);
+    }
+
+    // DSCP out of range
+    {
+        Yaml yml_wan = YAML::Clone(yml);
+        Yaml socket_yml = yml_wan[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::SOCKET_TAG];
+        socket_yml[ddsrouter::yaml::SOCKET_DSCP_TAG] = 300;
+
+        ASSERT_THROW(
+            ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_wan),
+            utils::ConfigurationException);
+    }
+
+    // RTPS keep alive timeout shorter than its period
+    {
+        Yaml yml_wan = YAML::Clone(yml);
+        Yaml socket_yml = yml_wan[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0][ddsrouter::yaml::SOCKET_TAG];
+        socket_yml[ddsrouter::yaml::SOCKET_RTPS_KEEP_ALIVE_PERIOD_TAG] = 5000;
+        socket_yml[ddsrouter::yaml::SOCKET_RTPS_KEEP_ALIVE_TIMEOUT_TAG] = 1000;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_wan);
+
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+
+    // busy poll with the Fast DDS backend
+    {
+        Yaml yml_wan = YAML::Clone(yml);
+        Yaml participant_yml = yml_wan[ddspipe::yaml::COLLECTION_PARTICIPANTS_TAG][0];
+        participant_yml[ddsrouter::yaml::IO_TAG][ddsrouter::yaml::IO_BACKEND_TAG] = "fastdds";
+        participant_yml[ddsrouter::yaml::SOCKET_TAG][ddsrouter::yaml::SOCKET_BUSY_POLL_TAG] = 50;
+
+        ddsrouter::core::DdsRouterConfiguration configuration_result =
+                ddsrouter::yaml::YamlReaderConfiguration::load_ddsrouter_configuration(yml_wan);
+
+        ASSERT_FALSE(configuration_result.is_valid(error_msg));
+    }
+}
+
 int main(
         int argc,
         char** argv)
@@ -17,6 +17,9 @@
  *
  */
 
+#include <atomic>
+#include <csignal>
+
 #include <cpp_utils/event/FileWatcherHandler.hpp>
 #include <cpp_utils/event/MultipleEventHandler.hpp>
 #include <cpp_utils/event/PeriodicEventHandler.hpp>
@@ -32,6 +35,10 @@
 
 #include <ddsrouter_core/configuration/DdsRouterConfiguration.hpp>
 #include <ddsrouter_core/core/DdsRouter.hpp>
+#include <ddsrouter_core/metrics/MetricsHttpServer.hpp>
+#include <ddsrouter_core/metrics/PrometheusSerializer.hpp>
+#include <ddsrouter_core/tracing/FlightRecorder.hpp>
+#include <ddsrouter_core/tracing/Tracer.hpp>
 
 #include <ddsrouter_yaml/YamlReaderConfiguration.hpp>
 
@@ -42,6 +49,40 @@
 using namespace eprosima;
 using namespace eprosima::ddsrouter;
 
+namespace {
+
+//! Whether the trace has been requested by signal and not written yet
+std::atomic<bool> trace_requested(false);
+
+//! File where the flight recorder is dumped, empty if it is not dumped
+//! (it must not change once the signal handlers are installed)
+std::string flight_recorder_file = "";
+
+//! Dump the flight recorder if a file has been given
+bool dump_flight_recorder()
+{
+    return !flight_recorder_file.empty() && core::FlightRecorder::dump(flight_recorder_file.c_str());
+}
+
+//! Dump the flight recorder when requested by signal
+void on_flight_recorder_signal(
+        int)
+{
+    core::FlightRecorder::dump(flight_recorder_file.c_str());
+}
+
+//! Dump the flight recorder on a fatal signal, and then let its default action terminate the process
+void on_fatal_signal(
+        int signal)
+{
+    core::FlightRecorder::dump(flight_recorder_file.c_str());
+
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
+
+} /* namespace */
+
 int main(
         int argc,
         char** argv)
@@ -55,13 +96,21 @@ int main(
     // Maximum timeout
     eprosima::utils::Duration_ms timeout = 0;
 
+    // Metrics port
+    uint16_t metrics_port = 0;
+
+    // Tracing
+    uint32_t trace_sampling = 0;
+    std::string trace_file = ui::DEFAULT_TRACE_FILE_NAME;
+
     // Debug options
     std::string log_filter = "(DDSROUTER|DDSPIPE)";
     eprosima::fastdds::dds::Log::Kind log_verbosity = eprosima::fastdds::dds::Log::Kind::Warning;
 
     // Parse arguments
     ui::ProcessReturnCode arg_parse_result =
-            ui::parse_arguments(argc, argv, file_path, reload_time, timeout, log_filter, log_verbosity);
+            ui::parse_arguments(argc, argv, file_path, reload_time, timeout, log_filter, log_verbosity,
+                    metrics_port, trace_sampling, trace_file, flight_recorder_file);
 
     if (arg_parse_result == ui::ProcessReturnCode::help_argument)
     {
@@ -98,6 +147,21 @@ int main(
 
     logUser(DDSROUTER_EXECUTION, "Starting DDS Router Tool execution.");
 
+    if (!flight_recorder_file.empty())
+    {
+        // Dump the flight recorder on a crash (the dump is async-signal-safe)
+        std::signal(SIGSEGV, on_fatal_signal);
+        std::signal(SIGABRT, on_fatal_signal);
+        std::signal(SIGFPE, on_fatal_signal);
+        std::signal(SIGILL, on_fatal_signal);
+#if !defined(_WIN32)
+        std::signal(SIGBUS, on_fatal_signal);
+
+        // Dump the flight recorder when SIGUSR1 is received
+        std::signal(SIGUSR1, on_flight_recorder_signal);
+#endif // if !defined(_WIN32)
+    }
+
     // Debug
     {
         // Remove every consumer
@@ -155,6 +219,23 @@ int main(
         // Create DDS Router
         core::DdsRouter router(router_configuration);
 
+        /////
+        // Metrics server
+
+        // It must be a ptr, so the object is only created when required by the arguments.
+        // It is declared after the router, so it is destroyed (and stops using it) first.
+        std::unique_ptr<core::MetricsHttpServer> metrics_server;
+
+        if (metrics_port > 0)
+        {
+            metrics_server = std::make_unique<core::MetricsHttpServer>(
+                metrics_port,
+                [&router]()
+                {
+                    return core::to_prometheus_text(router.get_statistics());
+                });
+        }
+
         /////
         // File Watcher Handler
 
@@ -220,6 +301,36 @@ int main(
                             reload_time);
         }
 
+        /////
+        // Tracing
+
+        // It must be a ptr, so the object is only created when required by the arguments
+        std::unique_ptr<eprosima::utils::event::PeriodicEventHandler> trace_handler;
+
+        if (trace_sampling > 0)
+        {
+            core::Tracer::enable(trace_sampling);
+
+#if !defined(_WIN32)
+            // Write the trace when SIGUSR2 is received.
+            // The signal handler only raises a flag, as writing a file is not allowed inside it.
+            std::signal(SIGUSR2, [](int)
+                    {
+                        trace_requested = true;
+                    });
+
+            trace_handler = std::make_unique<eprosima::utils::event::PeriodicEventHandler>(
+                [trace_file]()
+                {
+                    if (trace_requested.exchange(false))
+                    {
+                        core::Tracer::export_chrome_trace(trace_file);
+                    }
+                },
+                ui::TRACE_REQUEST_CHECK_PERIOD);
+#endif // if !defined(_WIN32)
+        }
+
         // Start Router
         router.start();
 
@@ -241,10 +352,34 @@ int main(
             file_watcher_handler.reset();
         }
 
+        // Stop serving metrics before stopping the Router
+        if (metrics_server)
+        {
+            metrics_server.reset();
+        }
+
         // Stop Router
         router.stop();
 
         logUser(DDSROUTER_EXECUTION, "DDS Router stopped correctly.");
+
+        // Write the trace of the whole execution
+        if (trace_sampling > 0)
+        {
+            trace_handler.reset();
+            core::Tracer::disable();
+
+            if (core::Tracer::export_chrome_trace(trace_file))
+            {
+                logUser(DDSROUTER_EXECUTION, "Trace written in file " << trace_file << ".");
+            }
+        }
+
+        // Keep the last events of the execution
+        if (dump_flight_recorder())
+        {
+            logUser(DDSROUTER_EXECUTION, "Flight recorder dumped in file " << flight_recorder_file << ".");
+        }
     }
     catch (const eprosima::utils::ConfigurationException& e)
     {
@@ -252,6 +387,7 @@ int main(
                 "Error Loading DDS Router Configuration from file " << file_path <<
                 ". Error message:\n " <<
                 e.what());
+        dump_flight_recorder();
         return static_cast<int>(ui::ProcessReturnCode::execution_failed);
     }
     catch (const eprosima::utils::InitializationException& e)
@@ -259,6 +395,7 @@ int main(
         logError(DDSROUTER_ERROR,
                 "Error Initializing DDS Router. Error message:\n " <<
                 e.what());
+        dump_flight_recorder();
         return static_cast<int>(ui::ProcessReturnCode::execution_failed);
     }
 
@@ -113,6 +113,18 @@ const option::Descriptor usage[] = {
         "Value 0 does not set maximum. [Default: 0]."
     },
 
+    {
+        optionIndex::METRICS_PORT,
+        0,
+        "",
+        "metrics-port",
+        Arg::Port,
+        "  \t--metrics-port\t  \t" \
+        "Serve the statistics of the Router in this TCP port (http://<host>:<port>/metrics) " \
+        "in Prometheus text format. " \
+        "Value 0 does not serve them. [Default: 0]."
+    },
+
     ////////////////////
     // Debug options
     {
@@ -154,6 +166,41 @@ const option::Descriptor usage[] = {
         "[Default = \"warning\"]. "
     },
 
+    {
+        optionIndex::TRACE_SAMPLING,
+        0,
+        "",
+        "trace-sampling",
+        Arg::Numeric,
+        "  \t--trace-sampling\t  \t" \
+        "Trace one of each <N> samples forwarded. " \
+        "The trace is written at the end of the execution and when SIGUSR2 is received. " \
+        "Value 0 does not trace samples. [Default: 0]."
+    },
+
+    {
+        optionIndex::TRACE_FILE,
+        0,
+        "",
+        "trace-file",
+        Arg::String,
+        "  \t--trace-file\t  \t" \
+        "Path to the file where the trace is written (Chrome trace event format) " \
+        "[Default: ./ddsrouter_trace.json]."
+    },
+
+    {
+        optionIndex::FLIGHT_RECORDER_FILE,
+        0,
+        "",
+        "flight-recorder-file",
+        Arg::String,
+        "  \t--flight-recorder-file\t  \t" \
+        "Path to the file where the last events of the router are dumped " \
+        "at the end of the execution, on a crash and when SIGUSR1 is received. " \
+        "If not given, the last events are not dumped."
+    },
+
     {
         optionIndex::UNKNOWN_OPT, 0, "", "", Arg::None,
         "\n"
@@ -175,7 +222,11 @@ ProcessReturnCode parse_arguments(
         utils::Duration_ms& reload_time,
         utils::Duration_ms& timeout,
         std::string& log_filter,
-        eprosima::fastdds::dds::Log::Kind& log_verbosity)
+        eprosima::fastdds::dds::Log::Kind& log_verbosity,
+        uint16_t& metrics_port,
+        uint32_t& trace_sampling,
+        std::string& trace_file,
+        std::string& flight_recorder_file)
 {
     // Variable to pretty print usage help
     int columns;
@@ -257,6 +308,22 @@ ProcessReturnCode parse_arguments(
                     timeout = std::stol(opt.arg) * 1000; // pass to milliseconds
                     break;
 
+                case optionIndex::METRICS_PORT:
+                    metrics_port = static_cast<uint16_t>(std::stol(opt.arg));
+                    break;
+
+                case optionIndex::TRACE_SAMPLING:
+                    trace_sampling = static_cast<uint32_t>(std::stoul(opt.arg));
+                    break;
+
+                case optionIndex::TRACE_FILE:
+                    trace_file = opt.arg;
+                    break;
+
+                case optionIndex::FLIGHT_RECORDER_FILE:
+                    flight_recorder_file = opt.arg;
+                    break;
+
                 case optionIndex::LOG_FILTER:
                     log_filter = opt.arg;
                     break;
@@ -334,6 +401,28 @@ option::ArgStatus Arg::Numeric(
     return option::ARG_ILLEGAL;
 }
 
+option::ArgStatus Arg::Port(
+        const option::Option& option,
+        bool msg)
+{
+    char* endptr = 0;
+    long port = -1;
+    if (option.arg != 0)
+    {
+        port = std::strtol(option.arg, &endptr, 10);
+    }
+    if (endptr != option.arg && *endptr == 0 && port >= 0 && port <= 65535)
+    {
+        return option::ARG_OK;
+    }
+
+    if (msg)
+    {
+        logError(DDSROUTER_ARGS, "Option '" << option << "' requires a port number (0-65535) as argument.");
+    }
+    return option::ARG_ILLEGAL;
+}
+
 option::ArgStatus Arg::Float(
         const option::Option& option,
         bool msg)
@@ -20,6 +20,7 @@
 #ifndef EPROSIMA_DDSROUTER_USERINTERFACE_ARGUMENTSCONFIGURATION_HPP
 #define EPROSIMA_DDSROUTER_USERINTERFACE_ARGUMENTSCONFIGURATION_HPP
 
+#include <cstdint>
 #include <string>
 
 #include <optionparser.h>
@@ -59,6 +60,11 @@ struct Arg : public option::Arg
             const option::Option& option,
             bool msg);
 
+    //! Check that the argument is a valid port number
+    static option::ArgStatus Port(
+            const option::Option& option,
+            bool msg);
+
     //! Check that the argument has float (or int) numeric value
     static option::ArgStatus Float(
             const option::Option& option,
@@ -99,6 +105,10 @@ enum optionIndex
     TIMEOUT,
     LOG_FILTER,
     LOG_VERBOSITY,
+    METRICS_PORT,
+    TRACE_SAMPLING,
+    TRACE_FILE,
+    FLIGHT_RECORDER_FILE,
 };
 
 /**
@@ -119,6 +129,12 @@ extern const option::Descriptor usage[];
  * @param [out] reload_time time in milliseconds to reload the configuration file
  * @param [out] activate_debug activate log info
  * @param [out] timeout time in milliseconds to maximum router execution time
+ * @param [out] log_filter regex filter of the log categories
+ * @param [out] log_verbosity minimum log verbosity
+ * @param [out] metrics_port TCP port where the metrics are served (0 to not serve them)
+ * @param [out] trace_sampling trace one of each \c trace_sampling samples (0 to not trace them)
+ * @param [out] trace_file path to the file where the trace is written
+ * @param [out] flight_recorder_file path to the file where the flight recorder is dumped (unchanged if not given)
  *
  * @return \c SUCCESS if everything OK
  * @return \c INCORRECT_ARGUMENT if arguments were incorrect (unknown or incorrect value)
@@ -132,7 +148,11 @@ ProcessReturnCode parse_arguments(
         utils::Duration_ms& reload_time,
         utils::Duration_ms& timeout,
         std::string& log_filter,
-        eprosima::fastdds::dds::Log::Kind& log_verbosity);
+        eprosima::fastdds::dds::Log::Kind& log_verbosity,
+        uint16_t& metrics_port,
+        uint32_t& trace_sampling,
+        std::string& trace_file,
+        std::string& flight_recorder_file);
 
 //! \c Option to stream serializator
 std::ostream& operator <<(
@@ -28,6 +28,12 @@ namespace ui {
 //! Default DdsRouter configuration file
 constexpr const char* DEFAULT_CONFIGURATION_FILE_NAME("DDS_ROUTER_CONFIGURATION.yaml");
 
+//! Default file where the trace is written
+constexpr const char* DEFAULT_TRACE_FILE_NAME("ddsrouter_trace.json");
+
+//! Time in milliseconds between checks of the requests to write the trace
+constexpr const unsigned int TRACE_REQUEST_CHECK_PERIOD(200);
+
 } /* namespace ui */
 } /* namespace ddsrouter */
 } /* namespace eprosima */